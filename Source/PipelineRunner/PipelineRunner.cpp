@@ -60,6 +60,9 @@
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/PipelineMemoryPlanner.h"
+#include "SIMPLib/Filtering/PipelineProfiler.h"
+#include "SIMPLib/Filtering/PipelineResultCache.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
@@ -121,6 +124,36 @@ int main(int argc, char* argv[])
                                      "Pipeline File as a JSON file.", "file");
   parser.addOption(pipelineFileArg);
 
+  QCommandLineOption profileTraceArg(QStringList() << "profile-trace", "Profile every filter and write a Chrome trace (chrome://tracing, ui.perfetto.dev) to this file.", "file");
+  parser.addOption(profileTraceArg);
+
+  QCommandLineOption profileSummaryArg(QStringList() << "profile-summary", "Profile every filter and write a JSON summary of the timings and memory use to this file.", "file");
+  parser.addOption(profileSummaryArg);
+
+  QCommandLineOption releaseDeadArraysArg(QStringList() << "release-dead-arrays", "Remove each array from memory once no later filter in the pipeline reads it.");
+  parser.addOption(releaseDeadArraysArg);
+
+  QCommandLineOption pinPathArg(QStringList() << "pin", "Never release this path when --release-dead-arrays is used. Use DataContainer|AttributeMatrix|DataArray and repeat for more paths.", "path");
+  parser.addOption(pinPathArg);
+
+  QCommandLineOption concurrentArg(QStringList() << "concurrent", "Run filters that do not depend on each other at the same time.");
+  parser.addOption(concurrentArg);
+
+  QCommandLineOption maxThreadsArg(QStringList() << "max-threads", "Number of threads shared by the filters when --concurrent is used. Defaults to every hardware thread.", "count");
+  parser.addOption(maxThreadsArg);
+
+  QCommandLineOption cacheDirArg(QStringList() << "cache-dir", "Restore the results of unchanged leading filters from, and store the results of slow filters in, this directory.", "directory");
+  parser.addOption(cacheDirArg);
+
+  QCommandLineOption cacheSizeArg(QStringList() << "cache-size", "Maximum size of the result cache in MB. The least recently used results are removed first.", "MB");
+  parser.addOption(cacheSizeArg);
+
+  QCommandLineOption memoryBudgetArg(QStringList() << "memory-budget", "Predict the peak memory of the pipeline from its preflight and warn when it exceeds this many MB. Also bounds the filters running at once when --concurrent is used.", "MB");
+  parser.addOption(memoryBudgetArg);
+
+  QCommandLineOption refuseOverBudgetArg(QStringList() << "refuse-over-budget", "Exit without executing the pipeline when the predicted peak memory exceeds --memory-budget.");
+  parser.addOption(refuseOverBudgetArg);
+
   // Process the actual command line arguments given by the user
   parser.process(app);
 
@@ -131,7 +164,7 @@ int main(int argc, char* argv[])
 
   // Register all the filters including trying to load those from Plugins
   FilterManager* fm = FilterManager::Instance();
-  SIMPLibPluginLoader::LoadPluginFilters(fm);
+  SIMPLibPluginLoader::LoadPluginFiltersLazily(fm);
 
 #ifdef SIMPL_EMBED_PYTHON
   if(hasPythonHome)
@@ -198,9 +231,89 @@ int main(int argc, char* argv[])
     std::cout << "Errors preflighting the pipeline. Exiting Now." << std::endl;
     return EXIT_FAILURE;
   }
+
+  if(parser.isSet(memoryBudgetArg))
+  {
+    PipelineMemoryPlanner::Pointer planner = PipelineMemoryPlanner::New();
+    planner->setBudget(parser.value(memoryBudgetArg).toLongLong() * 1024 * 1024);
+    planner->plan(pipeline->getFilterContainer());
+    std::cout << planner->getSummary().toStdString() << std::endl;
+    if(planner->exceedsBudget())
+    {
+      if(parser.isSet(refuseOverBudgetArg))
+      {
+        std::cout << "The predicted peak memory exceeds the memory budget. Exiting Now." << std::endl;
+        return EXIT_FAILURE;
+      }
+      std::cout << "Warning: The predicted peak memory exceeds the memory budget." << std::endl;
+    }
+    pipeline->setMemoryBudget(planner->getBudget());
+  }
+
+  QString profileTraceFile = parser.value(profileTraceArg);
+  QString profileSummaryFile = parser.value(profileSummaryArg);
+  PipelineProfiler::Pointer profiler = PipelineProfiler::NullPointer();
+  if(!profileTraceFile.isEmpty() || !profileSummaryFile.isEmpty())
+  {
+    profiler = PipelineProfiler::New();
+    pipeline->setProfiler(profiler);
+  }
+
+  if(parser.isSet(releaseDeadArraysArg))
+  {
+    std::vector<DataArrayPath> pinnedPaths;
+    for(const QString& pinnedPath : parser.values(pinPathArg))
+    {
+      pinnedPaths.emplace_back(pinnedPath);
+    }
+    pipeline->setReleaseDeadArrays(true);
+    pipeline->setPinnedPaths(pinnedPaths);
+  }
+
+  if(parser.isSet(concurrentArg))
+  {
+    pipeline->setConcurrentExecution(true);
+    pipeline->setMaxThreads(parser.value(maxThreadsArg).toInt());
+  }
+
+  if(parser.isSet(cacheDirArg))
+  {
+    PipelineResultCache::Pointer cache = PipelineResultCache::New();
+    cache->setCacheDirectory(parser.value(cacheDirArg));
+    if(parser.isSet(cacheSizeArg))
+    {
+      cache->setMaximumSize(parser.value(cacheSizeArg).toLongLong() * 1024 * 1024);
+    }
+    pipeline->setResultCache(cache);
+  }
+
   // Now actually execute the pipeline
   pipeline->execute();
   err = pipeline->getErrorCode();
+
+  // Write the profile even if the pipeline failed so the failing filter can be looked at
+  if(!profileTraceFile.isEmpty())
+  {
+    if(profiler->writeChromeTrace(profileTraceFile))
+    {
+      std::cout << "Profile trace written to " << profileTraceFile.toStdString() << std::endl;
+    }
+    else
+    {
+      std::cout << "Could not write the profile trace to " << profileTraceFile.toStdString() << std::endl;
+    }
+  }
+  if(!profileSummaryFile.isEmpty())
+  {
+    if(profiler->writeSummary(profileSummaryFile))
+    {
+      std::cout << "Profile summary written to " << profileSummaryFile.toStdString() << std::endl;
+    }
+    else
+    {
+      std::cout << "Could not write the profile summary to " << profileSummaryFile.toStdString() << std::endl;
+    }
+  }
   if(err < 0)
   {
     std::cout << "Error Condition of Pipeline: " << err << std::endl;
@@ -110,7 +110,7 @@ int main(int argc, char* argv[])
   //
   // Register all the filters including trying to load those from Plugins
   FilterManager* fm = FilterManager::Instance();
-  SIMPLibPluginLoader::LoadPluginFilters(fm);
+  SIMPLibPluginLoader::LoadPluginFiltersLazily(fm);
   //
   QMetaObjectUtilities::RegisterMetaTypes();
 
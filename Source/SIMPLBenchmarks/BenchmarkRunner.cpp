@@ -0,0 +1,214 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "BenchmarkRunner.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <numeric>
+
+#include <QtCore/QDateTime>
+#include <QtCore/QJsonArray>
+#include <QtCore/QSysInfo>
+
+#include "SIMPLib/SIMPLibVersion.h"
+
+using namespace SIMPLBenchmarks;
+
+namespace
+{
+std::atomic<uint64_t> s_Sink = {0};
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BenchmarkRunner::BenchmarkRunner(size_t scale, int repetitions, const QString& workDir)
+: m_Scale(std::max<size_t>(scale, 1))
+, m_Repetitions(std::max(repetitions, 1))
+, m_WorkDir(workDir)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BenchmarkRunner::~BenchmarkRunner() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BenchmarkRunner::getScale() const
+{
+  return m_Scale;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BenchmarkRunner::getRepetitions() const
+{
+  return m_Repetitions;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BenchmarkRunner::getWorkDir() const
+{
+  return m_WorkDir;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BenchmarkRunner::addCase(const QString& name, double items, const Body& body, const Callback& setup, const Callback& teardown)
+{
+  Case benchCase;
+  benchCase.name = name;
+  benchCase.items = items;
+  benchCase.body = body;
+  benchCase.setup = setup;
+  benchCase.teardown = teardown;
+  m_Cases.push_back(benchCase);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BenchmarkRunner::run(const QString& filter)
+{
+  using Clock = std::chrono::steady_clock;
+
+  m_Results.clear();
+  int failures = 0;
+  for(const auto& benchCase : m_Cases)
+  {
+    if(!filter.isEmpty() && !benchCase.name.contains(filter))
+    {
+      continue;
+    }
+
+    Result result;
+    result.name = benchCase.name;
+    std::vector<double> timings;
+    timings.reserve(static_cast<size_t>(m_Repetitions));
+    for(int rep = 0; rep < m_Repetitions; rep++)
+    {
+      if(benchCase.setup)
+      {
+        benchCase.setup();
+      }
+      Clock::time_point start = Clock::now();
+      bool ok = benchCase.body();
+      Clock::time_point stop = Clock::now();
+      if(benchCase.teardown)
+      {
+        benchCase.teardown();
+      }
+      if(!ok)
+      {
+        result.ok = false;
+        break;
+      }
+      timings.push_back(static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()));
+    }
+
+    if(!result.ok || timings.empty())
+    {
+      result.ok = false;
+      failures++;
+      std::cout << benchCase.name.toStdString() << ": FAILED" << std::endl;
+      m_Results.push_back(result);
+      continue;
+    }
+
+    std::sort(timings.begin(), timings.end());
+    size_t count = timings.size();
+    result.repetitions = static_cast<int>(count);
+    result.minNs = timings.front();
+    result.maxNs = timings.back();
+    result.medianNs = (count % 2 == 1) ? timings[count / 2] : 0.5 * (timings[count / 2 - 1] + timings[count / 2]);
+    result.meanNs = std::accumulate(timings.begin(), timings.end(), 0.0) / static_cast<double>(count);
+    if(result.medianNs > 0.0)
+    {
+      result.itemsPerSecond = benchCase.items / (result.medianNs * 1.0E-9);
+    }
+    std::cout << benchCase.name.toStdString() << ": median " << result.medianNs * 1.0E-6 << " ms, min " << result.minNs * 1.0E-6 << " ms (" << count << " reps)" << std::endl;
+    m_Results.push_back(result);
+  }
+  return failures;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject BenchmarkRunner::toJson() const
+{
+  QJsonObject context;
+  context["version"] = SIMPLib::Version::PackageComplete();
+  context["date"] = QDateTime::currentDateTime().toString(Qt::ISODate);
+  context["host"] = QSysInfo::machineHostName();
+  context["cpu_architecture"] = QSysInfo::currentCpuArchitecture();
+  context["os"] = QSysInfo::prettyProductName();
+  context["scale"] = static_cast<qint64>(m_Scale);
+  context["repetitions"] = m_Repetitions;
+
+  QJsonArray benchmarks;
+  for(const auto& result : m_Results)
+  {
+    QJsonObject obj;
+    obj["name"] = result.name;
+    obj["ok"] = result.ok;
+    obj["repetitions"] = result.repetitions;
+    obj["min_ns"] = result.minNs;
+    obj["median_ns"] = result.medianNs;
+    obj["mean_ns"] = result.meanNs;
+    obj["max_ns"] = result.maxNs;
+    obj["items_per_second"] = result.itemsPerSecond;
+    benchmarks.append(obj);
+  }
+
+  QJsonObject root;
+  root["context"] = context;
+  root["benchmarks"] = benchmarks;
+  return root;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BenchmarkRunner::KeepValue(uint64_t value)
+{
+  s_Sink.fetch_add(value, std::memory_order_relaxed);
+}
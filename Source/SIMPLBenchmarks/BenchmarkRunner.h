@@ -0,0 +1,139 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QString>
+
+namespace SIMPLBenchmarks
+{
+
+/**
+ * @brief The BenchmarkRunner class times named benchmark cases that run against synthetic
+ * data and collects min/median/mean/max wall clock times for each case. The results can be
+ * written as JSON and compared against a stored baseline with Support/Scripts/compare_benchmarks.py.
+ *
+ * Each case consists of an untimed setup, the timed body and an untimed teardown. A body returns
+ * false if the operation it is measuring reported an error, in which case the remaining
+ * repetitions are skipped and the case is flagged as failed in the output.
+ */
+class BenchmarkRunner
+{
+public:
+  using Callback = std::function<void()>;
+  using Body = std::function<bool()>;
+
+  struct Result
+  {
+    QString name;
+    int repetitions = 0;
+    double minNs = 0.0;
+    double medianNs = 0.0;
+    double meanNs = 0.0;
+    double maxNs = 0.0;
+    double itemsPerSecond = 0.0;
+    bool ok = true;
+  };
+
+  /**
+   * @brief BenchmarkRunner
+   * @param scale Multiplier applied to the synthetic data sizes of every case
+   * @param repetitions Number of timed repetitions for each case
+   * @param workDir Directory used for temporary files written by the I/O cases
+   */
+  BenchmarkRunner(size_t scale, int repetitions, const QString& workDir);
+  ~BenchmarkRunner();
+
+  size_t getScale() const;
+  int getRepetitions() const;
+  QString getWorkDir() const;
+
+  /**
+   * @brief Registers a benchmark case.
+   * @param name Unique name of the case. Names are used as the key when comparing against a baseline.
+   * @param items Number of items (tuples, lines, filters, ...) processed per repetition. Used to compute a throughput.
+   * @param body The timed operation
+   * @param setup Untimed preparation run before every repetition
+   * @param teardown Untimed cleanup run after every repetition
+   */
+  void addCase(const QString& name, double items, const Body& body, const Callback& setup = Callback(), const Callback& teardown = Callback());
+
+  /**
+   * @brief Runs every registered case whose name contains the filter string.
+   * @param filter Substring filter, empty to run every case
+   * @return The number of cases that failed
+   */
+  int run(const QString& filter);
+
+  /**
+   * @brief Returns the results of the last run() as a JSON object.
+   */
+  QJsonObject toJson() const;
+
+  /**
+   * @brief Keeps a computed value alive so the compiler cannot discard the work that produced it.
+   */
+  static void KeepValue(uint64_t value);
+
+private:
+  struct Case
+  {
+    QString name;
+    double items = 0.0;
+    Body body;
+    Callback setup;
+    Callback teardown;
+  };
+
+  size_t m_Scale = 1;
+  int m_Repetitions = 5;
+  QString m_WorkDir;
+  std::vector<Case> m_Cases;
+  std::vector<Result> m_Results;
+
+public:
+  BenchmarkRunner(const BenchmarkRunner&) = delete;            // Copy Constructor Not Implemented
+  BenchmarkRunner(BenchmarkRunner&&) = delete;                 // Move Constructor Not Implemented
+  BenchmarkRunner& operator=(const BenchmarkRunner&) = delete; // Copy Assignment Not Implemented
+  BenchmarkRunner& operator=(BenchmarkRunner&&) = delete;      // Move Assignment Not Implemented
+};
+
+void RegisterDataArrayBenchmarks(BenchmarkRunner& runner);
+void RegisterFilterBenchmarks(BenchmarkRunner& runner);
+void RegisterIOBenchmarks(BenchmarkRunner& runner);
+void RegisterGeometryBenchmarks(BenchmarkRunner& runner);
+
+} // namespace SIMPLBenchmarks
@@ -0,0 +1,98 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "BenchmarkRunner.h"
+
+#include <memory>
+#include <vector>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+
+using namespace SIMPLBenchmarks;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLBenchmarks::RegisterDataArrayBenchmarks(BenchmarkRunner& runner)
+{
+  const size_t numTuples = 4000000 * runner.getScale();
+  auto array = std::make_shared<FloatArrayType::Pointer>();
+
+  runner.addCase("DataArray.Allocate.Float32x3", static_cast<double>(numTuples), [=]() {
+    *array = FloatArrayType::CreateArray(numTuples, std::vector<size_t>(1, 3), "Allocate", true);
+    if(nullptr == array->get())
+    {
+      return false;
+    }
+    (*array)->initializeWithZeros();
+    return true;
+  },
+                 BenchmarkRunner::Callback(), [=]() { array->reset(); });
+
+  auto createSource = [=]() {
+    *array = FloatArrayType::CreateArray(numTuples, std::vector<size_t>(1, 3), "Source", true);
+    (*array)->initializeWithValue(1.0f);
+  };
+
+  runner.addCase("DataArray.ResizeTuples.Grow2x", static_cast<double>(numTuples), [=]() {
+    (*array)->resizeTuples(numTuples * 2);
+    BenchmarkRunner::KeepValue((*array)->getNumberOfTuples());
+    return (*array)->getNumberOfTuples() == numTuples * 2;
+  },
+                 createSource, [=]() { array->reset(); });
+
+  runner.addCase("DataArray.ResizeTuples.ShrinkHalf", static_cast<double>(numTuples), [=]() {
+    (*array)->resizeTuples(numTuples / 2);
+    BenchmarkRunner::KeepValue((*array)->getNumberOfTuples());
+    return (*array)->getNumberOfTuples() == numTuples / 2;
+  },
+                 createSource, [=]() { array->reset(); });
+
+  // Remove every 10th tuple, which exercises the compaction path of eraseTuples()
+  auto eraseList = std::make_shared<std::vector<size_t>>();
+  for(size_t i = 0; i < numTuples; i += 10)
+  {
+    eraseList->push_back(i);
+  }
+  runner.addCase("DataArray.EraseTuples.Every10th", static_cast<double>(numTuples), [=]() {
+    int32_t err = (*array)->eraseTuples(*eraseList);
+    BenchmarkRunner::KeepValue((*array)->getNumberOfTuples());
+    return err >= 0;
+  },
+                 createSource, [=]() { array->reset(); });
+
+  runner.addCase("DataArray.DeepCopy.Float32x3", static_cast<double>(numTuples), [=]() {
+    IDataArray::Pointer copy = (*array)->deepCopy(false);
+    BenchmarkRunner::KeepValue(copy->getNumberOfTuples());
+    return copy->getNumberOfTuples() == numTuples;
+  },
+                 createSource, [=]() { array->reset(); });
+}
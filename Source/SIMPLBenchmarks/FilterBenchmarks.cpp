@@ -0,0 +1,147 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "BenchmarkRunner.h"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/CoreFilters/ArrayCalculator.h"
+#include "SIMPLib/CoreFilters/CreateAttributeMatrix.h"
+#include "SIMPLib/CoreFilters/CreateDataArray.h"
+#include "SIMPLib/CoreFilters/CreateDataContainer.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/FilterParameters/DynamicTableData.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+
+using namespace SIMPLBenchmarks;
+
+namespace
+{
+const QString k_DataContainerName("BenchmarkDataContainer");
+const QString k_AttributeMatrixName("CellData");
+const QString k_ResultArrayName("Result");
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer CreateCalculatorInput(size_t numTuples)
+{
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  DataContainer::Pointer dc = DataContainer::New(k_DataContainerName);
+  AttributeMatrix::Pointer am = AttributeMatrix::New(std::vector<size_t>(1, numTuples), k_AttributeMatrixName, AttributeMatrix::Type::Cell);
+  dc->addOrReplaceAttributeMatrix(am);
+  dca->addOrReplaceDataContainer(dc);
+
+  std::mt19937_64 generator(5489u);
+  std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+  for(const QString& name : {QString("a"), QString("b"), QString("c")})
+  {
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(numTuples, name, true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      array->setValue(i, distribution(generator));
+    }
+    am->addOrReplaceAttributeArray(array);
+  }
+  return dca;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterPipeline::Pointer CreateSyntheticPipeline(int numFilters)
+{
+  FilterPipeline::Pointer pipeline = FilterPipeline::New();
+
+  CreateDataContainer::Pointer createDc = CreateDataContainer::New();
+  createDc->setDataContainerName(DataArrayPath(k_DataContainerName, "", ""));
+  pipeline->pushBack(createDc);
+
+  CreateAttributeMatrix::Pointer createAm = CreateAttributeMatrix::New();
+  createAm->setCreatedAttributeMatrix(DataArrayPath(k_DataContainerName, k_AttributeMatrixName, ""));
+  createAm->setAttributeMatrixType(static_cast<int>(AttributeMatrix::Type::Cell));
+  createAm->setTupleDimensions(DynamicTableData(std::vector<std::vector<double>>(1, {64.0, 64.0, 64.0})));
+  pipeline->pushBack(createAm);
+
+  for(int i = 2; i < numFilters; i++)
+  {
+    CreateDataArray::Pointer createArray = CreateDataArray::New();
+    createArray->setScalarType(SIMPL::ScalarTypes::Type::Float);
+    createArray->setNumberOfComponents(1 + (i % 3));
+    createArray->setNewArray(DataArrayPath(k_DataContainerName, k_AttributeMatrixName, QString("Array_%1").arg(i)));
+    createArray->setInitializationType(CreateDataArray::Manual);
+    createArray->setInitializationValue("0");
+    pipeline->pushBack(createArray);
+  }
+  return pipeline;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AddCalculatorCase(BenchmarkRunner& runner, const QString& name, const QString& equation, size_t numTuples)
+{
+  auto dca = std::make_shared<DataContainerArray::Pointer>();
+  auto setup = [=]() { *dca = CreateCalculatorInput(numTuples); };
+  auto body = [=]() {
+    ArrayCalculator::Pointer filter = ArrayCalculator::New();
+    filter->setDataContainerArray(*dca);
+    filter->setSelectedAttributeMatrix(DataArrayPath(k_DataContainerName, k_AttributeMatrixName, ""));
+    filter->setInfixEquation(equation);
+    filter->setCalculatedArray(DataArrayPath(k_DataContainerName, k_AttributeMatrixName, k_ResultArrayName));
+    filter->setScalarType(SIMPL::ScalarTypes::Type::Double);
+    filter->execute();
+    return filter->getErrorCode() >= 0;
+  };
+  runner.addCase(name, static_cast<double>(numTuples), body, setup, [=]() { dca->reset(); });
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLBenchmarks::RegisterFilterBenchmarks(BenchmarkRunner& runner)
+{
+  const size_t numTuples = 1000000 * runner.getScale();
+  AddCalculatorCase(runner, "ArrayCalculator.Arithmetic", "a + b * c - 2.5", numTuples);
+  AddCalculatorCase(runner, "ArrayCalculator.Transcendental", "sqrt(a^2 + b^2) + sin(c) * log10(abs(a) + 1)", numTuples);
+  AddCalculatorCase(runner, "ArrayCalculator.Nested", "((a - b) / (abs(c) + 1)) * ((a + b) / (abs(c) + 2)) + floor(a) - ceil(b)", numTuples);
+
+  const int numFilters = 100;
+  auto pipeline = std::make_shared<FilterPipeline::Pointer>();
+  runner.addCase("FilterPipeline.Preflight.100Filters", static_cast<double>(numFilters), [=]() { return (*pipeline)->preflightPipeline() >= 0; },
+                 [=]() { *pipeline = CreateSyntheticPipeline(numFilters); }, [=]() { pipeline->reset(); });
+}
@@ -0,0 +1,187 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "BenchmarkRunner.h"
+
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/DynamicListArray.hpp"
+#include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/IGeometry.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+
+using namespace SIMPLBenchmarks;
+
+namespace
+{
+struct Mesh
+{
+  MeshIndexArrayType::Pointer elements;
+  ElementDynamicList::Pointer elementsContainingVert;
+  size_t numVertices = 0;
+};
+
+// -----------------------------------------------------------------------------
+// Builds a triangulated n x n vertex grid (two triangles per quad)
+// -----------------------------------------------------------------------------
+Mesh CreateTriangleGrid(size_t n)
+{
+  Mesh mesh;
+  mesh.numVertices = n * n;
+  size_t numTris = 2 * (n - 1) * (n - 1);
+  mesh.elements = TriangleGeom::CreateSharedTriList(numTris);
+  MeshIndexType* tris = mesh.elements->getPointer(0);
+  size_t t = 0;
+  for(size_t j = 0; j < n - 1; j++)
+  {
+    for(size_t i = 0; i < n - 1; i++)
+    {
+      MeshIndexType v0 = j * n + i;
+      MeshIndexType v1 = v0 + 1;
+      MeshIndexType v2 = v0 + n;
+      MeshIndexType v3 = v2 + 1;
+      tris[t++] = v0;
+      tris[t++] = v1;
+      tris[t++] = v3;
+      tris[t++] = v0;
+      tris[t++] = v3;
+      tris[t++] = v2;
+    }
+  }
+  return mesh;
+}
+
+// -----------------------------------------------------------------------------
+// Builds an n x n x n vertex grid where every cube is split into six tetrahedra along its main diagonal
+// -----------------------------------------------------------------------------
+Mesh CreateTetGrid(size_t n)
+{
+  static const size_t k_Paths[6][2] = {{1, 3}, {1, 5}, {2, 3}, {2, 6}, {4, 5}, {4, 6}};
+
+  Mesh mesh;
+  mesh.numVertices = n * n * n;
+  size_t numTets = 6 * (n - 1) * (n - 1) * (n - 1);
+  mesh.elements = TetrahedralGeom::CreateSharedTetList(numTets);
+  MeshIndexType* tets = mesh.elements->getPointer(0);
+  size_t t = 0;
+  for(size_t k = 0; k < n - 1; k++)
+  {
+    for(size_t j = 0; j < n - 1; j++)
+    {
+      for(size_t i = 0; i < n - 1; i++)
+      {
+        // Corner c of the cube has the bits (x, y, z) = (c & 1, c & 2, c & 4)
+        MeshIndexType corners[8];
+        for(size_t c = 0; c < 8; c++)
+        {
+          corners[c] = ((k + ((c >> 2) & 1)) * n + (j + ((c >> 1) & 1))) * n + (i + (c & 1));
+        }
+        for(const auto& path : k_Paths)
+        {
+          tets[t++] = corners[0];
+          tets[t++] = corners[path[0]];
+          tets[t++] = corners[path[1]];
+          tets[t++] = corners[7];
+        }
+      }
+    }
+  }
+  return mesh;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AddMeshCases(BenchmarkRunner& runner, const QString& prefix, IGeometry::Type geomType, const std::function<Mesh()>& createMesh)
+{
+  auto mesh = std::make_shared<Mesh>();
+  auto setup = [=]() { *mesh = createMesh(); };
+  auto setupWithVertLinks = [=]() {
+    *mesh = createMesh();
+    mesh->elementsContainingVert = ElementDynamicList::New();
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, MeshIndexType>(mesh->elements, mesh->elementsContainingVert, mesh->numVertices);
+  };
+  auto teardown = [=]() { *mesh = Mesh(); };
+
+  // The item count is only known once the mesh exists, so build one up front to size the throughput
+  double numElements = static_cast<double>(createMesh().elements->getNumberOfTuples());
+
+  runner.addCase(prefix + ".FindElementsContainingVert", numElements, [=]() {
+    ElementDynamicList::Pointer dynamicList = ElementDynamicList::New();
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, MeshIndexType>(mesh->elements, dynamicList, mesh->numVertices);
+    BenchmarkRunner::KeepValue(dynamicList->size());
+    return true;
+  },
+                 setup, teardown);
+
+  runner.addCase(prefix + ".FindElementNeighbors", numElements, [=]() {
+    ElementDynamicList::Pointer neighbors = ElementDynamicList::New();
+    int err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, MeshIndexType>(mesh->elements, mesh->elementsContainingVert, neighbors, geomType);
+    BenchmarkRunner::KeepValue(neighbors->size());
+    return err >= 0;
+  },
+                 setupWithVertLinks, teardown);
+
+  runner.addCase(prefix + ".FindEdges", numElements, [=]() {
+    SharedEdgeList::Pointer edges = SharedEdgeList::CreateArray(0, std::vector<size_t>(1, 2), "Edges", true);
+    if(geomType == IGeometry::Type::Tetrahedral)
+    {
+      GeometryHelpers::Connectivity::FindTetEdges<MeshIndexType>(mesh->elements, edges);
+    }
+    else
+    {
+      GeometryHelpers::Connectivity::Find2DElementEdges<MeshIndexType>(mesh->elements, edges);
+    }
+    BenchmarkRunner::KeepValue(edges->getNumberOfTuples());
+    return edges->getNumberOfTuples() > 0;
+  },
+                 setup, teardown);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLBenchmarks::RegisterGeometryBenchmarks(BenchmarkRunner& runner)
+{
+  // Keep the element count proportional to the scale factor
+  const double scale = static_cast<double>(runner.getScale());
+  const size_t triGridSize = static_cast<size_t>(std::sqrt(scale) * 700.0);
+  const size_t tetGridSize = static_cast<size_t>(std::cbrt(scale) * 60.0);
+
+  AddMeshCases(runner, "Connectivity.TriangleGrid", IGeometry::Type::Triangle, [=]() { return CreateTriangleGrid(triGridSize); });
+  AddMeshCases(runner, "Connectivity.TetGrid", IGeometry::Type::Tetrahedral, [=]() { return CreateTetGrid(tetGridSize); });
+}
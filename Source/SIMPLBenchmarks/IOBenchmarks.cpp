@@ -0,0 +1,264 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "BenchmarkRunner.h"
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/CoreFilters/DataContainerReader.h"
+#include "SIMPLib/CoreFilters/DataContainerWriter.h"
+#include "SIMPLib/CoreFilters/RawBinaryReader.h"
+#include "SIMPLib/CoreFilters/ReadASCIIData.h"
+#include "SIMPLib/CoreFilters/util/ASCIIWizardData.hpp"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+using namespace SIMPLBenchmarks;
+
+namespace
+{
+const QString k_DataContainerName("BenchmarkDataContainer");
+const QString k_AttributeMatrixName("CellData");
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer CreateEmptyAttributeMatrix(size_t numTuples)
+{
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  DataContainer::Pointer dc = DataContainer::New(k_DataContainerName);
+  AttributeMatrix::Pointer am = AttributeMatrix::New(std::vector<size_t>(1, numTuples), k_AttributeMatrixName, AttributeMatrix::Type::Cell);
+  dc->addOrReplaceAttributeMatrix(am);
+  dca->addOrReplaceDataContainer(dc);
+  return dca;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer CreateImageData(size_t nx, size_t ny, size_t nz)
+{
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  DataContainer::Pointer dc = DataContainer::New(k_DataContainerName);
+  ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+  image->setDimensions(nx, ny, nz);
+  dc->setGeometry(image);
+
+  std::vector<size_t> tDims = {nx, ny, nz};
+  AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, k_AttributeMatrixName, AttributeMatrix::Type::Cell);
+  dc->addOrReplaceAttributeMatrix(am);
+  dca->addOrReplaceDataContainer(dc);
+
+  size_t numTuples = nx * ny * nz;
+  std::mt19937_64 generator(5489u);
+  std::uniform_real_distribution<float> floatDist(0.0f, 1.0f);
+  std::uniform_int_distribution<int32_t> intDist(0, 5000);
+
+  FloatArrayType::Pointer eulers = FloatArrayType::CreateArray(numTuples, std::vector<size_t>(1, 3), "EulerAngles", true);
+  for(size_t i = 0; i < numTuples * 3; i++)
+  {
+    eulers->setValue(i, floatDist(generator));
+  }
+  am->addOrReplaceAttributeArray(eulers);
+
+  Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(numTuples, std::string("FeatureIds"), true);
+  for(size_t i = 0; i < numTuples; i++)
+  {
+    featureIds->setValue(i, intDist(generator));
+  }
+  am->addOrReplaceAttributeArray(featureIds);
+  return dca;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool WriteRawFile(const QString& filePath, size_t numValues)
+{
+  QFile file(filePath);
+  if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+  {
+    return false;
+  }
+  std::mt19937_64 generator(5489u);
+  std::uniform_real_distribution<float> distribution(-1000.0f, 1000.0f);
+  std::vector<float> values(numValues);
+  for(auto& value : values)
+  {
+    value = distribution(generator);
+  }
+  qint64 numBytes = static_cast<qint64>(values.size() * sizeof(float));
+  return file.write(reinterpret_cast<const char*>(values.data()), numBytes) == numBytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool WriteAsciiFile(const QString& filePath, size_t numLines)
+{
+  QFile file(filePath);
+  if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+  {
+    return false;
+  }
+  std::mt19937_64 generator(5489u);
+  std::uniform_real_distribution<float> floatDist(-1000.0f, 1000.0f);
+  std::uniform_int_distribution<int32_t> intDist(0, 100000);
+  QTextStream out(&file);
+  for(size_t i = 0; i < numLines; i++)
+  {
+    out << floatDist(generator) << "," << floatDist(generator) << "," << floatDist(generator) << "," << intDist(generator) << "\n";
+  }
+  return out.status() == QTextStream::Ok;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLBenchmarks::RegisterIOBenchmarks(BenchmarkRunner& runner)
+{
+  const QDir workDir(runner.getWorkDir());
+
+  // RawBinaryReader: 3 component float array
+  {
+    const size_t numTuples = 4000000 * runner.getScale();
+    const QString rawFile = workDir.filePath("SIMPLBenchmark_Raw.bin");
+    auto dca = std::make_shared<DataContainerArray::Pointer>();
+    auto setup = [=]() {
+      if(!QFileInfo::exists(rawFile))
+      {
+        WriteRawFile(rawFile, numTuples * 3);
+      }
+      *dca = CreateEmptyAttributeMatrix(numTuples);
+    };
+    auto body = [=]() {
+      RawBinaryReader::Pointer filter = RawBinaryReader::New();
+      filter->setDataContainerArray(*dca);
+      filter->setInputFile(rawFile);
+      filter->setScalarType(SIMPL::NumericTypes::Type::Float);
+      filter->setNumberOfComponents(3);
+      filter->setEndian(0);
+      filter->setSkipHeaderBytes(0);
+      filter->setCreatedAttributeArrayPath(DataArrayPath(k_DataContainerName, k_AttributeMatrixName, "RawData"));
+      filter->execute();
+      return filter->getErrorCode() >= 0;
+    };
+    runner.addCase("RawBinaryReader.Float32x3", static_cast<double>(numTuples), body, setup, [=]() { dca->reset(); });
+  }
+
+  // ReadASCIIData: comma delimited, three float columns and one integer column
+  {
+    const size_t numLines = 250000 * runner.getScale();
+    const QString asciiFile = workDir.filePath("SIMPLBenchmark_Ascii.csv");
+    auto dca = std::make_shared<DataContainerArray::Pointer>();
+    auto setup = [=]() {
+      if(!QFileInfo::exists(asciiFile))
+      {
+        WriteAsciiFile(asciiFile, numLines);
+      }
+      *dca = CreateEmptyAttributeMatrix(numLines);
+    };
+    auto body = [=]() {
+      ASCIIWizardData data;
+      data.inputFilePath = asciiFile;
+      data.beginIndex = 1;
+      data.numberOfLines = static_cast<int>(numLines);
+      data.delimiters.push_back(',');
+      data.consecutiveDelimiters = false;
+      data.automaticAM = false;
+      data.dataHeaders << "X"
+                       << "Y"
+                       << "Z"
+                       << "Label";
+      data.dataTypes << SIMPL::TypeNames::Float << SIMPL::TypeNames::Float << SIMPL::TypeNames::Float << SIMPL::TypeNames::Int32;
+      data.selectedPath = DataArrayPath(k_DataContainerName, k_AttributeMatrixName, "");
+      data.tupleDims = std::vector<size_t>(1, numLines);
+
+      ReadASCIIData::Pointer filter = ReadASCIIData::New();
+      filter->setDataContainerArray(*dca);
+      filter->setWizardData(data);
+      filter->execute();
+      return filter->getErrorCode() >= 0;
+    };
+    runner.addCase("ReadASCIIData.Csv4Columns", static_cast<double>(numLines), body, setup, [=]() { dca->reset(); });
+  }
+
+  // DataContainerWriter / DataContainerReader round trip through HDF5
+  {
+    const size_t nx = 100;
+    const size_t ny = 100;
+    const size_t nz = 100 * runner.getScale();
+    const double numTuples = static_cast<double>(nx * ny * nz);
+    const QString h5File = workDir.filePath("SIMPLBenchmark_DataContainer.dream3d");
+    auto dca = std::make_shared<DataContainerArray::Pointer>();
+
+    auto writeBody = [=]() {
+      DataContainerWriter::Pointer writer = DataContainerWriter::New();
+      writer->setDataContainerArray(*dca);
+      writer->setOutputFile(h5File);
+      writer->setWriteXdmfFile(false);
+      writer->execute();
+      return writer->getErrorCode() >= 0;
+    };
+    runner.addCase("DataContainerWriter.ImageGeom", numTuples, writeBody, [=]() { *dca = CreateImageData(nx, ny, nz); }, [=]() { dca->reset(); });
+
+    auto readSetup = [=]() {
+      if(!QFileInfo::exists(h5File))
+      {
+        *dca = CreateImageData(nx, ny, nz);
+        writeBody();
+      }
+      *dca = DataContainerArray::New();
+    };
+    auto readBody = [=]() {
+      DataContainerReader::Pointer reader = DataContainerReader::New();
+      reader->setDataContainerArray(*dca);
+      reader->setInputFile(h5File);
+      DataContainerArrayProxy proxy = reader->readDataContainerArrayStructure(h5File);
+      reader->setInputFileDataContainerArrayProxy(proxy);
+      reader->execute();
+      return reader->getErrorCode() >= 0;
+    };
+    runner.addCase("DataContainerReader.ImageGeom", numTuples, readBody, readSetup, [=]() { dca->reset(); });
+  }
+}
@@ -0,0 +1,143 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include <iostream>
+
+#include <QtCore/QCommandLineOption>
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QString>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/SIMPLibVersion.h"
+
+#include "BenchmarkRunner.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setOrganizationName("BlueQuartz Software");
+  QCoreApplication::setOrganizationDomain("bluequartz.net");
+  QCoreApplication::setApplicationName("SIMPLBenchmarks");
+  QCoreApplication::setApplicationVersion(SIMPLib::Version::Major() + "." + SIMPLib::Version::Minor() + "." + SIMPLib::Version::Patch());
+
+  QCommandLineParser parser;
+  QString str;
+  QTextStream ss(&str);
+  ss << "SIMPL Benchmarks (" << SIMPLib::Version::Major() << "." << SIMPLib::Version::Minor() << "." << SIMPLib::Version::Patch()
+     << "): Times the SIMPLib hot paths on synthetic data and writes the results as JSON. Compare two result files with Support/Scripts/compare_benchmarks.py.";
+  parser.setApplicationDescription(str);
+  parser.addHelpOption();
+  parser.addVersionOption();
+
+  QCommandLineOption outputArg(QStringList() << "o"
+                                             << "output",
+                               "JSON file the results are written to.", "file");
+  parser.addOption(outputArg);
+  QCommandLineOption filterArg(QStringList() << "f"
+                                             << "filter",
+                               "Only run the benchmarks whose name contains this string.", "name");
+  parser.addOption(filterArg);
+  QCommandLineOption repetitionsArg(QStringList() << "r"
+                                                  << "repetitions",
+                                    "Number of timed repetitions per benchmark (default 5).", "count", "5");
+  parser.addOption(repetitionsArg);
+  QCommandLineOption scaleArg(QStringList() << "s"
+                                            << "scale",
+                              "Multiplier applied to the synthetic data sizes (default 1).", "factor", "1");
+  parser.addOption(scaleArg);
+  QCommandLineOption workDirArg(QStringList() << "w"
+                                              << "workdir",
+                                "Directory for the temporary files written by the I/O benchmarks.", "dir", QDir::tempPath());
+  parser.addOption(workDirArg);
+
+  parser.process(app);
+
+  bool ok = false;
+  int repetitions = parser.value(repetitionsArg).toInt(&ok);
+  if(!ok || repetitions < 1)
+  {
+    std::cout << "Invalid repetition count: " << parser.value(repetitionsArg).toStdString() << std::endl;
+    return EXIT_FAILURE;
+  }
+  qulonglong scale = parser.value(scaleArg).toULongLong(&ok);
+  if(!ok || scale < 1)
+  {
+    std::cout << "Invalid scale factor: " << parser.value(scaleArg).toStdString() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  QDir workDir(parser.value(workDirArg));
+  if(!workDir.exists() && !workDir.mkpath("."))
+  {
+    std::cout << "Could not create the working directory " << workDir.absolutePath().toStdString() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "SIMPLBenchmarks " << SIMPLib::Version::PackageComplete().toStdString() << std::endl;
+  std::cout << "Scale: " << scale << "  Repetitions: " << repetitions << std::endl;
+
+  SIMPLBenchmarks::BenchmarkRunner runner(static_cast<size_t>(scale), repetitions, workDir.absolutePath());
+  SIMPLBenchmarks::RegisterDataArrayBenchmarks(runner);
+  SIMPLBenchmarks::RegisterFilterBenchmarks(runner);
+  SIMPLBenchmarks::RegisterIOBenchmarks(runner);
+  SIMPLBenchmarks::RegisterGeometryBenchmarks(runner);
+
+  int failures = runner.run(parser.value(filterArg));
+
+  // Clean up the synthetic input and output files of the I/O benchmarks
+  for(const QString& fileName : workDir.entryList(QStringList() << "SIMPLBenchmark_*", QDir::Files))
+  {
+    workDir.remove(fileName);
+  }
+
+  QString outputFile = parser.value(outputArg);
+  if(!outputFile.isEmpty())
+  {
+    QFile file(outputFile);
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+      std::cout << "Could not open output file " << outputFile.toStdString() << std::endl;
+      return EXIT_FAILURE;
+    }
+    file.write(QJsonDocument(runner.toJson()).toJson());
+    std::cout << "Results written to " << outputFile.toStdString() << std::endl;
+  }
+
+  return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -880,6 +880,7 @@ inline const QString xBoundsList("xBounds");
 inline const QString yBoundsList("yBounds");
 inline const QString zBoundsList("zBounds");
 inline const QString SharedVertexList("SharedVertexList");
+inline const QString ImplicitVertexGrid("ImplicitVertexGrid");
 inline const QString SharedEdgeList("SharedEdgeList");
 inline const QString SharedTriList("SharedTriList");
 inline const QString SharedQuadList("SharedQuadList");
@@ -190,6 +190,13 @@
  * PYB11_METHOD(bool doesDataContainerExist OVERLOAD const.QString.&,Name CONST_METHOD)
  * PYB11_METHOD(bool doesDataContainerExist OVERLOAD const.DataArrayPath.&,Path CONST_METHOD)
  * @endcode
+ *
+ * Long running methods that do not call back into Python can release the GIL while they run by
+ * adding CALL_GUARD followed by the guard type.
+ *
+ * @code
+ * PYB11_METHOD(void execute CALL_GUARD py::gil_scoped_release)
+ * @endcode
  */
 #define PYB11_METHOD(...)
 
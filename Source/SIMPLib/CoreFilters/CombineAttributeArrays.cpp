@@ -45,6 +45,7 @@
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/MultiDataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Utilities/ComponentTranspose.hpp"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -80,93 +81,27 @@ public:
   {
     typename DataArrayType::Pointer outputDataPtr = std::dynamic_pointer_cast<DataArrayType>(outputIDataArray);
 
-    std::vector<DataType*> inputArrays;
-    int32_t numArrays = inputIDataArrays.size();
-
-    for(int32_t i = 0; i < numArrays; i++)
+    std::vector<ComponentTranspose::ComponentSlice<const DataType>> inputSlices;
+    size_t arrayOffset = 0;
+    for(const auto& inputIDataArray : inputIDataArrays)
     {
-      DataType* inputData = (std::dynamic_pointer_cast<DataArrayType>(inputIDataArrays.at(i).lock()))->getPointer(0);
-      inputArrays.push_back(inputData);
+      typename DataArrayType::Pointer inputDataPtr = std::dynamic_pointer_cast<DataArrayType>(inputIDataArray.lock());
+      size_t numComps = static_cast<size_t>(inputDataPtr->getNumberOfComponents());
+      inputSlices.push_back({inputDataPtr->getPointer(0), numComps, arrayOffset});
+      arrayOffset += numComps;
     }
-    DataType* outputData = static_cast<DataType*>(outputDataPtr->getPointer(0));
+    DataType* outputData = outputDataPtr->getPointer(0);
 
     size_t numTuples = inputIDataArrays[0].lock()->getNumberOfTuples();
-    int32_t stackedDims = outputIDataArray.get()->getNumberOfComponents();
-    size_t arrayOffset = 0;
-    int32_t numDims = 0;
+    size_t stackedDims = static_cast<size_t>(outputIDataArray->getNumberOfComponents());
 
     if(filter->getNormalizeData())
     {
-      std::vector<DataType> maxVals(stackedDims, std::numeric_limits<DataType>::lowest());
-      std::vector<DataType> minVals(stackedDims, std::numeric_limits<DataType>::max());
-
-      for(int32_t i = 0; i < numArrays; i++)
-      {
-        numDims = inputIDataArrays[i].lock()->getNumberOfComponents();
-        if(i > 0)
-        {
-          arrayOffset += inputIDataArrays[i - 1].lock()->getNumberOfComponents();
-        }
-        for(size_t j = 0; j < numTuples; j++)
-        {
-          for(int32_t k = 0; k < numDims; k++)
-          {
-            if(inputArrays[i][numDims * j + k] > maxVals[arrayOffset + k])
-            {
-              maxVals[arrayOffset + k] = inputArrays[i][numDims * j + k];
-            }
-            if(inputArrays[i][numDims * j + k] < minVals[arrayOffset + k])
-            {
-              minVals[arrayOffset + k] = inputArrays[i][numDims * j + k];
-            }
-          }
-        }
-      }
-
-      arrayOffset = 0;
-
-      for(size_t i = 0; i < numTuples; i++)
-      {
-        for(int32_t j = 0; j < numArrays; j++)
-        {
-          numDims = inputIDataArrays[j].lock()->getNumberOfComponents();
-          if(j > 0)
-          {
-            arrayOffset += inputIDataArrays[j - 1].lock()->getNumberOfComponents();
-          }
-          for(int32_t k = 0; k < numDims; k++)
-          {
-            if(maxVals[arrayOffset + k] == minVals[arrayOffset + k])
-            {
-              outputData[stackedDims * i + (arrayOffset) + k] = static_cast<DataType>(0);
-            }
-            else
-            {
-              outputData[stackedDims * i + (arrayOffset) + k] = (inputArrays[j][numDims * i + k] - minVals[arrayOffset + k]) / (maxVals[arrayOffset + k] - minVals[arrayOffset + k]);
-            }
-          }
-        }
-        arrayOffset = 0;
-      }
+      ComponentTranspose::InterleaveAndNormalize<DataType>(inputSlices, outputData, stackedDims, numTuples);
     }
     else
     {
-      for(size_t i = 0; i < numTuples; i++)
-      {
-        for(int32_t j = 0; j < numArrays; j++)
-        {
-          numDims = inputIDataArrays[j].lock()->getNumberOfComponents();
-          if(j > 0)
-          {
-            arrayOffset += inputIDataArrays[j - 1].lock()->getNumberOfComponents();
-          }
-          for(int32_t k = 0; k < numDims; k++)
-          {
-            outputData[stackedDims * i + (arrayOffset) + k] = inputArrays[j][numDims * i + k];
-          }
-        }
-        arrayOffset = 0;
-      }
+      ComponentTranspose::Interleave<DataType>(inputSlices, outputData, stackedDims, numTuples);
     }
   }
 
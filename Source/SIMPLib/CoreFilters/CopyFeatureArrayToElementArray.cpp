@@ -45,6 +45,7 @@
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Utilities/DataArrayReductions.hpp"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -197,18 +198,11 @@ void CopyFeatureArrayToElementArray::execute()
   int32_t numFeatures = static_cast<int32_t>(m_InArrayPtr.lock()->getNumberOfTuples());
   bool mismatchedFeatures = false;
   int32_t largestFeature = 0;
-  size_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
-  for(size_t i = 0; i < totalPoints; i++)
+  DataArrayReductions::MinMaxResult<int32_t> featureIdRange = DataArrayReductions::MinMax(*(m_FeatureIdsPtr.lock()));
+  if(featureIdRange.isValid())
   {
-    if(m_FeatureIds[i] > largestFeature)
-    {
-      largestFeature = m_FeatureIds[i];
-      if(largestFeature >= numFeatures)
-      {
-        mismatchedFeatures = true;
-        break;
-      }
-    }
+    largestFeature = std::max(largestFeature, featureIdRange.max);
+    mismatchedFeatures = (largestFeature >= numFeatures);
   }
 
   if(mismatchedFeatures)
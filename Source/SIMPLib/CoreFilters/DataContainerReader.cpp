@@ -51,6 +51,8 @@
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataContainerReaderFilterParameter.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersReader.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Montages/MontageSupport.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReader.h"
@@ -77,6 +79,9 @@ void DataContainerReader::setupFilterParameters()
   FilterParameterVectorType parameters;
 
   parameters.push_back(SIMPL_NEW_BOOL_FP("Overwrite Existing Data Containers", OverwriteExistingDataContainers, FilterParameter::Category::Parameter, DataContainerReader));
+  std::vector<QString> linkedProps = {"DeferredMemoryBudget"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Read Arrays On First Access", DeferArrayReads, FilterParameter::Category::Parameter, DataContainerReader, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Memory Budget For Read Arrays (MB)", DeferredMemoryBudget, FilterParameter::Category::Parameter, DataContainerReader));
   {
     DataContainerReaderFilterParameter::Pointer parameter = DataContainerReaderFilterParameter::New();
     parameter->setHumanLabel("Select Arrays from Input File");
@@ -101,6 +106,8 @@ void DataContainerReader::readFilterParameters(AbstractFilterParametersReader* r
   setInputFileDataContainerArrayProxy(reader->readDataContainerArrayProxy("InputFileDataContainerArrayProxy", getInputFileDataContainerArrayProxy()));
   syncProxies(); // Sync the file proxy and currently cached proxy together into one proxy
   setOverwriteExistingDataContainers(reader->readValue("OverwriteExistingDataContainers", getOverwriteExistingDataContainers()));
+  setDeferArrayReads(reader->readValue("DeferArrayReads", getDeferArrayReads()));
+  setDeferredMemoryBudget(reader->readValue("DeferredMemoryBudget", getDeferredMemoryBudget()));
   reader->closeFilterGroup();
 }
 
@@ -183,9 +190,30 @@ void DataContainerReader::dataCheck()
                   " into your code before calling preflight or execute on the filter or pipeline";
     setWarningCondition(1000, msg);
   }
+  if(getDeferArrayReads() && getDeferredMemoryBudget() < 0)
+  {
+    ss = QObject::tr("The memory budget for read arrays must be zero (no limit) or greater");
+    setErrorCondition(-391, ss);
+    return;
+  }
 
-  // Read either the structure or all the data depending on the preflight status
-  DataContainerArray::Pointer tempDCA = readData(m_InputFileDataContainerArrayProxy);
+  // Read either the structure or all the data depending on the preflight status. When arrays are
+  // read on first access only their meta data is read here and the data is read when a later
+  // filter or writer uses it.
+  DataContainerArray::Pointer tempDCA;
+  if(getDeferArrayReads() && !getInPreflight())
+  {
+    DataContainerArrayProxy deferredProxy = m_InputFileDataContainerArrayProxy;
+    for(auto& dcProxy : deferredProxy.getDataContainers())
+    {
+      dcProxy.setDeferArrayReads(true);
+    }
+    tempDCA = readData(deferredProxy);
+  }
+  else
+  {
+    tempDCA = readData(m_InputFileDataContainerArrayProxy);
+  }
   if(tempDCA.get() == nullptr)
   {
     return;
@@ -223,6 +251,11 @@ void DataContainerReader::dataCheck()
   {
     dca->addMontage(montage);
   }
+
+  if(getDeferArrayReads() && !getInPreflight() && getDeferredMemoryBudget() > 0)
+  {
+    dca->setDeferredMemoryBudget(static_cast<size_t>(getDeferredMemoryBudget()) * 1024 * 1024);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -468,6 +501,22 @@ bool DataContainerReader::syncProxies()
   return true;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerReader::copyPreflightState(AbstractFilter* filter) const
+{
+  AbstractFilter::copyPreflightState(filter);
+  DataContainerReader* reader = dynamic_cast<DataContainerReader*>(filter);
+  if(nullptr == reader)
+  {
+    return;
+  }
+  reader->setLastFileRead(getLastFileRead());
+  reader->setLastRead(getLastRead());
+  reader->setInputFileDataContainerArrayProxy(getInputFileDataContainerArrayProxy());
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -609,6 +658,30 @@ bool DataContainerReader::getOverwriteExistingDataContainers() const
   return m_OverwriteExistingDataContainers;
 }
 
+// -----------------------------------------------------------------------------
+void DataContainerReader::setDeferArrayReads(bool value)
+{
+  m_DeferArrayReads = value;
+}
+
+// -----------------------------------------------------------------------------
+bool DataContainerReader::getDeferArrayReads() const
+{
+  return m_DeferArrayReads;
+}
+
+// -----------------------------------------------------------------------------
+void DataContainerReader::setDeferredMemoryBudget(int value)
+{
+  m_DeferredMemoryBudget = value;
+}
+
+// -----------------------------------------------------------------------------
+int DataContainerReader::getDeferredMemoryBudget() const
+{
+  return m_DeferredMemoryBudget;
+}
+
 // -----------------------------------------------------------------------------
 void DataContainerReader::setLastFileRead(const QString& value)
 {
@@ -66,6 +66,8 @@ class SIMPLib_EXPORT DataContainerReader : public AbstractFilter
   PYB11_FILTER_NEW_MACRO(DataContainerReader)
   PYB11_PROPERTY(QString InputFile READ getInputFile WRITE setInputFile)
   PYB11_PROPERTY(bool OverwriteExistingDataContainers READ getOverwriteExistingDataContainers WRITE setOverwriteExistingDataContainers)
+  PYB11_PROPERTY(bool DeferArrayReads READ getDeferArrayReads WRITE setDeferArrayReads)
+  PYB11_PROPERTY(int DeferredMemoryBudget READ getDeferredMemoryBudget WRITE setDeferredMemoryBudget)
   PYB11_PROPERTY(DataContainerArrayProxy InputFileDataContainerArrayProxy READ getInputFileDataContainerArrayProxy WRITE setInputFileDataContainerArrayProxy)
   PYB11_METHOD(DataContainerArrayProxy readDataContainerArrayStructure ARGS path)
   PYB11_END_BINDINGS()
@@ -116,6 +118,30 @@ public:
 
   Q_PROPERTY(bool OverwriteExistingDataContainers READ getOverwriteExistingDataContainers WRITE setOverwriteExistingDataContainers)
 
+  /**
+   * @brief Setter property for DeferArrayReads
+   */
+  void setDeferArrayReads(bool value);
+  /**
+   * @brief Getter property for DeferArrayReads
+   * @return Value of DeferArrayReads
+   */
+  bool getDeferArrayReads() const;
+
+  Q_PROPERTY(bool DeferArrayReads READ getDeferArrayReads WRITE setDeferArrayReads)
+
+  /**
+   * @brief Setter property for DeferredMemoryBudget
+   */
+  void setDeferredMemoryBudget(int value);
+  /**
+   * @brief Getter property for DeferredMemoryBudget
+   * @return Value of DeferredMemoryBudget
+   */
+  int getDeferredMemoryBudget() const;
+
+  Q_PROPERTY(int DeferredMemoryBudget READ getDeferredMemoryBudget WRITE setDeferredMemoryBudget)
+
   /**
    * @brief Setter property for LastFileRead
    */
@@ -260,6 +286,13 @@ public:
    */
   bool syncProxies();
 
+  /**
+   * @brief Reimplemented from @see AbstractFilter class to also copy the cached file time
+   * stamps and the proxy, which dataCheck updates when the input file has changed.
+   * @param filter
+   */
+  void copyPreflightState(AbstractFilter* filter) const override;
+
 protected:
   DataContainerReader();
   /**
@@ -295,6 +328,8 @@ protected Q_SLOTS:
 private:
   QString m_InputFile = {""};
   bool m_OverwriteExistingDataContainers = {false};
+  bool m_DeferArrayReads = {false};
+  int m_DeferredMemoryBudget = {0};
   QString m_LastFileRead = {""};
   QDateTime m_LastRead = {QDateTime::currentDateTime()};
   DataContainerArrayProxy m_InputFileDataContainerArrayProxy = {};
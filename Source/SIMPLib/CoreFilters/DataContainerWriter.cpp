@@ -116,6 +116,49 @@ void DataContainerWriter::dataCheck()
   FileSystemPathHelper::CheckOutputFile(this, "Output File Path", getOutputFile(), true);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::list<DataArrayPath> DataContainerWriter::getConsumedPaths()
+{
+  return {DataArrayPath()};
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int DataContainerWriter::detachArraysReadFromOutputFile()
+{
+  const QString outputPath = QFileInfo(m_OutputFile).canonicalFilePath();
+  if(outputPath.isEmpty())
+  {
+    // The output file does not exist yet so nothing can have been read from it
+    return 0;
+  }
+
+  for(const auto& dc : getDataContainerArray()->getDataContainers())
+  {
+    for(const auto& am : dc->getAttributeMatrices())
+    {
+      for(const auto& array : *am)
+      {
+        if(!array->hasDeferredSource() || QFileInfo(array->getDeferredSourceFile()).canonicalFilePath() != outputPath)
+        {
+          continue;
+        }
+        if(array->detachDeferredSource() < 0)
+        {
+          QString ss = QObject::tr("The array '%1' has not been read from '%2' yet and could not be loaded before the file is overwritten")
+                           .arg(DataArrayPath(dc->getName(), am->getName(), array->getName()).serialize(), m_OutputFile);
+          setErrorCondition(-11114, ss);
+          return -1;
+        }
+      }
+    }
+  }
+  return 0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -139,6 +182,11 @@ void DataContainerWriter::execute()
     return;
   }
 
+  if(detachArraysReadFromOutputFile() < 0)
+  {
+    return;
+  }
+
   hid_t fileId = -1;
 
   // Try to open a file to append data into
@@ -201,6 +201,12 @@ public:
    */
   void execute() override;
 
+  /**
+   * @brief Reimplemented from @see AbstractFilter class. The writer saves the entire DataContainerArray.
+   * @return
+   */
+  std::list<DataArrayPath> getConsumedPaths() override;
+
 protected:
   DataContainerWriter();
   /**
@@ -219,6 +225,13 @@ protected:
    */
   int writePipeline();
 
+  /**
+   * @brief detachArraysReadFromOutputFile Reads into memory every deferred array whose data still lives in
+   * the output file, because opening that file for writing would destroy the data before it was loaded.
+   * @return 0 on success, negative if a deferred array could not be read
+   */
+  int detachArraysReadFromOutputFile();
+
   /**
    * @brief writeDataContainerBundles Writes any existing DataContainerBundles to the HDF5 file
    * @param fileId Group Id for the DataContainerBundles
@@ -362,6 +362,14 @@ QString ExecuteProcess::getSubGroupName() const
   return SIMPL::FilterSubGroups::MiscFilters;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ExecuteProcess::hasSideEffects() const
+{
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
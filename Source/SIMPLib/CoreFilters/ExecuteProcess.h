@@ -139,6 +139,11 @@ public:
    */
   QString getSubGroupName() const override;
 
+  /**
+   * @brief hasSideEffects Reimplemented from @see AbstractFilter class. The process may do anything.
+   */
+  bool hasSideEffects() const override;
+
   /**
    * @brief getUuid Return the unique identifier for this filter.
    * @return A QUuid object.
@@ -277,9 +277,6 @@ void ExtractAttributeArraysFromGeometry::dataCheck()
   {
     VertexGeom::Pointer vertex = std::static_pointer_cast<VertexGeom>(igeom);
 
-    QVector<IDataArray::Pointer> arrays;
-    arrays.push_back(vertex->getVertices());
-
     std::vector<size_t> cDims(1, 3);
 
     m_VertsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, getSharedVertexListArrayPath0(), 0, cDims, "", Vert_SharedVertexID);
@@ -287,13 +284,17 @@ void ExtractAttributeArraysFromGeometry::dataCheck()
     {
       m_Verts = m_VertsPtr.lock()->getPointer(0);
     }
-    if(getErrorCode() >= 0)
+
+    // Compare against the vertex count so implicit vertices are not stored just to be counted
+    if(getErrorCode() >= 0 && m_VertsPtr.lock() && m_VertsPtr.lock()->getNumberOfTuples() != vertex->getNumberOfVertices())
     {
-      arrays.push_back(m_VertsPtr.lock());
+      QString ss = QObject::tr("The number of tuples for the DataArray %1 is %2 and the Vertex Geometry has %3 vertices. The number of tuples must match.")
+                       .arg(m_VertsPtr.lock()->getName())
+                       .arg(m_VertsPtr.lock()->getNumberOfTuples())
+                       .arg(vertex->getNumberOfVertices());
+      setErrorCondition(-10200, ss);
     }
 
-    getDataContainerArray()->validateNumberOfTuples(this, arrays);
-
     break;
   }
   case IGeometry::Type::Edge: // EdgeGeom
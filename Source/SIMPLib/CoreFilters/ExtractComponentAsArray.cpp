@@ -46,6 +46,7 @@
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Utilities/ComponentTranspose.hpp"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -167,15 +168,11 @@ void extractComponent(IDataArray::Pointer inputData, IDataArray::Pointer newData
     return;
   }
 
-  T* inputArray = inputArrayPtr->getPointer(0);
-  T* newArray = newArrayPtr->getPointer(0);
   size_t numPoints = inputArrayPtr->getNumberOfTuples();
   size_t numComps = inputArrayPtr->getNumberOfComponents();
 
-  for(size_t i = 0; i < numPoints; i++)
-  {
-    newArray[i] = inputArray[numComps * i + compNumber];
-  }
+  std::vector<ComponentTranspose::ComponentSlice<T>> outputSlices = {{newArrayPtr->getPointer(0), 1, static_cast<size_t>(compNumber)}};
+  ComponentTranspose::Deinterleave<T>(inputArrayPtr->getPointer(0), numComps, outputSlices, numPoints);
 }
 
 // -----------------------------------------------------------------------------
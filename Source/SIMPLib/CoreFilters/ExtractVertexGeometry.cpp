@@ -47,6 +47,7 @@
 #include "SIMPLib/FilterParameters/DataContainerCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataContainerSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/MultiDataArraySelectionFilterParameter.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -112,6 +113,8 @@ void ExtractVertexGeometry::setupFilterParameters()
     parameters.push_back(SIMPL_NEW_MDA_SELECTION_FP("Included Attribute Arrays", IncludedDataArrayPaths, FilterParameter::Category::RequiredArray, ExtractVertexGeometry, req));
   }
 
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Compute Vertex Coordinates On Access", ImplicitVertices, FilterParameter::Category::Parameter, ExtractVertexGeometry));
+
   parameters.push_back(SIMPL_NEW_DC_CREATION_FP("Vertex Data Container Name", VertexDataContainerName, FilterParameter::Category::CreatedArray, ExtractVertexGeometry));
 
   setFilterParameters(parameters);
@@ -181,7 +184,8 @@ void ExtractVertexGeometry::dataCheck()
     vertexDataContainer = getDataContainerArray()->createNonPrereqDataContainer(this, getVertexDataContainerName(), DataContainerID);
     IGeometryGrid::Pointer imageGeom = std::dynamic_pointer_cast<IGeometryGrid>(fromGeometry);
     SizeVec3Type imageDims = imageGeom->getDimensions();
-    VertexGeom::Pointer vertexGeom = VertexGeom::CreateGeometry(imageDims[0] * imageDims[1] * imageDims[2], "VertexGeometry", !getInPreflight());
+    VertexGeom::Pointer vertexGeom = getImplicitVertices() ? VertexGeom::CreateGeometry(*imageGeom, "VertexGeometry", !getInPreflight())
+                                                           : VertexGeom::CreateGeometry(imageDims[0] * imageDims[1] * imageDims[2], "VertexGeometry", !getInPreflight());
     vertexDataContainer->setGeometry(vertexGeom);
     elementCount = imageDims[0] * imageDims[1] * imageDims[2];
   }
@@ -262,21 +266,28 @@ void ExtractVertexGeometry::execute()
 
   IGeometryGrid::Pointer sourceGeometry = getDataContainerArray()->getDataContainer(getSelectedDataContainerName())->getGeometryAs<IGeometryGrid>();
 
-  float coords[3] = {0.0f, 0.0f, 0.0f};
-
   SizeVec3Type dims = sourceGeometry->getDimensions();
   size_t cellCount = std::accumulate(dims.begin(), dims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
 
   VertexGeom::Pointer vertexGeom = getDataContainerArray()->getDataContainer(getVertexDataContainerName())->getGeometryAs<VertexGeom>();
-  SharedVertexList::Pointer vertices = vertexGeom->getVertices();
+  if(vertexGeom->hasImplicitVertices())
+  {
+    // The coordinates are computed from the copy of the grid taken in dataCheck()
+    return;
+  }
+  float* vertices = vertexGeom->getVertices()->getPointer(0);
+  const IGeometryGrid* grid = sourceGeometry.get();
 
   // Use the APIs from the IGeometryGrid to get the XYZ coord for the center of each cell and then set that into the
   // the new VertexGeometry
-  for(size_t idx = 0; idx < cellCount; idx++)
-  {
-    sourceGeometry->getCoords(idx, coords);
-    vertices->setTuple(idx, coords);
-  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, cellCount);
+  dataAlg.execute([vertices, grid](const SIMPLRange& range) {
+    for(size_t idx = range.min(); idx < range.max(); idx++)
+    {
+      grid->getCoords(idx, vertices + 3 * idx);
+    }
+  });
 }
 
 // -----------------------------------------------------------------------------
@@ -427,3 +438,15 @@ DataArrayPath ExtractVertexGeometry::getVertexDataContainerName() const
 {
   return m_VertexDataContainerName;
 }
+
+// -----------------------------------------------------------------------------
+void ExtractVertexGeometry::setImplicitVertices(bool value)
+{
+  m_ImplicitVertices = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ExtractVertexGeometry::getImplicitVertices() const
+{
+  return m_ImplicitVertices;
+}
@@ -59,6 +59,7 @@ class SIMPLib_EXPORT ExtractVertexGeometry : public AbstractFilter
   PYB11_PROPERTY(DataArrayPath SelectedDataContainerName READ getSelectedDataContainerName WRITE setSelectedDataContainerName)
   PYB11_PROPERTY(std::vector<DataArrayPath> IncludedDataArrayPaths READ getIncludedDataArrayPaths WRITE setIncludedDataArrayPaths)
   PYB11_PROPERTY(DataArrayPath VertexDataContainerName READ getVertexDataContainerName WRITE setVertexDataContainerName)
+  PYB11_PROPERTY(bool ImplicitVertices READ getImplicitVertices WRITE setImplicitVertices)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -138,6 +139,19 @@ public:
 
   Q_PROPERTY(DataArrayPath VertexDataContainerName READ getVertexDataContainerName WRITE setVertexDataContainerName)
 
+  /**
+   * @brief Setter property for ImplicitVertices. When set, the vertex coordinates are computed from the input grid
+   * instead of being stored. See VertexGeom::setImplicitVertices().
+   */
+  void setImplicitVertices(bool value);
+  /**
+   * @brief Getter property for ImplicitVertices
+   * @return Value of ImplicitVertices
+   */
+  bool getImplicitVertices() const;
+
+  Q_PROPERTY(bool ImplicitVertices READ getImplicitVertices WRITE setImplicitVertices)
+
   ~ExtractVertexGeometry() override;
 
   enum class ArrayHandlingType : unsigned int
@@ -219,6 +233,7 @@ private:
   DataArrayPath m_SelectedDataContainerName = {};
   std::vector<DataArrayPath> m_IncludedDataArrayPaths = {};
   DataArrayPath m_VertexDataContainerName = {"VertexDataContainer", "", ""};
+  bool m_ImplicitVertices = {false};
 
   std::vector<QString> m_NewDCGeometryChoices;
   std::vector<QString> m_ArrayHandlingChoices;
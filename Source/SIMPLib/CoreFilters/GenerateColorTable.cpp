@@ -13,144 +13,13 @@
 #include "SIMPLib/FilterParameters/GenerateColorTableFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
-#include "SIMPLib/Utilities/ColorTable.h"
-#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+#include "SIMPLib/Utilities/ColorMap.h"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
   ColorArrayID = 1
 };
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-template <typename T>
-int findRightBinIndex(T nValue, std::vector<float> binPoints)
-{
-  /* This is a brute-force way of finding the proper bins.
-     We will need to change this method to a binary search. */
-  int rightBinIndex = 0;
-  while(binPoints[rightBinIndex] < nValue)
-  {
-    rightBinIndex++;
-  }
-
-  return rightBinIndex;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-int findRightBinIndex_Binary(float nValue, std::vector<float> binPoints)
-{
-  int min = 0, max = binPoints.size() - 1;
-  while(min < max)
-  {
-    int middle = (min + max) / 2;
-    if(nValue > binPoints[middle])
-    {
-      min = middle + 1;
-    }
-    else
-    {
-      max = middle;
-    }
-  }
-  return min;
-}
-
-/**
- * @brief The GenerateColorTableImpl class implements a threaded algorithm that computes the RGB values
- * for each element in a given array of data
- */
-template <typename T>
-class GenerateColorTableImpl
-{
-public:
-  GenerateColorTableImpl(typename DataArray<T>::Pointer arrayPtr, std::vector<float> binPoints, std::vector<std::vector<double>> controlPoints, int numControlColors,
-                         UInt8ArrayType::Pointer colorArray)
-  : m_ArrayPtr(arrayPtr)
-  , m_BinPoints(std::move(binPoints))
-  , m_NumControlColors(numControlColors)
-  , m_ControlPoints(std::move(controlPoints))
-  , m_ColorArray(std::move(colorArray))
-  {
-    m_ArrayMin = arrayPtr->getValue(0);
-    m_ArrayMax = arrayPtr->getValue(0);
-    for(int i = 1; i < arrayPtr->getNumberOfTuples(); i++)
-    {
-      if(arrayPtr->getValue(i) < m_ArrayMin)
-      {
-        m_ArrayMin = arrayPtr->getValue(i);
-      }
-      if(arrayPtr->getValue(i) > m_ArrayMax)
-      {
-        m_ArrayMax = arrayPtr->getValue(i);
-      }
-    }
-  }
-  virtual ~GenerateColorTableImpl() = default;
-
-  void convert(size_t start, size_t end) const
-  {
-    for(size_t i = start; i < end; i++)
-    {
-      // Normalize value
-      float nValue = (static_cast<float>(m_ArrayPtr->getValue(i) - m_ArrayMin)) / static_cast<float>((m_ArrayMax - m_ArrayMin));
-
-      int rightBinIndex = findRightBinIndex_Binary(nValue, m_BinPoints);
-
-      int leftBinIndex = rightBinIndex - 1;
-      if(leftBinIndex < 0)
-      {
-        leftBinIndex = 0;
-        rightBinIndex = 1;
-      }
-
-      // Find the fractional distance traveled between the beginning and end of the current color bin
-      float currFraction = 0.0f;
-      if(rightBinIndex < m_BinPoints.size())
-      {
-        currFraction = (nValue - m_BinPoints[leftBinIndex]) / (m_BinPoints[rightBinIndex] - m_BinPoints[leftBinIndex]);
-      }
-      else
-      {
-        currFraction = (nValue - m_BinPoints[leftBinIndex]) / (1 - m_BinPoints[leftBinIndex]);
-      }
-
-      // If the current color bin index is larger than the total number of control colors, automatically set the currentBinIndex
-      // to the last control color.
-      if(leftBinIndex > m_NumControlColors - 1)
-      {
-        leftBinIndex = m_NumControlColors - 1;
-      }
-
-      // Calculate the RGB values
-      unsigned char r = (m_ControlPoints[leftBinIndex][1] * (1.0 - currFraction) + m_ControlPoints[rightBinIndex][1] * currFraction) * 255;
-      unsigned char g = (m_ControlPoints[leftBinIndex][2] * (1.0 - currFraction) + m_ControlPoints[rightBinIndex][2] * currFraction) * 255;
-      unsigned char b = (m_ControlPoints[leftBinIndex][3] * (1.0 - currFraction) + m_ControlPoints[rightBinIndex][3] * currFraction) * 255;
-
-      m_ColorArray->setComponent(i, 0, r);
-      m_ColorArray->setComponent(i, 1, g);
-      m_ColorArray->setComponent(i, 2, b);
-    }
-  }
-
-  void operator()(const SIMPLRange& r) const
-  {
-    convert(r.min(), r.max());
-  }
-
-private:
-  typename DataArray<T>::Pointer m_ArrayPtr;
-  std::vector<float> m_BinPoints;
-  T m_ArrayMin;
-  T m_ArrayMax;
-  int m_NumControlColors;
-  std::vector<std::vector<double>> m_ControlPoints;
-  UInt8ArrayType::Pointer m_ColorArray;
-};
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -167,32 +36,6 @@ void generateColorArray(typename DataArray<T>::Pointer arrayPtr, QJsonArray pres
     return;
   }
 
-  int numControlColors = presetControlPoints.count() / 4;
-  int numComponents = 4;
-  std::vector<std::vector<double>> controlPoints(numControlColors, std::vector<double>(numComponents));
-
-  // Migrate colorControlPoints values from QJsonArray to 2D array.  Store A-values in binPoints vector.
-  std::vector<float> binPoints;
-  for(int i = 0; i < numControlColors; i++)
-  {
-    for(int j = 0; j < numComponents; j++)
-    {
-      controlPoints[i][j] = static_cast<float>(presetControlPoints[numComponents * i + j].toDouble());
-      if(j == 0)
-      {
-        binPoints.push_back(controlPoints[i][j]);
-      }
-    }
-  }
-
-  // Normalize binPoints values
-  float binMin = binPoints[0];
-  float binMax = binPoints[binPoints.size() - 1];
-  for(int i = 0; i < binPoints.size(); i++)
-  {
-    binPoints[i] = (binPoints[i] - binMin) / (binMax - binMin);
-  }
-
   DataArrayPath tmpPath = selectedDAP;
   tmpPath.setDataArrayName(rgbArrayName);
 
@@ -202,9 +45,8 @@ void generateColorArray(typename DataArray<T>::Pointer arrayPtr, QJsonArray pres
     return;
   }
 
-  ParallelDataAlgorithm dataAlg;
-  dataAlg.setRange(0, arrayPtr->getNumberOfTuples());
-  dataAlg.execute(GenerateColorTableImpl<T>(arrayPtr, binPoints, controlPoints, numControlColors, colorArray));
+  ColorMap colorMap(presetControlPoints);
+  colorMap.mapArray(*arrayPtr, *colorArray);
 }
 
 // -----------------------------------------------------------------------------
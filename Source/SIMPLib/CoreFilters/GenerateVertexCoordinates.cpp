@@ -34,7 +34,6 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "GenerateVertexCoordinates.h"
 
-#include <array>
 #include <numeric>
 
 #include <QtCore/QTextStream>
@@ -45,6 +44,7 @@
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/DataArrayCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataContainerSelectionFilterParameter.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -148,18 +148,22 @@ void GenerateVertexCoordinates::execute()
 
   IGeometryGrid::Pointer sourceGeometry = getDataContainerArray()->getDataContainer(getSelectedDataContainerName())->getGeometryAs<IGeometryGrid>();
 
-  std::array<float, 3> coords = {0.0f, 0.0f, 0.0f};
-
   SizeVec3Type dims = sourceGeometry->getDimensions();
   size_t cellCount = std::accumulate(dims.begin(), dims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
 
+  float* coords = m_CoordinatesPtr->getPointer(0);
+  const IGeometryGrid* grid = sourceGeometry.get();
+
   // Use the APIs from the IGeometryGrid to get the XYZ coord for the center of each cell and then set that into the
-  // the new VertexGeometry
-  for(size_t idx = 0; idx < cellCount; idx++)
-  {
-    sourceGeometry->getCoords(idx, coords.data());
-    m_CoordinatesPtr->setTuple(idx, coords.data());
-  }
+  // the new coordinate array
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, cellCount);
+  dataAlg.execute([coords, grid](const SIMPLRange& range) {
+    for(size_t idx = range.min(); idx < range.max(); idx++)
+    {
+      grid->getCoords(idx, coords + 3 * idx);
+    }
+  });
 }
 
 // -----------------------------------------------------------------------------
@@ -31,6 +31,8 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "ImportHDF5Dataset.h"
 
+#include <numeric>
+
 #include <QtCore/QDebug>
 #include <QtCore/QFileInfo>
 #include <QtCore/QTextStream>
@@ -47,7 +49,11 @@
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/ImportHDF5DatasetFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
 
 namespace Detail
 {
@@ -115,6 +121,12 @@ void ImportHDF5Dataset::setupFilterParameters()
     parameters.push_back(SIMPL_NEW_AM_SELECTION_FP("Attribute Matrix", SelectedAttributeMatrix, FilterParameter::Category::RequiredArray, ImportHDF5Dataset, req));
   }
 
+  std::vector<QString> linkedProps = {"RegionMinIndex", "RegionMaxIndex", "RegionStride"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Read Sub-Volume Only", UseRegion, FilterParameter::Category::Parameter, ImportHDF5Dataset, linkedProps));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Minimum Voxel Index", RegionMinIndex, FilterParameter::Category::Parameter, ImportHDF5Dataset));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Maximum Voxel Index", RegionMaxIndex, FilterParameter::Category::Parameter, ImportHDF5Dataset));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Voxel Stride", RegionStride, FilterParameter::Category::Parameter, ImportHDF5Dataset));
+
   setFilterParameters(parameters);
 }
 
@@ -164,6 +176,19 @@ void ImportHDF5Dataset::dataCheck()
     return;
   }
 
+  // The tuple dimensions that every dataset must match. When only a region is read the
+  // Attribute Matrix is shrunk to the region, but the datasets still span the full extent.
+  std::vector<size_t> fullTupleDims = am->getTupleDimensions();
+  H5HyperslabRegion region;
+  if(m_UseRegion)
+  {
+    region = cropAttributeMatrixToRegion(*am);
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+  }
+
   hid_t fileId = H5Utilities::openFile(m_HDF5FilePath.toStdString(), true);
   if(fileId < 0)
   {
@@ -263,7 +288,7 @@ void ImportHDF5Dataset::dataCheck()
     stream << tr("Attribute Matrix Path: %1\n").arg(m_SelectedAttributeMatrix.serialize("/"));
 
     size_t userEnteredTotalElements = 1;
-    std::vector<size_t> amTupleDims = am->getTupleDimensions();
+    std::vector<size_t> amTupleDims = fullTupleDims;
     stream << tr("No. of Attribute Matrix Dimension(s): ") << locale.toString(static_cast<quint64>(amTupleDims.size())) << "\n";
     stream << "Attribute Matrix Dimension(s): ";
     for(int i = 0; i < amTupleDims.size(); i++)
@@ -278,7 +303,7 @@ void ImportHDF5Dataset::dataCheck()
     }
     stream << "\n";
 
-    int numOfAMTuples = am->getNumberOfTuples();
+    int numOfAMTuples = static_cast<int>(std::accumulate(fullTupleDims.begin(), fullTupleDims.end(), static_cast<size_t>(1), std::multiplies<size_t>()));
     stream << tr("Total Attribute Matrix Tuple Count: %1\n").arg(locale.toString(numOfAMTuples));
 
     stream << tr("No. of Component Dimension(s): ") << locale.toString(static_cast<quint64>(cDims.size())) << "\n";
@@ -334,11 +359,27 @@ void ImportHDF5Dataset::dataCheck()
     }
     else
     {
-      IDataArray::Pointer dPtr = readIDataArray(parentId, objectName, am->getNumberOfTuples(), cDims, getInPreflight());
+      IDataArray::Pointer dPtr = IDataArray::NullPointer();
+      if(region.isEmpty())
+      {
+        dPtr = readIDataArray(parentId, objectName, am->getNumberOfTuples(), cDims, getInPreflight());
+      }
+      else
+      {
+        dPtr = H5DataArrayReader::ReadDatasetRegion(parentId, objectName, fullTupleDims, cDims, region, getInPreflight());
+      }
       if(nullptr != dPtr)
       {
         am->insertOrAssign(dPtr);
       }
+      else if(!region.isEmpty())
+      {
+        ss.clear();
+        stream << tr("The sub-volume could not be read from dataset '%1'. The dataset must be a numeric type whose dimensions are the reversed Attribute Matrix dimensions followed by the "
+                     "component dimensions.")
+                      .arg(datasetPath);
+        setErrorCondition(-20014, ss);
+      }
       else
       {
         ss.clear();
@@ -351,6 +392,63 @@ void ImportHDF5Dataset::dataCheck()
   // The sentinel will close the HDF5 File and any groups that were open.
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5HyperslabRegion ImportHDF5Dataset::cropAttributeMatrixToRegion(AttributeMatrix& am)
+{
+  std::vector<size_t> fullTupleDims = am.getTupleDimensions();
+  if(fullTupleDims.size() != 3)
+  {
+    QString ss = tr("A sub-volume can only be read into an Attribute Matrix with 3 tuple dimensions, but '%1' has %2.").arg(am.getName()).arg(fullTupleDims.size());
+    setErrorCondition(-20011, ss);
+    return {};
+  }
+
+  for(size_t i = 0; i < 3; i++)
+  {
+    if(m_RegionMinIndex[i] < 0 || m_RegionMaxIndex[i] < m_RegionMinIndex[i] || m_RegionStride[i] < 1)
+    {
+      QString ss = tr("The sub-volume bounds are invalid. Each minimum index must be at least 0 and at most the maximum index, and each stride must be at least 1.");
+      setErrorCondition(-20012, ss);
+      return {};
+    }
+  }
+
+  SizeVec3Type minIndex(static_cast<size_t>(m_RegionMinIndex[0]), static_cast<size_t>(m_RegionMinIndex[1]), static_cast<size_t>(m_RegionMinIndex[2]));
+  SizeVec3Type maxIndex(static_cast<size_t>(m_RegionMaxIndex[0]), static_cast<size_t>(m_RegionMaxIndex[1]), static_cast<size_t>(m_RegionMaxIndex[2]));
+  SizeVec3Type stride(static_cast<size_t>(m_RegionStride[0]), static_cast<size_t>(m_RegionStride[1]), static_cast<size_t>(m_RegionStride[2]));
+  H5HyperslabRegion region = H5HyperslabRegion::FromImageIndexBounds(minIndex, maxIndex, stride);
+  if(!region.fitsWithin(fullTupleDims))
+  {
+    QString ss = tr("The sub-volume bounds lie outside of the Attribute Matrix dimensions (%1, %2, %3).").arg(fullTupleDims[0]).arg(fullTupleDims[1]).arg(fullTupleDims[2]);
+    setErrorCondition(-20012, ss);
+    return {};
+  }
+
+  // Arrays that are already in the Attribute Matrix can not be cropped by this filter
+  if(am.getNumAttributeArrays() > 0)
+  {
+    QString ss = tr("A sub-volume can only be read into an empty Attribute Matrix, but '%1' already contains %2 arrays.").arg(am.getName()).arg(am.getNumAttributeArrays());
+    setErrorCondition(-20013, ss);
+    return {};
+  }
+
+  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(m_SelectedAttributeMatrix.getDataContainerName());
+  ImageGeom::Pointer imageGeom = (nullptr == dc) ? ImageGeom::NullPointer() : dc->getGeometryAs<ImageGeom>();
+  if(nullptr != imageGeom && am.getType() == AttributeMatrix::Type::Cell)
+  {
+    SizeVec3Type geomDims = imageGeom->getDimensions();
+    if(geomDims[0] == fullTupleDims[0] && geomDims[1] == fullTupleDims[1] && geomDims[2] == fullTupleDims[2])
+    {
+      region.cropImageGeometry(*imageGeom);
+    }
+  }
+  am.setTupleDimensions(region.getTupleDims());
+
+  return region;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -569,6 +667,10 @@ AbstractFilter::Pointer ImportHDF5Dataset::newFilterInstance(bool copyFilterPara
     filter->setHDF5FilePath(getHDF5FilePath());
     filter->setDatasetImportInfoList(getDatasetImportInfoList());
     filter->setSelectedAttributeMatrix(getSelectedAttributeMatrix());
+    filter->setUseRegion(getUseRegion());
+    filter->setRegionMinIndex(getRegionMinIndex());
+    filter->setRegionMaxIndex(getRegionMaxIndex());
+    filter->setRegionStride(getRegionStride());
   }
   return filter;
 }
@@ -697,6 +799,54 @@ DataArrayPath ImportHDF5Dataset::getSelectedAttributeMatrix() const
   return m_SelectedAttributeMatrix;
 }
 
+// -----------------------------------------------------------------------------
+void ImportHDF5Dataset::setUseRegion(bool value)
+{
+  m_UseRegion = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ImportHDF5Dataset::getUseRegion() const
+{
+  return m_UseRegion;
+}
+
+// -----------------------------------------------------------------------------
+void ImportHDF5Dataset::setRegionMinIndex(const IntVec3Type& value)
+{
+  m_RegionMinIndex = value;
+}
+
+// -----------------------------------------------------------------------------
+IntVec3Type ImportHDF5Dataset::getRegionMinIndex() const
+{
+  return m_RegionMinIndex;
+}
+
+// -----------------------------------------------------------------------------
+void ImportHDF5Dataset::setRegionMaxIndex(const IntVec3Type& value)
+{
+  m_RegionMaxIndex = value;
+}
+
+// -----------------------------------------------------------------------------
+IntVec3Type ImportHDF5Dataset::getRegionMaxIndex() const
+{
+  return m_RegionMaxIndex;
+}
+
+// -----------------------------------------------------------------------------
+void ImportHDF5Dataset::setRegionStride(const IntVec3Type& value)
+{
+  m_RegionStride = value;
+}
+
+// -----------------------------------------------------------------------------
+IntVec3Type ImportHDF5Dataset::getRegionStride() const
+{
+  return m_RegionStride;
+}
+
 // -----------------------------------------------------------------------------
 void ImportHDF5Dataset::setDatasetPathsWithErrors(const QStringList& value)
 {
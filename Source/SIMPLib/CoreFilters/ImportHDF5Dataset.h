@@ -39,8 +39,11 @@
 #include <QtCore/QJsonObject>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLArray.hpp"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/HDF5/H5HyperslabRegion.h"
 
+class AttributeMatrix;
 class IDataArray;
 using IDataArrayShPtrType = std::shared_ptr<IDataArray>;
 
@@ -59,6 +62,10 @@ class SIMPLib_EXPORT ImportHDF5Dataset : public AbstractFilter
   PYB11_PROPERTY(QString HDF5FilePath READ getHDF5FilePath WRITE setHDF5FilePath)
   PYB11_PROPERTY(QList<ImportHDF5Dataset::DatasetImportInfo> DatasetImportInfoList READ getDatasetImportInfoList WRITE setDatasetImportInfoList)
   PYB11_PROPERTY(DataArrayPath SelectedAttributeMatrix READ getSelectedAttributeMatrix WRITE setSelectedAttributeMatrix)
+  PYB11_PROPERTY(bool UseRegion READ getUseRegion WRITE setUseRegion)
+  PYB11_PROPERTY(IntVec3Type RegionMinIndex READ getRegionMinIndex WRITE setRegionMinIndex)
+  PYB11_PROPERTY(IntVec3Type RegionMaxIndex READ getRegionMaxIndex WRITE setRegionMaxIndex)
+  PYB11_PROPERTY(IntVec3Type RegionStride READ getRegionStride WRITE setRegionStride)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -146,6 +153,54 @@ public:
 
   Q_PROPERTY(DataArrayPath SelectedAttributeMatrix READ getSelectedAttributeMatrix WRITE setSelectedAttributeMatrix)
 
+  /**
+   * @brief Setter property for UseRegion
+   */
+  void setUseRegion(bool value);
+  /**
+   * @brief Getter property for UseRegion
+   * @return Value of UseRegion
+   */
+  bool getUseRegion() const;
+
+  Q_PROPERTY(bool UseRegion READ getUseRegion WRITE setUseRegion)
+
+  /**
+   * @brief Setter property for RegionMinIndex
+   */
+  void setRegionMinIndex(const IntVec3Type& value);
+  /**
+   * @brief Getter property for RegionMinIndex
+   * @return Value of RegionMinIndex
+   */
+  IntVec3Type getRegionMinIndex() const;
+
+  Q_PROPERTY(IntVec3Type RegionMinIndex READ getRegionMinIndex WRITE setRegionMinIndex)
+
+  /**
+   * @brief Setter property for RegionMaxIndex
+   */
+  void setRegionMaxIndex(const IntVec3Type& value);
+  /**
+   * @brief Getter property for RegionMaxIndex
+   * @return Value of RegionMaxIndex
+   */
+  IntVec3Type getRegionMaxIndex() const;
+
+  Q_PROPERTY(IntVec3Type RegionMaxIndex READ getRegionMaxIndex WRITE setRegionMaxIndex)
+
+  /**
+   * @brief Setter property for RegionStride
+   */
+  void setRegionStride(const IntVec3Type& value);
+  /**
+   * @brief Getter property for RegionStride
+   * @return Value of RegionStride
+   */
+  IntVec3Type getRegionStride() const;
+
+  Q_PROPERTY(IntVec3Type RegionStride READ getRegionStride WRITE setRegionStride)
+
   /**
    * @brief Setter property for DatasetPathsWithErrors
    */
@@ -229,9 +284,21 @@ private:
   QList<ImportHDF5Dataset::DatasetImportInfo> m_DatasetImportInfoList = {};
   DataArrayPath m_SelectedAttributeMatrix = {};
   QStringList m_DatasetPathsWithErrors = {};
+  bool m_UseRegion = {false};
+  IntVec3Type m_RegionMinIndex = {0, 0, 0};
+  IntVec3Type m_RegionMaxIndex = {0, 0, 0};
+  IntVec3Type m_RegionStride = {1, 1, 1};
 
   IDataArrayShPtrType readIDataArray(hid_t gid, const QString& name, size_t numOfTuples, const std::vector<size_t>& cDims, bool metaDataOnly);
 
+  /**
+   * @brief Checks the region parameters against the selected Attribute Matrix and, if they are valid,
+   * shrinks the Attribute Matrix (and its Image Geometry) to the region.
+   * @param am The selected Attribute Matrix, whose tuple dimensions describe the full datasets
+   * @return The region to read, or an empty region if an error was set
+   */
+  H5HyperslabRegion cropAttributeMatrixToRegion(AttributeMatrix& am);
+
   /**
    * @brief createComponentDimensions
    * @return
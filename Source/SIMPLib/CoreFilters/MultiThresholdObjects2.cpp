@@ -34,10 +34,16 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "MultiThresholdObjects2.h"
 
+#include <algorithm>
+#include <functional>
+#include <vector>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
@@ -45,13 +51,255 @@
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
-#include "SIMPLib/Filtering/ThresholdFilterHelper.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
   ThresholdArrayID = 1
 };
 
+namespace
+{
+/**
+ * @brief Number of tuples that are evaluated together by the fused threshold kernel. This keeps
+ * the intermediate results of every nesting level of the comparison tree resident in cache.
+ */
+constexpr size_t k_ThresholdTileSize = 4096;
+
+/**
+ * @brief Evaluates a single ComparisonValue over a contiguous run of tuples, writing 0 or 1 into output
+ */
+using ThresholdKernel = std::function<void(size_t start, size_t count, uint8_t* output)>;
+
+/**
+ * @brief The ThresholdNode struct is the compiled form of a ComparisonSet or ComparisonValue. Values hold
+ * a kernel that is already specialized for the type of their input array, sets hold their children.
+ */
+struct ThresholdNode
+{
+  int32_t unionOperator = SIMPL::Union::Operator_And;
+  bool invert = false;
+  ThresholdKernel kernel;
+  std::vector<ThresholdNode> children;
+};
+
+/**
+ * @brief Creates the kernel for a single comparison using the comparison functor CompareOp
+ */
+template <typename T, typename CompareOp>
+ThresholdKernel createComparisonKernel(const T* data, T value)
+{
+  return [data, value](size_t start, size_t count, uint8_t* output) {
+    CompareOp compare;
+    const T* input = data + start;
+    for(size_t i = 0; i < count; i++)
+    {
+      output[i] = static_cast<uint8_t>(compare(input[i], value));
+    }
+  };
+}
+
+/**
+ * @brief Resolves the data type and comparison operator of a ComparisonValue once so the per tuple loop
+ * is branch free. Unknown operators never match, which is the same result the original helper produced.
+ */
+template <typename T>
+void createThresholdKernel(const IDataArray::Pointer& inputArray, int32_t compOperator, double compValue, ThresholdKernel& kernel)
+{
+  const T* data = std::dynamic_pointer_cast<DataArray<T>>(inputArray)->getPointer(0);
+  T value = static_cast<T>(compValue);
+
+  switch(compOperator)
+  {
+  case SIMPL::Comparison::Operator_LessThan:
+    kernel = createComparisonKernel<T, std::less<T>>(data, value);
+    break;
+  case SIMPL::Comparison::Operator_GreaterThan:
+    kernel = createComparisonKernel<T, std::greater<T>>(data, value);
+    break;
+  case SIMPL::Comparison::Operator_Equal:
+    kernel = createComparisonKernel<T, std::equal_to<T>>(data, value);
+    break;
+  case SIMPL::Comparison::Operator_NotEqual:
+    kernel = createComparisonKernel<T, std::not_equal_to<T>>(data, value);
+    break;
+  default:
+    kernel = [](size_t start, size_t count, uint8_t* output) { std::fill_n(output, count, static_cast<uint8_t>(0)); };
+    break;
+  }
+}
+
+/**
+ * @brief Compiles a ComparisonSet or ComparisonValue into a ThresholdNode. Returns false if the comparison
+ * should be skipped or an error was set on the filter.
+ */
+bool compileThreshold(AbstractFilter* filter, const AbstractComparison::Pointer& comparison, const AttributeMatrix::Pointer& attrMat, const DataArrayPath& amPath, ThresholdNode& node)
+{
+  if(std::dynamic_pointer_cast<ComparisonSet>(comparison))
+  {
+    ComparisonSet::Pointer comparisonSet = std::dynamic_pointer_cast<ComparisonSet>(comparison);
+    node.unionOperator = comparisonSet->getUnionOperator();
+    node.invert = comparisonSet->getInvertComparison();
+
+    QVector<AbstractComparison::Pointer> comparisons = comparisonSet->getComparisons();
+    for(const auto& childComparison : comparisons)
+    {
+      ThresholdNode child;
+      if(compileThreshold(filter, childComparison, attrMat, amPath, child))
+      {
+        node.children.push_back(std::move(child));
+      }
+      else if(filter->getErrorCode() < 0)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  if(std::dynamic_pointer_cast<ComparisonValue>(comparison))
+  {
+    ComparisonValue::Pointer comparisonValue = std::dynamic_pointer_cast<ComparisonValue>(comparison);
+    node.unionOperator = comparisonValue->getUnionOperator();
+
+    IDataArray::Pointer inputArray = attrMat->getAttributeArray(comparisonValue->getAttributeArrayName());
+    if(nullptr != inputArray)
+    {
+      int32_t compOperator = comparisonValue->getCompOperator();
+      double compValue = comparisonValue->getCompValue();
+      EXECUTE_FUNCTION_TEMPLATE(filter, createThresholdKernel, inputArray, inputArray, compOperator, compValue, node.kernel)
+    }
+    if(nullptr == inputArray || filter->getErrorCode() < 0)
+    {
+      DataArrayPath tempPath(amPath.getDataContainerName(), amPath.getAttributeMatrixName(), comparisonValue->getAttributeArrayName());
+      QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
+      filter->setErrorCondition(-13002, ss);
+      return false;
+    }
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * @brief Returns the number of scratch tiles needed to evaluate the node
+ */
+size_t thresholdTreeDepth(const ThresholdNode& node)
+{
+  if(node.kernel)
+  {
+    return 1;
+  }
+  size_t childDepth = 0;
+  for(const auto& child : node.children)
+  {
+    childDepth = std::max(childDepth, thresholdTreeDepth(child));
+  }
+  return 1 + childDepth;
+}
+
+/**
+ * @brief The FusedThresholdImpl class evaluates the complete compiled comparison tree one tile of tuples
+ * at a time and writes the final mask exactly once.
+ */
+class FusedThresholdImpl
+{
+public:
+  FusedThresholdImpl(const ThresholdNode& root, bool* destination)
+  : m_Root(root)
+  , m_Destination(destination)
+  , m_Depth(thresholdTreeDepth(root))
+  {
+  }
+  FusedThresholdImpl(const FusedThresholdImpl&) = default;           // Copy Constructor Not Implemented
+  FusedThresholdImpl(FusedThresholdImpl&&) = default;                // Move Constructor Not Implemented
+  FusedThresholdImpl& operator=(const FusedThresholdImpl&) = delete; // Copy Assignment Not Implemented
+  FusedThresholdImpl& operator=(FusedThresholdImpl&&) = delete;      // Move Assignment Not Implemented
+  ~FusedThresholdImpl() = default;
+
+  void convert(size_t start, size_t end) const
+  {
+    // One tile per nesting level of the tree, the root result lives in the first tile
+    std::vector<uint8_t> scratch(m_Depth * k_ThresholdTileSize);
+    const uint8_t* result = scratch.data();
+    for(size_t tileStart = start; tileStart < end; tileStart += k_ThresholdTileSize)
+    {
+      size_t count = std::min(k_ThresholdTileSize, end - tileStart);
+      evaluateSet(m_Root, tileStart, count, scratch.data());
+      for(size_t i = 0; i < count; i++)
+      {
+        m_Destination[tileStart + i] = (result[i] != 0);
+      }
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    convert(range.min(), range.max());
+  }
+
+private:
+  const ThresholdNode& m_Root;
+  bool* m_Destination;
+  size_t m_Depth;
+
+  /**
+   * @brief Evaluates a set into output. The tiles after output are used for the results of its children.
+   */
+  void evaluateSet(const ThresholdNode& node, size_t start, size_t count, uint8_t* output) const
+  {
+    uint8_t* childOutput = output + k_ThresholdTileSize;
+    if(node.children.empty())
+    {
+      std::fill_n(output, count, static_cast<uint8_t>(0));
+    }
+
+    // The first child replaces the current result and its union operator is ignored
+    bool firstValueFound = false;
+    for(const auto& child : node.children)
+    {
+      uint8_t* target = firstValueFound ? childOutput : output;
+      if(child.kernel)
+      {
+        child.kernel(start, count, target);
+      }
+      else
+      {
+        evaluateSet(child, start, count, target);
+      }
+
+      if(!firstValueFound)
+      {
+        firstValueFound = true;
+      }
+      else if(SIMPL::Union::Operator_Or == child.unionOperator)
+      {
+        for(size_t i = 0; i < count; i++)
+        {
+          output[i] |= childOutput[i];
+        }
+      }
+      else
+      {
+        for(size_t i = 0; i < count; i++)
+        {
+          output[i] &= childOutput[i];
+        }
+      }
+    }
+
+    if(node.invert)
+    {
+      for(size_t i = 0; i < count; i++)
+      {
+        output[i] ^= 1;
+      }
+    }
+  }
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -181,14 +429,13 @@ void MultiThresholdObjects2::execute()
     return;
   }
 
-  // Get the first comparison object
-  AbstractComparison::Pointer comp_0 = m_SelectedThresholds[0];
   // Get the names of the Data Container and AttributeMatrix for later
   QString dcName = m_SelectedThresholds.getDataContainerName();
   QString amName = m_SelectedThresholds.getAttributeMatrixName();
 
   DataContainerArray::Pointer dca = getDataContainerArray();
-  DataContainer::Pointer m = dca->getDataContainer(dcName);
+  AttributeMatrix::Pointer attrMat = dca->getDataContainer(dcName)->getAttributeMatrix(amName);
+  DataArrayPath amPath(dcName, amName, "");
 
   // At least one threshold value is required
   if(!m_SelectedThresholds.hasComparisonValue())
@@ -198,221 +445,27 @@ void MultiThresholdObjects2::execute()
     return;
   }
 
-  bool invert = m_SelectedThresholds.shouldInvert();
-
-  int64_t thresholdSize;
-  BoolArrayType::Pointer thresholdArray;
-
-  createBoolArray(thresholdSize, thresholdArray);
-  bool firstValueFound = false;
-
-  int32_t err = 0;
-
-  // Loop on the remaining Comparison objects updating our final result array as we go
-  for(int32_t i = 0; i < m_SelectedThresholds.size() && err >= 0; ++i)
-  {
-    if(std::dynamic_pointer_cast<ComparisonSet>(m_SelectedThresholds[i]))
-    {
-      ComparisonSet::Pointer comparisonSet = std::dynamic_pointer_cast<ComparisonSet>(m_SelectedThresholds[i]);
-      thresholdSet(comparisonSet, thresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-    else if(std::dynamic_pointer_cast<ComparisonValue>(m_SelectedThresholds[i]))
-    {
-      ComparisonValue::Pointer comparisonValue = std::dynamic_pointer_cast<ComparisonValue>(m_SelectedThresholds[i]);
-      thresholdValue(comparisonValue, thresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-  }
-
-  if(invert)
-  {
-    invertThreshold(thresholdSize, thresholdArray);
-  }
-
-  bool* threshold = thresholdArray->getPointer(0);
-  for(int64_t p = 0; p < thresholdSize; p++)
-  {
-    m_Destination[p] = threshold[p];
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::createBoolArray(int64_t& totalTuples, BoolArrayType::Pointer& thresholdArrayPtr)
-{
-  // Get the names of the Data Container and AttributeMatrix for later
-  QString dcName = m_SelectedThresholds.getDataContainerName();
-  QString amName = m_SelectedThresholds.getAttributeMatrixName();
-
-  DataContainerArray::Pointer dca = getDataContainerArray();
-  DataContainer::Pointer m = dca->getDataContainer(dcName);
-
-  // Get the total number of tuples, create and initialize an array to use for these results
-  totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-  thresholdArrayPtr = BoolArrayType::CreateArray(totalTuples, std::string("_INTERNAL_USE_ONLY_TEMP"), true);
-
-  // Initialize the array to false
-  thresholdArrayPtr->initializeWithZeros();
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::insertThreshold(int64_t numItems, BoolArrayType::Pointer currentArrayPtr, int unionOperator, const BoolArrayType::Pointer newArrayPtr, bool inverse)
-{
-  bool* newArray = newArrayPtr->getPointer(0);
-  bool* currentArray = currentArrayPtr->getPointer(0);
-
-  for(int64_t i = 0; i < numItems; i++)
-  {
-    // invert the current comparison if necessary
-    if(inverse)
-    {
-      newArray[i] = !newArray[i];
-    }
-
-    if(SIMPL::Union::Operator_Or == unionOperator)
-    {
-      currentArray[i] = currentArray[i] || newArray[i];
-    }
-    else if(!currentArray[i] || !newArray[i])
-    {
-      currentArray[i] = false;
-    }
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::invertThreshold(int64_t numItems, BoolArrayType::Pointer thresholdArray)
-{
-  bool* threshold = thresholdArray->getPointer(0);
-
-  for(int64_t i = 0; i < numItems; i++)
-  {
-    threshold[i] = !threshold[i];
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::thresholdSet(ComparisonSet::Pointer comparisonSet, BoolArrayType::Pointer& currentThreshold, int32_t& err, bool replaceInput, bool inverse)
-{
-  if(nullptr == comparisonSet)
-  {
-    return;
-  }
-
-  if(inverse)
-  {
-    inverse = !comparisonSet->getInvertComparison();
-  }
-  else
+  // Compile the whole comparison tree up front so the data types are only resolved once. The
+  // top level of the tree behaves like a ComparisonSet whose inversion is controlled by the inputs.
+  ThresholdNode root;
+  root.invert = m_SelectedThresholds.shouldInvert();
+  for(int32_t i = 0; i < m_SelectedThresholds.size(); ++i)
   {
-    inverse = comparisonSet->getInvertComparison();
-  }
-
-  int64_t setArraySize;
-  BoolArrayType::Pointer setThresholdArray;
-
-  createBoolArray(setArraySize, setThresholdArray);
-  bool firstValueFound = false;
-
-  QVector<AbstractComparison::Pointer> comparisons = comparisonSet->getComparisons();
-  for(int i = 0; i < comparisons.size(); i++)
-  {
-    // Check all contents of child Comparison Sets
-    if(std::dynamic_pointer_cast<ComparisonSet>(comparisons.at(i)))
-    {
-      ComparisonSet::Pointer childSet = std::dynamic_pointer_cast<ComparisonSet>(comparisons.at(i));
-      thresholdSet(childSet, setThresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-    // Check Comparison Values
-    if(std::dynamic_pointer_cast<ComparisonValue>(comparisons.at(i)))
+    ThresholdNode child;
+    if(compileThreshold(this, m_SelectedThresholds[i], attrMat, amPath, child))
     {
-      ComparisonValue::Pointer childValue = std::dynamic_pointer_cast<ComparisonValue>(comparisons.at(i));
-      thresholdValue(childValue, setThresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
+      root.children.push_back(std::move(child));
     }
-
-    if(err < 0)
+    else if(getErrorCode() < 0)
     {
       return;
     }
   }
 
-  if(replaceInput)
-  {
-    if(inverse)
-    {
-      invertThreshold(setArraySize, setThresholdArray);
-    }
-    currentThreshold.swap(setThresholdArray);
-  }
-  else
-  {
-    // insert into current threshold
-    insertThreshold(setArraySize, currentThreshold, comparisonSet->getUnionOperator(), setThresholdArray, inverse);
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::thresholdValue(ComparisonValue::Pointer comparisonValue, BoolArrayType::Pointer& inputThreshold, int32_t& err, bool replaceInput, bool inverse)
-{
-  if(nullptr == comparisonValue)
-  {
-    return;
-  }
-
-  // Get the names of the Data Container and AttributeMatrix for later
-  QString dcName = m_SelectedThresholds.getDataContainerName();
-  QString amName = m_SelectedThresholds.getAttributeMatrixName();
-
-  DataContainerArray::Pointer dca = getDataContainerArray();
-  DataContainer::Pointer m = dca->getDataContainer(dcName);
-
-  // Get the total number of tuples, create and initialize an array to use for these results
-  int64_t totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-  BoolArrayType::Pointer currentArrayPtr = BoolArrayType::CreateArray(totalTuples, std::string("_INTERNAL_USE_ONLY_TEMP"), true);
-
-  // Initialize the array to false
-  currentArrayPtr->initializeWithZeros();
-
-  // bool* currentArray = currentArrayPtr->getPointer(0);
-  int compOperator = comparisonValue->getCompOperator();
-  double compValue = comparisonValue->getCompValue();
-
-  ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(compOperator), compValue, currentArrayPtr.get());
-
-  err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(comparisonValue->getAttributeArrayName()), currentArrayPtr.get());
-  if(err < 0)
-  {
-    DataArrayPath tempPath(m_SelectedThresholds.getDataContainerName(), m_SelectedThresholds.getAttributeMatrixName(), comparisonValue->getAttributeArrayName());
-    QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
-    setErrorCondition(-13002, ss);
-    return;
-  }
-
-  if(replaceInput)
-  {
-    if(inverse)
-    {
-      invertThreshold(totalTuples, currentArrayPtr);
-    }
-    inputThreshold.swap(currentArrayPtr);
-  }
-  else
-  {
-    // insert into current threshold
-    insertThreshold(totalTuples, inputThreshold, comparisonValue->getUnionOperator(), currentArrayPtr, inverse);
-  }
+  size_t totalTuples = attrMat->getNumberOfTuples();
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, totalTuples);
+  dataAlg.execute(FusedThresholdImpl(root, m_Destination));
 }
 
 // -----------------------------------------------------------------------------
@@ -0,0 +1,485 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ReorderUnstructuredGeometry.h"
+
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/SIMPLibVersion.h"
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
+#include "SIMPLib/FilterParameters/DataArrayCreationFilterParameter.h"
+#include "SIMPLib/FilterParameters/DataContainerSelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
+#include "SIMPLib/Geometry/EdgeGeom.h"
+#include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/IGeometry2D.h"
+#include "SIMPLib/Geometry/IGeometry3D.h"
+
+enum createdPathID : RenameDataPath::DataID_t
+{
+  DataArrayID31 = 31,
+  DataArrayID32 = 32
+};
+
+namespace
+{
+// -----------------------------------------------------------------------------
+size_t NumberOfVertices(const IGeometry& geometry)
+{
+  if(const auto* edgeGeom = dynamic_cast<const EdgeGeom*>(&geometry))
+  {
+    return edgeGeom->getNumberOfVertices();
+  }
+  if(const auto* geom2D = dynamic_cast<const IGeometry2D*>(&geometry))
+  {
+    return geom2D->getNumberOfVertices();
+  }
+  if(const auto* geom3D = dynamic_cast<const IGeometry3D*>(&geometry))
+  {
+    return geom3D->getNumberOfVertices();
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+// The AttributeMatrix type that holds one tuple per element of the geometry
+AttributeMatrix::Type ElementAttributeMatrixType(IGeometry::Type geomType)
+{
+  switch(geomType)
+  {
+  case IGeometry::Type::Edge:
+    return AttributeMatrix::Type::Edge;
+  case IGeometry::Type::Triangle:
+  case IGeometry::Type::Quad:
+    return AttributeMatrix::Type::Face;
+  case IGeometry::Type::Tetrahedral:
+  case IGeometry::Type::Hexahedral:
+    return AttributeMatrix::Type::Cell;
+  default:
+    return AttributeMatrix::Type::Unknown;
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ReorderUnstructuredGeometry::ReorderUnstructuredGeometry()
+{
+  initialize();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ReorderUnstructuredGeometry::~ReorderUnstructuredGeometry() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReorderUnstructuredGeometry::initialize()
+{
+  clearErrorCode();
+  clearWarningCode();
+  setCancel(false);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReorderUnstructuredGeometry::setupFilterParameters()
+{
+  FilterParameterVectorType parameters;
+  {
+    std::vector<QString> choices = {"Morton (Z-Order)", "Hilbert"};
+    parameters.push_back(SIMPL_NEW_CHOICE_FP("Space Filling Curve", CurveType, FilterParameter::Category::Parameter, ReorderUnstructuredGeometry, choices, false));
+  }
+  std::vector<QString> linkedProps = {"OriginalVertexIdsArrayPath", "OriginalElementIdsArrayPath"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save Original Ids", SaveOriginalIds, FilterParameter::Category::Parameter, ReorderUnstructuredGeometry, linkedProps));
+  {
+    DataContainerSelectionFilterParameter::RequirementType req;
+    req.dcGeometryTypes = {IGeometry::Type::Edge, IGeometry::Type::Triangle, IGeometry::Type::Quad, IGeometry::Type::Tetrahedral, IGeometry::Type::Hexahedral};
+    parameters.push_back(SIMPL_NEW_DC_SELECTION_FP("Data Container", DataContainerName, FilterParameter::Category::RequiredArray, ReorderUnstructuredGeometry, req));
+  }
+  {
+    DataArrayCreationFilterParameter::RequirementType req;
+    req.amTypes = {AttributeMatrix::Type::Vertex};
+    parameters.push_back(SIMPL_NEW_DA_CREATION_FP("Original Vertex Ids", OriginalVertexIdsArrayPath, FilterParameter::Category::CreatedArray, ReorderUnstructuredGeometry, req));
+  }
+  {
+    DataArrayCreationFilterParameter::RequirementType req;
+    req.amTypes = {AttributeMatrix::Type::Edge, AttributeMatrix::Type::Face, AttributeMatrix::Type::Cell};
+    parameters.push_back(SIMPL_NEW_DA_CREATION_FP("Original Element Ids", OriginalElementIdsArrayPath, FilterParameter::Category::CreatedArray, ReorderUnstructuredGeometry, req));
+  }
+  setFilterParameters(parameters);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReorderUnstructuredGeometry::dataCheck()
+{
+  clearErrorCode();
+  clearWarningCode();
+  m_OriginalVertexIdsPtr = Int64ArrayType::NullPointer();
+  m_OriginalElementIdsPtr = Int64ArrayType::NullPointer();
+
+  if(getCurveType() < 0 || getCurveType() > 1)
+  {
+    QString ss = QObject::tr("The space filling curve must be 0 (Morton) or 1 (Hilbert). The value given was %1").arg(getCurveType());
+    setErrorCondition(-5560, ss);
+    return;
+  }
+
+  DataContainer::Pointer dc = getDataContainerArray()->getPrereqDataContainer(this, getDataContainerName());
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
+  IGeometry::Pointer geometry = dc->getGeometry();
+  if(nullptr == geometry)
+  {
+    QString ss = QObject::tr("The Data Container '%1' does not contain a Geometry").arg(getDataContainerName().getDataContainerName());
+    setErrorCondition(-5561, ss);
+    return;
+  }
+
+  AttributeMatrix::Type elementAmType = ElementAttributeMatrixType(geometry->getGeometryType());
+  if(AttributeMatrix::Type::Unknown == elementAmType)
+  {
+    QString ss = QObject::tr("The Geometry must be an Edge, Triangle, Quadrilateral, Tetrahedral or Hexahedral Geometry. The Geometry is of type %1").arg(geometry->getGeometryTypeAsString());
+    setErrorCondition(-5562, ss);
+    return;
+  }
+
+  // Every Vertex and element AttributeMatrix is permuted along with the geometry, so each must have one tuple per
+  // vertex or element. Edge and Face data on 3D geometries (and Edge data on 2D geometries) describe lists that are
+  // found again in the new order, so they are left as they are.
+  size_t numVerts = NumberOfVertices(*geometry);
+  size_t numElements = geometry->getNumberOfElements();
+  for(const auto& am : dc->getAttributeMatrices())
+  {
+    if(am->getType() == AttributeMatrix::Type::Vertex && am->getNumberOfTuples() != numVerts)
+    {
+      QString ss = QObject::tr("The Vertex Attribute Matrix '%1' has %2 tuples but the Geometry has %3 vertices").arg(am->getName()).arg(am->getNumberOfTuples()).arg(numVerts);
+      setErrorCondition(-5563, ss);
+    }
+    else if(am->getType() == elementAmType && am->getNumberOfTuples() != numElements)
+    {
+      QString ss = QObject::tr("The Attribute Matrix '%1' has %2 tuples but the Geometry has %3 elements").arg(am->getName()).arg(am->getNumberOfTuples()).arg(numElements);
+      setErrorCondition(-5564, ss);
+    }
+    else if(am->getType() == AttributeMatrix::Type::Edge || am->getType() == AttributeMatrix::Type::Face)
+    {
+      if(am->getType() != elementAmType)
+      {
+        QString ss = QObject::tr("The Attribute Matrix '%1' is not reordered. The shared edge and face lists of the Geometry are deleted and will be found again in the new order.").arg(am->getName());
+        setWarningCondition(-5565, ss);
+      }
+    }
+  }
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
+  if(getSaveOriginalIds())
+  {
+    // Only the AttributeMatrices of this Data Container are known to have one tuple per vertex or element
+    const QString dcName = getDataContainerName().getDataContainerName();
+    if(getOriginalVertexIdsArrayPath().getDataContainerName() != dcName || getOriginalElementIdsArrayPath().getDataContainerName() != dcName)
+    {
+      QString ss = QObject::tr("The Original Vertex Ids and Original Element Ids must be created in the Data Container '%1'").arg(dcName);
+      setErrorCondition(-5571, ss);
+      return;
+    }
+    AttributeMatrix::Pointer vertAm = getDataContainerArray()->getPrereqAttributeMatrixFromPath(this, getOriginalVertexIdsArrayPath(), -5566);
+    AttributeMatrix::Pointer elemAm = getDataContainerArray()->getPrereqAttributeMatrixFromPath(this, getOriginalElementIdsArrayPath(), -5567);
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+    if(vertAm->getType() != AttributeMatrix::Type::Vertex)
+    {
+      QString ss = QObject::tr("The Original Vertex Ids must be created in a Vertex Attribute Matrix");
+      setErrorCondition(-5568, ss);
+    }
+    if(elemAm->getType() != elementAmType)
+    {
+      QString ss = QObject::tr("The Original Element Ids must be created in an Attribute Matrix of the element type of the Geometry");
+      setErrorCondition(-5569, ss);
+    }
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+
+    m_OriginalVertexIdsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<Int64ArrayType>(this, getOriginalVertexIdsArrayPath(), -1, {1}, "", DataArrayID31);
+    m_OriginalElementIdsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<Int64ArrayType>(this, getOriginalElementIdsArrayPath(), -1, {1}, "", DataArrayID32);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReorderUnstructuredGeometry::execute()
+{
+  initialize();
+  dataCheck();
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
+  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getDataContainerName());
+  IGeometry::Pointer geometry = dc->getGeometry();
+
+  std::vector<MeshIndexType> vertexOrder;
+  std::vector<MeshIndexType> elementOrder;
+  auto curve = static_cast<GeometryHelpers::Reordering::Curve>(getCurveType());
+  if(!GeometryHelpers::Reordering::ReorderGeometry(geometry.get(), curve, vertexOrder, elementOrder))
+  {
+    QString ss = QObject::tr("The Geometry does not have a vertex and element list to reorder");
+    setErrorCondition(-5570, ss);
+    return;
+  }
+
+  notifyStatusMessage("Permuting Attribute Matrices");
+  AttributeMatrix::Type elementAmType = ElementAttributeMatrixType(geometry->getGeometryType());
+  for(const auto& am : dc->getAttributeMatrices())
+  {
+    const std::vector<MeshIndexType>* order = nullptr;
+    if(am->getType() == AttributeMatrix::Type::Vertex)
+    {
+      order = &vertexOrder;
+    }
+    else if(am->getType() == elementAmType)
+    {
+      order = &elementOrder;
+    }
+    if(nullptr == order)
+    {
+      continue;
+    }
+    for(const auto& array : *am)
+    {
+      if(getCancel())
+      {
+        return;
+      }
+      if(!GeometryHelpers::Reordering::PermuteTuples(array.get(), *order))
+      {
+        QString ss = QObject::tr("The array '%1' in the Attribute Matrix '%2' could not be reordered").arg(array->getName()).arg(am->getName());
+        setErrorCondition(-5572, ss);
+        return;
+      }
+    }
+  }
+
+  // The id arrays live in the permuted AttributeMatrices, so they are filled last
+  if(getSaveOriginalIds())
+  {
+    for(size_t i = 0; i < vertexOrder.size(); i++)
+    {
+      m_OriginalVertexIdsPtr->setValue(i, static_cast<int64_t>(vertexOrder[i]));
+    }
+    for(size_t i = 0; i < elementOrder.size(); i++)
+    {
+      m_OriginalElementIdsPtr->setValue(i, static_cast<int64_t>(elementOrder[i]));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer ReorderUnstructuredGeometry::newFilterInstance(bool copyFilterParameters) const
+{
+  ReorderUnstructuredGeometry::Pointer filter = ReorderUnstructuredGeometry::New();
+  if(copyFilterParameters)
+  {
+    copyFilterParameterInstanceVariables(filter.get());
+  }
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ReorderUnstructuredGeometry::getCompiledLibraryName() const
+{
+  return Core::CoreBaseName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ReorderUnstructuredGeometry::getBrandingString() const
+{
+  return "SIMPLib Core Filter";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ReorderUnstructuredGeometry::getFilterVersion() const
+{
+  QString version;
+  QTextStream vStream(&version);
+  vStream << SIMPLib::Version::Major() << "." << SIMPLib::Version::Minor() << "." << SIMPLib::Version::Patch();
+  return version;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ReorderUnstructuredGeometry::getGroupName() const
+{
+  return SIMPL::FilterGroups::CoreFilters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ReorderUnstructuredGeometry::getSubGroupName() const
+{
+  return SIMPL::FilterSubGroups::GeometryFilters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ReorderUnstructuredGeometry::getHumanLabel() const
+{
+  return "Reorder Unstructured Geometry";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QUuid ReorderUnstructuredGeometry::getUuid() const
+{
+  return QUuid("{5efae250-3d8e-4adc-a30d-615236c77bf6}");
+}
+
+// -----------------------------------------------------------------------------
+ReorderUnstructuredGeometry::Pointer ReorderUnstructuredGeometry::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+std::shared_ptr<ReorderUnstructuredGeometry> ReorderUnstructuredGeometry::New()
+{
+  struct make_shared_enabler : public ReorderUnstructuredGeometry
+  {
+  };
+  std::shared_ptr<make_shared_enabler> val = std::make_shared<make_shared_enabler>();
+  val->setupFilterParameters();
+  return val;
+}
+
+// -----------------------------------------------------------------------------
+QString ReorderUnstructuredGeometry::getNameOfClass() const
+{
+  return QString("ReorderUnstructuredGeometry");
+}
+
+// -----------------------------------------------------------------------------
+QString ReorderUnstructuredGeometry::ClassName()
+{
+  return QString("ReorderUnstructuredGeometry");
+}
+
+// -----------------------------------------------------------------------------
+void ReorderUnstructuredGeometry::setDataContainerName(const DataArrayPath& value)
+{
+  m_DataContainerName = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath ReorderUnstructuredGeometry::getDataContainerName() const
+{
+  return m_DataContainerName;
+}
+
+// -----------------------------------------------------------------------------
+void ReorderUnstructuredGeometry::setCurveType(int value)
+{
+  m_CurveType = value;
+}
+
+// -----------------------------------------------------------------------------
+int ReorderUnstructuredGeometry::getCurveType() const
+{
+  return m_CurveType;
+}
+
+// -----------------------------------------------------------------------------
+void ReorderUnstructuredGeometry::setSaveOriginalIds(bool value)
+{
+  m_SaveOriginalIds = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ReorderUnstructuredGeometry::getSaveOriginalIds() const
+{
+  return m_SaveOriginalIds;
+}
+
+// -----------------------------------------------------------------------------
+void ReorderUnstructuredGeometry::setOriginalVertexIdsArrayPath(const DataArrayPath& value)
+{
+  m_OriginalVertexIdsArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath ReorderUnstructuredGeometry::getOriginalVertexIdsArrayPath() const
+{
+  return m_OriginalVertexIdsArrayPath;
+}
+
+// -----------------------------------------------------------------------------
+void ReorderUnstructuredGeometry::setOriginalElementIdsArrayPath(const DataArrayPath& value)
+{
+  m_OriginalElementIdsArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath ReorderUnstructuredGeometry::getOriginalElementIdsArrayPath() const
+{
+  return m_OriginalElementIdsArrayPath;
+}
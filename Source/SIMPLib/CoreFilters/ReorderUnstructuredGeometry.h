@@ -0,0 +1,234 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+/**
+ * @brief The ReorderUnstructuredGeometry class. See [Filter documentation](@ref reorderunstructuredgeometry) for details.
+ */
+class SIMPLib_EXPORT ReorderUnstructuredGeometry : public AbstractFilter
+{
+  Q_OBJECT
+
+  // Start Python bindings declarations
+  PYB11_BEGIN_BINDINGS(ReorderUnstructuredGeometry SUPERCLASS AbstractFilter)
+  PYB11_FILTER()
+  PYB11_SHARED_POINTERS(ReorderUnstructuredGeometry)
+  PYB11_FILTER_NEW_MACRO(ReorderUnstructuredGeometry)
+  PYB11_PROPERTY(DataArrayPath DataContainerName READ getDataContainerName WRITE setDataContainerName)
+  PYB11_PROPERTY(int CurveType READ getCurveType WRITE setCurveType)
+  PYB11_PROPERTY(bool SaveOriginalIds READ getSaveOriginalIds WRITE setSaveOriginalIds)
+  PYB11_PROPERTY(DataArrayPath OriginalVertexIdsArrayPath READ getOriginalVertexIdsArrayPath WRITE setOriginalVertexIdsArrayPath)
+  PYB11_PROPERTY(DataArrayPath OriginalElementIdsArrayPath READ getOriginalElementIdsArrayPath WRITE setOriginalElementIdsArrayPath)
+  PYB11_END_BINDINGS()
+  // End Python bindings declarations
+
+public:
+  using Self = ReorderUnstructuredGeometry;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+
+  ~ReorderUnstructuredGeometry() override;
+
+  /**
+   * @brief Returns a NullPointer wrapped by a shared_ptr<>
+   * @return
+   */
+  static Pointer NullPointer();
+
+  /**
+   * @brief Creates a new object wrapped in a shared_ptr<>
+   * @return
+   */
+  static Pointer New();
+
+  /**
+   * @brief Returns the name of the class for ReorderUnstructuredGeometry
+   */
+  QString getNameOfClass() const override;
+  /**
+   * @brief Returns the name of the class for ReorderUnstructuredGeometry
+   */
+  static QString ClassName();
+
+  /**
+   * @brief Setter property for DataContainerName
+   */
+  void setDataContainerName(const DataArrayPath& value);
+  /**
+   * @brief Getter property for DataContainerName
+   * @return Value of DataContainerName
+   */
+  DataArrayPath getDataContainerName() const;
+
+  Q_PROPERTY(DataArrayPath DataContainerName READ getDataContainerName WRITE setDataContainerName)
+
+  /**
+   * @brief Setter property for CurveType. 0 sorts along a Morton (Z-order) curve, 1 along a Hilbert curve.
+   */
+  void setCurveType(int value);
+  /**
+   * @brief Getter property for CurveType
+   * @return Value of CurveType
+   */
+  int getCurveType() const;
+
+  Q_PROPERTY(int CurveType READ getCurveType WRITE setCurveType)
+
+  /**
+   * @brief Setter property for SaveOriginalIds
+   */
+  void setSaveOriginalIds(bool value);
+  /**
+   * @brief Getter property for SaveOriginalIds
+   * @return Value of SaveOriginalIds
+   */
+  bool getSaveOriginalIds() const;
+
+  Q_PROPERTY(bool SaveOriginalIds READ getSaveOriginalIds WRITE setSaveOriginalIds)
+
+  /**
+   * @brief Setter property for OriginalVertexIdsArrayPath
+   */
+  void setOriginalVertexIdsArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for OriginalVertexIdsArrayPath
+   * @return Value of OriginalVertexIdsArrayPath
+   */
+  DataArrayPath getOriginalVertexIdsArrayPath() const;
+
+  Q_PROPERTY(DataArrayPath OriginalVertexIdsArrayPath READ getOriginalVertexIdsArrayPath WRITE setOriginalVertexIdsArrayPath)
+
+  /**
+   * @brief Setter property for OriginalElementIdsArrayPath
+   */
+  void setOriginalElementIdsArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for OriginalElementIdsArrayPath
+   * @return Value of OriginalElementIdsArrayPath
+   */
+  DataArrayPath getOriginalElementIdsArrayPath() const;
+
+  Q_PROPERTY(DataArrayPath OriginalElementIdsArrayPath READ getOriginalElementIdsArrayPath WRITE setOriginalElementIdsArrayPath)
+
+  /**
+   * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
+   */
+  QString getCompiledLibraryName() const override;
+
+  /**
+   * @brief getBrandingString Returns the branding string for the filter, which is a tag
+   * used to denote the filter's association with specific plugins
+   * @return Branding string
+   */
+  QString getBrandingString() const override;
+
+  /**
+   * @brief getFilterVersion Returns a version string for this filter. Default
+   * value is an empty string.
+   * @return
+   */
+  QString getFilterVersion() const override;
+
+  /**
+   * @brief newFilterInstance Reimplemented from @see AbstractFilter class
+   */
+  AbstractFilter::Pointer newFilterInstance(bool copyFilterParameters) const override;
+
+  /**
+   * @brief getGroupName Reimplemented from @see AbstractFilter class
+   */
+  QString getGroupName() const override;
+
+  /**
+   * @brief getSubGroupName Reimplemented from @see AbstractFilter class
+   */
+  QString getSubGroupName() const override;
+
+  /**
+   * @brief getUuid Return the unique identifier for this filter.
+   * @return A QUuid object.
+   */
+  QUuid getUuid() const override;
+
+  /**
+   * @brief getHumanLabel Reimplemented from @see AbstractFilter class
+   */
+  QString getHumanLabel() const override;
+
+  /**
+   * @brief setupFilterParameters Reimplemented from @see AbstractFilter class
+   */
+  void setupFilterParameters() override;
+
+  /**
+   * @brief execute Reimplemented from @see AbstractFilter class
+   */
+  void execute() override;
+
+protected:
+  ReorderUnstructuredGeometry();
+
+  /**
+   * @brief dataCheck Checks for the appropriate parameter values and availability of arrays
+   */
+  void dataCheck() override;
+
+  /**
+   * @brief Initializes all the private instance variables.
+   */
+  void initialize();
+
+private:
+  DataArrayPath m_DataContainerName = {"", "", ""};
+  int m_CurveType = 1;
+  bool m_SaveOriginalIds = false;
+  DataArrayPath m_OriginalVertexIdsArrayPath = {"", "", "OriginalVertexIds"};
+  DataArrayPath m_OriginalElementIdsArrayPath = {"", "", "OriginalElementIds"};
+
+  Int64ArrayType::Pointer m_OriginalVertexIdsPtr;
+  Int64ArrayType::Pointer m_OriginalElementIdsPtr;
+
+public:
+  ReorderUnstructuredGeometry(const ReorderUnstructuredGeometry&) = delete;            // Copy Constructor Not Implemented
+  ReorderUnstructuredGeometry& operator=(const ReorderUnstructuredGeometry&) = delete; // Copy Assignment Not Implemented
+  ReorderUnstructuredGeometry(ReorderUnstructuredGeometry&&) = delete;                 // Move Constructor Not Implemented
+  ReorderUnstructuredGeometry& operator=(ReorderUnstructuredGeometry&&) = delete;      // Move Assignment Not Implemented
+};
@@ -34,6 +34,12 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "ReplaceValueInArray.h"
 
+#include <algorithm>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/SIMPLibVersion.h"
@@ -44,11 +50,26 @@
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/DoubleFilterParameter.h"
+#include "SIMPLib/FilterParameters/DynamicTableFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-ReplaceValueInArray::ReplaceValueInArray() = default;
+ReplaceValueInArray::ReplaceValueInArray()
+{
+  std::vector<std::vector<double>> defaultTable{{0.0, 0.0}};
+
+  m_ReplaceMap.setTableData(defaultTable);
+  m_ReplaceMap.setColHeaders({"Value to Replace", "New Value"});
+  m_ReplaceMap.setDynamicRows(true);
+  m_ReplaceMap.setDynamicCols(false);
+  m_ReplaceMap.setDefaultColCount(2);
+  m_ReplaceMap.setDefaultRowCount(1);
+  m_ReplaceMap.setMinCols(2);
+  m_ReplaceMap.setMinRows(1);
+}
 
 // -----------------------------------------------------------------------------
 //
@@ -61,9 +82,25 @@ ReplaceValueInArray::~ReplaceValueInArray() = default;
 void ReplaceValueInArray::setupFilterParameters()
 {
   FilterParameterVectorType parameters;
-  parameters.push_back(SIMPL_NEW_DOUBLE_FP("Value to Replace", RemoveValue, FilterParameter::Category::Parameter, ReplaceValueInArray));
+  {
+    LinkedChoicesFilterParameter::Pointer parameter = LinkedChoicesFilterParameter::New();
+    parameter->setHumanLabel("Replace Mode");
+    parameter->setPropertyName("ReplaceMode");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(ReplaceValueInArray, this, ReplaceMode));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(ReplaceValueInArray, this, ReplaceMode));
+    std::vector<QString> choices{"Single Value", "Value Map"};
+    parameter->setChoices(choices);
+    std::vector<QString> linkedProps{"RemoveValue", "ReplaceValue", "ReplaceMap"};
+    parameter->setLinkedProperties(linkedProps);
+    parameter->setEditable(false);
+    parameter->setCategory(FilterParameter::Category::Parameter);
+    parameters.push_back(parameter);
+  }
+  parameters.push_back(SIMPL_NEW_DOUBLE_FP("Value to Replace", RemoveValue, FilterParameter::Category::Parameter, ReplaceValueInArray, 0));
 
-  parameters.push_back(SIMPL_NEW_DOUBLE_FP("New Value", ReplaceValue, FilterParameter::Category::Parameter, ReplaceValueInArray));
+  parameters.push_back(SIMPL_NEW_DOUBLE_FP("New Value", ReplaceValue, FilterParameter::Category::Parameter, ReplaceValueInArray, 0));
+
+  parameters.push_back(SIMPL_NEW_DYN_TABLE_FP("Value Map", ReplaceMap, FilterParameter::Category::Parameter, ReplaceValueInArray, 1));
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::Defaults::AnyPrimitive, 1, AttributeMatrix::Category::Any);
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Attribute Array", SelectedArray, FilterParameter::Category::RequiredArray, ReplaceValueInArray, req));
@@ -80,6 +117,8 @@ void ReplaceValueInArray::readFilterParameters(AbstractFilterParametersReader* r
   setSelectedArray(reader->readDataArrayPath("SelectedArray", getSelectedArray()));
   setRemoveValue(reader->readValue("RemoveValue", getRemoveValue()));
   setReplaceValue(reader->readValue("ReplaceValue", getReplaceValue()));
+  setReplaceMode(reader->readValue("ReplaceMode", getReplaceMode()));
+  setReplaceMap(reader->readDynamicTableData("ReplaceMap", getReplaceMap()));
   reader->closeFilterGroup();
 }
 
@@ -129,113 +168,299 @@ void checkValuesFloatDouble(AbstractFilter* filter, double removeValue, double r
 //
 // -----------------------------------------------------------------------------
 
+/**
+ * @brief The ReplaceValueImpl class swaps a single value for another. The select is written
+ * without a branch so the compiler can vectorize it.
+ */
 template <typename T>
-void replaceValue(AbstractFilter* filter, IDataArray::Pointer inDataPtr, double removeValue, double replaceValue)
+class ReplaceValueImpl
 {
-  typename DataArray<T>::Pointer inputArrayPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
+public:
+  ReplaceValueImpl(T* data, T removeValue, T replaceValue)
+  : m_Data(data)
+  , m_RemoveValue(removeValue)
+  , m_ReplaceValue(replaceValue)
+  {
+  }
+  ReplaceValueImpl(const ReplaceValueImpl&) = default;           // Copy Constructor Not Implemented
+  ReplaceValueImpl(ReplaceValueImpl&&) = default;                // Move Constructor Not Implemented
+  ReplaceValueImpl& operator=(const ReplaceValueImpl&) = delete; // Copy Assignment Not Implemented
+  ReplaceValueImpl& operator=(ReplaceValueImpl&&) = delete;      // Move Assignment Not Implemented
+  ~ReplaceValueImpl() = default;
 
-  T removeVal = static_cast<T>(removeValue);
-  T replaceVal = static_cast<T>(replaceValue);
+  void convert(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      m_Data[i] = (m_Data[i] == m_RemoveValue) ? m_ReplaceValue : m_Data[i];
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    convert(range.min(), range.max());
+  }
 
-  T* inData = inputArrayPtr->getPointer(0);
-  size_t numTuples = inputArrayPtr->getNumberOfTuples();
+private:
+  T* m_Data;
+  T m_RemoveValue;
+  T m_ReplaceValue;
+};
+
+/**
+ * @brief The ReplaceValueMapImpl class applies every (old, new) pair of a replace map in one pass.
+ * Each value is looked up against its original contents so replacements never chain. Small maps
+ * are scanned with a branch-free select, larger ones use a binary search over the sorted keys.
+ */
+template <typename T>
+class ReplaceValueMapImpl
+{
+public:
+  static constexpr size_t k_MaxLinearScanSize = 8;
 
-  for(size_t iter = 0; iter < numTuples; iter++)
+  ReplaceValueMapImpl(T* data, const std::vector<T>& keys, const std::vector<T>& values)
+  : m_Data(data)
+  , m_Keys(keys)
+  , m_Values(values)
   {
-    if(inData[iter] == removeVal)
+  }
+  ReplaceValueMapImpl(const ReplaceValueMapImpl&) = default;           // Copy Constructor Not Implemented
+  ReplaceValueMapImpl(ReplaceValueMapImpl&&) = default;                // Move Constructor Not Implemented
+  ReplaceValueMapImpl& operator=(const ReplaceValueMapImpl&) = delete; // Copy Assignment Not Implemented
+  ReplaceValueMapImpl& operator=(ReplaceValueMapImpl&&) = delete;      // Move Assignment Not Implemented
+  ~ReplaceValueMapImpl() = default;
+
+  void convert(size_t start, size_t end) const
+  {
+    const size_t numKeys = m_Keys.size();
+    const T* keys = m_Keys.data();
+    const T* values = m_Values.data();
+    if(numKeys <= k_MaxLinearScanSize)
+    {
+      for(size_t i = start; i < end; i++)
+      {
+        const T value = m_Data[i];
+        T result = value;
+        for(size_t k = 0; k < numKeys; k++)
+        {
+          result = (value == keys[k]) ? values[k] : result;
+        }
+        m_Data[i] = result;
+      }
+      return;
+    }
+
+    for(size_t i = start; i < end; i++)
     {
-      inData[iter] = replaceVal;
+      const T value = m_Data[i];
+      const size_t k = static_cast<size_t>(std::lower_bound(keys, keys + numKeys, value) - keys);
+      m_Data[i] = (k < numKeys && keys[k] == value) ? values[k] : value;
     }
   }
-}
+
+  void operator()(const SIMPLRange& range) const
+  {
+    convert(range.min(), range.max());
+  }
+
+private:
+  T* m_Data;
+  const std::vector<T>& m_Keys;
+  const std::vector<T>& m_Values;
+};
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ReplaceValueInArray::initialize()
+template <typename T>
+void replaceValue(AbstractFilter* filter, IDataArray::Pointer inDataPtr, double removeValue, double replaceValue)
 {
+  std::ignore = filter;
+  typename DataArray<T>::Pointer inputArrayPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
+
+  T removeVal = static_cast<T>(removeValue);
+  T replaceVal = static_cast<T>(replaceValue);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, inputArrayPtr->getNumberOfTuples());
+  dataAlg.execute(ReplaceValueImpl<T>(inputArrayPtr->getPointer(0), removeVal, replaceVal));
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ReplaceValueInArray::dataCheck()
+template <typename T>
+void replaceValueMap(AbstractFilter* filter, IDataArray::Pointer inDataPtr, const std::vector<std::vector<double>>& replaceMap)
 {
-  clearErrorCode();
-  clearWarningCode();
+  std::ignore = filter;
+  typename DataArray<T>::Pointer inputArrayPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
 
-  m_ArrayPtr = getDataContainerArray()->getPrereqIDataArrayFromPath(this, getSelectedArray());
-  if(getErrorCode() < 0)
+  // Sort the pairs by their value to replace. dataCheck has already rejected duplicates.
+  std::vector<std::pair<T, T>> pairs;
+  pairs.reserve(replaceMap.size());
+  for(const auto& row : replaceMap)
   {
-    return;
+    pairs.emplace_back(static_cast<T>(row[0]), static_cast<T>(row[1]));
   }
+  std::stable_sort(pairs.begin(), pairs.end(), [](const std::pair<T, T>& a, const std::pair<T, T>& b) { return a.first < b.first; });
 
-  if(m_ArrayPtr.lock()->getNumberOfComponents() > 1)
+  std::vector<T> keys(pairs.size());
+  std::vector<T> values(pairs.size());
+  for(size_t i = 0; i < pairs.size(); i++)
   {
-    QString ss = QObject::tr("Selected array '%1' must be a scalar array (1 component). The number of components is %2")
-                     .arg(getSelectedArray().getDataArrayName())
-                     .arg(m_ArrayPtr.lock()->getNumberOfComponents());
-    setErrorCondition(-11002, ss);
-    return;
+    keys[i] = pairs[i].first;
+    values[i] = pairs[i].second;
   }
 
-  QString dType = m_ArrayPtr.lock()->getTypeAsString();
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, inputArrayPtr->getNumberOfTuples());
+  dataAlg.execute(ReplaceValueMapImpl<T>(inputArrayPtr->getPointer(0), keys, values));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+void checkDuplicateKeys(AbstractFilter* filter, const std::vector<std::vector<double>>& replaceMap)
+{
+  // Compare the keys after conversion to the array type since distinct doubles such as 1.2 and 1.7
+  // collapse onto the same integer value
+  std::set<T> removeValues;
+  for(const auto& row : replaceMap)
+  {
+    if(!removeValues.insert(static_cast<T>(row[0])).second)
+    {
+      QString ss = QObject::tr("The value %1 appears more than once in the value map after conversion to the array type").arg(row[0]);
+      filter->setErrorCondition(-11005, ss);
+      return;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void checkReplacePair(AbstractFilter* filter, const QString& dType, double& removeValue, double& replaceValue)
+{
   if(dType.compare(SIMPL::TypeNames::Int8) == 0)
   {
-    checkValuesInt<int8_t>(this, m_RemoveValue, m_ReplaceValue, SIMPL::TypeNames::Int8);
+    checkValuesInt<int8_t>(filter, removeValue, replaceValue, SIMPL::TypeNames::Int8);
   }
   else if(dType.compare(SIMPL::TypeNames::UInt8) == 0)
   {
-    checkValuesInt<uint8_t>(this, m_RemoveValue, m_ReplaceValue, SIMPL::TypeNames::UInt8);
+    checkValuesInt<uint8_t>(filter, removeValue, replaceValue, SIMPL::TypeNames::UInt8);
   }
   else if(dType.compare(SIMPL::TypeNames::Int16) == 0)
   {
-    checkValuesInt<int16_t>(this, m_RemoveValue, m_ReplaceValue, SIMPL::TypeNames::Int16);
+    checkValuesInt<int16_t>(filter, removeValue, replaceValue, SIMPL::TypeNames::Int16);
   }
   else if(dType.compare(SIMPL::TypeNames::UInt16) == 0)
   {
-    checkValuesInt<uint16_t>(this, m_RemoveValue, m_ReplaceValue, SIMPL::TypeNames::UInt16);
+    checkValuesInt<uint16_t>(filter, removeValue, replaceValue, SIMPL::TypeNames::UInt16);
   }
   else if(dType.compare(SIMPL::TypeNames::Int32) == 0)
   {
-    checkValuesInt<int32_t>(this, m_RemoveValue, m_ReplaceValue, SIMPL::TypeNames::Int32);
+    checkValuesInt<int32_t>(filter, removeValue, replaceValue, SIMPL::TypeNames::Int32);
   }
   else if(dType.compare(SIMPL::TypeNames::UInt32) == 0)
   {
-    checkValuesInt<uint32_t>(this, m_RemoveValue, m_ReplaceValue, SIMPL::TypeNames::UInt32);
+    checkValuesInt<uint32_t>(filter, removeValue, replaceValue, SIMPL::TypeNames::UInt32);
   }
   else if(dType.compare(SIMPL::TypeNames::Int64) == 0)
   {
-    checkValuesInt<int64_t>(this, m_RemoveValue, m_ReplaceValue, SIMPL::TypeNames::Int64);
+    checkValuesInt<int64_t>(filter, removeValue, replaceValue, SIMPL::TypeNames::Int64);
   }
   else if(dType.compare(SIMPL::TypeNames::UInt64) == 0)
   {
-    checkValuesInt<uint64_t>(this, m_RemoveValue, m_ReplaceValue, SIMPL::TypeNames::UInt64);
+    checkValuesInt<uint64_t>(filter, removeValue, replaceValue, SIMPL::TypeNames::UInt64);
   }
   else if(dType.compare(SIMPL::TypeNames::Float) == 0)
   {
-    checkValuesFloatDouble<float>(this, m_RemoveValue, m_ReplaceValue, SIMPL::TypeNames::Float);
+    checkValuesFloatDouble<float>(filter, removeValue, replaceValue, SIMPL::TypeNames::Float);
   }
   else if(dType.compare(SIMPL::TypeNames::Double) == 0)
   {
-    checkValuesFloatDouble<double>(this, m_RemoveValue, m_ReplaceValue, SIMPL::TypeNames::Double);
+    checkValuesFloatDouble<double>(filter, removeValue, replaceValue, SIMPL::TypeNames::Double);
   }
   else if(dType.compare(SIMPL::TypeNames::Bool) == 0)
   {
-    if(m_RemoveValue != 0.0)
+    if(removeValue != 0.0)
     {
-      m_RemoveValue = 1.0; // anything that is not a zero is a one
+      removeValue = 1.0; // anything that is not a zero is a one
     }
-    if(m_ReplaceValue != 0.0)
+    if(replaceValue != 0.0)
     {
-      m_ReplaceValue = 1.0; // anything that is not a zero is a one
+      replaceValue = 1.0; // anything that is not a zero is a one
     }
   }
   else
   {
     QString ss = QObject::tr("Incorrect data scalar type");
-    setErrorCondition(-4060, ss);
+    filter->setErrorCondition(-4060, ss);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReplaceValueInArray::initialize()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReplaceValueInArray::dataCheck()
+{
+  clearErrorCode();
+  clearWarningCode();
+
+  m_ArrayPtr = getDataContainerArray()->getPrereqIDataArrayFromPath(this, getSelectedArray());
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
+  if(m_ArrayPtr.lock()->getNumberOfComponents() > 1)
+  {
+    QString ss = QObject::tr("Selected array '%1' must be a scalar array (1 component). The number of components is %2")
+                     .arg(getSelectedArray().getDataArrayName())
+                     .arg(m_ArrayPtr.lock()->getNumberOfComponents());
+    setErrorCondition(-11002, ss);
+    return;
+  }
+
+  QString dType = m_ArrayPtr.lock()->getTypeAsString();
+  if(m_ReplaceMode == 0)
+  {
+    checkReplacePair(this, dType, m_RemoveValue, m_ReplaceValue);
+    return;
+  }
+
+  std::vector<std::vector<double>> replaceMap = m_ReplaceMap.getTableData();
+  if(replaceMap.empty())
+  {
+    QString ss = QObject::tr("The value map must contain at least one row");
+    setErrorCondition(-11003, ss);
+    return;
+  }
+
+  for(auto& row : replaceMap)
+  {
+    if(row.size() != 2)
+    {
+      QString ss = QObject::tr("Each row of the value map must contain exactly 2 columns: the value to replace and the new value");
+      setErrorCondition(-11004, ss);
+      return;
+    }
+    checkReplacePair(this, dType, row[0], row[1]);
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
   }
+
+  EXECUTE_FUNCTION_TEMPLATE(this, checkDuplicateKeys, m_ArrayPtr.lock(), this, replaceMap)
 }
 
 // -----------------------------------------------------------------------------
@@ -249,7 +474,14 @@ void ReplaceValueInArray::execute()
     return;
   }
 
-  EXECUTE_FUNCTION_TEMPLATE(this, replaceValue, m_ArrayPtr.lock(), this, m_ArrayPtr.lock(), m_RemoveValue, m_ReplaceValue)
+  if(m_ReplaceMode == 0)
+  {
+    EXECUTE_FUNCTION_TEMPLATE(this, replaceValue, m_ArrayPtr.lock(), this, m_ArrayPtr.lock(), m_RemoveValue, m_ReplaceValue)
+  }
+  else
+  {
+    EXECUTE_FUNCTION_TEMPLATE(this, replaceValueMap, m_ArrayPtr.lock(), this, m_ArrayPtr.lock(), m_ReplaceMap.getTableData())
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -388,3 +620,27 @@ double ReplaceValueInArray::getReplaceValue() const
 {
   return m_ReplaceValue;
 }
+
+// -----------------------------------------------------------------------------
+void ReplaceValueInArray::setReplaceMode(int value)
+{
+  m_ReplaceMode = value;
+}
+
+// -----------------------------------------------------------------------------
+int ReplaceValueInArray::getReplaceMode() const
+{
+  return m_ReplaceMode;
+}
+
+// -----------------------------------------------------------------------------
+void ReplaceValueInArray::setReplaceMap(const DynamicTableData& value)
+{
+  m_ReplaceMap = value;
+}
+
+// -----------------------------------------------------------------------------
+DynamicTableData ReplaceValueInArray::getReplaceMap() const
+{
+  return m_ReplaceMap;
+}
@@ -38,6 +38,7 @@
 #include <memory>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/FilterParameters/DynamicTableData.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 
 class IDataArray;
@@ -60,6 +61,8 @@ class SIMPLib_EXPORT ReplaceValueInArray : public AbstractFilter
   PYB11_PROPERTY(DataArrayPath SelectedArray READ getSelectedArray WRITE setSelectedArray)
   PYB11_PROPERTY(double RemoveValue READ getRemoveValue WRITE setRemoveValue)
   PYB11_PROPERTY(double ReplaceValue READ getReplaceValue WRITE setReplaceValue)
+  PYB11_PROPERTY(int ReplaceMode READ getReplaceMode WRITE setReplaceMode)
+  PYB11_PROPERTY(DynamicTableData ReplaceMap READ getReplaceMap WRITE setReplaceMap)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -120,6 +123,30 @@ public:
 
   Q_PROPERTY(double ReplaceValue READ getReplaceValue WRITE setReplaceValue)
 
+  /**
+   * @brief Setter property for ReplaceMode. 0 replaces a single value, 1 applies every pair in ReplaceMap
+   */
+  void setReplaceMode(int value);
+  /**
+   * @brief Getter property for ReplaceMode
+   * @return Value of ReplaceMode
+   */
+  int getReplaceMode() const;
+
+  Q_PROPERTY(int ReplaceMode READ getReplaceMode WRITE setReplaceMode)
+
+  /**
+   * @brief Setter property for ReplaceMap. Each row holds a value to replace and its new value
+   */
+  void setReplaceMap(const DynamicTableData& value);
+  /**
+   * @brief Getter property for ReplaceMap
+   * @return Value of ReplaceMap
+   */
+  DynamicTableData getReplaceMap() const;
+
+  Q_PROPERTY(DynamicTableData ReplaceMap READ getReplaceMap WRITE setReplaceMap)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -198,6 +225,8 @@ private:
   DataArrayPath m_SelectedArray = {"", "", ""};
   double m_RemoveValue = {0.0};
   double m_ReplaceValue = {0.0};
+  int m_ReplaceMode = {0};
+  DynamicTableData m_ReplaceMap;
 
 public:
   ReplaceValueInArray(const ReplaceValueInArray&) = delete;            // Copy Constructor Not Implemented
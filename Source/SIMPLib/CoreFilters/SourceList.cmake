@@ -43,6 +43,7 @@ set(_PublicFilters
   CopyObject
   CreateGeometry
   CropVertexGeometry
+  ReorderUnstructuredGeometry
   DataContainerReader
   DataContainerWriter
   ExecuteProcess
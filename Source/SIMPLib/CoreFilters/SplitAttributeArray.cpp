@@ -44,6 +44,7 @@
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Utilities/ComponentTranspose.hpp"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -154,26 +155,20 @@ template <typename T>
 void splitMulticomponentArray(IDataArray::Pointer inputArray, std::vector<IDataArray::Pointer>& splitArrays)
 {
   typename DataArray<T>::Pointer inputPtr = std::dynamic_pointer_cast<DataArray<T>>(inputArray);
-  T* iPtr = inputPtr->getPointer(0);
-  std::vector<T*> downcastPtrs;
+  std::vector<ComponentTranspose::ComponentSlice<T>> outputSlices;
 
+  size_t comp = 0;
   for(auto&& ptr : splitArrays)
   {
     auto tmp = std::dynamic_pointer_cast<DataArray<T>>(ptr);
-    T* tmpPtr = tmp->getPointer(0);
-    downcastPtrs.push_back(tmpPtr);
+    outputSlices.push_back({tmp->getPointer(0), 1, comp});
+    comp++;
   }
 
   size_t numTuples = inputPtr->getNumberOfTuples();
-  int32_t numComps = inputPtr->getNumberOfComponents();
+  size_t numComps = static_cast<size_t>(inputPtr->getNumberOfComponents());
 
-  for(size_t i = 0; i < numTuples; i++)
-  {
-    for(int32_t j = 0; j < numComps; j++)
-    {
-      downcastPtrs[j][i] = iPtr[numComps * i + j];
-    }
-  }
+  ComponentTranspose::Deinterleave<T>(inputPtr->getPointer(0), numComps, outputSlices, numTuples);
 }
 
 // -----------------------------------------------------------------------------
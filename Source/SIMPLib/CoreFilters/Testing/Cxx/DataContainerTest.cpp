@@ -38,6 +38,7 @@
 
 #include <QtCore/QDir>
 #include <QtCore/QFile>
+#include <QtCore/QJsonObject>
 #include <QtCore/QList>
 #include <QtCore/QMap>
 #include <QtCore/QString>
@@ -60,6 +61,7 @@
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/HDF5/H5HyperslabRegion.h"
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
 #include "SIMPLib/Testing/UnitTestSupport.hpp"
 
@@ -109,6 +111,21 @@ QString TestFile3()
   return TestDir() + QString::fromLatin1("/DataContainerIOTest_Subset.h5");
 }
 
+QString TestFile4()
+{
+  return TestDir() + QString::fromLatin1("/DataContainerIOTest_Region.h5");
+}
+
+QString TestFile5()
+{
+  return TestDir() + QString::fromLatin1("/DataContainerIOTest_Deferred.h5");
+}
+
+QString TestFile6()
+{
+  return TestDir() + QString::fromLatin1("/DataContainerIOTest_DeferredRewrite.h5");
+}
+
 QString JsonFile()
 {
   return TestDir() + QString::fromLatin1("/DataContainerProxyTest.json");
@@ -143,6 +160,9 @@ public:
     QFile::remove(DataContainerIOTest::TestFile());
     QFile::remove(DataContainerIOTest::TestFile2());
     QFile::remove(DataContainerIOTest::TestFile3());
+    QFile::remove(DataContainerIOTest::TestFile4());
+    QFile::remove(DataContainerIOTest::TestFile5());
+    QFile::remove(DataContainerIOTest::TestFile6());
     QFile::remove(DataContainerIOTest::JsonFile());
     QFile::remove(DataContainerIOTest::H5File());
 
@@ -469,6 +489,282 @@ public:
     DREAM3D_REQUIRE_EQUAL(err, 0)
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDataContainerReaderRegion()
+  {
+    const size_t nx = 6;
+    const size_t ny = 5;
+    const size_t nz = 4;
+    std::vector<size_t> tupleDims = {nx, ny, nz};
+
+    {
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      DataContainer::Pointer dc = DataContainer::New(SIMPL::Defaults::ImageDataContainerName);
+      ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+      image->setDimensions(nx, ny, nz);
+      image->setOrigin(1.0f, 2.0f, 3.0f);
+      image->setSpacing(0.5f, 0.5f, 2.0f);
+      dc->setGeometry(image);
+      dca->addOrReplaceDataContainer(dc);
+
+      AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(tupleDims, getCellAttributeMatrixName(), AttributeMatrix::Type::Cell);
+      dc->addOrReplaceAttributeMatrix(cellAttrMat);
+      Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(tupleDims, std::vector<size_t>(1, 1), SIMPL::CellData::FeatureIds, true);
+      FloatArrayType::Pointer eulers = FloatArrayType::CreateArray(tupleDims, std::vector<size_t>(1, 3), SIMPL::CellData::EulerAngles, true);
+      for(size_t i = 0; i < featureIds->getNumberOfTuples(); i++)
+      {
+        featureIds->setValue(i, static_cast<int32_t>(i));
+        eulers->setComponent(i, 0, static_cast<float>(i));
+        eulers->setComponent(i, 1, static_cast<float>(i) + 0.25f);
+        eulers->setComponent(i, 2, static_cast<float>(i) + 0.5f);
+      }
+      cellAttrMat->insertOrAssign(featureIds);
+      cellAttrMat->insertOrAssign(eulers);
+
+      AttributeMatrix::Pointer ensembleAttrMat = AttributeMatrix::New(std::vector<size_t>(1, 2), getCellEnsembleAttributeMatrixName(), AttributeMatrix::Type::CellEnsemble);
+      dc->addOrReplaceAttributeMatrix(ensembleAttrMat);
+      ensembleAttrMat->insertOrAssign(UInt32ArrayType::CreateArray(2, SIMPL::EnsembleData::CrystalStructures, true));
+
+      DataContainerWriter::Pointer writer = DataContainerWriter::New();
+      writer->setDataContainerArray(dca);
+      writer->setOutputFile(DataContainerIOTest::TestFile4());
+      writer->execute();
+      DREAM3D_REQUIRE_EQUAL(writer->getErrorCode(), 0)
+    }
+
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    DataContainerArrayProxy dcaProxy = reader->readDataContainerArrayStructure(DataContainerIOTest::TestFile4());
+    H5HyperslabRegion region = H5HyperslabRegion::FromImageIndexBounds(SizeVec3Type(1, 1, 1), SizeVec3Type(5, 3, 3), SizeVec3Type(2, 1, 2));
+    dcaProxy.getDataContainers()[SIMPL::Defaults::ImageDataContainerName].setReadRegion(region);
+
+    // The region survives a round trip through the json representation that pipelines store
+    QJsonObject proxyJson;
+    dcaProxy.writeJson(proxyJson);
+    DataContainerArrayProxy jsonProxy;
+    jsonProxy.readJson(proxyJson);
+    DREAM3D_REQUIRE(jsonProxy.getDataContainers()[SIMPL::Defaults::ImageDataContainerName].getReadRegion() == region)
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    reader->setInputFile(DataContainerIOTest::TestFile4());
+    reader->setDataContainerArray(dca);
+    reader->setInputFileDataContainerArrayProxy(jsonProxy);
+    reader->execute();
+    DREAM3D_REQUIRE(reader->getErrorCode() >= 0)
+
+    DataContainer::Pointer dc = dca->getDataContainer(SIMPL::Defaults::ImageDataContainerName);
+    DREAM3D_REQUIRE_VALID_POINTER(dc.get())
+    ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
+    DREAM3D_REQUIRE_VALID_POINTER(image.get())
+    SizeVec3Type dims = image->getDimensions();
+    DREAM3D_REQUIRE_EQUAL(dims[0], 3)
+    DREAM3D_REQUIRE_EQUAL(dims[1], 3)
+    DREAM3D_REQUIRE_EQUAL(dims[2], 2)
+    FloatVec3Type origin = image->getOrigin();
+    DREAM3D_REQUIRE_EQUAL(origin[0], 1.5f)
+    DREAM3D_REQUIRE_EQUAL(origin[1], 2.5f)
+    DREAM3D_REQUIRE_EQUAL(origin[2], 5.0f)
+    FloatVec3Type spacing = image->getSpacing();
+    DREAM3D_REQUIRE_EQUAL(spacing[0], 1.0f)
+    DREAM3D_REQUIRE_EQUAL(spacing[1], 0.5f)
+    DREAM3D_REQUIRE_EQUAL(spacing[2], 4.0f)
+
+    AttributeMatrix::Pointer cellAttrMat = dc->getAttributeMatrix(getCellAttributeMatrixName());
+    DREAM3D_REQUIRE_VALID_POINTER(cellAttrMat.get())
+    DREAM3D_REQUIRE_EQUAL(cellAttrMat->getNumberOfTuples(), 18)
+
+    Int32ArrayType::Pointer featureIds = cellAttrMat->getAttributeArrayAs<Int32ArrayType>(SIMPL::CellData::FeatureIds);
+    FloatArrayType::Pointer eulers = cellAttrMat->getAttributeArrayAs<FloatArrayType>(SIMPL::CellData::EulerAngles);
+    DREAM3D_REQUIRE_VALID_POINTER(featureIds.get())
+    DREAM3D_REQUIRE_VALID_POINTER(eulers.get())
+    DREAM3D_REQUIRE_EQUAL(featureIds->getNumberOfTuples(), 18)
+    DREAM3D_REQUIRE_EQUAL(eulers->getNumberOfComponents(), 3)
+
+    size_t index = 0;
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      for(size_t y = 0; y < dims[1]; y++)
+      {
+        for(size_t x = 0; x < dims[0]; x++)
+        {
+          size_t fileIndex = (1 + z * 2) * nx * ny + (1 + y) * nx + (1 + x * 2);
+          DREAM3D_REQUIRE_EQUAL(featureIds->getValue(index), static_cast<int32_t>(fileIndex))
+          DREAM3D_REQUIRE_EQUAL(eulers->getComponent(index, 0), static_cast<float>(fileIndex))
+          DREAM3D_REQUIRE_EQUAL(eulers->getComponent(index, 2), static_cast<float>(fileIndex) + 0.5f)
+          index++;
+        }
+      }
+    }
+
+    // Attribute matrices that do not span the geometry are read in full
+    AttributeMatrix::Pointer ensembleAttrMat = dc->getAttributeMatrix(getCellEnsembleAttributeMatrixName());
+    DREAM3D_REQUIRE_VALID_POINTER(ensembleAttrMat.get())
+    DREAM3D_REQUIRE_EQUAL(ensembleAttrMat->getNumberOfTuples(), 2)
+
+    // A region that does not fit inside the geometry is an error
+    DataContainerArrayProxy badProxy = reader->readDataContainerArrayStructure(DataContainerIOTest::TestFile4());
+    badProxy.getDataContainers()[SIMPL::Defaults::ImageDataContainerName].setReadRegion(H5HyperslabRegion::FromImageIndexBounds(SizeVec3Type(0, 0, 0), SizeVec3Type(nx, 0, 0)));
+    reader->setDataContainerArray(DataContainerArray::New());
+    reader->setInputFileDataContainerArrayProxy(badProxy);
+    reader->execute();
+    DREAM3D_REQUIRE(reader->getErrorCode() < 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDataContainerReaderDeferred()
+  {
+    const size_t numTuples = 60;
+    {
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      DataContainer::Pointer dc = DataContainer::New(SIMPL::Defaults::ImageDataContainerName);
+      ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+      image->setDimensions(5, 4, 3);
+      dc->setGeometry(image);
+      dca->addOrReplaceDataContainer(dc);
+      AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(std::vector<size_t>{5, 4, 3}, getCellAttributeMatrixName(), AttributeMatrix::Type::Cell);
+      dc->addOrReplaceAttributeMatrix(cellAttrMat);
+      Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(numTuples, SIMPL::CellData::FeatureIds, true);
+      FloatArrayType::Pointer eulers = FloatArrayType::CreateArray(numTuples, std::vector<size_t>(1, 3), SIMPL::CellData::EulerAngles, true);
+      for(size_t i = 0; i < numTuples; i++)
+      {
+        featureIds->setValue(i, static_cast<int32_t>(i));
+        eulers->setComponent(i, 0, static_cast<float>(i));
+        eulers->setComponent(i, 1, static_cast<float>(i) + 0.25f);
+        eulers->setComponent(i, 2, static_cast<float>(i) + 0.5f);
+      }
+      cellAttrMat->insertOrAssign(featureIds);
+      cellAttrMat->insertOrAssign(eulers);
+
+      DataContainerWriter::Pointer writer = DataContainerWriter::New();
+      writer->setDataContainerArray(dca);
+      writer->setOutputFile(DataContainerIOTest::TestFile5());
+      writer->execute();
+      DREAM3D_REQUIRE_EQUAL(writer->getErrorCode(), 0)
+    }
+
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    reader->setInputFile(DataContainerIOTest::TestFile5());
+    reader->setInputFileDataContainerArrayProxy(reader->readDataContainerArrayStructure(DataContainerIOTest::TestFile5()));
+    reader->setDeferArrayReads(true);
+    reader->setDeferredMemoryBudget(1);
+    reader->setDataContainerArray(dca);
+    reader->execute();
+    DREAM3D_REQUIRE(reader->getErrorCode() >= 0)
+    DREAM3D_REQUIRE_EQUAL(dca->getDeferredMemoryBudget(), static_cast<size_t>(1024 * 1024))
+
+    AttributeMatrix::Pointer cellAttrMat = dca->getAttributeMatrix(DataArrayPath(SIMPL::Defaults::ImageDataContainerName, getCellAttributeMatrixName(), ""));
+    DREAM3D_REQUIRE_VALID_POINTER(cellAttrMat.get())
+    Int32ArrayType::Pointer featureIds = cellAttrMat->getAttributeArrayAs<Int32ArrayType>(SIMPL::CellData::FeatureIds);
+    FloatArrayType::Pointer eulers = cellAttrMat->getAttributeArrayAs<FloatArrayType>(SIMPL::CellData::EulerAngles);
+    DREAM3D_REQUIRE_VALID_POINTER(featureIds.get())
+    DREAM3D_REQUIRE_VALID_POINTER(eulers.get())
+
+    // Only the meta data has been read so far
+    DREAM3D_REQUIRE(featureIds->isDeferred())
+    DREAM3D_REQUIRE(eulers->isDeferred())
+    DREAM3D_REQUIRE(featureIds->isAllocated())
+    DREAM3D_REQUIRE_EQUAL(featureIds->getNumberOfTuples(), numTuples)
+    DREAM3D_REQUIRE_EQUAL(eulers->getNumberOfComponents(), 3)
+
+    // The data is read once, when a filter fetches the array as a prerequisite
+    Int32ArrayType::Pointer prereqIds = cellAttrMat->getPrereqArray<Int32ArrayType>(reader.get(), SIMPL::CellData::FeatureIds, -1);
+    DREAM3D_REQUIRE_VALID_POINTER(prereqIds.get())
+    DREAM3D_REQUIRE(reader->getErrorCode() >= 0)
+    DREAM3D_REQUIRE(!featureIds->isDeferred())
+    DREAM3D_REQUIRE_EQUAL(featureIds->getValue(7), 7)
+    DREAM3D_REQUIRE(eulers->isDeferred())
+
+    // Unmodified data can be released and is read again on the next access
+    DREAM3D_REQUIRE(featureIds->evict())
+    DREAM3D_REQUIRE(featureIds->isDeferred())
+    DREAM3D_REQUIRE_EQUAL(featureIds->data()[59], 59)
+
+    // A deep copy of a deferred array reads from the same source
+    IDataArray::Pointer eulersCopy = eulers->deepCopy();
+    DREAM3D_REQUIRE(eulersCopy->isDeferred())
+    DREAM3D_REQUIRE_EQUAL(std::dynamic_pointer_cast<FloatArrayType>(eulersCopy)->getPointer(0)[4 * 3 + 1], 4.25f)
+    DREAM3D_REQUIRE(eulers->isDeferred())
+
+    // Modified data is never released
+    featureIds->setValue(3, 100);
+    DREAM3D_REQUIRE(!featureIds->evict())
+    DREAM3D_REQUIRE_EQUAL(featureIds->getValue(3), 100)
+
+    // Over budget only the arrays that can be read again are released
+    dca->setDeferredMemoryBudget(1);
+    DREAM3D_REQUIRE_EQUAL(eulers->data()[10 * 3 + 2], 10.5f)
+    size_t released = dca->releaseDeferredArrays();
+    DREAM3D_REQUIRE_EQUAL(released, numTuples * 3 * sizeof(float))
+    DREAM3D_REQUIRE(eulers->isDeferred())
+    DREAM3D_REQUIRE(!featureIds->isDeferred())
+
+    // Writing reads each deferred array and releases it again afterwards
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setDataContainerArray(dca);
+    writer->setOutputFile(DataContainerIOTest::TestFile6());
+    writer->execute();
+    DREAM3D_REQUIRE_EQUAL(writer->getErrorCode(), 0)
+    DREAM3D_REQUIRE(eulers->isDeferred())
+
+    DataContainerReader::Pointer rereader = DataContainerReader::New();
+    DataContainerArray::Pointer rereadDca = DataContainerArray::New();
+    rereader->setInputFile(DataContainerIOTest::TestFile6());
+    rereader->setInputFileDataContainerArrayProxy(rereader->readDataContainerArrayStructure(DataContainerIOTest::TestFile6()));
+    rereader->setDataContainerArray(rereadDca);
+    rereader->execute();
+    DREAM3D_REQUIRE(rereader->getErrorCode() >= 0)
+    AttributeMatrix::Pointer rereadAttrMat = rereadDca->getAttributeMatrix(DataArrayPath(SIMPL::Defaults::ImageDataContainerName, getCellAttributeMatrixName(), ""));
+    DREAM3D_REQUIRE_VALID_POINTER(rereadAttrMat.get())
+    Int32ArrayType::Pointer rereadIds = rereadAttrMat->getAttributeArrayAs<Int32ArrayType>(SIMPL::CellData::FeatureIds);
+    FloatArrayType::Pointer rereadEulers = rereadAttrMat->getAttributeArrayAs<FloatArrayType>(SIMPL::CellData::EulerAngles);
+    DREAM3D_REQUIRE_VALID_POINTER(rereadIds.get())
+    DREAM3D_REQUIRE_VALID_POINTER(rereadEulers.get())
+    DREAM3D_REQUIRE(!rereadIds->isDeferred())
+    DREAM3D_REQUIRE_EQUAL(rereadIds->getValue(3), 100)
+    DREAM3D_REQUIRE_EQUAL(rereadIds->getValue(8), 8)
+    DREAM3D_REQUIRE_EQUAL(rereadEulers->getComponent(59, 0), 59.0f)
+
+    // Overwriting the file the deferred arrays are read from loads them first
+    DREAM3D_REQUIRE(eulers->isDeferred())
+    writer = DataContainerWriter::New();
+    writer->setDataContainerArray(dca);
+    writer->setOutputFile(DataContainerIOTest::TestFile5());
+    writer->execute();
+    DREAM3D_REQUIRE_EQUAL(writer->getErrorCode(), 0)
+    DREAM3D_REQUIRE(!eulers->isDeferred())
+    DREAM3D_REQUIRE(!eulers->hasDeferredSource())
+    DREAM3D_REQUIRE(!featureIds->hasDeferredSource())
+    DREAM3D_REQUIRE_EQUAL(eulers->getComponent(21, 1), 21.25f)
+    DREAM3D_REQUIRE_EQUAL(featureIds->getValue(3), 100)
+
+    rereadDca = DataContainerArray::New();
+    rereader = DataContainerReader::New();
+    rereader->setInputFile(DataContainerIOTest::TestFile5());
+    rereader->setInputFileDataContainerArrayProxy(rereader->readDataContainerArrayStructure(DataContainerIOTest::TestFile5()));
+    rereader->setDataContainerArray(rereadDca);
+    rereader->execute();
+    DREAM3D_REQUIRE(rereader->getErrorCode() >= 0)
+    rereadAttrMat = rereadDca->getAttributeMatrix(DataArrayPath(SIMPL::Defaults::ImageDataContainerName, getCellAttributeMatrixName(), ""));
+    DREAM3D_REQUIRE_VALID_POINTER(rereadAttrMat.get())
+    rereadIds = rereadAttrMat->getAttributeArrayAs<Int32ArrayType>(SIMPL::CellData::FeatureIds);
+    DREAM3D_REQUIRE_VALID_POINTER(rereadIds.get())
+    DREAM3D_REQUIRE_EQUAL(rereadIds->getValue(3), 100)
+    DREAM3D_REQUIRE_EQUAL(rereadIds->getValue(42), 42)
+
+    // A deferred array that can not be read is reported to the filter that needs it
+    Int32ArrayType::Pointer unreadable = Int32ArrayType::CreateArray(numTuples, "Unreadable", true);
+    unreadable->setDeferredLoader([]() { return IDataArray::NullPointer(); });
+    rereadAttrMat->insertOrAssign(unreadable);
+    DREAM3D_REQUIRE(unreadable->isDeferred())
+    Int32ArrayType::Pointer prereqUnreadable = rereadAttrMat->getPrereqArray<Int32ArrayType>(rereader.get(), "Unreadable", -1);
+    DREAM3D_REQUIRE(prereqUnreadable.get() == nullptr)
+    DREAM3D_REQUIRE_EQUAL(rereader->getErrorCode(), -1)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1196,6 +1492,8 @@ public:
     DREAM3D_REGISTER_TEST(TestDataContainerArrayProxy())
 
     DREAM3D_REGISTER_TEST(TestDataContainerReader())
+    DREAM3D_REGISTER_TEST(TestDataContainerReaderRegion())
+    DREAM3D_REGISTER_TEST(TestDataContainerReaderDeferred())
     DREAM3D_REGISTER_TEST(TestDataArrayPath())
 
 #if REMOVE_TEST_FILES
@@ -4,11 +4,14 @@
 #pragma once
 
 #include <array>
+#include <cstring>
 #include <numeric>
 
 #include <QtCore/QFile>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/CoreFilters/DataContainerReader.h"
+#include "SIMPLib/CoreFilters/DataContainerWriter.h"
 #include "SIMPLib/CoreFilters/ExtractVertexGeometry.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
@@ -239,6 +242,97 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  void CheckImplicitCoords(const VertexGeom::Pointer& vertexGeom, const ImageGeom::Pointer& imageGeom)
+  {
+    DREAM3D_REQUIRE(vertexGeom->hasImplicitVertices())
+    DREAM3D_REQUIRE_EQUAL(vertexGeom->getNumberOfVertices(), imageGeom->getNumberOfElements())
+    float expected[3] = {0.0f, 0.0f, 0.0f};
+    float coords[3] = {0.0f, 0.0f, 0.0f};
+    for(size_t i = 0; i < vertexGeom->getNumberOfVertices(); i++)
+    {
+      imageGeom->getCoords(i, expected);
+      vertexGeom->getCoords(i, coords);
+      DREAM3D_REQUIRE_EQUAL(std::memcmp(coords, expected, sizeof(coords)), 0)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestImplicitVertices()
+  {
+    DataContainerArray::Pointer dca = createDataContainerArray();
+    ImageGeom::Pointer imageGeom = dca->getDataContainer(k_ImageGeomDataContainerName)->getGeometryAs<ImageGeom>();
+    imageGeom->setOrigin(-4.0f, 2.5f, 10.0f);
+    imageGeom->setSpacing(0.25f, 1.5f, 3.0f);
+
+    ExtractVertexGeometry::Pointer extVertGeomFilter = ExtractVertexGeometry::New();
+    extVertGeomFilter->setDataContainerArray(dca);
+    extVertGeomFilter->setArrayHandling(1);
+    extVertGeomFilter->setSelectedDataContainerName(k_ImageGeomDataContainerPath);
+    extVertGeomFilter->setVertexDataContainerName(k_VertexDataContainerPath);
+    extVertGeomFilter->setIncludedDataArrayPaths({DataArrayPath(k_ImageGeomDataContainerName, k_CellAttrMatName, k_FloatArrayName)});
+    extVertGeomFilter->setImplicitVertices(true);
+    extVertGeomFilter->execute();
+    DREAM3D_REQUIRE_EQUAL(extVertGeomFilter->getErrorCode(), 0)
+
+    VertexGeom::Pointer vertexGeom = dca->getDataContainer(k_VertexDataContainerName)->getGeometryAs<VertexGeom>();
+    CheckImplicitCoords(vertexGeom, imageGeom);
+    CheckImplicitCoords(std::dynamic_pointer_cast<VertexGeom>(vertexGeom->deepCopy()), imageGeom);
+
+    // Moving the source grid afterwards does not move the vertices
+    imageGeom->setOrigin(0.0f, 0.0f, 0.0f);
+    ImageGeom::Pointer gridCopy = std::dynamic_pointer_cast<ImageGeom>(vertexGeom->getImplicitGrid());
+    DREAM3D_REQUIRE_VALID_POINTER(gridCopy)
+    DREAM3D_REQUIRE_EQUAL(gridCopy->getOrigin()[0], -4.0f)
+    imageGeom->setOrigin(-4.0f, 2.5f, 10.0f);
+
+    // The file holds the grid, and reading it back gives implicit vertices again
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setDataContainerArray(dca);
+    writer->setOutputFile(UnitTest::ExtractVertexGeometryTest::TestFile);
+    writer->setWriteXdmfFile(true);
+    writer->execute();
+    DREAM3D_REQUIRE_EQUAL(writer->getErrorCode(), 0)
+    DREAM3D_REQUIRE(vertexGeom->hasImplicitVertices())
+
+    QFile xdmfFile(UnitTest::ExtractVertexGeometryTest::TestFileXdmf);
+    DREAM3D_REQUIRE(xdmfFile.open(QIODevice::ReadOnly | QIODevice::Text))
+    DREAM3D_REQUIRE(xdmfFile.readAll().contains("3DCoRectMesh"))
+
+    DataContainerArray::Pointer readDca = DataContainerArray::New();
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setInputFile(UnitTest::ExtractVertexGeometryTest::TestFile);
+    reader->setDataContainerArray(readDca);
+    reader->setInputFileDataContainerArrayProxy(reader->readDataContainerArrayStructure(UnitTest::ExtractVertexGeometryTest::TestFile));
+    reader->execute();
+    DREAM3D_REQUIRED(reader->getErrorCode(), >=, 0)
+    CheckImplicitCoords(readDca->getDataContainer(k_VertexDataContainerName)->getGeometryAs<VertexGeom>(), imageGeom);
+
+    // Asking for the vertex list stores the same coordinates
+    SharedVertexList::Pointer vertices = vertexGeom->getVertices();
+    DREAM3D_REQUIRE(!vertexGeom->hasImplicitVertices())
+    DREAM3D_REQUIRE_EQUAL(vertices->getNumberOfTuples(), imageGeom->getNumberOfElements())
+    float expected[3] = {0.0f, 0.0f, 0.0f};
+    for(size_t i = 0; i < vertices->getNumberOfTuples(); i++)
+    {
+      imageGeom->getCoords(i, expected);
+      DREAM3D_REQUIRE_EQUAL(std::memcmp(vertices->getTuplePointer(i), expected, sizeof(expected)), 0)
+    }
+
+    // Preflight only hands out the shape of the vertex list
+    DataContainerArray::Pointer preflightDca = createDataContainerArray();
+    extVertGeomFilter->setDataContainerArray(preflightDca);
+    extVertGeomFilter->preflight();
+    DREAM3D_REQUIRE_EQUAL(extVertGeomFilter->getErrorCode(), 0)
+    VertexGeom::Pointer preflightGeom = preflightDca->getDataContainer(k_VertexDataContainerName)->getGeometryAs<VertexGeom>();
+    SharedVertexList::Pointer preflightVertices = preflightGeom->getVertices();
+    DREAM3D_REQUIRE_VALID_POINTER(preflightVertices)
+    DREAM3D_REQUIRE(!preflightVertices->isAllocated())
+    DREAM3D_REQUIRE_EQUAL(preflightVertices->getNumberOfTuples(), imageGeom->getNumberOfElements())
+    DREAM3D_REQUIRE_EQUAL(preflightVertices->getNumberOfComponents(), 3)
+    DREAM3D_REQUIRE(preflightGeom->hasImplicitVertices())
+  }
+
   // -----------------------------------------------------------------------------
   void operator()()
   {
@@ -247,6 +341,7 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
 
     DREAM3D_REGISTER_TEST(TestExtractVertexGeometryTest())
+    DREAM3D_REGISTER_TEST(TestImplicitVertices())
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
@@ -718,6 +718,115 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RunImportHDF5DatasetRegionTest()
+  {
+    const size_t nx = 6;
+    const size_t ny = 5;
+    const size_t nz = 4;
+    const size_t numComps = 2;
+    QString filePath = UnitTest::TestTempDir + "/ImportHDF5DatasetRegionTest.h5";
+
+    {
+      hid_t file_id = QH5Utilities::createFile(filePath);
+      DREAM3D_REQUIRE(file_id > 0);
+      H5ScopedFileSentinel sentinel(file_id, false);
+
+      // Stored the way DREAM.3D writes arrays: Z, Y, X followed by the components
+      hsize_t dims[4] = {nz, ny, nx, numComps};
+      std::vector<float> data(nx * ny * nz * numComps);
+      for(size_t i = 0; i < data.size(); i++)
+      {
+        data[i] = static_cast<float>(i * 5);
+      }
+      herr_t err = QH5Lite::writePointerDataset(file_id, "Volume", 4, dims, data.data());
+      DREAM3D_REQUIRE(err >= 0);
+    }
+
+    auto createImageDataContainerArray = [=]() {
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      DataContainer::Pointer dc = DataContainer::New("DataContainer");
+      ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+      image->setDimensions(nx, ny, nz);
+      image->setOrigin(10.0f, 20.0f, 30.0f);
+      image->setSpacing(0.25f, 0.5f, 1.0f);
+      dc->setGeometry(image);
+      dca->addOrReplaceDataContainer(dc);
+      dc->addOrReplaceAttributeMatrix(AttributeMatrix::New({nx, ny, nz}, "AttributeMatrix", AttributeMatrix::Type::Cell));
+      return dca;
+    };
+
+    ImportHDF5Dataset::Pointer filter = ImportHDF5Dataset::New();
+    filter->setHDF5FilePath(filePath);
+    filter->setSelectedAttributeMatrix(DataArrayPath("DataContainer", "AttributeMatrix", ""));
+    ImportHDF5Dataset::DatasetImportInfo importInfo;
+    importInfo.dataSetPath = "/Volume";
+    importInfo.componentDimensions = "2";
+    filter->setDatasetImportInfoList({importInfo});
+    filter->setUseRegion(true);
+    filter->setRegionMinIndex(IntVec3Type(1, 0, 1));
+    filter->setRegionMaxIndex(IntVec3Type(5, 4, 2));
+    filter->setRegionStride(IntVec3Type(2, 2, 1));
+
+    DataContainerArray::Pointer dca = createImageDataContainerArray();
+    filter->setDataContainerArray(dca);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0);
+
+    ImageGeom::Pointer image = dca->getDataContainer("DataContainer")->getGeometryAs<ImageGeom>();
+    SizeVec3Type geomDims = image->getDimensions();
+    DREAM3D_REQUIRE_EQUAL(geomDims[0], 3);
+    DREAM3D_REQUIRE_EQUAL(geomDims[1], 3);
+    DREAM3D_REQUIRE_EQUAL(geomDims[2], 2);
+    FloatVec3Type origin = image->getOrigin();
+    DREAM3D_REQUIRE_EQUAL(origin[0], 10.25f);
+    DREAM3D_REQUIRE_EQUAL(origin[1], 20.0f);
+    DREAM3D_REQUIRE_EQUAL(origin[2], 31.0f);
+    FloatVec3Type spacing = image->getSpacing();
+    DREAM3D_REQUIRE_EQUAL(spacing[0], 0.5f);
+    DREAM3D_REQUIRE_EQUAL(spacing[1], 1.0f);
+    DREAM3D_REQUIRE_EQUAL(spacing[2], 1.0f);
+
+    FloatArrayType::Pointer da = dca->getPrereqArrayFromPath<FloatArrayType>(filter.get(), DataArrayPath("DataContainer", "AttributeMatrix", "Volume"));
+    DREAM3D_REQUIRE_VALID_POINTER(da.get());
+    DREAM3D_REQUIRE_EQUAL(da->getNumberOfTuples(), 18);
+    DREAM3D_REQUIRE_EQUAL(da->getNumberOfComponents(), 2);
+    size_t index = 0;
+    for(size_t z = 0; z < 2; z++)
+    {
+      for(size_t y = 0; y < 3; y++)
+      {
+        for(size_t x = 0; x < 3; x++)
+        {
+          size_t fileTuple = (1 + z) * nx * ny + (y * 2) * nx + (1 + x * 2);
+          for(size_t c = 0; c < numComps; c++)
+          {
+            DREAM3D_REQUIRE_EQUAL(da->getComponent(index, c), static_cast<float>((fileTuple * numComps + c) * 5));
+          }
+          index++;
+        }
+      }
+    }
+
+    // Region outside of the Attribute Matrix dimensions
+    filter->setRegionMaxIndex(IntVec3Type(6, 4, 2));
+    filter->setDataContainerArray(createImageDataContainerArray());
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -20012);
+
+    // Attribute Matrix that already holds arrays
+    filter->setRegionMaxIndex(IntVec3Type(5, 4, 2));
+    dca = createImageDataContainerArray();
+    dca->getAttributeMatrix(DataArrayPath("DataContainer", "AttributeMatrix", ""))->insertOrAssign(FloatArrayType::CreateArray(nx * ny * nz, "Existing", true));
+    filter->setDataContainerArray(dca);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -20013);
+
+    QFile::remove(filePath);
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -732,6 +841,7 @@ public:
     //#endif
 
     DREAM3D_REGISTER_TEST(RunImportHDF5DatasetTest())
+    DREAM3D_REGISTER_TEST(RunImportHDF5DatasetRegionTest())
 
     //#if REMOVE_TEST_FILES
     //    DREAM3D_REGISTER_TEST(RemoveTestFiles())
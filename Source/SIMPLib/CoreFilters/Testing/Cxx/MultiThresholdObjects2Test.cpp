@@ -352,6 +352,52 @@ public:
     compSet->setInvertComparison(true);
     ComparisonSetTest(filter, compSet, SIMPL::GeneralData::ThresholdArray + QString::number(3), expectedOutput);
 
+    // Nested, inverted ComparisonSet mixed with values from arrays of different types
+    ComparisonSet::Pointer outerSet = ComparisonSet::New();
+
+    ComparisonValue::Pointer comp3 = ComparisonValue::New();
+    comp3->setAttributeArrayName(path.getDataArrayName());
+    comp3->setCompOperator(SIMPL::Comparison::Operator_LessThan);
+    comp3->setCompValue(5);
+    outerSet->addComparison(comp3);
+
+    ComparisonSet::Pointer innerSet = ComparisonSet::New();
+    innerSet->setUnionOperator(SIMPL::Union::Operator_And);
+    innerSet->setInvertComparison(true);
+    ComparisonValue::Pointer comp4 = ComparisonValue::New();
+    comp4->setAttributeArrayName(path.getDataArrayName());
+    comp4->setCompOperator(SIMPL::Comparison::Operator_GreaterThan);
+    comp4->setCompValue(2);
+    innerSet->addComparison(comp4);
+    ComparisonValue::Pointer comp5 = ComparisonValue::New();
+    comp5->setUnionOperator(SIMPL::Union::Operator_And);
+    comp5->setAttributeArrayName(path.getDataArrayName());
+    comp5->setCompOperator(SIMPL::Comparison::Operator_LessThan);
+    comp5->setCompValue(8);
+    innerSet->addComparison(comp5);
+    outerSet->addComparison(innerSet);
+
+    ComparisonValue::Pointer comp6 = ComparisonValue::New();
+    comp6->setUnionOperator(SIMPL::Union::Operator_Or);
+    comp6->setAttributeArrayName(path.getDataArrayName());
+    comp6->setCompOperator(SIMPL::Comparison::Operator_Equal);
+    comp6->setCompValue(12);
+    outerSet->addComparison(comp6);
+
+    ComparisonValue::Pointer comp7 = ComparisonValue::New();
+    comp7->setUnionOperator(SIMPL::Union::Operator_Or);
+    comp7->setAttributeArrayName("TestArrayFloat");
+    comp7->setCompOperator(SIMPL::Comparison::Operator_GreaterThan);
+    comp7->setCompValue(0.185);
+    outerSet->addComparison(comp7);
+
+    bool expectedOutput3[] = {true,  true,  true,  false, false, // 0, 1, 2, 3, 4
+                              false, false, false, false, false, // 5, 6, 7, 8, 9
+                              false, false, true,  false, false, // 10, 11, 12, 13, 14
+                              false, false, false, true,  true}; // 15, 16, 17, 18, 19
+
+    ComparisonSetTest(filter, outerSet, SIMPL::GeneralData::ThresholdArray + QString::number(4), expectedOutput3);
+
     return 1;
   }
 
@@ -0,0 +1,343 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <random>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Plugin/ISIMPLibPlugin.h"
+#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+
+class ReorderUnstructuredGeometryTest
+{
+
+public:
+  ReorderUnstructuredGeometryTest() = default;
+  ~ReorderUnstructuredGeometryTest() = default;
+  ReorderUnstructuredGeometryTest(const ReorderUnstructuredGeometryTest&) = delete;            // Copy Constructor
+  ReorderUnstructuredGeometryTest(ReorderUnstructuredGeometryTest&&) = delete;                 // Move Constructor
+  ReorderUnstructuredGeometryTest& operator=(const ReorderUnstructuredGeometryTest&) = delete; // Copy Assignment
+  ReorderUnstructuredGeometryTest& operator=(ReorderUnstructuredGeometryTest&&) = delete;      // Move Assignment
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestFilterAvailability()
+  {
+    // Now instantiate the ReorderUnstructuredGeometry Filter from the FilterManager
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(m_FilterName);
+    if(nullptr == filterFactory.get())
+    {
+      std::stringstream ss;
+      ss << "The ReorderUnstructuredGeometryTest Requires the use of the " << m_FilterName.toStdString() << " filter which is found in Core Filters";
+      DREAM3D_TEST_THROW_EXCEPTION(ss.str())
+    }
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Builds a triangulated k_GridSize x k_GridSize plane whose vertices and triangles are stored in a shuffled order.
+  // The vertex and face data hold the coordinates and index of each vertex and triangle so their permutation can be
+  // checked against the geometry.
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createDataContainerArray()
+  {
+    const size_t numVerts = (k_GridSize + 1) * (k_GridSize + 1);
+    const size_t numTris = 2 * k_GridSize * k_GridSize;
+    std::mt19937 generator(7);
+
+    std::vector<MeshIndexType> vertSlots(numVerts);
+    std::iota(vertSlots.begin(), vertSlots.end(), 0);
+    std::shuffle(vertSlots.begin(), vertSlots.end(), generator);
+
+    SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(numVerts);
+    for(size_t j = 0; j <= k_GridSize; j++)
+    {
+      for(size_t i = 0; i <= k_GridSize; i++)
+      {
+        float* coords = vertices->getTuplePointer(vertSlots[j * (k_GridSize + 1) + i]);
+        coords[0] = static_cast<float>(i);
+        coords[1] = static_cast<float>(j);
+        coords[2] = 0.0f;
+      }
+    }
+
+    std::vector<MeshIndexType> triSlots(numTris);
+    std::iota(triSlots.begin(), triSlots.end(), 0);
+    std::shuffle(triSlots.begin(), triSlots.end(), generator);
+
+    TriangleGeom::Pointer triangleGeom = TriangleGeom::CreateGeometry(numTris, vertices, SIMPL::Geometry::TriangleGeometry);
+    SharedTriList::Pointer triangles = triangleGeom->getTriangles();
+    for(size_t j = 0; j < k_GridSize; j++)
+    {
+      for(size_t i = 0; i < k_GridSize; i++)
+      {
+        MeshIndexType v0 = vertSlots[j * (k_GridSize + 1) + i];
+        MeshIndexType v1 = vertSlots[j * (k_GridSize + 1) + i + 1];
+        MeshIndexType v2 = vertSlots[(j + 1) * (k_GridSize + 1) + i + 1];
+        MeshIndexType v3 = vertSlots[(j + 1) * (k_GridSize + 1) + i];
+        size_t quad = j * k_GridSize + i;
+        triangles->setTuple(triSlots[2 * quad], std::vector<MeshIndexType>{v0, v1, v2});
+        triangles->setTuple(triSlots[2 * quad + 1], std::vector<MeshIndexType>{v0, v2, v3});
+      }
+    }
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New(k_DataContainerName);
+    dc->setGeometry(triangleGeom);
+    dca->addOrReplaceDataContainer(dc);
+
+    AttributeMatrix::Pointer vertexAM = AttributeMatrix::New({numVerts}, k_VertexAttributeMatrixName, AttributeMatrix::Type::Vertex);
+    dc->addOrReplaceAttributeMatrix(vertexAM);
+    FloatArrayType::Pointer coordsCopy = std::dynamic_pointer_cast<FloatArrayType>(vertices->deepCopy());
+    coordsCopy->setName(k_CoordinatesArrayName);
+    vertexAM->insertOrAssign(coordsCopy);
+
+    AttributeMatrix::Pointer faceAM = AttributeMatrix::New({numTris}, k_FaceAttributeMatrixName, AttributeMatrix::Type::Face);
+    dc->addOrReplaceAttributeMatrix(faceAM);
+    Int32ArrayType::Pointer faceIds = Int32ArrayType::CreateArray(numTris, k_FaceIdsArrayName, true);
+    for(size_t t = 0; t < numTris; t++)
+    {
+      faceIds->setValue(t, static_cast<int32_t>(t));
+    }
+    faceAM->insertOrAssign(faceIds);
+
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestReorder(int curveType)
+  {
+    DataContainerArray::Pointer dca = createDataContainerArray();
+    DataContainer::Pointer dc = dca->getDataContainer(k_DataContainerName);
+    TriangleGeom::Pointer triangleGeom = dc->getGeometryAs<TriangleGeom>();
+    SharedVertexList::Pointer originalVerts = std::dynamic_pointer_cast<SharedVertexList>(triangleGeom->getVertices()->deepCopy());
+    SharedTriList::Pointer originalTris = std::dynamic_pointer_cast<SharedTriList>(triangleGeom->getTriangles()->deepCopy());
+
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(m_FilterName);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    var.setValue(DataArrayPath(k_DataContainerName, "", ""));
+    bool propWasSet = filter->setProperty("DataContainerName", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(curveType);
+    propWasSet = filter->setProperty("CurveType", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(true);
+    propWasSet = filter->setProperty("SaveOriginalIds", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(DataArrayPath(k_DataContainerName, k_VertexAttributeMatrixName, k_OriginalVertexIdsArrayName));
+    propWasSet = filter->setProperty("OriginalVertexIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(DataArrayPath(k_DataContainerName, k_FaceAttributeMatrixName, k_OriginalFaceIdsArrayName));
+    propWasSet = filter->setProperty("OriginalElementIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0);
+
+    AttributeMatrix::Pointer vertexAM = dc->getAttributeMatrix(k_VertexAttributeMatrixName);
+    AttributeMatrix::Pointer faceAM = dc->getAttributeMatrix(k_FaceAttributeMatrixName);
+    Int64ArrayType::Pointer originalVertIds = vertexAM->getAttributeArrayAs<Int64ArrayType>(k_OriginalVertexIdsArrayName);
+    Int64ArrayType::Pointer originalFaceIds = faceAM->getAttributeArrayAs<Int64ArrayType>(k_OriginalFaceIdsArrayName);
+    DREAM3D_REQUIRE_VALID_POINTER(originalVertIds)
+    DREAM3D_REQUIRE_VALID_POINTER(originalFaceIds)
+
+    // The vertices and the vertex data moved together, and the saved ids point back at where they came from
+    SharedVertexList::Pointer vertices = triangleGeom->getVertices();
+    FloatArrayType::Pointer coordsCopy = vertexAM->getAttributeArrayAs<FloatArrayType>(k_CoordinatesArrayName);
+    std::vector<bool> seen(vertices->getNumberOfTuples(), false);
+    for(size_t v = 0; v < vertices->getNumberOfTuples(); v++)
+    {
+      size_t oldId = static_cast<size_t>(originalVertIds->getValue(v));
+      DREAM3D_REQUIRE(!seen[oldId])
+      seen[oldId] = true;
+      for(size_t c = 0; c < 3; c++)
+      {
+        DREAM3D_REQUIRE_EQUAL(vertices->getComponent(v, c), originalVerts->getComponent(oldId, c))
+        DREAM3D_REQUIRE_EQUAL(coordsCopy->getComponent(v, c), originalVerts->getComponent(oldId, c))
+      }
+    }
+
+    // Each triangle and its face data moved together, and its corners are still the same points
+    SharedTriList::Pointer triangles = triangleGeom->getTriangles();
+    Int32ArrayType::Pointer faceIds = faceAM->getAttributeArrayAs<Int32ArrayType>(k_FaceIdsArrayName);
+    for(size_t t = 0; t < triangles->getNumberOfTuples(); t++)
+    {
+      int64_t oldId = originalFaceIds->getValue(t);
+      DREAM3D_REQUIRE_EQUAL(static_cast<int64_t>(faceIds->getValue(t)), oldId)
+      for(size_t c = 0; c < 3; c++)
+      {
+        MeshIndexType oldVert = static_cast<MeshIndexType>(originalVertIds->getValue(triangles->getComponent(t, c)));
+        DREAM3D_REQUIRE_EQUAL(oldVert, originalTris->getComponent(static_cast<size_t>(oldId), c))
+      }
+    }
+
+    // Neighboring vertices along the curve are close together, which the shuffled input is not
+    DREAM3D_REQUIRED(meanStep(vertices), <, meanStep(originalVerts) / 4.0f);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  float meanStep(const SharedVertexList::Pointer& vertices)
+  {
+    float total = 0.0f;
+    for(size_t v = 1; v < vertices->getNumberOfTuples(); v++)
+    {
+      total += std::abs(vertices->getComponent(v, 0) - vertices->getComponent(v - 1, 0)) + std::abs(vertices->getComponent(v, 1) - vertices->getComponent(v - 1, 1));
+    }
+    return total / static_cast<float>(vertices->getNumberOfTuples() - 1);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMismatchedAttributeMatrix()
+  {
+    DataContainerArray::Pointer dca = createDataContainerArray();
+    DataContainer::Pointer dc = dca->getDataContainer(k_DataContainerName);
+    dc->getAttributeMatrix(k_FaceAttributeMatrixName)->resizeAttributeArrays({3});
+
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(m_FilterName);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    var.setValue(DataArrayPath(k_DataContainerName, "", ""));
+    bool propWasSet = filter->setProperty("DataContainerName", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -5564)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestOriginalIdsInOtherDataContainer()
+  {
+    DataContainerArray::Pointer dca = createDataContainerArray();
+    DataContainer::Pointer otherDc = DataContainer::New("OtherDataContainer");
+    dca->addOrReplaceDataContainer(otherDc);
+    otherDc->addOrReplaceAttributeMatrix(AttributeMatrix::New({3}, k_VertexAttributeMatrixName, AttributeMatrix::Type::Vertex));
+
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(m_FilterName);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    var.setValue(DataArrayPath(k_DataContainerName, "", ""));
+    bool propWasSet = filter->setProperty("DataContainerName", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(true);
+    propWasSet = filter->setProperty("SaveOriginalIds", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    // The other Vertex Attribute Matrix has fewer tuples than the Geometry has vertices
+    var.setValue(DataArrayPath("OtherDataContainer", k_VertexAttributeMatrixName, k_OriginalVertexIdsArrayName));
+    propWasSet = filter->setProperty("OriginalVertexIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(DataArrayPath(k_DataContainerName, k_FaceAttributeMatrixName, k_OriginalFaceIdsArrayName));
+    propWasSet = filter->setProperty("OriginalElementIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -5571)
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -5571)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### ReorderUnstructuredGeometryTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestFilterAvailability())
+
+    DREAM3D_REGISTER_TEST(TestReorder(0))
+    DREAM3D_REGISTER_TEST(TestReorder(1))
+    DREAM3D_REGISTER_TEST(TestMismatchedAttributeMatrix())
+    DREAM3D_REGISTER_TEST(TestOriginalIdsInOtherDataContainer())
+  }
+
+private:
+  QString m_FilterName = QString("ReorderUnstructuredGeometry");
+
+  static constexpr size_t k_GridSize = 24;
+  const QString k_DataContainerName = QString("DataContainer");
+  const QString k_VertexAttributeMatrixName = QString("VertexData");
+  const QString k_FaceAttributeMatrixName = QString("FaceData");
+  const QString k_CoordinatesArrayName = QString("Coordinates");
+  const QString k_FaceIdsArrayName = QString("FaceIds");
+  const QString k_OriginalVertexIdsArrayName = QString("OriginalVertexIds");
+  const QString k_OriginalFaceIdsArrayName = QString("OriginalFaceIds");
+};
@@ -39,6 +39,7 @@
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/FilterParameters/DynamicTableData.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
@@ -279,6 +280,94 @@ public:
     SET_PROPERTIES_AND_CHECK_EQ(filter, 10.0, 5.0, attrMat_double_1, dataArray, double)
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void validateReplaceMap(AbstractFilter::Pointer filter, DataContainerArray::Pointer dca)
+  {
+    QVariant var;
+    bool propWasSet;
+    int err = 0;
+
+    DataArrayPath path("ReplaceValueTest", "ReplaceValueAttrMat", "int32_t1");
+    Int32ArrayType::Pointer dataArray = dca->getPrereqArrayFromPath<Int32ArrayType>(nullptr, path, {1});
+    DREAM3D_REQUIRE_VALID_POINTER(dataArray.get())
+    size_t numTuples = dataArray->getNumberOfTuples();
+
+    var.setValue(path);
+    propWasSet = filter->setProperty("SelectedArray", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+    var.setValue(1);
+    propWasSet = filter->setProperty("ReplaceMode", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    // More pairs than the linear scan handles. Each value must be replaced once, never chained.
+    std::vector<std::vector<double>> table;
+    for(int32_t k = 9; k >= 0; k--)
+    {
+      table.push_back({static_cast<double>(k), static_cast<double>(k + 1)});
+    }
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      dataArray->setValue(i, static_cast<int32_t>(i % 12));
+    }
+    var.setValue(DynamicTableData(table));
+    propWasSet = filter->setProperty("ReplaceMap", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+    filter->execute();
+    err = filter->getErrorCode();
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      int32_t original = static_cast<int32_t>(i % 12);
+      DREAM3D_REQUIRE_EQUAL(dataArray->getValue(i), (original < 10 ? original + 1 : original))
+    }
+
+    // A small map swapping two values
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      dataArray->setValue(i, static_cast<int32_t>(i % 3));
+    }
+    table = {{0.0, 1.0}, {1.0, 0.0}};
+    var.setValue(DynamicTableData(table));
+    filter->setProperty("ReplaceMap", var);
+    filter->execute();
+    err = filter->getErrorCode();
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      int32_t original = static_cast<int32_t>(i % 3);
+      DREAM3D_REQUIRE_EQUAL(dataArray->getValue(i), (original == 2 ? 2 : 1 - original))
+    }
+
+    // Fail if a value appears twice
+    table = {{0.0, 1.0}, {0.0, 2.0}};
+    var.setValue(DynamicTableData(table));
+    filter->setProperty("ReplaceMap", var);
+    filter->execute();
+    err = filter->getErrorCode();
+    DREAM3D_REQUIRE_EQUAL(err, -11005)
+
+    // Fail if two values collapse onto the same integer
+    table = {{1.2, 5.0}, {1.7, 6.0}};
+    var.setValue(DynamicTableData(table));
+    filter->setProperty("ReplaceMap", var);
+    filter->execute();
+    err = filter->getErrorCode();
+    DREAM3D_REQUIRE_EQUAL(err, -11005)
+
+    // Fail if a value in the map is out of range
+    table = {{0.0, 2147483648.0}};
+    var.setValue(DynamicTableData(table));
+    filter->setProperty("ReplaceMap", var);
+    filter->execute();
+    err = filter->getErrorCode();
+    DREAM3D_REQUIRE_EQUAL(err, -100)
+
+    var.setValue(0);
+    filter->setProperty("ReplaceMode", var);
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -297,6 +386,7 @@ public:
     replaceValueFilter->setDataContainerArray(dca);
 
     validateReplaceValue(replaceValueFilter, dca);
+    validateReplaceMap(replaceValueFilter, dca);
 
     return EXIT_SUCCESS;
   }
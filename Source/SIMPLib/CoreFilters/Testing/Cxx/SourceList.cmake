@@ -45,6 +45,7 @@ set(TEST_${SUBDIR_NAME}_NAMES
   RenameAttributeMatrixTest
   RenameDataContainerTest
   # RenameTimingTest
+  ReorderUnstructuredGeometryTest
   ReplaceValueTest
   RequiredZThicknessTest
   RotateSampleRefFrameTest
@@ -35,6 +35,11 @@
 
 #pragma once
 
+#include <clocale>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
 #include <QtCore/QFile>
 #include <QtCore/QTextStream>
 
@@ -54,6 +59,7 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/CoreFilters/WriteTriangleGeometry.h"
 
 class WriteTriangleGeometryTest
 {
@@ -294,6 +300,210 @@ public:
     fileTriangles.close();
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer CreateTriangleGeometry(size_t numNodes, size_t numTriangles)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New(DataArrayPath("DataContainer", "", ""));
+    dca->addOrReplaceDataContainer(dc);
+
+    std::vector<size_t> cDims(1, 3);
+    FloatArrayType::Pointer vertices = FloatArrayType::CreateArray(numNodes, cDims, "TriVertexList", true);
+    for(size_t i = 0; i < vertices->getSize(); i++)
+    {
+      vertices->setValue(i, static_cast<float>(i % 1000) * 0.25f - 100.0f);
+    }
+
+    SharedTriList::Pointer tris = SharedTriList::CreateArray(numTriangles, cDims, "TriangleList", true);
+    for(size_t i = 0; i < tris->getSize(); i++)
+    {
+      tris->setValue(i, (i * 7) % numNodes);
+    }
+
+    dc->setGeometry(TriangleGeom::CreateGeometry(tris, vertices, SIMPL::Geometry::TriangleGeometry));
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  AbstractFilter::Pointer CreateWriter(const DataContainerArray::Pointer& dca, WriteTriangleGeometry::OutputFormat format)
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(m_FilterName);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    var.setValue(DataArrayPath("DataContainer", "", ""));
+    bool propWasSet = filter->setProperty("DataContainerSelection", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(UnitTest::WriteTriangleGeometryTest::NodesFile);
+    propWasSet = filter->setProperty("OutputNodesFile", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(UnitTest::WriteTriangleGeometryTest::TrianglesFile);
+    propWasSet = filter->setProperty("OutputTrianglesFile", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(static_cast<int>(format));
+    propWasSet = filter->setProperty("OutputFormat", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestWriteMultiBlockText()
+  {
+    // Enough rows that the text is formatted in several blocks which must be written in order
+    const size_t numNodes = 100000;
+    const size_t numTriangles = 70001;
+    DataContainerArray::Pointer dca = CreateTriangleGeometry(numNodes, numTriangles);
+    TriangleGeom::Pointer triGeom = dca->getDataContainer("DataContainer")->getGeometryAs<TriangleGeom>();
+
+    AbstractFilter::Pointer filter = CreateWriter(dca, WriteTriangleGeometry::OutputFormat::Text);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0);
+
+    QFile fileNodes(UnitTest::WriteTriangleGeometryTest::NodesFile);
+    DREAM3D_REQUIRE(fileNodes.open(QIODevice::ReadOnly | QIODevice::Text))
+    QTextStream inFileNodes(&fileNodes);
+    for(int i = 0; i < 5; i++)
+    {
+      inFileNodes.readLine();
+    }
+    float* nodes = triGeom->getVertexPointer(0);
+    for(size_t i = 0; i < numNodes; i++)
+    {
+      QString line = inFileNodes.readLine();
+      QString expected = QString("%1 %2 %3")
+                             .arg(QString::number(nodes[i * 3], 'f', 5), 8)
+                             .arg(QString::number(nodes[i * 3 + 1], 'f', 5), 8)
+                             .arg(QString::number(nodes[i * 3 + 2], 'f', 5), 8);
+      DREAM3D_REQUIRE(line == expected)
+    }
+    DREAM3D_REQUIRE(inFileNodes.atEnd())
+    fileNodes.close();
+
+    QFile fileTriangles(UnitTest::WriteTriangleGeometryTest::TrianglesFile);
+    DREAM3D_REQUIRE(fileTriangles.open(QIODevice::ReadOnly | QIODevice::Text))
+    QTextStream inFileTriangles(&fileTriangles);
+    for(int i = 0; i < 9; i++)
+    {
+      inFileTriangles.readLine();
+    }
+    MeshIndexType* tris = triGeom->getTriPointer(0);
+    for(size_t i = 0; i < numTriangles; i++)
+    {
+      QString line = inFileTriangles.readLine();
+      QString expected = QString("%1 %2 %3").arg(tris[i * 3]).arg(tris[i * 3 + 1]).arg(tris[i * 3 + 2]);
+      DREAM3D_REQUIRE(line == expected)
+    }
+    DREAM3D_REQUIRE(inFileTriangles.atEnd())
+    fileTriangles.close();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestWriteTextCommaLocale()
+  {
+    // QCoreApplication adopts the locale of the environment on Unix, which uses a decimal comma in many countries
+    const std::string previousLocale = std::setlocale(LC_NUMERIC, nullptr);
+    const char* commaLocale = nullptr;
+    for(const char* name : {"de_DE.UTF-8", "de_DE.utf8", "de_DE", "fr_FR.UTF-8", "fr_FR.utf8", "fr_FR", "German_Germany.1252"})
+    {
+      if(nullptr != std::setlocale(LC_NUMERIC, name))
+      {
+        commaLocale = name;
+        break;
+      }
+    }
+    char probe[16];
+    if(nullptr == commaLocale || std::snprintf(probe, sizeof(probe), "%.1f", 1.5) != 3 || probe[1] != ',')
+    {
+      std::setlocale(LC_NUMERIC, previousLocale.c_str());
+      std::cout << "No locale with a decimal comma is installed. Skipping the test." << std::endl;
+      return;
+    }
+
+    DataContainerArray::Pointer dca = CreateTriangleGeometry(12, 4);
+    AbstractFilter::Pointer filter = CreateWriter(dca, WriteTriangleGeometry::OutputFormat::Text);
+    filter->execute();
+    std::setlocale(LC_NUMERIC, previousLocale.c_str());
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0);
+
+    QFile fileNodes(UnitTest::WriteTriangleGeometryTest::NodesFile);
+    DREAM3D_REQUIRE(fileNodes.open(QIODevice::ReadOnly | QIODevice::Text))
+    QTextStream inFileNodes(&fileNodes);
+    for(int i = 0; i < 5; i++)
+    {
+      inFileNodes.readLine();
+    }
+    // The first coordinates are -100, -99.75 and -99.5
+    DREAM3D_REQUIRE(inFileNodes.readLine() == QString("-100.00000 -99.75000 -99.50000"))
+    while(!inFileNodes.atEnd())
+    {
+      DREAM3D_REQUIRE(!inFileNodes.readLine().contains(','))
+    }
+    fileNodes.close();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestWriteBinary()
+  {
+    const size_t numNodes = 99;
+    const size_t numTriangles = 33;
+    DataContainerArray::Pointer dca = CreateTriangleGeometry(numNodes, numTriangles);
+    TriangleGeom::Pointer triGeom = dca->getDataContainer("DataContainer")->getGeometryAs<TriangleGeom>();
+
+    AbstractFilter::Pointer filter = CreateWriter(dca, WriteTriangleGeometry::OutputFormat::Binary);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0);
+
+    // Nodes: 32 byte header then X Y Z float32 values
+    QFile fileNodes(UnitTest::WriteTriangleGeometryTest::NodesFile);
+    DREAM3D_REQUIRE(fileNodes.open(QIODevice::ReadOnly))
+    QByteArray bytes = fileNodes.readAll();
+    fileNodes.close();
+    DREAM3D_REQUIRE_EQUAL(bytes.size(), static_cast<int>(32 + numNodes * 3 * sizeof(float)))
+    DREAM3D_REQUIRE(bytes.left(8) == QByteArray("D3DNODES"))
+
+    uint32_t version = 0;
+    uint32_t components = 0;
+    uint64_t count = 0;
+    std::memcpy(&version, bytes.constData() + 8, sizeof(version));
+    std::memcpy(&components, bytes.constData() + 12, sizeof(components));
+    std::memcpy(&count, bytes.constData() + 16, sizeof(count));
+    DREAM3D_REQUIRE_EQUAL(version, 1u)
+    DREAM3D_REQUIRE_EQUAL(components, 3u)
+    DREAM3D_REQUIRE_EQUAL(count, numNodes)
+    DREAM3D_REQUIRE(std::memcmp(bytes.constData() + 32, triGeom->getVertexPointer(0), numNodes * 3 * sizeof(float)) == 0)
+
+    // Triangles: 32 byte header then 3 uint64 node ids per triangle
+    QFile fileTriangles(UnitTest::WriteTriangleGeometryTest::TrianglesFile);
+    DREAM3D_REQUIRE(fileTriangles.open(QIODevice::ReadOnly))
+    bytes = fileTriangles.readAll();
+    fileTriangles.close();
+    DREAM3D_REQUIRE_EQUAL(bytes.size(), static_cast<int>(32 + numTriangles * 3 * sizeof(uint64_t)))
+    DREAM3D_REQUIRE(std::memcmp(bytes.constData(), "D3DTRIS", 8) == 0)
+
+    uint64_t nodeCount = 0;
+    std::memcpy(&count, bytes.constData() + 16, sizeof(count));
+    std::memcpy(&nodeCount, bytes.constData() + 24, sizeof(nodeCount));
+    DREAM3D_REQUIRE_EQUAL(count, numTriangles)
+    DREAM3D_REQUIRE_EQUAL(nodeCount, numNodes)
+    DREAM3D_REQUIRE(std::memcmp(bytes.constData() + 32, triGeom->getTriPointer(0), numTriangles * 3 * sizeof(uint64_t)) == 0)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -306,6 +516,9 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
 
     DREAM3D_REGISTER_TEST(TestWriteTriangleGeometryTest())
+    DREAM3D_REGISTER_TEST(TestWriteMultiBlockText())
+    DREAM3D_REGISTER_TEST(TestWriteTextCommaLocale())
+    DREAM3D_REGISTER_TEST(TestWriteBinary())
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
@@ -34,6 +34,11 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "WriteTriangleGeometry.h"
 
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
 #include <QtCore/QDir>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
@@ -43,15 +48,178 @@
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataContainerSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/Geometry/TriangleGeom.h"
 #include "SIMPLib/Utilities/FileSystemPathHelper.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+#include "SIMPLib/Utilities/SIMPLibEndian.h"
 
 #define WRITE_EDGES_FILE 0
 
+namespace
+{
+// Binary files start with a 32 byte header so the data block that follows stays 8 byte aligned
+constexpr char k_BinaryNodesMagic[8] = {'D', '3', 'D', 'N', 'O', 'D', 'E', 'S'};
+constexpr char k_BinaryTrianglesMagic[8] = {'D', '3', 'D', 'T', 'R', 'I', 'S', '\0'};
+constexpr uint32_t k_BinaryFormatVersion = 1;
+constexpr size_t k_BinaryHeaderSize = 32;
+
+// Text rows are formatted in blocks; a batch of blocks is formatted in parallel then written in order
+constexpr size_t k_RowsPerBlock = 32768;
+constexpr size_t k_BlocksPerBatch = 64;
+
+// Elements per write call when streaming a binary data block
+constexpr size_t k_BinaryChunkSize = 1048576;
+
+/**
+ * @brief AppendUnsigned Appends the decimal digits of value to the buffer
+ * @param buffer
+ * @param value
+ */
+void AppendUnsigned(std::string& buffer, uint64_t value)
+{
+  char digits[20];
+  size_t count = 0;
+  do
+  {
+    digits[count++] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while(value != 0);
+  while(count > 0)
+  {
+    buffer.push_back(digits[--count]);
+  }
+}
+
+/**
+ * @brief AppendCoordinate Appends value in fixed notation with 5 decimals, right aligned in 8 characters.
+ * Unlike printf this ignores LC_NUMERIC, which QCoreApplication sets from the environment on Unix, so the
+ * decimal separator is always a point.
+ * @param buffer
+ * @param value
+ */
+void AppendCoordinate(std::string& buffer, float value)
+{
+  const QByteArray digits = QByteArray::number(static_cast<double>(value), 'f', 5);
+  if(digits.size() < 8)
+  {
+    buffer.append(static_cast<size_t>(8 - digits.size()), ' ');
+  }
+  buffer.append(digits.constData(), static_cast<size_t>(digits.size()));
+}
+
+/**
+ * @brief WriteRowBlocks Formats numRows rows with formatRows(rowStart, rowEnd, buffer) in
+ * parallel blocks and writes the blocks to the file in row order
+ * @param filter
+ * @param file
+ * @param numRows
+ * @param formatRows
+ * @return true if every block was written
+ */
+template <typename FormatRows>
+bool WriteRowBlocks(const AbstractFilter* filter, QFile& file, size_t numRows, FormatRows formatRows)
+{
+  const size_t numBlocks = (numRows + k_RowsPerBlock - 1) / k_RowsPerBlock;
+  std::vector<std::string> buffers(std::min(numBlocks, k_BlocksPerBatch));
+
+  for(size_t firstBlock = 0; firstBlock < numBlocks; firstBlock += k_BlocksPerBatch)
+  {
+    if(filter->getCancel())
+    {
+      return true;
+    }
+    const size_t batchSize = std::min(k_BlocksPerBatch, numBlocks - firstBlock);
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, batchSize);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      for(size_t b = range.min(); b < range.max(); b++)
+      {
+        const size_t rowStart = (firstBlock + b) * k_RowsPerBlock;
+        const size_t rowEnd = std::min(rowStart + k_RowsPerBlock, numRows);
+        buffers[b].clear();
+        formatRows(rowStart, rowEnd, buffers[b]);
+      }
+    });
+
+    for(size_t b = 0; b < batchSize; b++)
+    {
+      const qint64 size = static_cast<qint64>(buffers[b].size());
+      if(file.write(buffers[b].data(), size) != size)
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief AppendLittleEndian Appends the little endian bytes of value to the header
+ * @param header
+ * @param value
+ */
+template <typename T>
+void AppendLittleEndian(QByteArray& header, T value)
+{
+  SIMPLib::Endian::FromSystemToLittle::convert(value);
+  header.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/**
+ * @brief CreateBinaryHeader Builds the fixed size header of a binary nodes or triangles file
+ * @param magic
+ * @param elementCount
+ * @param nodeCount Only used by the triangles file, 0 otherwise
+ * @return
+ */
+QByteArray CreateBinaryHeader(const char* magic, uint64_t elementCount, uint64_t nodeCount)
+{
+  QByteArray header(magic, 8);
+  AppendLittleEndian<uint32_t>(header, k_BinaryFormatVersion);
+  AppendLittleEndian<uint32_t>(header, 3);
+  AppendLittleEndian<uint64_t>(header, elementCount);
+  AppendLittleEndian<uint64_t>(header, nodeCount);
+  return header;
+}
+
+/**
+ * @brief WriteLittleEndianBlock Writes count values to the file in little endian byte order
+ * @param file
+ * @param data
+ * @param count
+ * @return true if every value was written
+ */
+template <typename T>
+bool WriteLittleEndianBlock(QFile& file, const T* data, size_t count)
+{
+#ifdef SIMPLib_BIG_ENDIAN
+  std::vector<T> swapped(std::min(count, k_BinaryChunkSize));
+#endif
+  for(size_t offset = 0; offset < count; offset += k_BinaryChunkSize)
+  {
+    const size_t chunk = std::min(k_BinaryChunkSize, count - offset);
+    const char* bytes = reinterpret_cast<const char*>(data + offset);
+#ifdef SIMPLib_BIG_ENDIAN
+    std::copy(data + offset, data + offset + chunk, swapped.begin());
+    std::for_each(swapped.begin(), swapped.begin() + chunk, [](T& value) { SIMPLib::Endian::FromSystemToLittle::convert(value); });
+    bytes = reinterpret_cast<const char*>(swapped.data());
+#endif
+    const qint64 size = static_cast<qint64>(chunk * sizeof(T));
+    if(file.write(bytes, size) != size)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -69,6 +237,12 @@ void WriteTriangleGeometry::setupFilterParameters()
 {
   FilterParameterVectorType parameters;
 
+  {
+    std::vector<QString> choices;
+    choices.push_back("Text");
+    choices.push_back("Binary");
+    parameters.push_back(SIMPL_NEW_CHOICE_FP("Output Format", OutputFormat, FilterParameter::Category::Parameter, WriteTriangleGeometry, choices, false));
+  }
   parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output Nodes File", OutputNodesFile, FilterParameter::Category::Parameter, WriteTriangleGeometry));
   parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output Triangles File", OutputTrianglesFile, FilterParameter::Category::Parameter, WriteTriangleGeometry));
 
@@ -89,6 +263,7 @@ void WriteTriangleGeometry::readFilterParameters(AbstractFilterParametersReader*
   setDataContainerSelection(reader->readDataArrayPath("DataContainerSelection", getDataContainerSelection()));
   setOutputNodesFile(reader->readString("OutputNodesFile", getOutputNodesFile()));
   setOutputTrianglesFile(reader->readString("OutputTrianglesFile", getOutputTrianglesFile()));
+  setOutputFormat(reader->readValue("OutputFormat", getOutputFormat()));
   reader->closeFilterGroup();
 }
 
@@ -107,6 +282,13 @@ void WriteTriangleGeometry::dataCheck()
   clearErrorCode();
   clearWarningCode();
 
+  if(getOutputFormat() != static_cast<int>(OutputFormat::Text) && getOutputFormat() != static_cast<int>(OutputFormat::Binary))
+  {
+    QString ss = QObject::tr("The Output Format must be 0 (Text) or 1 (Binary). The current value is %1").arg(getOutputFormat());
+    setErrorCondition(-388, ss);
+    return;
+  }
+
   QFileInfo fi(getOutputNodesFile());
   if(fi.suffix().compare("") == 0)
   {
@@ -162,107 +344,185 @@ void WriteTriangleGeometry::execute()
 
   TriangleGeom::Pointer triangleGeom = dataContainer->getGeometryAs<TriangleGeom>();
   QString geometryType = triangleGeom->getGeometryTypeAsString();
-  float* nodes = triangleGeom->getVertexPointer(0);
-  size_t* triangles = triangleGeom->getTriPointer(0);
+  const float* nodes = triangleGeom->getVertexPointer(0);
+  const size_t* triangles = triangleGeom->getTriPointer(0);
 
   size_t numNodes = triangleGeom->getNumberOfVertices();
-  size_t maxNodeId = numNodes - 1;
   size_t numTriangles = triangleGeom->getNumberOfTris();
 
-  // ++++++++++++++ Write the Nodes File +++++++++++++++++++++++++++++++++++++++++++
+  if(getOutputFormat() == static_cast<int>(OutputFormat::Binary))
+  {
+    writeBinaryFiles(nodes, numNodes, triangles, numTriangles);
+  }
+  else
+  {
+    writeTextFiles(nodes, numNodes, triangles, numTriangles, geometryType);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool WriteTriangleGeometry::openOutputFile(QFile& file, QIODevice::OpenMode mode)
+{
   // Make sure any directory path is also available as the user may have just typed
   // in a path without actually creating the full path
-
-  notifyStatusMessage("Writing Nodes Text File");
-  QFileInfo fi(getOutputNodesFile());
+  QFileInfo fi(file.fileName());
   QDir parentPath = fi.path();
 
   if(!parentPath.mkpath("."))
   {
     QString ss = QObject::tr("Error creating parent path '%1'").arg(parentPath.absolutePath());
     setErrorCondition(-1, ss);
-    return;
+    return false;
   }
 
-  QFile fileNodes(getOutputNodesFile());
-
-  if(!fileNodes.open(QIODevice::WriteOnly | QIODevice::Text))
+  if(!file.open(mode))
   {
-    QString ss = QObject::tr("Output file could not be opened: %1").arg(getOutputNodesFile());
+    QString ss = QObject::tr("Output file could not be opened: %1").arg(file.fileName());
     setErrorCondition(-100, ss);
-    return;
+    return false;
   }
+  return true;
+}
 
-  QTextStream outFileNodes(&fileNodes);
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void WriteTriangleGeometry::writeTextFiles(const float* nodes, size_t numNodes, const size_t* triangles, size_t numTriangles, const QString& geometryType)
+{
+  size_t maxNodeId = numNodes - 1;
 
-  outFileNodes << "# All lines starting with '#' are comments\n";
-  outFileNodes << "# DREAM.3D Nodes file\n";
-  outFileNodes << "# DREAM.3D Version " << SIMPLib::Version::Complete().toLatin1().constData() << "\n";
-  outFileNodes << "# Node Data is X Y Z space delimited.\n";
-  outFileNodes << "Node Count: " << numNodes << "\n";
+  // ++++++++++++++ Write the Nodes File +++++++++++++++++++++++++++++++++++++++++++
+  notifyStatusMessage("Writing Nodes Text File");
 
-  outFileNodes.setFieldWidth(8);
-  outFileNodes.setRealNumberPrecision(5);
-  outFileNodes.setRealNumberNotation(QTextStream::FixedNotation);
+  QFile fileNodes(getOutputNodesFile());
+  if(!openOutputFile(fileNodes, QIODevice::WriteOnly | QIODevice::Text))
+  {
+    return;
+  }
 
-  for(size_t i = 0; i < numNodes; i++)
   {
-    outFileNodes.setFieldWidth(8);
-    outFileNodes << nodes[i * 3] << qSetFieldWidth(0);
-    outFileNodes << " " << qSetFieldWidth(8);
-    outFileNodes << nodes[i * 3 + 1] << qSetFieldWidth(0);
-    outFileNodes << " " << qSetFieldWidth(8);
-    outFileNodes << nodes[i * 3 + 2] << qSetFieldWidth(0);
-    outFileNodes << "\n";
+    QTextStream outFileNodes(&fileNodes);
+    outFileNodes << "# All lines starting with '#' are comments\n";
+    outFileNodes << "# DREAM.3D Nodes file\n";
+    outFileNodes << "# DREAM.3D Version " << SIMPLib::Version::Complete().toLatin1().constData() << "\n";
+    outFileNodes << "# Node Data is X Y Z space delimited.\n";
+    outFileNodes << "Node Count: " << numNodes << "\n";
   }
 
+  // Each coordinate is written in fixed notation with 5 decimals, right aligned in 8 characters
+  bool written = WriteRowBlocks(this, fileNodes, numNodes, [nodes](size_t rowStart, size_t rowEnd, std::string& buffer) {
+    for(size_t i = rowStart; i < rowEnd; i++)
+    {
+      AppendCoordinate(buffer, nodes[i * 3]);
+      buffer.push_back(' ');
+      AppendCoordinate(buffer, nodes[i * 3 + 1]);
+      buffer.push_back(' ');
+      AppendCoordinate(buffer, nodes[i * 3 + 2]);
+      buffer.push_back('\n');
+    }
+  });
   fileNodes.close();
+  if(!written)
+  {
+    QString ss = QObject::tr("Error writing to the output file: %1").arg(getOutputNodesFile());
+    setErrorCondition(-101, ss);
+    return;
+  }
+  if(getCancel())
+  {
+    return;
+  }
 
   // ++++++++++++++ Write the Triangles File +++++++++++++++++++++++++++++++++++++++++++
-
   notifyStatusMessage("Writing Triangles Text File");
-  QFileInfo triFI(getOutputTrianglesFile());
-  parentPath.setPath(triFI.path());
 
-  if(!parentPath.mkpath("."))
+  QFile fileTri(getOutputTrianglesFile());
+  if(!openOutputFile(fileTri, QIODevice::WriteOnly | QIODevice::Text))
   {
-    QString ss = QObject::tr("Error creating parent path '%1'").arg(parentPath.absolutePath());
-    setErrorCondition(-1, ss);
     return;
   }
 
-  QFile fileTri(getOutputTrianglesFile());
+  {
+    QTextStream outFileTri(&fileTri);
+    outFileTri << "# All lines starting with '#' are comments\n";
+    outFileTri << "# DREAM.3D Triangle file\n";
+    outFileTri << "# DREAM.3D Version " << SIMPLib::Version::Complete().toLatin1().constData() << "\n";
+    outFileTri << "# Each Triangle consists of 3 Node Ids.\n";
+    outFileTri << "# NODE IDs START AT 0.\n";
+    outFileTri << "Geometry Type: " << geometryType.toLatin1().constData() << "\n";
+    outFileTri << "Node Count: " << numNodes << "\n";
+    outFileTri << "Max Node Id: " << maxNodeId << "\n";
+    outFileTri << "Triangle Count: " << numTriangles << "\n";
+  }
 
-  if(!fileTri.open(QIODevice::WriteOnly | QIODevice::Text))
+  written = WriteRowBlocks(this, fileTri, numTriangles, [triangles](size_t rowStart, size_t rowEnd, std::string& buffer) {
+    for(size_t j = rowStart; j < rowEnd; j++)
+    {
+      AppendUnsigned(buffer, triangles[j * 3]);
+      buffer.push_back(' ');
+      AppendUnsigned(buffer, triangles[j * 3 + 1]);
+      buffer.push_back(' ');
+      AppendUnsigned(buffer, triangles[j * 3 + 2]);
+      buffer.push_back('\n');
+    }
+  });
+  fileTri.close();
+  if(!written)
   {
-    QString ss = QObject::tr("Output file could not be opened: %1").arg(getOutputTrianglesFile());
-    setErrorCondition(-100, ss);
-    return;
+    QString ss = QObject::tr("Error writing to the output file: %1").arg(getOutputTrianglesFile());
+    setErrorCondition(-101, ss);
   }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void WriteTriangleGeometry::writeBinaryFiles(const float* nodes, size_t numNodes, const size_t* triangles, size_t numTriangles)
+{
+  static_assert(sizeof(size_t) == sizeof(uint64_t), "Binary triangle files store 64 bit node ids");
 
-  QTextStream outFileTri(&fileTri);
+  // ++++++++++++++ Write the Nodes File +++++++++++++++++++++++++++++++++++++++++++
+  notifyStatusMessage("Writing Nodes Binary File");
 
-  outFileTri << "# All lines starting with '#' are comments\n";
-  outFileTri << "# DREAM.3D Triangle file\n";
-  outFileTri << "# DREAM.3D Version " << SIMPLib::Version::Complete().toLatin1().constData() << "\n";
-  outFileTri << "# Each Triangle consists of 3 Node Ids.\n";
-  outFileTri << "# NODE IDs START AT 0.\n";
-  outFileTri << "Geometry Type: " << geometryType.toLatin1().constData() << "\n";
-  outFileTri << "Node Count: " << numNodes << "\n";
-  outFileTri << "Max Node Id: " << maxNodeId << "\n";
-  outFileTri << "Triangle Count: " << numTriangles << "\n";
+  QFile fileNodes(getOutputNodesFile());
+  if(!openOutputFile(fileNodes, QIODevice::WriteOnly))
+  {
+    return;
+  }
 
-  int n1, n2, n3;
-  for(size_t j = 0; j < numTriangles; ++j)
+  QByteArray header = CreateBinaryHeader(k_BinaryNodesMagic, numNodes, 0);
+  bool written = fileNodes.write(header) == static_cast<qint64>(k_BinaryHeaderSize) && WriteLittleEndianBlock(fileNodes, nodes, numNodes * 3);
+  fileNodes.close();
+  if(!written)
+  {
+    QString ss = QObject::tr("Error writing to the output file: %1").arg(getOutputNodesFile());
+    setErrorCondition(-101, ss);
+    return;
+  }
+  if(getCancel())
   {
-    n1 = triangles[j * 3];
-    n2 = triangles[j * 3 + 1];
-    n3 = triangles[j * 3 + 2];
+    return;
+  }
 
-    outFileTri << n1 << " " << n2 << " " << n3 << "\n";
+  // ++++++++++++++ Write the Triangles File +++++++++++++++++++++++++++++++++++++++++++
+  notifyStatusMessage("Writing Triangles Binary File");
+
+  QFile fileTri(getOutputTrianglesFile());
+  if(!openOutputFile(fileTri, QIODevice::WriteOnly))
+  {
+    return;
   }
 
+  header = CreateBinaryHeader(k_BinaryTrianglesMagic, numTriangles, numNodes);
+  written = fileTri.write(header) == static_cast<qint64>(k_BinaryHeaderSize) && WriteLittleEndianBlock(fileTri, reinterpret_cast<const uint64_t*>(triangles), numTriangles * 3);
   fileTri.close();
+  if(!written)
+  {
+    QString ss = QObject::tr("Error writing to the output file: %1").arg(getOutputTrianglesFile());
+    setErrorCondition(-101, ss);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -401,3 +661,15 @@ QString WriteTriangleGeometry::getOutputTrianglesFile() const
 {
   return m_OutputTrianglesFile;
 }
+
+// -----------------------------------------------------------------------------
+void WriteTriangleGeometry::setOutputFormat(int value)
+{
+  m_OutputFormat = value;
+}
+
+// -----------------------------------------------------------------------------
+int WriteTriangleGeometry::getOutputFormat() const
+{
+  return m_OutputFormat;
+}
@@ -37,6 +37,7 @@
 
 #include <memory>
 
+#include <QtCore/QFile>
 #include <QtCore/QString>
 
 #include "SIMPLib/Common/Constants.h"
@@ -63,6 +64,7 @@ class SIMPLib_EXPORT WriteTriangleGeometry : public AbstractFilter
   PYB11_PROPERTY(DataArrayPath DataContainerSelection READ getDataContainerSelection WRITE setDataContainerSelection)
   PYB11_PROPERTY(QString OutputNodesFile READ getOutputNodesFile WRITE setOutputNodesFile)
   PYB11_PROPERTY(QString OutputTrianglesFile READ getOutputTrianglesFile WRITE setOutputTrianglesFile)
+  PYB11_PROPERTY(int OutputFormat READ getOutputFormat WRITE setOutputFormat)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -76,6 +78,15 @@ public:
 
   static std::shared_ptr<WriteTriangleGeometry> New();
 
+  /**
+   * @brief The OutputFormat enum lists the file formats the filter can write
+   */
+  enum class OutputFormat : int
+  {
+    Text = 0,
+    Binary = 1
+  };
+
   /**
    * @brief Returns the name of the class for WriteTriangleGeometry
    */
@@ -123,6 +134,18 @@ public:
 
   Q_PROPERTY(QString OutputTrianglesFile READ getOutputTrianglesFile WRITE setOutputTrianglesFile)
 
+  /**
+   * @brief Setter property for OutputFormat
+   */
+  void setOutputFormat(int value);
+  /**
+   * @brief Getter property for OutputFormat
+   * @return Value of OutputFormat
+   */
+  int getOutputFormat() const;
+
+  Q_PROPERTY(int OutputFormat READ getOutputFormat WRITE setOutputFormat)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -196,6 +219,35 @@ protected:
    */
   void initialize();
 
+  /**
+   * @brief openOutputFile Creates the parent directory of the file and opens it for writing
+   * @param file
+   * @param mode
+   * @return true if the file was opened
+   */
+  bool openOutputFile(QFile& file, QIODevice::OpenMode mode);
+
+  /**
+   * @brief writeTextFiles Writes the ASCII nodes and triangles files. Blocks of rows are
+   * formatted in parallel and written to the file in order.
+   * @param nodes
+   * @param numNodes
+   * @param triangles
+   * @param numTriangles
+   * @param geometryType
+   */
+  void writeTextFiles(const float* nodes, size_t numNodes, const size_t* triangles, size_t numTriangles, const QString& geometryType);
+
+  /**
+   * @brief writeBinaryFiles Writes the nodes and triangles as little endian blocks that
+   * follow a fixed size header so the files can be memory mapped.
+   * @param nodes
+   * @param numNodes
+   * @param triangles
+   * @param numTriangles
+   */
+  void writeBinaryFiles(const float* nodes, size_t numNodes, const size_t* triangles, size_t numTriangles);
+
 public:
   WriteTriangleGeometry(const WriteTriangleGeometry&) = delete;            // Copy Constructor Not Implemented
   WriteTriangleGeometry(WriteTriangleGeometry&&) = delete;                 // Move Constructor Not Implemented
@@ -206,4 +258,5 @@ private:
   DataArrayPath m_DataContainerSelection = {"", "", ""};
   QString m_OutputNodesFile = {""};
   QString m_OutputTrianglesFile = {""};
+  int m_OutputFormat = {0};
 };
@@ -0,0 +1,1057 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "BitMaskArray.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include <QtCore/QLocale>
+
+#include "H5Support/QH5Lite.h"
+
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+/**
+ * @brief Number of elements unpacked into the temporary byte buffer for each HDF5 read/write
+ */
+constexpr size_t k_H5SlabElements = 16777216;
+
+/**
+ * @brief Number of words each parallel task reduces when counting set bits
+ */
+constexpr size_t k_PopCountBlockWords = 65536;
+
+// -----------------------------------------------------------------------------
+inline size_t PopCount(BitMaskArray::WordType word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<size_t>(__builtin_popcountll(word));
+#else
+  word = word - ((word >> 1) & 0x5555555555555555ULL);
+  word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+  word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  return static_cast<size_t>((word * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+size_t ProductOf(const std::vector<size_t>& dims)
+{
+  return std::accumulate(dims.begin(), dims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+}
+
+/**
+ * @brief The BinaryWordImpl class applies a word-wise binary operation between two packed arrays
+ */
+template <typename Operation>
+class BinaryWordImpl
+{
+public:
+  BinaryWordImpl(BitMaskArray::WordType* destination, const BitMaskArray::WordType* source)
+  : m_Destination(destination)
+  , m_Source(source)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    Operation op;
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      m_Destination[i] = op(m_Destination[i], m_Source[i]);
+    }
+  }
+
+private:
+  BitMaskArray::WordType* m_Destination;
+  const BitMaskArray::WordType* m_Source;
+};
+
+struct AndNotOperation
+{
+  BitMaskArray::WordType operator()(BitMaskArray::WordType a, BitMaskArray::WordType b) const
+  {
+    return a & ~b;
+  }
+};
+
+/**
+ * @brief The PackBoolsImpl class packs 64 bools at a time into each destination word
+ */
+class PackBoolsImpl
+{
+public:
+  PackBoolsImpl(const bool* source, size_t numElements, BitMaskArray::WordType* destination)
+  : m_Source(source)
+  , m_NumElements(numElements)
+  , m_Destination(destination)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t w = range.min(); w < range.max(); w++)
+    {
+      size_t base = w * BitMaskArray::k_BitsPerWord;
+      size_t count = std::min(BitMaskArray::k_BitsPerWord, m_NumElements - base);
+      BitMaskArray::WordType word = 0;
+      for(size_t b = 0; b < count; b++)
+      {
+        word |= static_cast<BitMaskArray::WordType>(m_Source[base + b] ? 1 : 0) << b;
+      }
+      m_Destination[w] = word;
+    }
+  }
+
+private:
+  const bool* m_Source;
+  size_t m_NumElements;
+  BitMaskArray::WordType* m_Destination;
+};
+
+/**
+ * @brief The UnpackBoolsImpl class expands each packed word back into 64 bools
+ */
+class UnpackBoolsImpl
+{
+public:
+  UnpackBoolsImpl(const BitMaskArray::WordType* source, size_t numElements, bool* destination)
+  : m_Source(source)
+  , m_NumElements(numElements)
+  , m_Destination(destination)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t w = range.min(); w < range.max(); w++)
+    {
+      size_t base = w * BitMaskArray::k_BitsPerWord;
+      size_t count = std::min(BitMaskArray::k_BitsPerWord, m_NumElements - base);
+      BitMaskArray::WordType word = m_Source[w];
+      for(size_t b = 0; b < count; b++)
+      {
+        m_Destination[base + b] = ((word >> b) & 1) != 0;
+      }
+    }
+  }
+
+private:
+  const BitMaskArray::WordType* m_Source;
+  size_t m_NumElements;
+  bool* m_Destination;
+};
+
+/**
+ * @brief The PopCountImpl class counts the set bits of fixed size blocks of words. Each block writes
+ * its own slot so the final sum is independent of how the range was partitioned.
+ */
+class PopCountImpl
+{
+public:
+  PopCountImpl(const BitMaskArray::WordType* words, size_t numWords, size_t* blockCounts)
+  : m_Words(words)
+  , m_NumWords(numWords)
+  , m_BlockCounts(blockCounts)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      size_t start = block * k_PopCountBlockWords;
+      size_t end = std::min(start + k_PopCountBlockWords, m_NumWords);
+      size_t count = 0;
+      for(size_t w = start; w < end; w++)
+      {
+        count += PopCount(m_Words[w]);
+      }
+      m_BlockCounts[block] = count;
+    }
+  }
+
+private:
+  const BitMaskArray::WordType* m_Words;
+  size_t m_NumWords;
+  size_t* m_BlockCounts;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::BitMaskArray() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::BitMaskArray(size_t numTuples, const std::vector<size_t>& compDims, const QString& name, bool allocate)
+: IDataArray(name)
+, m_CompDims(compDims)
+, m_NumTuples(numTuples)
+{
+  if(m_CompDims.empty())
+  {
+    m_CompDims = {1};
+  }
+  m_NumComponents = ProductOf(m_CompDims);
+  if(allocate)
+  {
+    resizeTuples(numTuples);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::~BitMaskArray() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::GetNumberOfWords(size_t numElements)
+{
+  return (numElements + k_BitsPerWord - 1) / k_BitsPerWord;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::Pointer BitMaskArray::CreateArray(size_t numTuples, const QString& name, bool allocate)
+{
+  return CreateArray(numTuples, std::vector<size_t>{1}, name, allocate);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::Pointer BitMaskArray::CreateArray(size_t numTuples, const std::vector<size_t>& compDims, const QString& name, bool allocate)
+{
+  if(name.isEmpty())
+  {
+    return NullPointer();
+  }
+  Pointer ptr(new BitMaskArray(numTuples, compDims, name, allocate));
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::Pointer BitMaskArray::CreateArray(const std::vector<size_t>& tupleDims, const std::vector<size_t>& compDims, const QString& name, bool allocate)
+{
+  return CreateArray(ProductOf(tupleDims), compDims, name, allocate);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::Pointer BitMaskArray::FromBoolArray(const BoolArrayType& boolArray)
+{
+  Pointer ptr = CreateArray(boolArray.getNumberOfTuples(), boolArray.getComponentDimensions(), boolArray.getName(), true);
+  if(nullptr != ptr)
+  {
+    ptr->copyFromBoolArray(boolArray);
+  }
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BoolArrayType::Pointer BitMaskArray::toBoolArray() const
+{
+  BoolArrayType::Pointer boolArray = BoolArrayType::CreateArray(m_NumTuples, m_CompDims, getName(), true);
+  copyIntoBoolArray(*boolArray);
+  return boolArray;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitMaskArray::copyIntoBoolArray(BoolArrayType& boolArray) const
+{
+  if(boolArray.getSize() != getSize() || !m_IsAllocated)
+  {
+    return false;
+  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, m_Words.size());
+  dataAlg.execute(UnpackBoolsImpl(m_Words.data(), getSize(), boolArray.getPointer(0)));
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitMaskArray::copyFromBoolArray(const BoolArrayType& boolArray)
+{
+  if(boolArray.getSize() != getSize() || !m_IsAllocated)
+  {
+    return false;
+  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, m_Words.size());
+  dataAlg.execute(PackBoolsImpl(boolArray.getPointer(0), getSize(), m_Words.data()));
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer BitMaskArray::createNewArray(size_t numElements, int32_t rank, const size_t* compDims, const QString& name, bool allocate) const
+{
+  std::vector<size_t> dims(compDims, compDims + rank);
+  return CreateArray(numElements, dims, name, allocate);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer BitMaskArray::createNewArray(size_t numElements, const std::vector<size_t>& compDims, const QString& name, bool allocate) const
+{
+  return CreateArray(numElements, compDims, name, allocate);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitMaskArray::isAllocated() const
+{
+  return m_IsAllocated;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::takeOwnership()
+{
+  m_OwnsData = true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::releaseOwnership()
+{
+  m_OwnsData = false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* BitMaskArray::getVoidPointer([[maybe_unused]] size_t i)
+{
+  // The elements are packed bits, so there is no address that getTypeSize()/getSize() describe.
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::getNumberOfTuples() const
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::getSize() const
+{
+  return m_NumTuples * m_NumComponents;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t BitMaskArray::getNumberOfComponents() const
+{
+  return static_cast<int32_t>(m_NumComponents);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> BitMaskArray::getComponentDimensions() const
+{
+  return m_CompDims;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::getTypeSize() const
+{
+  return sizeof(bool);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::getXdmfTypeAndSize(QString& xdmfTypeName, int32_t& precision) const
+{
+  xdmfTypeName = "UChar";
+  precision = 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t BitMaskArray::eraseTuples(const std::vector<size_t>& idxs)
+{
+  // If nothing is to be erased just return
+  if(idxs.empty())
+  {
+    return 0;
+  }
+
+  // Flag the tuples to remove in a packed mask of our own. This does not require the indices to
+  // be sorted or unique and keeps the whole operation linear in the number of tuples.
+  std::vector<WordType> removed(GetNumberOfWords(m_NumTuples), 0);
+  for(const size_t& idx : idxs)
+  {
+    if(idx >= m_NumTuples)
+    {
+      return -100;
+    }
+    removed[idx / k_BitsPerWord] |= WordType(1) << (idx % k_BitsPerWord);
+  }
+  size_t numRemoved = 0;
+  for(const auto& word : removed)
+  {
+    numRemoved += PopCount(word);
+  }
+  if(numRemoved == m_NumTuples)
+  {
+    resizeTuples(0);
+    return 0;
+  }
+
+  size_t newNumTuples = m_NumTuples - numRemoved;
+  std::vector<WordType> newWords(GetNumberOfWords(newNumTuples * m_NumComponents), 0);
+  size_t dest = 0;
+  for(size_t t = 0; t < m_NumTuples; t++)
+  {
+    if(((removed[t / k_BitsPerWord] >> (t % k_BitsPerWord)) & 1) != 0)
+    {
+      continue;
+    }
+    for(size_t c = 0; c < m_NumComponents; c++, dest++)
+    {
+      if(getValue(t * m_NumComponents + c))
+      {
+        newWords[dest / k_BitsPerWord] |= WordType(1) << (dest % k_BitsPerWord);
+      }
+    }
+  }
+
+  m_Words.swap(newWords);
+  m_NumTuples = newNumTuples;
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t BitMaskArray::copyTuple(size_t currentPos, size_t newPos)
+{
+  if(currentPos >= m_NumTuples || newPos >= m_NumTuples)
+  {
+    return -1;
+  }
+  for(size_t c = 0; c < m_NumComponents; c++)
+  {
+    setValue(newPos * m_NumComponents + c, getValue(currentPos * m_NumComponents + c));
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitMaskArray::copyFromArray(size_t destTupleOffset, IDataArray::ConstPointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples)
+{
+  if(!m_IsAllocated || nullptr == sourceArray || !sourceArray->isAllocated())
+  {
+    return false;
+  }
+  if(destTupleOffset >= m_NumTuples)
+  {
+    return false;
+  }
+  if(sourceArray->getNumberOfComponents() != getNumberOfComponents())
+  {
+    return false;
+  }
+  if(srcTupleOffset + totalSrcTuples > sourceArray->getNumberOfTuples())
+  {
+    return false;
+  }
+  if(totalSrcTuples + destTupleOffset > m_NumTuples)
+  {
+    return false;
+  }
+
+  size_t numElements = totalSrcTuples * m_NumComponents;
+  size_t destStart = destTupleOffset * m_NumComponents;
+  size_t srcStart = srcTupleOffset * m_NumComponents;
+
+  if(const auto* source = dynamic_cast<const Self*>(sourceArray.get()))
+  {
+    for(size_t i = 0; i < numElements; i++)
+    {
+      setValue(destStart + i, source->getValue(srcStart + i));
+    }
+    return true;
+  }
+  if(const auto* source = dynamic_cast<const BoolArrayType*>(sourceArray.get()))
+  {
+    const bool* sourceData = source->getPointer(0);
+    for(size_t i = 0; i < numElements; i++)
+    {
+      setValue(destStart + i, sourceData[srcStart + i]);
+    }
+    return true;
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::initializeTuple(size_t pos, const void* value)
+{
+  bool c = *(static_cast<const bool*>(value));
+  for(size_t j = 0; j < m_NumComponents; j++)
+  {
+    setValue(pos * m_NumComponents + j, c);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::initializeWithZeros()
+{
+  initializeWithValue(false);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::initializeWithValue(bool value)
+{
+  if(!m_IsAllocated)
+  {
+    resizeTuples(m_NumTuples);
+  }
+  std::fill(m_Words.begin(), m_Words.end(), value ? ~WordType(0) : WordType(0));
+  clearTailBits();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer BitMaskArray::deepCopy(bool forceNoAllocate) const
+{
+  bool allocate = m_IsAllocated && !forceNoAllocate;
+  Pointer daCopy = CreateArray(m_NumTuples, m_CompDims, getName(), allocate);
+  if(allocate)
+  {
+    daCopy->m_Words = m_Words;
+  }
+  return daCopy;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t BitMaskArray::resizeTotalElements(size_t size)
+{
+  m_Words.resize(GetNumberOfWords(size), 0);
+  m_NumTuples = size / m_NumComponents;
+  m_IsAllocated = true;
+  clearTailBits();
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::resizeTuples(size_t numTuples)
+{
+  resizeTotalElements(numTuples * m_NumComponents);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::clearTailBits()
+{
+  size_t remainder = getSize() % k_BitsPerWord;
+  if(remainder != 0 && !m_Words.empty())
+  {
+    m_Words.back() &= (WordType(1) << remainder) - 1;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::printTuple(QTextStream& out, size_t i, char delimiter) const
+{
+  for(size_t j = 0; j < m_NumComponents; j++)
+  {
+    if(j != 0)
+    {
+      out << delimiter;
+    }
+    out << (getValue(i * m_NumComponents + j) ? 1 : 0);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::printComponent(QTextStream& out, size_t i, int32_t j) const
+{
+  out << (getComponent(i, j) ? 1 : 0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BitMaskArray::getFullNameOfClass() const
+{
+  return "BitMaskArray";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BitMaskArray::getTypeAsString() const
+{
+  return "BitMaskArray";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t BitMaskArray::writeH5Data(hid_t parentId, const std::vector<size_t>& tDims) const
+{
+  if(!m_IsAllocated)
+  {
+    return -85648;
+  }
+
+  // HDF5 wants the dimensions from slowest to fastest, see H5DataArrayWriter::writeDataArray
+  std::vector<hsize_t> h5Dims;
+  for(auto iter = tDims.rbegin(); iter != tDims.rend(); ++iter)
+  {
+    h5Dims.push_back(static_cast<hsize_t>(*iter));
+  }
+  for(auto iter = m_CompDims.rbegin(); iter != m_CompDims.rend(); ++iter)
+  {
+    h5Dims.push_back(static_cast<hsize_t>(*iter));
+  }
+  if(ProductOf(tDims) * m_NumComponents != getSize())
+  {
+    return -601;
+  }
+
+  std::string name = getName().toStdString();
+  if(QH5Lite::datasetExists(parentId, getName()))
+  {
+    H5Ldelete(parentId, name.c_str(), H5P_DEFAULT);
+  }
+
+  hid_t fileSpaceId = H5Screate_simple(static_cast<int>(h5Dims.size()), h5Dims.data(), nullptr);
+  if(fileSpaceId < 0)
+  {
+    return -602;
+  }
+  hid_t datasetId = H5Dcreate(parentId, name.c_str(), H5T_STD_U8LE, fileSpaceId, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  if(datasetId < 0)
+  {
+    H5Sclose(fileSpaceId);
+    return -603;
+  }
+
+  // Write whole "rows" of the slowest dimension so each slab is a simple hyperslab
+  size_t numRows = h5Dims.empty() ? 0 : static_cast<size_t>(h5Dims[0]);
+  size_t rowSize = (numRows == 0) ? 0 : getSize() / numRows;
+  size_t rowsPerSlab = (rowSize == 0) ? 1 : std::max(static_cast<size_t>(1), k_H5SlabElements / rowSize);
+  std::vector<uint8_t> buffer(std::min(rowsPerSlab * rowSize, getSize()));
+  std::vector<hsize_t> offset(h5Dims.size(), 0);
+  std::vector<hsize_t> count(h5Dims);
+
+  herr_t err = 0;
+  for(size_t row = 0; row < numRows && err >= 0; row += rowsPerSlab)
+  {
+    size_t slabRows = std::min(rowsPerSlab, numRows - row);
+    size_t slabStart = row * rowSize;
+    hsize_t slabElements = slabRows * rowSize;
+    for(size_t i = 0; i < slabElements; i++)
+    {
+      buffer[i] = getValue(slabStart + i) ? 1 : 0;
+    }
+
+    offset[0] = row;
+    count[0] = slabRows;
+    H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, offset.data(), nullptr, count.data(), nullptr);
+    hid_t memSpaceId = H5Screate_simple(1, &slabElements, nullptr);
+    err = H5Dwrite(datasetId, H5T_NATIVE_UINT8, memSpaceId, fileSpaceId, H5P_DEFAULT, buffer.data());
+    H5Sclose(memSpaceId);
+  }
+
+  H5Dclose(datasetId);
+  H5Sclose(fileSpaceId);
+  if(err < 0)
+  {
+    return err;
+  }
+
+  return H5DataArrayWriter::writeDataArrayAttributes<Self>(parentId, this, tDims, m_CompDims);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t BitMaskArray::readH5Data(hid_t parentId)
+{
+  QString classType;
+  int version = 0;
+  std::vector<size_t> tDims;
+  std::vector<size_t> cDims;
+  int32_t err = H5DataArrayReader::ReadRequiredAttributes(parentId, getName(), classType, version, tDims, cDims);
+  if(err < 0)
+  {
+    return err;
+  }
+
+  m_CompDims = cDims.empty() ? std::vector<size_t>{1} : cDims;
+  m_NumComponents = ProductOf(m_CompDims);
+  m_Words.clear();
+  resizeTuples(ProductOf(tDims));
+
+  std::string name = getName().toStdString();
+  hid_t datasetId = H5Dopen(parentId, name.c_str(), H5P_DEFAULT);
+  if(datasetId < 0)
+  {
+    return -1;
+  }
+  hid_t fileSpaceId = H5Dget_space(datasetId);
+  int rank = H5Sget_simple_extent_ndims(fileSpaceId);
+  std::vector<hsize_t> h5Dims(static_cast<size_t>(std::max(rank, 0)), 0);
+  H5Sget_simple_extent_dims(fileSpaceId, h5Dims.data(), nullptr);
+
+  // The slabs are unpacked into a buffer sized from the tuple and component attributes, so the
+  // dataset extent must hold exactly that many values.
+  hsize_t numDatasetValues = h5Dims.empty() ? 0 : 1;
+  for(const auto& dim : h5Dims)
+  {
+    numDatasetValues *= dim;
+  }
+  if(rank < 1 || numDatasetValues != getSize() || (h5Dims[0] != 0 && getSize() % h5Dims[0] != 0))
+  {
+    H5Sclose(fileSpaceId);
+    H5Dclose(datasetId);
+    resizeTuples(0);
+    return -604;
+  }
+
+  size_t numRows = h5Dims.empty() ? 0 : static_cast<size_t>(h5Dims[0]);
+  size_t rowSize = (numRows == 0) ? 0 : getSize() / numRows;
+  size_t rowsPerSlab = (rowSize == 0) ? 1 : std::max(static_cast<size_t>(1), k_H5SlabElements / rowSize);
+  std::vector<uint8_t> buffer(std::min(rowsPerSlab * rowSize, getSize()));
+  std::vector<hsize_t> offset(h5Dims.size(), 0);
+  std::vector<hsize_t> count(h5Dims);
+
+  herr_t h5Err = 0;
+  for(size_t row = 0; row < numRows && h5Err >= 0; row += rowsPerSlab)
+  {
+    size_t slabRows = std::min(rowsPerSlab, numRows - row);
+    size_t slabStart = row * rowSize;
+    hsize_t slabElements = slabRows * rowSize;
+
+    offset[0] = row;
+    count[0] = slabRows;
+    H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, offset.data(), nullptr, count.data(), nullptr);
+    hid_t memSpaceId = H5Screate_simple(1, &slabElements, nullptr);
+    h5Err = H5Dread(datasetId, H5T_NATIVE_UINT8, memSpaceId, fileSpaceId, H5P_DEFAULT, buffer.data());
+    H5Sclose(memSpaceId);
+
+    for(size_t i = 0; i < slabElements && h5Err >= 0; i++)
+    {
+      setValue(slabStart + i, buffer[i] != 0);
+    }
+  }
+
+  H5Sclose(fileSpaceId);
+  H5Dclose(datasetId);
+  return h5Err < 0 ? h5Err : 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t BitMaskArray::writeXdmfAttribute(QTextStream& out, const int64_t* volDims, const QString& hdfFileName, const QString& groupPath, const QString& label) const
+{
+  if(!m_IsAllocated)
+  {
+    return -85648;
+  }
+  QString dimStr;
+  int32_t precision = 0;
+  QString xdmfTypeName;
+  getXdmfTypeAndSize(xdmfTypeName, precision);
+
+  int32_t numComp = getNumberOfComponents();
+  out << "    <Attribute Name=\"" << getName() << label << "\" ";
+  if(numComp == 1)
+  {
+    out << "AttributeType=\"Scalar\" ";
+    dimStr = QString("%1 %2 %3 ").arg(volDims[2]).arg(volDims[1]).arg(volDims[0]);
+  }
+  else
+  {
+    out << "AttributeType=\"Vector\" ";
+    dimStr = QString("%1 %2 %3 %4 ").arg(volDims[2]).arg(volDims[1]).arg(volDims[0]).arg(numComp);
+  }
+  out << "Center=\"Cell\">\n";
+  // Open the <DataItem> Tag
+  out << R"(      <DataItem Format="HDF" Dimensions=")" << dimStr << R"(" )";
+  out << "NumberType=\"" << xdmfTypeName << "\" "
+      << "Precision=\"" << precision << "\" >\n";
+
+  out << "        " << hdfFileName << groupPath << "/" << getName() << "\n";
+  out << "      </DataItem>"
+      << "\n";
+  out << "    </Attribute>"
+      << "\n";
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BitMaskArray::getInfoString(SIMPL::InfoStringFormat format) const
+{
+  if(format == SIMPL::HtmlFormat)
+  {
+    return getToolTipGenerator().generateHTML();
+  }
+  return QString();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ToolTipGenerator BitMaskArray::getToolTipGenerator() const
+{
+  ToolTipGenerator toolTipGen;
+  QLocale usa(QLocale::English, QLocale::UnitedStates);
+
+  toolTipGen.addTitle("Attribute Array Info");
+  toolTipGen.addValue("Name", getName());
+  toolTipGen.addValue("Type", getTypeAsString());
+  toolTipGen.addValue("Number of Tuples", usa.toString(static_cast<qlonglong>(getNumberOfTuples())));
+
+  QString compDimStr = "(";
+  for(size_t i = 0; i < m_CompDims.size(); i++)
+  {
+    compDimStr = compDimStr + QString::number(m_CompDims[i]);
+    if(i < m_CompDims.size() - 1)
+    {
+      compDimStr = compDimStr + QString(", ");
+    }
+  }
+  compDimStr += ")";
+  toolTipGen.addValue("Component Dimensions", compDimStr);
+  toolTipGen.addValue("Total Elements", usa.toString(static_cast<qlonglong>(getSize())));
+  toolTipGen.addValue("Total Memory Required", usa.toString(static_cast<qlonglong>(m_Words.size() * sizeof(WordType))));
+
+  return toolTipGen;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitMaskArray::getComponent(size_t i, int32_t j) const
+{
+  return getValue(i * m_NumComponents + static_cast<size_t>(j));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::setComponent(size_t i, int32_t j, bool value)
+{
+  setValue(i * m_NumComponents + static_cast<size_t>(j), value);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::getNumberOfWords() const
+{
+  return m_Words.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::WordType* BitMaskArray::getWordPointer(size_t i)
+{
+  return m_Words.data() + i;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const BitMaskArray::WordType* BitMaskArray::getWordPointer(size_t i) const
+{
+  return m_Words.data() + i;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitMaskArray::bitwiseAnd(const BitMaskArray& other)
+{
+  if(other.getSize() != getSize() || other.m_Words.size() != m_Words.size())
+  {
+    return false;
+  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, m_Words.size());
+  dataAlg.execute(BinaryWordImpl<std::bit_and<WordType>>(m_Words.data(), other.m_Words.data()));
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitMaskArray::bitwiseOr(const BitMaskArray& other)
+{
+  if(other.getSize() != getSize() || other.m_Words.size() != m_Words.size())
+  {
+    return false;
+  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, m_Words.size());
+  dataAlg.execute(BinaryWordImpl<std::bit_or<WordType>>(m_Words.data(), other.m_Words.data()));
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitMaskArray::bitwiseAndNot(const BitMaskArray& other)
+{
+  if(other.getSize() != getSize() || other.m_Words.size() != m_Words.size())
+  {
+    return false;
+  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, m_Words.size());
+  dataAlg.execute(BinaryWordImpl<AndNotOperation>(m_Words.data(), other.m_Words.data()));
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::bitwiseNot()
+{
+  WordType* words = m_Words.data();
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, m_Words.size());
+  dataAlg.execute([words](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      words[i] = ~words[i];
+    }
+  });
+  clearTailBits();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::countTrue() const
+{
+  size_t numBlocks = (m_Words.size() + k_PopCountBlockWords - 1) / k_PopCountBlockWords;
+  std::vector<size_t> blockCounts(numBlocks, 0);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numBlocks);
+  dataAlg.execute(PopCountImpl(m_Words.data(), m_Words.size(), blockCounts.data()));
+  return std::accumulate(blockCounts.begin(), blockCounts.end(), static_cast<size_t>(0));
+}
+
+// -----------------------------------------------------------------------------
+BitMaskArray::Pointer BitMaskArray::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+BitMaskArray::Pointer BitMaskArray::New()
+{
+  Pointer sharedPtr(new(BitMaskArray));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+QString BitMaskArray::getNameOfClass() const
+{
+  return QString("BitMaskArray");
+}
+
+// -----------------------------------------------------------------------------
+QString BitMaskArray::ClassName()
+{
+  return QString("BitMaskArray");
+}
+
+// -----------------------------------------------------------------------------
+int32_t BitMaskArray::getClassVersion() const
+{
+  return 2;
+}
@@ -0,0 +1,359 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <QtCore/QString>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/IDataArray.h"
+
+/**
+ * @class BitMaskArray BitMaskArray.h SIMPLib/DataArrays/BitMaskArray.h
+ * @brief Stores boolean values packed 64 to a word. This is the compact alternative to
+ * BoolArrayType for very large masks. The bits past the last element of the final word are
+ * always kept cleared so the word-wise kernels never have to special case the tail.
+ *
+ * On disk the array is stored as one unsigned byte per element, exactly like BoolArrayType,
+ * so the files can be viewed through XDMF and read by tools that know nothing about the packing.
+ */
+class SIMPLib_EXPORT BitMaskArray : public IDataArray
+{
+public:
+  using Self = BitMaskArray;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+  static Pointer New();
+
+  using value_type = bool;
+  using WordType = uint64_t;
+  static constexpr size_t k_BitsPerWord = 64;
+
+  /**
+   * @brief Returns the name of the class for BitMaskArray
+   */
+  QString getNameOfClass() const override;
+  /**
+   * @brief Returns the name of the class for BitMaskArray
+   */
+  static QString ClassName();
+
+  int32_t getClassVersion() const override;
+
+  /**
+   * @brief Returns the number of words needed to store numElements bits
+   * @param numElements
+   * @return
+   */
+  static size_t GetNumberOfWords(size_t numElements);
+
+  /**
+   * @brief CreateArray
+   * @param numTuples
+   * @param name
+   * @param allocate
+   * @return
+   */
+  static Pointer CreateArray(size_t numTuples, const QString& name, bool allocate = true);
+
+  /**
+   * @brief CreateArray
+   * @param numTuples
+   * @param compDims
+   * @param name
+   * @param allocate
+   * @return
+   */
+  static Pointer CreateArray(size_t numTuples, const std::vector<size_t>& compDims, const QString& name, bool allocate = true);
+
+  /**
+   * @brief CreateArray
+   * @param tupleDims
+   * @param compDims
+   * @param name
+   * @param allocate
+   * @return
+   */
+  static Pointer CreateArray(const std::vector<size_t>& tupleDims, const std::vector<size_t>& compDims, const QString& name, bool allocate = true);
+
+  /**
+   * @brief Packs the values of a BoolArrayType into a new BitMaskArray with the same name and dimensions
+   * @param boolArray
+   * @return
+   */
+  static Pointer FromBoolArray(const BoolArrayType& boolArray);
+
+  /**
+   * @brief Unpacks this array into a new BoolArrayType with the same name and dimensions
+   * @return
+   */
+  BoolArrayType::Pointer toBoolArray() const;
+
+  /**
+   * @brief Unpacks this array into an existing BoolArrayType. Both arrays must hold the same number of elements.
+   * @param boolArray
+   * @return false if the sizes do not match
+   */
+  bool copyIntoBoolArray(BoolArrayType& boolArray) const;
+
+  /**
+   * @brief Packs the values of an existing BoolArrayType into this array. Both arrays must hold the same number of elements.
+   * @param boolArray
+   * @return false if the sizes do not match
+   */
+  bool copyFromBoolArray(const BoolArrayType& boolArray);
+
+  IDataArray::Pointer createNewArray(size_t numElements, int32_t rank, const size_t* compDims, const QString& name, bool allocate = true) const override;
+
+  IDataArray::Pointer createNewArray(size_t numElements, const std::vector<size_t>& compDims, const QString& name, bool allocate = true) const override;
+
+  ~BitMaskArray() override;
+
+  bool isAllocated() const override;
+
+  void takeOwnership() override;
+
+  void releaseOwnership() override;
+
+  /**
+   * @brief Always returns nullptr. The elements are packed into words, so no pointer exists that
+   * matches getTypeSize() and getSize(). Use getWordPointer() to reach the packed storage.
+   * @param i
+   * @return
+   */
+  void* getVoidPointer(size_t i) override;
+
+  size_t getNumberOfTuples() const override;
+
+  size_t getSize() const override;
+
+  int32_t getNumberOfComponents() const override;
+
+  std::vector<size_t> getComponentDimensions() const override;
+
+  /**
+   * @brief Returns the size of the logical element type, which is a bool. The packed storage actually
+   * uses 1/8th of a byte per element.
+   */
+  size_t getTypeSize() const override;
+
+  void getXdmfTypeAndSize(QString& xdmfTypeName, int32_t& precision) const override;
+
+  /**
+   * @brief Removes the tuples at the given indices in a single pass over the array. The indices do not need to be sorted
+   * or unique but must all be less than the number of tuples.
+   * @param idxs The indices to erase
+   * @return error code.
+   */
+  int32_t eraseTuples(const std::vector<size_t>& idxs) override;
+
+  int32_t copyTuple(size_t currentPos, size_t newPos) override;
+
+  // This line must be here, because we are overloading the copyData pure virtual function in IDataArray.
+  // This is required so that other classes can call this version of copyData from the subclasses.
+  using IDataArray::copyFromArray;
+
+  /**
+   * @brief Copies tuples from either another BitMaskArray or a BoolArrayType
+   */
+  bool copyFromArray(size_t destTupleOffset, IDataArray::ConstPointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples) override;
+
+  /**
+   * @brief Splats the bool pointed to by value across all components of the tuple
+   * @param pos The index of the Tuple
+   * @param value pointer to a bool
+   */
+  void initializeTuple(size_t pos, const void* value) override;
+
+  void initializeWithZeros() override;
+
+  /**
+   * @brief Sets every element to value
+   * @param value
+   */
+  void initializeWithValue(bool value);
+
+  IDataArray::Pointer deepCopy(bool forceNoAllocate = false) const override;
+
+  int32_t resizeTotalElements(size_t size) override;
+
+  void resizeTuples(size_t numTuples) override;
+
+  void printTuple(QTextStream& out, size_t i, char delimiter = ',') const override;
+
+  void printComponent(QTextStream& out, size_t i, int32_t j) const override;
+
+  /**
+   * @brief getFullNameOfClass
+   * @return
+   */
+  QString getFullNameOfClass() const;
+
+  QString getTypeAsString() const override;
+
+  /**
+   * @brief Writes the array unpacked to one byte per element, a slab at a time so the
+   * unpacked copy never exists in memory all at once.
+   */
+  int32_t writeH5Data(hid_t parentId, const std::vector<size_t>& tDims) const override;
+
+  /**
+   * @brief Reads a BitMaskArray or DataArray<bool> dataset a slab at a time, packing as it goes
+   */
+  int32_t readH5Data(hid_t parentId) override;
+
+  int32_t writeXdmfAttribute(QTextStream& out, const int64_t* volDims, const QString& hdfFileName, const QString& groupPath, const QString& label) const override;
+
+  QString getInfoString(SIMPL::InfoStringFormat format) const override;
+
+  ToolTipGenerator getToolTipGenerator() const override;
+
+  /**
+   * @brief Returns the value of element i
+   * @param i
+   * @return
+   */
+  bool getValue(size_t i) const
+  {
+    return ((m_Words[i / k_BitsPerWord] >> (i % k_BitsPerWord)) & 1) != 0;
+  }
+
+  /**
+   * @brief Sets the value of element i. Not safe to call concurrently for elements that share a word.
+   * @param i
+   * @param value
+   */
+  void setValue(size_t i, bool value)
+  {
+    WordType mask = WordType(1) << (i % k_BitsPerWord);
+    WordType& word = m_Words[i / k_BitsPerWord];
+    word = value ? (word | mask) : (word & ~mask);
+  }
+
+  /**
+   * @brief Returns the value of component j of tuple i
+   */
+  bool getComponent(size_t i, int32_t j) const;
+
+  /**
+   * @brief Sets the value of component j of tuple i
+   */
+  void setComponent(size_t i, int32_t j, bool value);
+
+  /**
+   * @brief Returns the number of 64 bit words used to store the bits
+   * @return
+   */
+  size_t getNumberOfWords() const;
+
+  /**
+   * @brief Returns a pointer to the packed words
+   * @return
+   */
+  WordType* getWordPointer(size_t i = 0);
+
+  /**
+   * @brief Returns a pointer to the packed words
+   * @return
+   */
+  const WordType* getWordPointer(size_t i = 0) const;
+
+  /**
+   * @brief Sets this = this AND other. Both arrays must hold the same number of elements.
+   * @param other
+   * @return false if the sizes do not match
+   */
+  bool bitwiseAnd(const BitMaskArray& other);
+
+  /**
+   * @brief Sets this = this OR other. Both arrays must hold the same number of elements.
+   * @param other
+   * @return false if the sizes do not match
+   */
+  bool bitwiseOr(const BitMaskArray& other);
+
+  /**
+   * @brief Sets this = this AND NOT other. Both arrays must hold the same number of elements.
+   * @param other
+   * @return false if the sizes do not match
+   */
+  bool bitwiseAndNot(const BitMaskArray& other);
+
+  /**
+   * @brief Flips every element
+   */
+  void bitwiseNot();
+
+  /**
+   * @brief Returns the number of elements that are true
+   * @return
+   */
+  size_t countTrue() const;
+
+protected:
+  /**
+   * @brief Protected Constructor
+   * @param numTuples The number of tuples in the array
+   * @param compDims The component dimensions
+   * @param name The name of the array
+   * @param allocate Should the memory be allocated now
+   */
+  BitMaskArray(size_t numTuples, const std::vector<size_t>& compDims, const QString& name, bool allocate = true);
+  BitMaskArray();
+
+  /**
+   * @brief Clears the unused bits of the last word
+   */
+  void clearTailBits();
+
+private:
+  std::vector<WordType> m_Words;
+  std::vector<size_t> m_CompDims = {1};
+  size_t m_NumTuples = 0;
+  size_t m_NumComponents = 1;
+  bool m_IsAllocated = false;
+  bool m_OwnsData = true;
+
+public:
+  BitMaskArray(const BitMaskArray&) = delete;            // Copy Constructor Not Implemented
+  BitMaskArray(BitMaskArray&&) = delete;                 // Move Constructor Not Implemented
+  BitMaskArray& operator=(const BitMaskArray&) = delete; // Copy Assignment Not Implemented
+  BitMaskArray& operator=(BitMaskArray&&) = delete;      // Move Assignment Not Implemented
+};
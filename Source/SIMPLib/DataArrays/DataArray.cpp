@@ -406,6 +406,18 @@ typename DataArray<T>::Pointer DataArray<T>::WrapPointer(T* data, size_t numTupl
 template <typename T>
 IDataArray::Pointer DataArray<T>::deepCopy(bool forceNoAllocate) const
 {
+  if(!forceNoAllocate)
+  {
+    // A deferred array is copied as another deferred array that reads from the same source
+    std::lock_guard<std::mutex> lock(m_DeferredMutex);
+    if(m_IsDeferred)
+    {
+      auto daCopy = CreateArray(getNumberOfTuples(), getComponentDimensions(), getName(), false);
+      daCopy->setDeferredLoader(m_DeferredLoader);
+      daCopy->setDeferredSourceFile(getDeferredSourceFile());
+      return daCopy;
+    }
+  }
   bool allocate = m_IsAllocated;
   if(forceNoAllocate)
   {
@@ -543,6 +555,7 @@ void DataArray<T>::getXdmfTypeAndSize(QString& xdmfTypeName, int32_t& precision)
 template <typename T>
 bool DataArray<T>::copyFromArray(size_t destTupleOffset, IDataArray::ConstPointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples)
 {
+  ensureLoaded();
   if(!m_IsAllocated)
   {
     return false;
@@ -595,6 +608,7 @@ bool DataArray<T>::copyFromArray(size_t destTupleOffset, IDataArray::ConstPointe
 template <typename T>
 bool DataArray<T>::copyIntoArray(Pointer dest) const
 {
+  ensureLoaded();
   if(m_IsAllocated && dest->isAllocated() && m_Array && dest->getPointer(0))
   {
     std::copy(cbegin(), cend(), dest->begin());
@@ -607,7 +621,7 @@ bool DataArray<T>::copyIntoArray(Pointer dest) const
 template <typename T>
 bool DataArray<T>::isAllocated() const
 {
-  return m_IsAllocated;
+  return m_IsAllocated || m_IsDeferred;
 }
 
 // -----------------------------------------------------------------------------
@@ -635,6 +649,7 @@ void DataArray<T>::releaseOwnership()
 template <typename T>
 int32_t DataArray<T>::allocate()
 {
+  forgetDeferredSource();
   if((nullptr != m_Array) && m_OwnsData)
   {
     deallocate();
@@ -665,6 +680,12 @@ int32_t DataArray<T>::allocate()
 template <typename T>
 void DataArray<T>::initializeWithZeros()
 {
+  if(m_IsDeferred)
+  {
+    // Every value is overwritten so there is no need to read the deferred data
+    allocate();
+    return;
+  }
   if(!m_IsAllocated || nullptr == m_Array)
   {
     return;
@@ -676,6 +697,11 @@ void DataArray<T>::initializeWithZeros()
 template <typename T>
 void DataArray<T>::initializeWithValue(T initValue, size_t offset)
 {
+  if(m_IsDeferred && offset == 0)
+  {
+    allocate();
+  }
+  ensureLoaded();
   if(!m_IsAllocated || nullptr == m_Array)
   {
     return;
@@ -711,6 +737,10 @@ int32_t DataArray<T>::eraseTuples(const comp_dims_type& idxs)
     }
   }
 
+  // The tuples no longer match the deferred source once they are erased
+  ensureLoaded();
+  forgetDeferredSource();
+
   // Calculate the new size of the array to copy into
   size_t newSize = (getNumberOfTuples() - idxs.size()) * m_NumComponents;
 
@@ -803,6 +833,7 @@ int32_t DataArray<T>::eraseTuples(const comp_dims_type& idxs)
 template <typename T>
 int32_t DataArray<T>::copyTuple(size_t currentPos, size_t newPos)
 {
+  ensureLoaded();
   size_t max = ((m_MaxId + 1) / m_NumComponents);
   if(currentPos >= max || newPos >= max)
   {
@@ -858,6 +889,7 @@ void* DataArray<T>::getVoidPointer(size_t i)
   {
     return nullptr;
   }
+  ensureLoaded();
 
   return reinterpret_cast<void*>(&(m_Array[i]));
 }
@@ -866,6 +898,7 @@ void* DataArray<T>::getVoidPointer(size_t i)
 template <typename T>
 T* DataArray<T>::getPointer(size_t i) const
 {
+  ensureLoaded();
 #ifndef NDEBUG
   if(m_Size > 0)
   {
@@ -880,6 +913,7 @@ template <typename T>
 T DataArray<T>::getValue(size_t i) const
 {
 #ifndef NDEBUG
+  Q_ASSERT(!m_IsDeferred.load(std::memory_order_relaxed));
   if(m_Size > 0)
   {
     Q_ASSERT(i < m_Size);
@@ -893,6 +927,7 @@ template <typename T>
 void DataArray<T>::setValue(size_t i, T value)
 {
 #ifndef NDEBUG
+  Q_ASSERT(!m_IsDeferred.load(std::memory_order_relaxed));
   if(m_Size > 0)
   {
     Q_ASSERT(i < m_Size);
@@ -906,6 +941,7 @@ template <typename T>
 T DataArray<T>::getComponent(size_t i, int32_t j) const
 {
 #ifndef NDEBUG
+  Q_ASSERT(!m_IsDeferred.load(std::memory_order_relaxed));
   if(m_Size > 0)
   {
     Q_ASSERT(i * m_NumComponents + static_cast<size_t>(j) < m_Size);
@@ -919,6 +955,7 @@ template <typename T>
 void DataArray<T>::setComponent(size_t i, int32_t j, T c)
 {
 #ifndef NDEBUG
+  Q_ASSERT(!m_IsDeferred.load(std::memory_order_relaxed));
   if(m_Size > 0)
   {
     Q_ASSERT(i * m_NumComponents + static_cast<size_t>(j) < m_Size);
@@ -971,6 +1008,7 @@ void DataArray<T>::initializeTuple(size_t i, const void* p)
 template <typename T>
 void DataArray<T>::fillTuple(size_t i, T value)
 {
+  ensureLoaded();
   if(!m_IsAllocated)
   {
     return;
@@ -988,6 +1026,7 @@ void DataArray<T>::fillTuple(size_t i, T value)
 template <typename T>
 T* DataArray<T>::getTuplePointer(size_t tupleIndex) const
 {
+  ensureLoaded();
 #ifndef NDEBUG
   if(m_Size > 0)
   {
@@ -1012,6 +1051,7 @@ void DataArray<T>::resizeTuples(size_t numTuples)
 template <typename T>
 void DataArray<T>::printTuple(QTextStream& out, size_t i, char delimiter) const
 {
+  Q_ASSERT(!m_IsDeferred.load(std::memory_order_relaxed));
   int32_t precision = out.realNumberPrecision();
   if constexpr(std::is_same_v<T, float>)
   {
@@ -1037,6 +1077,7 @@ void DataArray<T>::printTuple(QTextStream& out, size_t i, char delimiter) const
 template <typename T>
 void DataArray<T>::printComponent(QTextStream& out, size_t i, int32_t j) const
 {
+  Q_ASSERT(!m_IsDeferred.load(std::memory_order_relaxed));
   out << m_Array[i * m_NumComponents + static_cast<size_t>(j)];
 }
 
@@ -1108,18 +1149,27 @@ QString DataArray<T>::getTypeAsString() const
 template <typename T>
 int32_t DataArray<T>::writeH5Data(hid_t parentId, const comp_dims_type& tDims) const
 {
+  // Arrays that are only read for writing go back to being deferred afterwards so that
+  // writing a file does not pull every deferred array into memory at the same time.
+  bool evictAfterWrite = m_IsDeferred;
+  ensureLoaded();
   if(m_Array == nullptr)
   {
     return -85648;
   }
-  return H5DataArrayWriter::writeDataArray<Self>(parentId, this, tDims);
+  int32_t err = H5DataArrayWriter::writeDataArray<Self>(parentId, this, tDims);
+  if(evictAfterWrite)
+  {
+    const_cast<DataArray<T>*>(this)->evict();
+  }
+  return err;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 int32_t DataArray<T>::writeXdmfAttribute(QTextStream& out, const int64_t* volDims, const QString& hdfFileName, const QString& groupPath, const QString& label) const
 {
-  if(m_Array == nullptr)
+  if(m_Array == nullptr && !m_IsDeferred)
   {
     return -85648;
   }
@@ -1239,6 +1289,8 @@ int32_t DataArray<T>::readH5Data(hid_t parentId)
 {
   int32_t err = 0;
 
+  forgetDeferredSource();
+
   resizeTuples(0);
   IDataArray::Pointer p = H5DataArrayReader::ReadIDataArray(parentId, getName());
   if(p == nullptr)
@@ -1271,26 +1323,156 @@ void DataArray<T>::byteSwapElements()
   }
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+void DataArray<T>::setDeferredLoader(const DeferredLoader& loader)
+{
+  std::lock_guard<std::mutex> lock(m_DeferredMutex);
+  if(nullptr != m_Array && m_OwnsData)
+  {
+    deallocate();
+  }
+  m_Array = nullptr;
+  m_OwnsData = true;
+  m_IsAllocated = false;
+  m_DeferredChecksum = 0;
+  // An empty array has nothing to read so it is simply left unallocated
+  m_DeferredLoader = (m_Size > 0) ? loader : DeferredLoader();
+  m_IsDeferred.store(static_cast<bool>(m_DeferredLoader), std::memory_order_release);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool DataArray<T>::isDeferred() const
+{
+  return m_IsDeferred;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool DataArray<T>::hasDeferredSource() const
+{
+  std::lock_guard<std::mutex> lock(m_DeferredMutex);
+  return static_cast<bool>(m_DeferredLoader);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+int32_t DataArray<T>::materialize()
+{
+  std::lock_guard<std::mutex> lock(m_DeferredMutex);
+  if(!m_IsDeferred.load(std::memory_order_relaxed))
+  {
+    return 0;
+  }
+
+  IDataArray::Pointer p = m_DeferredLoader();
+  std::shared_ptr<Self> source = std::dynamic_pointer_cast<Self>(p);
+  if(nullptr == source || source->isDeferred() || nullptr == source->m_Array || !source->m_OwnsData || source->m_Size != m_Size)
+  {
+    qDebug() << "Unable to read the deferred data for array " << getName();
+    m_DeferredLoader = DeferredLoader();
+    m_IsDeferred.store(false, std::memory_order_release);
+    return -1;
+  }
+
+  // Take over the buffer of the array that was read, the same way readH5Data() does
+  m_Array = source->m_Array;
+  source->releaseOwnership();
+  m_OwnsData = true;
+  m_IsAllocated = true;
+  m_DeferredChecksum = computeChecksum();
+  m_IsDeferred.store(false, std::memory_order_release);
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool DataArray<T>::evict()
+{
+  std::lock_guard<std::mutex> lock(m_DeferredMutex);
+  if(!m_DeferredLoader || m_IsDeferred || nullptr == m_Array || !m_OwnsData)
+  {
+    return false;
+  }
+  if(computeChecksum() != m_DeferredChecksum)
+  {
+    return false;
+  }
+  deallocate();
+  m_IsDeferred.store(true, std::memory_order_release);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+int32_t DataArray<T>::detachDeferredSource()
+{
+  if(materialize() < 0)
+  {
+    return -1;
+  }
+  forgetDeferredSource();
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void DataArray<T>::forgetDeferredSource()
+{
+  std::lock_guard<std::mutex> lock(m_DeferredMutex);
+  m_DeferredLoader = DeferredLoader();
+  m_DeferredChecksum = 0;
+  m_IsDeferred.store(false, std::memory_order_release);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+uint64_t DataArray<T>::computeChecksum() const
+{
+  // FNV-1a over 64 bit words. Any single changed word always changes the result.
+  constexpr uint64_t k_Prime = 1099511628211ULL;
+  uint64_t hash = 14695981039346656037ULL;
+  const auto* bytes = reinterpret_cast<const unsigned char*>(m_Array);
+  const size_t numBytes = m_Size * sizeof(T);
+  size_t i = 0;
+  for(; i + sizeof(uint64_t) <= numBytes; i += sizeof(uint64_t))
+  {
+    uint64_t word = 0;
+    std::memcpy(&word, bytes + i, sizeof(uint64_t));
+    hash = (hash ^ word) * k_Prime;
+  }
+  for(; i < numBytes; i++)
+  {
+    hash = (hash ^ bytes[i]) * k_Prime;
+  }
+  return hash;
+}
+
 template <typename T>
 typename DataArray<T>::iterator DataArray<T>::begin()
 {
+  ensureLoaded();
   return iterator(m_Array);
 }
 
 template <typename T>
 typename DataArray<T>::iterator DataArray<T>::end()
 {
+  ensureLoaded();
   return iterator(m_Array + m_Size);
 }
 
 template <typename T>
 typename DataArray<T>::const_iterator DataArray<T>::begin() const
 {
+  ensureLoaded();
   return const_iterator(m_Array);
 }
 template <typename T>
 typename DataArray<T>::const_iterator DataArray<T>::end() const
 {
+  ensureLoaded();
   return const_iterator(m_Array + m_Size);
 }
 
@@ -1345,24 +1527,28 @@ typename DataArray<T>::const_reverse_iterator DataArray<T>::crend() const
 template <typename T>
 typename DataArray<T>::tuple_iterator DataArray<T>::tupleBegin()
 {
+  ensureLoaded();
   return tuple_iterator(m_Array, m_NumComponents);
 }
 
 template <typename T>
 typename DataArray<T>::tuple_iterator DataArray<T>::tupleEnd()
 {
+  ensureLoaded();
   return tuple_iterator(m_Array + m_Size, m_NumComponents);
 }
 
 template <typename T>
 typename DataArray<T>::const_tuple_iterator DataArray<T>::tupleBegin() const
 {
+  ensureLoaded();
   return const_tuple_iterator(m_Array, m_NumComponents);
 }
 
 template <typename T>
 typename DataArray<T>::const_tuple_iterator DataArray<T>::tupleEnd() const
 {
+  ensureLoaded();
   return const_tuple_iterator(m_Array + m_Size, m_NumComponents);
 }
 
@@ -1443,6 +1629,7 @@ void DataArray<T>::pop_back()
 template <typename T>
 void DataArray<T>::clear()
 {
+  forgetDeferredSource();
   if(nullptr != m_Array && m_OwnsData)
   {
     deallocate();
@@ -1550,6 +1737,10 @@ T* DataArray<T>::resizeAndExtend(size_t size)
     return m_Array;
   }
 
+  // Keep the existing values of a deferred array; after the resize it no longer matches its source
+  ensureLoaded();
+  forgetDeferredSource();
+
   newArray = new(std::nothrow) T[newSize]();
   if(!newArray)
   {
@@ -36,9 +36,11 @@
 #pragma once
 
 // STL Includes
+#include <atomic>
 #include <cassert>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include <QtCore/QString>
@@ -570,6 +572,48 @@ public:
    */
   void byteSwapElements();
 
+  /**
+   * @brief setDeferredLoader Releases the current data and defers reading it until the buffer is first handed
+   * out through data(), getPointer(), getVoidPointer() or the iterators, or the array is fetched as a filter
+   * prerequisite. The element accessors assume it has been read. The loader must return a DataArray of the
+   * same type and size as this array.
+   * @param loader
+   */
+  void setDeferredLoader(const DeferredLoader& loader) override;
+
+  /**
+   * @brief isDeferred
+   * @return
+   */
+  bool isDeferred() const override;
+
+  /**
+   * @brief hasDeferredSource
+   * @return
+   */
+  bool hasDeferredSource() const override;
+
+  /**
+   * @brief materialize Runs the deferred loader and takes over the data it read. A failed load leaves the
+   * array unallocated in the same way a failed allocation does and returns a negative value, which
+   * AttributeMatrix::getPrereqArray() reports to the filter.
+   * @return
+   */
+  int32_t materialize() override;
+
+  /**
+   * @brief detachDeferredSource Materializes the array and drops its loader so it can not be evicted
+   * and read back from its source file again.
+   * @return
+   */
+  int32_t detachDeferredSource() override;
+
+  /**
+   * @brief evict Releases the data if a checksum taken when it was read still matches.
+   * @return
+   */
+  bool evict() override;
+
   //========================================= STL INTERFACE COMPATIBILITY =================================
 
   class tuple_iterator
@@ -1083,20 +1127,27 @@ public:
 
   // ######### Element Access #########
 
+  // The element accessors do not read deferred data so that loops over them stay as cheap as loops over a
+  // raw pointer. Deferred data is read by data(), getPointer(), getVoidPointer(), the iterators and the
+  // whole-array operations, and by AttributeMatrix::getPrereqArray() before a filter starts using the array.
+
   inline reference operator[](size_type index)
   {
+    assert(!m_IsDeferred.load(std::memory_order_relaxed));
     assert(index < m_Size);
     return m_Array[index];
   }
 
   inline const T& operator[](size_type index) const
   {
+    assert(!m_IsDeferred.load(std::memory_order_relaxed));
     assert(index < m_Size);
     return m_Array[index];
   }
 
   inline reference at(size_type index)
   {
+    assert(!m_IsDeferred.load(std::memory_order_relaxed));
     if(index >= m_Size)
     {
       throw std::out_of_range("DataArray subscript out of range");
@@ -1106,6 +1157,7 @@ public:
 
   inline const T& at(size_type index) const
   {
+    assert(!m_IsDeferred.load(std::memory_order_relaxed));
     if(index >= m_Size)
     {
       throw std::out_of_range("DataArray subscript out of range");
@@ -1115,28 +1167,34 @@ public:
 
   inline reference front()
   {
+    assert(!m_IsDeferred.load(std::memory_order_relaxed));
     return m_Array[0];
   }
   inline const T& front() const
   {
+    assert(!m_IsDeferred.load(std::memory_order_relaxed));
     return m_Array[0];
   }
 
   inline reference back()
   {
+    assert(!m_IsDeferred.load(std::memory_order_relaxed));
     return m_Array[m_MaxId];
   }
   inline const T& back() const
   {
+    assert(!m_IsDeferred.load(std::memory_order_relaxed));
     return m_Array[m_MaxId];
   }
 
-  inline T* data() noexcept
+  inline T* data()
   {
+    ensureLoaded();
     return m_Array;
   }
-  inline const T* data() const noexcept
+  inline const T* data() const
   {
+    ensureLoaded();
     return m_Array;
   }
 
@@ -1233,6 +1291,28 @@ protected:
   T* resizeAndExtend(size_t size);
 
 private:
+  /**
+   * @brief Reads deferred data before the buffer is handed out. It is only called where the buffer is
+   * handed out or the whole array is processed, never per element.
+   */
+  inline void ensureLoaded() const
+  {
+    if(m_IsDeferred.load(std::memory_order_acquire))
+    {
+      const_cast<DataArray<T>*>(this)->materialize();
+    }
+  }
+
+  /**
+   * @brief Drops the deferred source once the data no longer matches what was read
+   */
+  void forgetDeferredSource();
+
+  /**
+   * @brief Returns a checksum of the current data used to detect modifications before eviction
+   */
+  uint64_t computeChecksum() const;
+
   T* m_Array = nullptr;
   size_t m_Size = 0;
   size_t m_MaxId = 0;
@@ -1242,6 +1322,10 @@ private:
   comp_dims_type m_CompDims = {1};
   bool m_IsAllocated = false;
   bool m_OwnsData = true;
+  DeferredLoader m_DeferredLoader;
+  std::atomic<bool> m_IsDeferred = {false};
+  uint64_t m_DeferredChecksum = 0;
+  mutable std::mutex m_DeferredMutex;
 };
 
 // -----------------------------------------------------------------------------
@@ -61,3 +61,51 @@ QString IDataArray::ClassName()
 {
   return QString("IDataArray");
 }
+
+// -----------------------------------------------------------------------------
+void IDataArray::setDeferredLoader(const DeferredLoader& loader)
+{
+  Q_UNUSED(loader);
+}
+
+// -----------------------------------------------------------------------------
+bool IDataArray::isDeferred() const
+{
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+bool IDataArray::hasDeferredSource() const
+{
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+int32_t IDataArray::materialize()
+{
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+bool IDataArray::evict()
+{
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+int32_t IDataArray::detachDeferredSource()
+{
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+void IDataArray::setDeferredSourceFile(const QString& filePath)
+{
+  m_DeferredSourceFile = filePath;
+}
+
+// -----------------------------------------------------------------------------
+QString IDataArray::getDeferredSourceFile() const
+{
+  return m_DeferredSourceFile;
+}
@@ -11,6 +11,7 @@
 #pragma once
 
 //-- C++
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -294,8 +295,68 @@ public:
    */
   virtual ToolTipGenerator getToolTipGenerator() const = 0;
 
+  /**
+   * @brief Returns a fully read array holding the data of a deferred array, typically by reading it
+   * back from the file the array was registered from.
+   */
+  using DeferredLoader = std::function<Pointer()>;
+
+  /**
+   * @brief setDeferredLoader Releases any data held by the array and defers reading it until the data is
+   * first accessed. The tuple and component dimensions of the array must already match what the loader
+   * returns. Array types that can not defer their data ignore the loader.
+   * @param loader
+   */
+  virtual void setDeferredLoader(const DeferredLoader& loader);
+
+  /**
+   * @brief isDeferred Returns true while the data of the array has not been read into memory.
+   */
+  virtual bool isDeferred() const;
+
+  /**
+   * @brief hasDeferredSource Returns true if the array can read its data again from where it was
+   * registered, i.e. it is deferred or was materialized from a loader and not reshaped since.
+   */
+  virtual bool hasDeferredSource() const;
+
+  /**
+   * @brief materialize Reads the data of a deferred array into memory.
+   * @return 1 if data was read, 0 if there was nothing to read and a negative value on failure
+   */
+  virtual int32_t materialize();
+
+  /**
+   * @brief evict Releases the memory of a materialized array whose data is unchanged since it was read
+   * and defers it again. Callers must make sure no raw pointers into the array are still in use.
+   * @return true if the memory was released
+   */
+  virtual bool evict();
+
+  /**
+   * @brief detachDeferredSource Reads any deferred data into memory and drops the loader so the array no
+   * longer depends on the file it was read from. This must be done before that file is overwritten.
+   * @return 0 on success and a negative value if the deferred data could not be read
+   */
+  virtual int32_t detachDeferredSource();
+
+  /**
+   * @brief setDeferredSourceFile Records the file that the deferred loader of this array reads from
+   * @param filePath
+   */
+  void setDeferredSourceFile(const QString& filePath);
+
+  /**
+   * @brief getDeferredSourceFile Returns the file that the deferred loader of this array reads from. This
+   * is only meaningful while hasDeferredSource() returns true.
+   * @return
+   */
+  QString getDeferredSourceFile() const;
+
 protected:
 private:
+  QString m_DeferredSourceFile;
+
   IDataArray(const IDataArray&);     // Not Implemented
   void operator=(const IDataArray&); // Not Implemented
 };
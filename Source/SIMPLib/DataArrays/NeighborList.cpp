@@ -464,9 +464,9 @@ bool NeighborList<T>::copyFromArray(size_t destTupleOffset, IDataArray::ConstPoi
     return false;
   }
 
-  for(size_t i = srcTupleOffset; i < srcTupleOffset + totalSrcTuples; i++)
+  for(size_t i = 0; i < totalSrcTuples; i++)
   {
-    m_Array[destTupleOffset + i] = source->getList(i);
+    m_Array[destTupleOffset + i] = source->getList(srcTupleOffset + i);
   }
   return true;
 
@@ -1050,6 +1050,49 @@ typename NeighborList<T>::VectorType NeighborList<T>::copyOfList(int grainId) co
   return copy;
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+void NeighborList<T>::copyToFlatArrays(uint64_t* offsets, T* values) const
+{
+  offsets[0] = 0;
+  for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
+  {
+    size_t nEle = m_Array[dIdx]->size();
+    if(nEle > 0)
+    {
+      ::memcpy(values + offsets[dIdx], m_Array[dIdx]->data(), nEle * sizeof(T));
+    }
+    offsets[dIdx + 1] = offsets[dIdx] + nEle;
+  }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool NeighborList<T>::setFromFlatArrays(size_t numLists, const uint64_t* offsets, const T* values)
+{
+  if(offsets[0] != 0)
+  {
+    return false;
+  }
+  for(size_t dIdx = 0; dIdx < numLists; ++dIdx)
+  {
+    if(offsets[dIdx + 1] < offsets[dIdx])
+    {
+      return false;
+    }
+  }
+
+  m_Array.resize(numLists);
+  for(size_t dIdx = 0; dIdx < numLists; ++dIdx)
+  {
+    const T* start = values + offsets[dIdx];
+    m_Array[dIdx] = SharedVectorType(new VectorType(start, values + offsets[dIdx + 1]));
+  }
+  m_IsAllocated = true;
+  m_NumTuples = m_Array.size();
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 template <typename T>
 typename NeighborList<T>::VectorType& NeighborList<T>::operator[](int grainId)
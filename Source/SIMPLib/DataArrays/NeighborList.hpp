@@ -441,6 +441,26 @@ public:
    */
   VectorType copyOfList(int grainId) const;
 
+  /**
+   * @brief Copies every list into one flat array. offsets must hold getNumberOfLists() + 1 values
+   * and values must hold getSize() values. List i is written to values[offsets[i]] through
+   * values[offsets[i + 1] - 1].
+   * @param offsets
+   * @param values
+   */
+  void copyToFlatArrays(uint64_t* offsets, T* values) const;
+
+  /**
+   * @brief Replaces all the lists with the ones described by a flat array in the same layout that
+   * copyToFlatArrays produces. Returns false and leaves the lists untouched if the offsets do not
+   * start at zero or are not increasing.
+   * @param numLists
+   * @param offsets numLists + 1 values
+   * @param values
+   * @return
+   */
+  bool setFromFlatArrays(size_t numLists, const uint64_t* offsets, const T* values);
+
   /**
    * @brief operator []
    * @param grainId
@@ -3,6 +3,7 @@ set(SUBDIR_NAME DataArrays)
 
 
 set(SIMPLib_${SUBDIR_NAME}_HDRS
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/BitMaskArray.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArray.hpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArray.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArrayFilter.h
@@ -14,6 +15,7 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
 )
 
 set(SIMPLib_${SUBDIR_NAME}_SRCS
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/BitMaskArray.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArray.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArray.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArrayFilter.cpp
@@ -34,13 +34,29 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "StringDataArray.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include <QtCore/QTextStream>
 
-#include "H5Support/H5Lite.h"
+#include "H5Support/QH5Lite.h"
 
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
 
+namespace
+{
+/**
+ * @brief Number of strings handed to HDF5 in each read/write call
+ */
+constexpr hsize_t k_H5SlabStrings = 1048576;
+
+/**
+ * @brief Smallest number of values held aside before they are merged back into the buffer
+ */
+constexpr size_t k_MinPendingValues = 4096;
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -56,7 +72,7 @@ StringDataArray::StringDataArray(size_t numTuples, const QString& name, bool all
 : IDataArray(name)
 , _ownsData(true)
 {
-  m_Array.resize(numTuples);
+  m_Offsets.assign(numTuples + 1, 0);
   setName(name);
 }
 
@@ -190,7 +206,8 @@ void StringDataArray::releaseOwnership()
 // -----------------------------------------------------------------------------
 void* StringDataArray::getVoidPointer(size_t i)
 {
-  return static_cast<void*>(&(m_Array[i]));
+  compact();
+  return static_cast<void*>(m_Buffer.data() + m_Offsets[i]);
 }
 
 // -----------------------------------------------------------------------------
@@ -198,7 +215,7 @@ void* StringDataArray::getVoidPointer(size_t i)
 // -----------------------------------------------------------------------------
 size_t StringDataArray::getNumberOfTuples() const
 {
-  return m_Array.size();
+  return m_Offsets.size() - 1;
 }
 
 // -----------------------------------------------------------------------------
@@ -206,7 +223,7 @@ size_t StringDataArray::getNumberOfTuples() const
 // -----------------------------------------------------------------------------
 size_t StringDataArray::getSize() const
 {
-  return m_Array.size();
+  return m_Offsets.size() - 1;
 }
 
 // -----------------------------------------------------------------------------
@@ -246,7 +263,8 @@ int StringDataArray::getRank() const
 // -----------------------------------------------------------------------------
 size_t StringDataArray::getTypeSize() const
 {
-  return sizeof(QString);
+  // getVoidPointer() and initializeTuple() work with the UTF-8 bytes of the buffer
+  return sizeof(char);
 }
 
 // -----------------------------------------------------------------------------
@@ -271,35 +289,40 @@ int StringDataArray::eraseTuples(const std::vector<size_t>& idxs)
 
   // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
   // off the end of the array and return an error code.
-  // for(std::vector<size_t>::size_type i = 0; i < idxs.size(); ++i)
+  size_t numTuples = getNumberOfTuples();
+  std::vector<bool> erase(numTuples, false);
   for(auto& value : idxs)
   {
-    if(value >= static_cast<size_t>(m_Array.size()))
+    if(value >= numTuples)
     {
       return -100;
     }
+    erase[value] = true;
   }
 
-  // Create a new Array to copy into
-  std::vector<QString> newArray;
-  std::vector<size_t>::size_type start = 0;
-  for(QVector<QString>::size_type i = 0; i < m_Array.size(); ++i)
+  // Slide the kept values down over the erased ones in a single pass. The write position never
+  // passes the read position so the offsets and the bytes can both be updated in place.
+  compact();
+  OffsetType writeOffset = 0;
+  size_t writeTuple = 0;
+  for(size_t i = 0; i < numTuples; i++)
   {
-    bool keep = true;
-    for(std::vector<size_t>::size_type j = start; j < idxs.size(); ++j)
+    if(erase[i])
     {
-      if(static_cast<size_t>(i) == idxs[j])
-      {
-        keep = false;
-        break;
-      }
+      continue;
     }
-    if(keep)
+    OffsetType start = m_Offsets[i];
+    OffsetType length = m_Offsets[i + 1] - start;
+    if(writeOffset != start && length > 0)
     {
-      newArray.push_back(m_Array[i]);
+      std::memmove(m_Buffer.data() + writeOffset, m_Buffer.data() + start, length);
     }
+    writeOffset += length;
+    writeTuple++;
+    m_Offsets[writeTuple] = writeOffset;
   }
-  m_Array = newArray;
+  m_Offsets.resize(writeTuple + 1);
+  m_Buffer.resize(writeOffset);
   return err;
 }
 
@@ -308,16 +331,20 @@ int StringDataArray::eraseTuples(const std::vector<size_t>& idxs)
 // -----------------------------------------------------------------------------
 int StringDataArray::copyTuple(size_t currentPos, size_t newPos)
 {
-  if(currentPos >= m_Array.size())
+  if(currentPos >= getNumberOfTuples())
   {
     return -1;
   }
-  if(newPos >= m_Array.size())
+  if(newPos >= getNumberOfTuples())
   {
     return -1;
   }
-  // QString s = m_Array[currentPos];
-  m_Array[newPos] = m_Array[currentPos];
+  if(currentPos == newPos)
+  {
+    return 0;
+  }
+  std::string value(getValueView(currentPos));
+  storeValue(newPos, value);
   return 0;
 }
 
@@ -326,7 +353,7 @@ int StringDataArray::copyTuple(size_t currentPos, size_t newPos)
 // -----------------------------------------------------------------------------
 bool StringDataArray::copyFromArray(size_t destTupleOffset, IDataArray::ConstPointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples)
 {
-  if(destTupleOffset >= m_Array.size())
+  if(destTupleOffset >= getNumberOfTuples())
   {
     return false;
   }
@@ -345,14 +372,15 @@ bool StringDataArray::copyFromArray(size_t destTupleOffset, IDataArray::ConstPoi
   {
     return false;
   }
-  if(totalSrcTuples + destTupleOffset > m_Array.size())
+  if(totalSrcTuples + destTupleOffset > getNumberOfTuples())
   {
     return false;
   }
 
-  for(size_t i = srcTupleOffset; i < srcTupleOffset + totalSrcTuples; i++)
+  for(size_t i = 0; i < totalSrcTuples; i++)
   {
-    m_Array[destTupleOffset + i] = source->getValue(i);
+    std::string value(source->getValueView(srcTupleOffset + i));
+    storeValue(destTupleOffset + i, value);
   }
   return true;
 }
@@ -362,7 +390,7 @@ bool StringDataArray::copyFromArray(size_t destTupleOffset, IDataArray::ConstPoi
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeTuple(size_t pos, const void* value)
 {
-  m_Array[pos] = *(reinterpret_cast<const QString*>(value));
+  setValueUtf8(pos, std::string_view(static_cast<const char*>(value)));
 }
 
 // -----------------------------------------------------------------------------
@@ -370,7 +398,9 @@ void StringDataArray::initializeTuple(size_t pos, const void* value)
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeWithZeros()
 {
-  m_Array.assign(m_Array.size(), QString(""));
+  m_Offsets.assign(m_Offsets.size(), 0);
+  m_Buffer.clear();
+  m_PendingValues.clear();
 }
 
 // -----------------------------------------------------------------------------
@@ -378,7 +408,7 @@ void StringDataArray::initializeWithZeros()
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeWithValue(const QString& value)
 {
-  m_Array.assign(m_Array.size(), value);
+  initializeWithValue(value.toUtf8().toStdString());
 }
 
 // -----------------------------------------------------------------------------
@@ -386,7 +416,19 @@ void StringDataArray::initializeWithValue(const QString& value)
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeWithValue(const std::string& value)
 {
-  m_Array.assign(m_Array.size(), QString::fromStdString(value));
+  size_t numTuples = getNumberOfTuples();
+  size_t length = value.size();
+  m_PendingValues.clear();
+  m_Buffer.resize(numTuples * length);
+  for(size_t i = 0; i < numTuples; i++)
+  {
+    m_Offsets[i] = i * length;
+    if(length > 0)
+    {
+      std::memcpy(m_Buffer.data() + i * length, value.data(), length);
+    }
+  }
+  m_Offsets[numTuples] = numTuples * length;
 }
 
 // -----------------------------------------------------------------------------
@@ -397,10 +439,9 @@ IDataArray::Pointer StringDataArray::deepCopy(bool forceNoAllocate) const
   StringDataArray::Pointer daCopy = StringDataArray::CreateArray(getNumberOfTuples(), getName(), true);
   if(!forceNoAllocate)
   {
-    for(std::vector<QString>::size_type i = 0; i < m_Array.size(); ++i)
-    {
-      daCopy->setValue(i, m_Array[i]);
-    }
+    daCopy->m_Offsets = m_Offsets;
+    daCopy->m_Buffer = m_Buffer;
+    daCopy->m_PendingValues = m_PendingValues;
   }
   return daCopy;
 }
@@ -410,7 +451,7 @@ IDataArray::Pointer StringDataArray::deepCopy(bool forceNoAllocate) const
 // -----------------------------------------------------------------------------
 int32_t StringDataArray::resizeTotalElements(size_t size)
 {
-  m_Array.resize(size);
+  resizeTuples(size);
   return 1;
 }
 
@@ -419,7 +460,17 @@ int32_t StringDataArray::resizeTotalElements(size_t size)
 // -----------------------------------------------------------------------------
 void StringDataArray::resizeTuples(size_t numTuples)
 {
-  m_Array.resize(numTuples);
+  compact();
+  if(numTuples < getNumberOfTuples())
+  {
+    m_Offsets.resize(numTuples + 1);
+    m_Buffer.resize(m_Offsets.back());
+  }
+  else
+  {
+    // New values are empty strings
+    m_Offsets.resize(numTuples + 1, m_Offsets.back());
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -427,9 +478,11 @@ void StringDataArray::resizeTuples(size_t numTuples)
 // -----------------------------------------------------------------------------
 void StringDataArray::initialize()
 {
-  if(!m_Array.empty())
+  if(getNumberOfTuples() > 0)
   {
-    m_Array.clear();
+    std::vector<OffsetType>(1, 0).swap(m_Offsets);
+    std::vector<char>().swap(m_Buffer);
+    m_PendingValues.clear();
     this->_ownsData = true;
   }
 }
@@ -439,7 +492,7 @@ void StringDataArray::initialize()
 // -----------------------------------------------------------------------------
 void StringDataArray::printTuple(QTextStream& out, size_t i, char delimiter) const
 {
-  out << m_Array[i];
+  out << getValue(i);
 }
 
 // -----------------------------------------------------------------------------
@@ -447,7 +500,7 @@ void StringDataArray::printTuple(QTextStream& out, size_t i, char delimiter) con
 // -----------------------------------------------------------------------------
 void StringDataArray::printComponent(QTextStream& out, size_t i, int j) const
 {
-  out << m_Array[i];
+  out << getValue(i);
 }
 
 // -----------------------------------------------------------------------------
@@ -463,7 +516,69 @@ QString StringDataArray::getFullNameOfClass() const
 // -----------------------------------------------------------------------------
 int StringDataArray::writeH5Data(hid_t parentId, const std::vector<size_t>& tDims) const
 {
-  return H5DataArrayWriter::writeStringDataArray<StringDataArray>(parentId, this);
+  std::string name = getName().toStdString();
+  if(QH5Lite::datasetExists(parentId, getName()))
+  {
+    H5Ldelete(parentId, name.c_str(), H5P_DEFAULT);
+  }
+
+  hsize_t numStrings = static_cast<hsize_t>(getNumberOfTuples());
+  hid_t typeId = H5Tcopy(H5T_C_S1);
+  H5Tset_size(typeId, H5T_VARIABLE);
+  hid_t fileSpaceId = H5Screate_simple(1, &numStrings, nullptr);
+  hid_t datasetId = H5Dcreate(parentId, name.c_str(), typeId, fileSpaceId, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  if(datasetId < 0)
+  {
+    H5Sclose(fileSpaceId);
+    H5Tclose(typeId);
+    return -1;
+  }
+
+  // HDF5 needs NUL terminated strings, so each slab is staged into one buffer and written with a
+  // single call instead of one write per string
+  herr_t err = 0;
+  std::vector<char> staging;
+  std::vector<const char*> pointers;
+  for(hsize_t start = 0; start < numStrings && err >= 0; start += k_H5SlabStrings)
+  {
+    hsize_t count = std::min(k_H5SlabStrings, numStrings - start);
+    size_t numBytes = count;
+    for(hsize_t i = 0; i < count; i++)
+    {
+      numBytes += getValueView(start + i).size();
+    }
+    staging.resize(numBytes);
+    pointers.resize(count);
+    char* dest = staging.data();
+    for(hsize_t i = 0; i < count; i++)
+    {
+      std::string_view value = getValueView(start + i);
+      if(!value.empty())
+      {
+        std::memcpy(dest, value.data(), value.size());
+      }
+      dest[value.size()] = '\0';
+      pointers[i] = dest;
+      dest += value.size() + 1;
+    }
+
+    H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, &start, nullptr, &count, nullptr);
+    hid_t memSpaceId = H5Screate_simple(1, &count, nullptr);
+    err = H5Dwrite(datasetId, typeId, memSpaceId, fileSpaceId, H5P_DEFAULT, pointers.data());
+    H5Sclose(memSpaceId);
+  }
+
+  H5Dclose(datasetId);
+  H5Sclose(fileSpaceId);
+  H5Tclose(typeId);
+  if(err < 0)
+  {
+    return err;
+  }
+
+  std::vector<size_t> h5TupleDims(1, getNumberOfTuples());
+  std::vector<size_t> cDims(1, 1);
+  return H5DataArrayWriter::writeDataArrayAttributes<Self>(parentId, this, h5TupleDims, cDims);
 }
 
 // -----------------------------------------------------------------------------
@@ -511,30 +626,120 @@ ToolTipGenerator StringDataArray::getToolTipGenerator() const
 // -----------------------------------------------------------------------------
 int StringDataArray::readH5Data(hid_t parentId)
 {
-  int err = 0;
-  this->resizeTuples(0);
-  std::vector<std::string> strings;
-  err = H5Lite::readVectorOfStringDataset(parentId, getName().toStdString(), strings);
+  m_Offsets.assign(1, 0);
+  m_Buffer.clear();
+  m_PendingValues.clear();
 
-  m_Array.resize(strings.size());
-  for(std::vector<QString>::size_type i = 0; i < strings.size(); i++)
+  std::string name = getName().toStdString();
+  hid_t datasetId = H5Dopen(parentId, name.c_str(), H5P_DEFAULT);
+  if(datasetId < 0)
   {
-    m_Array[i] = QString::fromStdString(strings[i]);
+    return -1;
   }
-#if 0
-  IDataArray::Pointer p = H5DataArrayReader::ReadStringDataArray(parentId, getName());
-  if (p.get() == nullptr)
+  hid_t fileTypeId = H5Dget_type(datasetId);
+  hid_t fileSpaceId = H5Dget_space(datasetId);
+  hssize_t numPoints = H5Sget_simple_extent_npoints(fileSpaceId);
+  int rank = H5Sget_simple_extent_ndims(fileSpaceId);
+
+  // Both variable and fixed length string datasets are accepted
+  bool isVariable = H5Tis_variable_str(fileTypeId) > 0;
+  size_t fixedSize = isVariable ? 0 : H5Tget_size(fileTypeId);
+  hid_t memTypeId = H5Tcopy(H5T_C_S1);
+  H5Tset_size(memTypeId, isVariable ? H5T_VARIABLE : fixedSize);
+
+  herr_t err = (numPoints < 0) ? -1 : 0;
+  hsize_t numStrings = (numPoints < 0) ? 0 : static_cast<hsize_t>(numPoints);
+  // Only one dimensional datasets, which is what writeH5Data produces, are read in slabs
+  hsize_t slabSize = (rank == 1) ? k_H5SlabStrings : std::max(numStrings, static_cast<hsize_t>(1));
+  m_Offsets.reserve(numStrings + 1);
+
+  std::vector<char*> vlenData;
+  std::vector<char> fixedData;
+  std::vector<size_t> lengths;
+  for(hsize_t start = 0; start < numStrings && err >= 0; start += slabSize)
   {
-    return -1;
+    hsize_t count = std::min(slabSize, numStrings - start);
+    hid_t memSpaceId = H5S_ALL;
+    hid_t selectedSpaceId = H5S_ALL;
+    if(rank == 1)
+    {
+      H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, &start, nullptr, &count, nullptr);
+      memSpaceId = H5Screate_simple(1, &count, nullptr);
+      selectedSpaceId = fileSpaceId;
+    }
+
+    // The bytes of each string are appended straight into the buffer
+    lengths.resize(count);
+    const char* values = nullptr;
+    size_t stride = 0;
+    if(isVariable)
+    {
+      vlenData.assign(count, nullptr);
+      err = H5Dread(datasetId, memTypeId, memSpaceId, selectedSpaceId, H5P_DEFAULT, vlenData.data());
+    }
+    else
+    {
+      fixedData.resize(count * fixedSize);
+      err = H5Dread(datasetId, memTypeId, memSpaceId, selectedSpaceId, H5P_DEFAULT, fixedData.data());
+      values = fixedData.data();
+      stride = fixedSize;
+    }
+
+    if(err >= 0)
+    {
+      size_t numBytes = 0;
+      for(hsize_t i = 0; i < count; i++)
+      {
+        const char* value = isVariable ? vlenData[i] : values + i * stride;
+        if(value == nullptr)
+        {
+          lengths[i] = 0;
+        }
+        else if(isVariable)
+        {
+          lengths[i] = std::strlen(value);
+        }
+        else
+        {
+          lengths[i] = static_cast<size_t>(std::find(value, value + stride, '\0') - value);
+        }
+        numBytes += lengths[i];
+      }
+
+      m_Buffer.reserve(m_Buffer.size() + numBytes);
+      for(hsize_t i = 0; i < count; i++)
+      {
+        const char* value = isVariable ? vlenData[i] : values + i * stride;
+        if(lengths[i] > 0)
+        {
+          m_Buffer.insert(m_Buffer.end(), value, value + lengths[i]);
+        }
+        m_Offsets.push_back(m_Buffer.size());
+      }
+    }
+
+    if(isVariable)
+    {
+      H5Dvlen_reclaim(memTypeId, (rank == 1) ? memSpaceId : fileSpaceId, H5P_DEFAULT, vlenData.data());
+    }
+    if(rank == 1)
+    {
+      H5Sclose(memSpaceId);
+    }
   }
-  StringDataArray::Pointer srcPtr = std::dynamic_pointer_cast<StringDataArray>(p);
-  size_t count = srcPtr->getNumberOfTuples();
-  for (size_t i = 0; i < count; ++i)
+
+  H5Tclose(memTypeId);
+  H5Sclose(fileSpaceId);
+  H5Tclose(fileTypeId);
+  H5Dclose(datasetId);
+
+  if(err < 0)
   {
-    m_Array.push_back( srcPtr->getValue(i) );
+    m_Offsets.assign(1, 0);
+    m_Buffer.clear();
+    return err;
   }
-#endif
-  return err;
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -542,7 +747,8 @@ int StringDataArray::readH5Data(hid_t parentId)
 // -----------------------------------------------------------------------------
 void StringDataArray::setValue(size_t i, const QString& value)
 {
-  m_Array[i] = value;
+  QByteArray bytes = value.toUtf8();
+  storeValue(i, std::string_view(bytes.constData(), static_cast<size_t>(bytes.size())));
 }
 
 // -----------------------------------------------------------------------------
@@ -550,7 +756,158 @@ void StringDataArray::setValue(size_t i, const QString& value)
 // -----------------------------------------------------------------------------
 QString StringDataArray::getValue(size_t i) const
 {
-  return m_Array.at(i);
+  std::string_view value = getValueView(i);
+  return QString::fromUtf8(value.data(), static_cast<int>(value.size()));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::setValueUtf8(size_t i, std::string_view value)
+{
+  storeValue(i, value);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::string_view StringDataArray::getValueView(size_t i) const
+{
+  if(!m_PendingValues.empty())
+  {
+    auto pending = m_PendingValues.find(i);
+    if(pending != m_PendingValues.end())
+    {
+      return pending->second;
+    }
+  }
+  OffsetType start = m_Offsets[i];
+  return std::string_view(m_Buffer.data() + start, m_Offsets[i + 1] - start);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::storeValue(size_t i, std::string_view value)
+{
+  OffsetType start = m_Offsets[i];
+  OffsetType length = m_Offsets[i + 1] - start;
+  auto pending = m_PendingValues.find(i);
+
+  // A value of the same length as the one in the buffer is overwritten in place
+  if(value.size() == length)
+  {
+    if(length > 0)
+    {
+      std::memmove(m_Buffer.data() + start, value.data(), length);
+    }
+    if(pending != m_PendingValues.end())
+    {
+      m_PendingValues.erase(pending);
+    }
+    return;
+  }
+
+  if(pending != m_PendingValues.end())
+  {
+    pending->second.assign(value.data(), value.size());
+  }
+  else
+  {
+    m_PendingValues.emplace(i, std::string(value));
+  }
+
+  // Merging costs one pass over the buffer so it is only done once the number of held values is
+  // a fixed fraction of the array, which keeps filling the array one value at a time linear
+  if(m_PendingValues.size() > std::max(k_MinPendingValues, getNumberOfTuples() / 8))
+  {
+    compact();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::compact()
+{
+  if(m_PendingValues.empty())
+  {
+    return;
+  }
+
+  std::vector<size_t> pendingIndices;
+  pendingIndices.reserve(m_PendingValues.size());
+  size_t numBytes = m_Buffer.size();
+  for(const auto& pending : m_PendingValues)
+  {
+    pendingIndices.push_back(pending.first);
+    numBytes += pending.second.size();
+    numBytes -= m_Offsets[pending.first + 1] - m_Offsets[pending.first];
+  }
+  std::sort(pendingIndices.begin(), pendingIndices.end());
+
+  // Runs of untouched values between the held values are copied as single blocks
+  size_t numTuples = getNumberOfTuples();
+  pendingIndices.push_back(numTuples);
+  std::vector<OffsetType> offsets(numTuples + 1, 0);
+  std::vector<char> buffer(numBytes);
+  size_t tuple = 0;
+  for(size_t pendingIndex : pendingIndices)
+  {
+    OffsetType runStart = m_Offsets[tuple];
+    OffsetType runLength = m_Offsets[pendingIndex] - runStart;
+    OffsetType dest = offsets[tuple];
+    if(runLength > 0)
+    {
+      std::memcpy(buffer.data() + dest, m_Buffer.data() + runStart, runLength);
+    }
+    for(size_t k = tuple; k < pendingIndex; k++)
+    {
+      offsets[k + 1] = m_Offsets[k + 1] - runStart + dest;
+    }
+    if(pendingIndex == numTuples)
+    {
+      break;
+    }
+
+    const std::string& value = m_PendingValues[pendingIndex];
+    if(!value.empty())
+    {
+      std::memcpy(buffer.data() + offsets[pendingIndex], value.data(), value.size());
+    }
+    offsets[pendingIndex + 1] = offsets[pendingIndex] + value.size();
+    tuple = pendingIndex + 1;
+  }
+
+  m_Offsets.swap(offsets);
+  m_Buffer.swap(buffer);
+  m_PendingValues.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool StringDataArray::isCompact() const
+{
+  return m_PendingValues.empty();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<StringDataArray::OffsetType>& StringDataArray::getOffsets()
+{
+  compact();
+  return m_Offsets;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<char>& StringDataArray::getBuffer()
+{
+  compact();
+  return m_Buffer;
 }
 
 // -----------------------------------------------------------------------------
@@ -37,6 +37,8 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include <QtCore/QString>
@@ -47,29 +49,21 @@
 
 /**
  * @class StringDataArray StringDataArray.h DREAM3DLib/Common/StringDataArray.h
- * @brief Stores an array of QString objects
+ * @brief Stores an array of strings as UTF-8 bytes in a single contiguous buffer
+ *
+ * String i occupies the bytes [offsets[i], offsets[i+1]) of the buffer, which is the same
+ * layout Apache Arrow uses for its large string arrays. Values that are replaced with a string
+ * of a different length are held aside and merged back into the buffer in a single pass once
+ * enough of them accumulate, or when compact() is called, so filling an array one value at
+ * a time stays linear.
+ *
+ * The Python bindings for this class are registered by hand in pySupport.h.
  *
  * @date Nov 13, 2012
  * @version 1.0
  */
 class SIMPLib_EXPORT StringDataArray : public IDataArray
 {
-  // clang-format off
-  // Start Python bindings declarations
-  PYB11_BEGIN_BINDINGS(StringDataArray SUPERCLASS IDataArray)
-  PYB11_SHARED_POINTERS(StringDataArray)
-  PYB11_STATIC_NEW_MACRO(StringDataArray)
-  PYB11_STATIC_CREATION(CreateArray OVERLOAD size_t QString bool)
-  PYB11_STATIC_CREATION(CreateArray OVERLOAD size_t std::vector<size_t> QString bool)
-  PYB11_PROPERTY(QString Name READ getName WRITE setName)
-  PYB11_METHOD(QString getValue ARGS size_t,i)
-  PYB11_METHOD(void setValue ARGS size_t,i const.QString.&,value)
-  PYB11_METHOD(size_t getSize)
-  PYB11_METHOD(size_t getNumberOfTuples)
-  PYB11_END_BINDINGS()
-  // End Python bindings declarations
-  // clang-format on
-
 public:
   using Self = StringDataArray;
   using Pointer = std::shared_ptr<Self>;
@@ -81,6 +75,7 @@ public:
   static Pointer New();
 
   using value_type = QString;
+  using OffsetType = uint64_t;
 
   /**
    * @brief Returns the name of the class for StringDataArray
@@ -175,9 +170,9 @@ public:
    */
   void releaseOwnership() override;
   /**
-   * @brief Returns a void pointer pointing to the index of the array. nullptr
-   * pointers are entirely possible. No checks are performed to make sure
-   * the index is with in the range of the internal data array.
+   * @brief Returns a pointer to the first UTF-8 byte of value i in the contiguous buffer. The
+   * array is compacted first. No checks are performed to make sure the index is with in the
+   * range of the internal data array.
    * @param i The index to have the returned pointer pointing to.
    * @return Void Pointer. Possibly nullptr.
    */
@@ -210,11 +205,8 @@ public:
   int getRank() const;
 
   /**
-   * @brief Returns the number of bytes that make up the data type.
-   * 1 = char
-   * 2 = 16 bit integer
-   * 4 = 32 bit integer/Float
-   * 8 = 64 bit integer/Double
+   * @brief Returns the size of one UTF-8 code unit, which is the element type behind
+   * getVoidPointer() and initializeTuple().
    */
   size_t getTypeSize() const override;
 
@@ -262,9 +254,9 @@ public:
   bool copyFromArray(size_t destTupleOffset, IDataArray::ConstPointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples) override;
 
   /**
-   * @brief Does Nothing
+   * @brief Sets the value at pos from a pointer to a null terminated UTF-8 string
    * @param pos The index of the Tuple
-   * @param value pointer to value
+   * @param value pointer to the first byte of the string
    */
   void initializeTuple(size_t pos, const void* value) override;
 
@@ -383,6 +375,46 @@ public:
    */
   QString getValue(size_t i) const;
 
+  /**
+   * @brief Sets the value at index i from UTF-8 encoded bytes without going through QString
+   * @param i
+   * @param value
+   */
+  void setValueUtf8(size_t i, std::string_view value);
+
+  /**
+   * @brief Returns the UTF-8 bytes of the value at index i without copying them. The view is
+   * invalidated by any call that modifies the array.
+   * @param i
+   * @return
+   */
+  std::string_view getValueView(size_t i) const;
+
+  /**
+   * @brief Merges any values that are held aside back into the contiguous buffer. After this
+   * call getOffsets() and getBuffer() describe every value in the array.
+   */
+  void compact();
+
+  /**
+   * @brief Returns true if every value lives in the contiguous buffer
+   * @return
+   */
+  bool isCompact() const;
+
+  /**
+   * @brief Returns the numTuples + 1 byte offsets of each value in the buffer. The array is
+   * compacted first.
+   * @return
+   */
+  const std::vector<OffsetType>& getOffsets();
+
+  /**
+   * @brief Returns the UTF-8 bytes of all the values. The array is compacted first.
+   * @return
+   */
+  const std::vector<char>& getBuffer();
+
 protected:
   /**
    * @brief Protected Constructor
@@ -395,9 +427,18 @@ protected:
 
 private:
   QString m_InitValue;
-  std::vector<QString> m_Array;
+  std::vector<OffsetType> m_Offsets = {0};
+  std::vector<char> m_Buffer;
+  std::unordered_map<size_t, std::string> m_PendingValues;
   bool _ownsData;
 
+  /**
+   * @brief Stores the value for index i, either in place or aside until the next compaction
+   * @param i
+   * @param value
+   */
+  void storeValue(size_t i, std::string_view value);
+
 public:
   StringDataArray(const StringDataArray&) = delete;            // Copy Constructor Not Implemented
   StringDataArray(StringDataArray&&) = delete;                 // Move Constructor Not Implemented
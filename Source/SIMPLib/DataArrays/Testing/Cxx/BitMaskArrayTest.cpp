@@ -0,0 +1,300 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <algorithm>
+#include <iostream>
+
+#include <QtCore/QFile>
+
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Lite.h"
+#include "H5Support/QH5Utilities.h"
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/BitMaskArray.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class BitMaskArrayTest
+{
+public:
+  // An odd size so the last word is only partially used
+  const size_t k_ArraySize = 203;
+
+  BitMaskArrayTest() = default;
+  virtual ~BitMaskArrayTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  BoolArrayType::Pointer createBoolArray(size_t modulus)
+  {
+    BoolArrayType::Pointer boolArray = BoolArrayType::CreateArray(k_ArraySize, "Bools", true);
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      boolArray->setValue(i, (i % modulus) == 0);
+    }
+    return boolArray;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBoolArrayRoundTrip()
+  {
+    BoolArrayType::Pointer boolArray = createBoolArray(3);
+    BitMaskArray::Pointer mask = BitMaskArray::FromBoolArray(*boolArray);
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfTuples(), k_ArraySize)
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfWords(), BitMaskArray::GetNumberOfWords(k_ArraySize))
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(mask->getValue(i), boolArray->getValue(i))
+    }
+
+    BoolArrayType::Pointer unpacked = mask->toBoolArray();
+    DREAM3D_REQUIRE_EQUAL(unpacked->getNumberOfTuples(), k_ArraySize)
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(unpacked->getValue(i), boolArray->getValue(i))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBitwiseOperations()
+  {
+    BoolArrayType::Pointer evens = createBoolArray(2);
+    BoolArrayType::Pointer threes = createBoolArray(3);
+    BitMaskArray::Pointer threesMask = BitMaskArray::FromBoolArray(*threes);
+
+    BitMaskArray::Pointer andMask = BitMaskArray::FromBoolArray(*evens);
+    DREAM3D_REQUIRE(andMask->bitwiseAnd(*threesMask))
+    BitMaskArray::Pointer orMask = BitMaskArray::FromBoolArray(*evens);
+    DREAM3D_REQUIRE(orMask->bitwiseOr(*threesMask))
+    BitMaskArray::Pointer andNotMask = BitMaskArray::FromBoolArray(*evens);
+    DREAM3D_REQUIRE(andNotMask->bitwiseAndNot(*threesMask))
+    BitMaskArray::Pointer notMask = BitMaskArray::FromBoolArray(*evens);
+    notMask->bitwiseNot();
+
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      bool a = evens->getValue(i);
+      bool b = threes->getValue(i);
+      DREAM3D_REQUIRE_EQUAL(andMask->getValue(i), a && b)
+      DREAM3D_REQUIRE_EQUAL(orMask->getValue(i), a || b)
+      DREAM3D_REQUIRE_EQUAL(andNotMask->getValue(i), a && !b)
+      DREAM3D_REQUIRE_EQUAL(notMask->getValue(i), !a)
+    }
+
+    // Bits past the end must stay clear after a NOT
+    size_t tailBits = notMask->getNumberOfWords() * BitMaskArray::k_BitsPerWord - k_ArraySize;
+    BitMaskArray::WordType lastWord = *notMask->getWordPointer(notMask->getNumberOfWords() - 1);
+    BitMaskArray::WordType tail = lastWord >> (BitMaskArray::k_BitsPerWord - tailBits);
+    DREAM3D_REQUIRE_EQUAL(tail, 0)
+
+    // Generic IDataArray callers must not be handed the packed words as if they were bools
+    DREAM3D_REQUIRE(notMask->getVoidPointer(0) == nullptr)
+
+    BitMaskArray::Pointer smaller = BitMaskArray::CreateArray(k_ArraySize - 1, "Smaller", true);
+    DREAM3D_REQUIRE_EQUAL(andMask->bitwiseAnd(*smaller), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCountTrue()
+  {
+    BitMaskArray::Pointer mask = BitMaskArray::CreateArray(k_ArraySize, "Mask", true);
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), 0)
+    mask->initializeWithValue(true);
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), k_ArraySize)
+
+    BoolArrayType::Pointer threes = createBoolArray(3);
+    mask = BitMaskArray::FromBoolArray(*threes);
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), (k_ArraySize + 2) / 3)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTupleErase()
+  {
+    BoolArrayType::Pointer threes = createBoolArray(3);
+    BitMaskArray::Pointer mask = BitMaskArray::FromBoolArray(*threes);
+
+    // Unsorted on purpose
+    std::vector<size_t> idxs = {150, 0, 64, 65, 202};
+    int32_t err = mask->eraseTuples(idxs);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfTuples(), k_ArraySize - idxs.size())
+
+    size_t dest = 0;
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      if(std::find(idxs.begin(), idxs.end(), i) != idxs.end())
+      {
+        continue;
+      }
+      DREAM3D_REQUIRE_EQUAL(mask->getValue(dest), threes->getValue(i))
+      dest++;
+    }
+
+    idxs = {k_ArraySize + 10};
+    err = mask->eraseTuples(idxs);
+    DREAM3D_REQUIRE_EQUAL(err, -100)
+
+    // Repeated indices only remove their tuple once, even when there are more of them than tuples
+    size_t numTuples = mask->getNumberOfTuples();
+    idxs.assign(numTuples + 5, 1);
+    idxs.push_back(3);
+    err = mask->eraseTuples(idxs);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfTuples(), numTuples - 2)
+
+    idxs.assign(numTuples, 0);
+    idxs.push_back(numTuples + 1);
+    err = mask->eraseTuples(idxs);
+    DREAM3D_REQUIRE_EQUAL(err, -100)
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfTuples(), numTuples - 2)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestResizeAndCopy()
+  {
+    BoolArrayType::Pointer threes = createBoolArray(3);
+    BitMaskArray::Pointer mask = BitMaskArray::FromBoolArray(*threes);
+
+    mask->resizeTuples(70);
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfTuples(), 70)
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), 24)
+    mask->resizeTuples(k_ArraySize);
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), 24)
+
+    BitMaskArray::Pointer copy = std::dynamic_pointer_cast<BitMaskArray>(mask->deepCopy());
+    DREAM3D_REQUIRE_VALID_POINTER(copy.get())
+    DREAM3D_REQUIRE_EQUAL(copy->getSize(), mask->getSize())
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(copy->getValue(i), mask->getValue(i))
+    }
+
+    BitMaskArray::Pointer target = BitMaskArray::CreateArray(k_ArraySize, "Target", true);
+    DREAM3D_REQUIRE(target->copyFromArray(10, threes, 0, 20))
+    for(size_t i = 0; i < 20; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(target->getValue(10 + i), threes->getValue(i))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(UnitTest::BitMaskArrayTest::TestFile);
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestH5RoundTrip()
+  {
+    BoolArrayType::Pointer threes = createBoolArray(3);
+    BitMaskArray::Pointer mask = BitMaskArray::FromBoolArray(*threes);
+    mask->setName("Mask");
+    std::vector<size_t> tDims = {k_ArraySize};
+
+    {
+      hid_t fileId = QH5Utilities::createFile(UnitTest::BitMaskArrayTest::TestFile);
+      DREAM3D_REQUIRE(fileId > 0)
+      H5ScopedFileSentinel sentinel(fileId, false);
+      DREAM3D_REQUIRE_EQUAL(mask->writeH5Data(fileId, tDims), 0)
+    }
+
+    {
+      hid_t fileId = QH5Utilities::openFile(UnitTest::BitMaskArrayTest::TestFile, true);
+      DREAM3D_REQUIRE(fileId > 0)
+      H5ScopedFileSentinel sentinel(fileId, false);
+      BitMaskArray::Pointer readMask = BitMaskArray::CreateArray(0, "Mask", false);
+      DREAM3D_REQUIRE_EQUAL(readMask->readH5Data(fileId), 0)
+      DREAM3D_REQUIRE_EQUAL(readMask->getNumberOfTuples(), k_ArraySize)
+      DREAM3D_REQUIRE_EQUAL(readMask->getNumberOfComponents(), 1)
+      for(size_t i = 0; i < k_ArraySize; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(readMask->getValue(i), mask->getValue(i))
+      }
+    }
+
+    // A TupleDimensions attribute that does not match the dataset extent must be rejected
+    {
+      hid_t fileId = QH5Utilities::openFile(UnitTest::BitMaskArrayTest::TestFile, false);
+      DREAM3D_REQUIRE(fileId > 0)
+      H5ScopedFileSentinel sentinel(fileId, false);
+      std::vector<size_t> badDims = {k_ArraySize * 4};
+      hsize_t rank = 1;
+      DREAM3D_REQUIRE(QH5Lite::writePointerAttribute(fileId, "Mask", SIMPL::HDF5::TupleDimensions, 1, &rank, badDims.data()) >= 0)
+      BitMaskArray::Pointer readMask = BitMaskArray::CreateArray(0, "Mask", false);
+      DREAM3D_REQUIRE(readMask->readH5Data(fileId) < 0)
+      DREAM3D_REQUIRE_EQUAL(readMask->getNumberOfTuples(), 0)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### BitMaskArrayTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestBoolArrayRoundTrip())
+    DREAM3D_REGISTER_TEST(TestBitwiseOperations())
+    DREAM3D_REGISTER_TEST(TestCountTrue())
+    DREAM3D_REGISTER_TEST(TestTupleErase())
+    DREAM3D_REGISTER_TEST(TestResizeAndCopy())
+    DREAM3D_REGISTER_TEST(TestH5RoundTrip())
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+
+public:
+  BitMaskArrayTest(const BitMaskArrayTest&) = delete;            // Copy Constructor Not Implemented
+  BitMaskArrayTest(BitMaskArrayTest&&) = delete;                 // Move Constructor Not Implemented
+  BitMaskArrayTest& operator=(const BitMaskArrayTest&) = delete; // Copy Assignment Not Implemented
+  BitMaskArrayTest& operator=(BitMaskArrayTest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -659,6 +659,46 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  void TestNeighborListFlatArraysForType()
+  {
+    typename NeighborList<T>::Pointer neiList = NeighborList<T>::CreateArray(6, std::string("NeighborList"), true);
+    for(int i = 0; i < 6; ++i)
+    {
+      // List 3 is left empty
+      for(int j = 0; j < i && i != 3; ++j)
+      {
+        neiList->addEntry(i, static_cast<T>(i * 10 + j));
+      }
+    }
+
+    size_t numLists = static_cast<size_t>(neiList->getNumberOfLists());
+    std::vector<uint64_t> offsets(numLists + 1);
+    std::vector<T> values(neiList->getSize());
+    neiList->copyToFlatArrays(offsets.data(), values.data());
+    DREAM3D_REQUIRE_EQUAL(offsets[0], 0)
+    DREAM3D_REQUIRE_EQUAL(offsets[numLists], values.size())
+    DREAM3D_REQUIRE_EQUAL(offsets[4], offsets[3])
+
+    typename NeighborList<T>::Pointer copy = NeighborList<T>::CreateArray(0, std::string("Copy"), true);
+    bool valid = copy->setFromFlatArrays(numLists, offsets.data(), values.data());
+    DREAM3D_REQUIRE_EQUAL(valid, true)
+    DREAM3D_REQUIRE_EQUAL(copy->getNumberOfLists(), neiList->getNumberOfLists())
+    for(int i = 0; i < neiList->getNumberOfLists(); ++i)
+    {
+      DREAM3D_REQUIRE(copy->copyOfList(i) == neiList->copyOfList(i))
+    }
+
+    // Decreasing offsets are rejected and the lists are left alone
+    std::swap(offsets[1], offsets[2]);
+    valid = copy->setFromFlatArrays(numLists, offsets.data(), values.data());
+    DREAM3D_REQUIRE_EQUAL(valid, false)
+    DREAM3D_REQUIRE_EQUAL(copy->getSize(), neiList->getSize())
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -676,6 +716,9 @@ public:
     TestNeighborListForType<double>();
 
     TestNeighborListDeepCopyForType<int8_t>();
+
+    TestNeighborListFlatArraysForType<int32_t>();
+    TestNeighborListFlatArraysForType<float>();
   }
 
   // -----------------------------------------------------------------------------
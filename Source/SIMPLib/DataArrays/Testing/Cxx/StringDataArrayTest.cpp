@@ -37,6 +37,7 @@
 
 #include <iostream>
 #include <string>
+#include <string_view>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Constants.h"
@@ -378,6 +379,79 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestValueViews()
+  {
+    StringDataArray::Pointer nodes = initializeStringDataArray();
+
+    // Non ASCII values round trip through the UTF-8 buffer
+    QString grain = QString::fromUtf8("K\xC3\xB6rner \xCE\xB1");
+    nodes->setValue(3, grain);
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(3), grain)
+    DREAM3D_REQUIRE(nodes->getValueView(3) == std::string_view("K\xC3\xB6rner \xCE\xB1"))
+
+    // Values of a new length are held until the array is compacted, same length values are written in place
+    DREAM3D_REQUIRE_EQUAL(nodes->isCompact(), false)
+    nodes->setValueUtf8(0, "ZERO");
+    nodes->setValueUtf8(1, "ONE");
+    DREAM3D_REQUIRE(nodes->getValueView(0) == std::string_view("ZERO"))
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(1), QString("ONE"))
+
+    const std::vector<StringDataArray::OffsetType>& offsets = nodes->getOffsets();
+    DREAM3D_REQUIRE_EQUAL(nodes->isCompact(), true)
+    DREAM3D_REQUIRE_EQUAL(offsets.size(), k_ArraySize + 1)
+    DREAM3D_REQUIRE_EQUAL(offsets.front(), 0)
+    DREAM3D_REQUIRE_EQUAL(offsets.back(), nodes->getBuffer().size())
+    std::string expected = "ZEROONEtwo";
+    DREAM3D_REQUIRE(std::string_view(nodes->getBuffer().data(), offsets[3]) == expected)
+
+    // The void* API works on UTF-8 bytes: one byte elements, pointers into the buffer and C strings in
+    DREAM3D_REQUIRE_EQUAL(nodes->getTypeSize(), sizeof(char))
+    DREAM3D_REQUIRE(static_cast<const char*>(nodes->getVoidPointer(1)) == nodes->getBuffer().data() + 4)
+    nodes->initializeTuple(2, "K\xC3\xB6rner");
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(2), QString::fromUtf8("K\xC3\xB6rner"))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSequentialFill()
+  {
+    // Enough values to force several merges of the held values while filling
+    const size_t numTuples = 50000;
+    StringDataArray::Pointer labels = StringDataArray::CreateArray(numTuples, kArrayName, true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      labels->setValue(i, QString("Label_%1").arg(i));
+    }
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(labels->getValue(i), QString("Label_%1").arg(i))
+    }
+
+    // Erasing keeps the order of the remaining values
+    std::vector<size_t> idxs;
+    for(size_t i = 0; i < numTuples; i += 3)
+    {
+      idxs.push_back(i);
+    }
+    int err = labels->eraseTuples(idxs);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    DREAM3D_REQUIRE_EQUAL(labels->getNumberOfTuples(), numTuples - idxs.size())
+    size_t index = 0;
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      if(i % 3 == 0)
+      {
+        continue;
+      }
+      DREAM3D_REQUIRE_EQUAL(labels->getValue(index), QString("Label_%1").arg(i))
+      index++;
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -396,6 +470,8 @@ public:
     DREAM3D_REGISTER_TEST(TestTupleCopy())
     DREAM3D_REGISTER_TEST(TestTupleErase())
     DREAM3D_REGISTER_TEST(TestDeepCopyArray())
+    DREAM3D_REGISTER_TEST(TestValueViews())
+    DREAM3D_REGISTER_TEST(TestSequentialFill())
 
 #if REMOVE_TEST_FILES
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
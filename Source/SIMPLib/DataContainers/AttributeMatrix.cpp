@@ -54,6 +54,7 @@
 #include "SIMPLib/DataContainers/AttributeMatrixProxy.h"
 #include "SIMPLib/DataContainers/DataContainerProxy.h"
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/HDF5/H5HyperslabRegion.h"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
@@ -585,6 +586,14 @@ int AttributeMatrix::addAttributeArrayFromHDF5Path(hid_t gid, const QString& nam
       dPtr->resizeTuples(getNumberOfTuples());
     }
   }
+  else if(classType.compare("BitMaskArray") == 0)
+  {
+    dPtr = H5DataArrayReader::ReadBitMaskArray(gid, name, preflight);
+    if(preflight)
+    {
+      dPtr->resizeTuples(getNumberOfTuples());
+    }
+  }
   else if(classType.compare("vector") == 0)
   {
   }
@@ -620,6 +629,14 @@ int AttributeMatrix::addAttributeArrayFromHDF5Path(hid_t gid, const QString& nam
 //
 // -----------------------------------------------------------------------------
 int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy)
+{
+  return readAttributeArraysFromHDF5(amGid, preflight, attrMatProxy, H5HyperslabRegion());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy, const H5HyperslabRegion& region, bool deferArrayReads)
 {
   int err = 0;
   AttributeMatrixProxy::StorageType dasToRead = attrMatProxy->getDataArrays();
@@ -636,12 +653,49 @@ int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, At
 
     if(classType.startsWith("DataArray"))
     {
-      dPtr = H5DataArrayReader::ReadIDataArray(amGid, daToRead.getName(), preflight);
+      IDataArray::DeferredLoader loader;
+      if(region.isEmpty() && deferArrayReads && !preflight)
+      {
+        loader = H5DataArrayReader::CreateDeferredLoader(amGid, daToRead.getName());
+      }
+
+      if(loader)
+      {
+        dPtr = H5DataArrayReader::ReadIDataArray(amGid, daToRead.getName(), true);
+        if(nullptr != dPtr.get())
+        {
+          dPtr->setDeferredLoader(loader);
+          dPtr->setDeferredSourceFile(QH5Utilities::fileNameFromFileId(amGid));
+        }
+      }
+      else if(region.isEmpty())
+      {
+        dPtr = H5DataArrayReader::ReadIDataArray(amGid, daToRead.getName(), preflight);
+      }
+      else
+      {
+        dPtr = H5DataArrayReader::ReadIDataArray(amGid, daToRead.getName(), region, preflight);
+        if(nullptr == dPtr.get())
+        {
+          err = -1;
+          break;
+        }
+      }
+    }
+    else if(!region.isEmpty())
+    {
+      qDebug() << "Array " << daToRead.getName() << " of type " << classType << " can not be read as a region";
+      err = -1;
+      break;
     }
     else if(classType.compare("StringDataArray") == 0)
     {
       dPtr = H5DataArrayReader::ReadStringDataArray(amGid, daToRead.getName(), preflight);
     }
+    else if(classType.compare("BitMaskArray") == 0)
+    {
+      dPtr = H5DataArrayReader::ReadBitMaskArray(amGid, daToRead.getName(), preflight);
+    }
     else if(classType.compare("vector") == 0)
     {
     }
@@ -1029,6 +1083,31 @@ IDataArray::Pointer AttributeMatrix::getPrereqIDataArray(AbstractFilter* filter,
     ss = QObject::tr("Unable to cast input array %1 to the necessary type.").arg(attributeArrayName);
     filter->setErrorCondition(err, ss);
   }
+  else if(!readDeferredArray(filter, attributeArray, err))
+  {
+    return nullptr;
+  }
 
   return attributeArray;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool AttributeMatrix::readDeferredArray(AbstractFilter* filter, const IDataArrayShPtrType& array, int err) const
+{
+  if(!array->isDeferred() || (nullptr != filter && filter->getInPreflight()))
+  {
+    return true;
+  }
+  if(array->materialize() < 0)
+  {
+    if(nullptr != filter)
+    {
+      QString ss = QObject::tr("The data of the DataArray '%1' in the AttributeMatrix '%2' could not be read from '%3'").arg(array->getName()).arg(getName()).arg(array->getDeferredSourceFile());
+      filter->setErrorCondition(err, ss);
+    }
+    return false;
+  }
+  return true;
+}
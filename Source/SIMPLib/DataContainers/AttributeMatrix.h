@@ -60,6 +60,7 @@
 
 class AttributeMatrixProxy;
 class DataContainerProxy;
+class H5HyperslabRegion;
 class SIMPLH5DataReaderRequirements;
 template <class T>
 class DataArray;
@@ -373,6 +374,10 @@ public:
                .arg(attributeArrayName);
       filter->setErrorCondition(err, ss);
     }
+    if(nullptr != attributeArray.get() && !readDeferredArray(filter, iDataArray, err))
+    {
+      return ArrayType::NullPointer();
+    }
     return attributeArray;
   }
 
@@ -614,6 +619,20 @@ public:
    */
   virtual int readAttributeArraysFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy);
 
+  /**
+   * @brief readAttributeArraysFromHDF5 Reads only the tuples selected by the region from each checked
+   * DataArray. Other array types cannot be read as a region and produce an error unless the region is empty.
+   * When deferArrayReads is set, DataArrays that are read in full are created from their meta data only and
+   * read from the file on first access. Other array types are always read immediately.
+   * @param amGid
+   * @param preflight
+   * @param attrMatProxy
+   * @param region
+   * @param deferArrayReads
+   * @return
+   */
+  int readAttributeArraysFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy, const H5HyperslabRegion& region, bool deferArrayReads = false);
+
   /**
    * @brief generateXdmfText
    * @param centering
@@ -642,6 +661,16 @@ public:
 protected:
   AttributeMatrix(const std::vector<size_t>& tDims, const QString& name, AttributeMatrix::Type attrType);
 
+  /**
+   * @brief Reads a deferred prerequisite array once, before the filter starts using it, so the element
+   * accessors never have to. Nothing is read while the filter is preflighting.
+   * @param filter The filter to report a failed read to. Can be nullptr.
+   * @param array
+   * @param err The error code to set into the filter if the data can not be read
+   * @return false if the data could not be read
+   */
+  bool readDeferredArray(AbstractFilter* filter, const IDataArrayShPtrType& array, int err) const;
+
   /**
    * @brief writeXdmfAttributeData
    * @param array
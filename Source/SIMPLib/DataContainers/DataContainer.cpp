@@ -53,6 +53,7 @@
 #include "SIMPLib/Geometry/TetrahedralGeom.h"
 #include "SIMPLib/Geometry/TriangleGeom.h"
 #include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/HDF5/H5HyperslabRegion.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
 #include "SIMPLib/Utilities/STLUtilities.hpp"
 
@@ -280,6 +281,25 @@ int DataContainer::readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, Da
   int err = 0;
   std::vector<size_t> tDims;
 
+  // A read region selects a sub-volume of an Image geometry. Only the Cell attribute matrices
+  // that span the whole geometry are read as hyperslabs; everything else is read in full.
+  const H5HyperslabRegion& region = dcProxy.getReadRegion();
+  ImageGeom::Pointer imageGeom = getGeometryAs<ImageGeom>();
+  std::vector<size_t> geomDims;
+  if(!region.isEmpty())
+  {
+    if(nullptr == imageGeom)
+    {
+      return -1;
+    }
+    SizeVec3Type dims = imageGeom->getDimensions();
+    geomDims = {dims[0], dims[1], dims[2]};
+    if(!region.fitsWithin(geomDims))
+    {
+      return -1;
+    }
+  }
+
   DataContainerProxy::StorageType& attrMatsToRead = dcProxy.getAttributeMatricies();
   AttributeMatrix::Type amType = AttributeMatrix::Type::Unknown;
   QString amName;
@@ -310,15 +330,16 @@ int DataContainer::readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, Da
       return -1;
     }
 
+    amType = static_cast<AttributeMatrix::Type>(amTypeTmp);
+    bool readRegion = !region.isEmpty() && amType == AttributeMatrix::Type::Cell && tDims == geomDims;
     if(getAttributeMatrix(amName) == nullptr)
     {
-      amType = static_cast<AttributeMatrix::Type>(amTypeTmp);
-      AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, amName, amType);
+      AttributeMatrix::Pointer am = AttributeMatrix::New(readRegion ? region.getTupleDims() : tDims, amName, amType);
       addOrReplaceAttributeMatrix(am);
     }
 
     AttributeMatrixProxy amProxy = iter.value();
-    err = getAttributeMatrix(amName)->readAttributeArraysFromHDF5(amGid, preflight, &amProxy);
+    err = getAttributeMatrix(amName)->readAttributeArraysFromHDF5(amGid, preflight, &amProxy, readRegion ? region : H5HyperslabRegion(), dcProxy.getDeferArrayReads());
     if(err < 0)
     {
       err |= H5Gclose(dcGid);
@@ -328,6 +349,11 @@ int DataContainer::readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, Da
 
   err |= H5Gclose(dcGid);
 
+  if(!region.isEmpty())
+  {
+    region.cropImageGeometry(*imageGeom);
+  }
+
   return err;
 }
 
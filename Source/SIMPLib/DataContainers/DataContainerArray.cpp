@@ -35,7 +35,9 @@
 
 #include "DataContainerArray.h"
 
+#include <algorithm>
 #include <type_traits>
+#include <vector>
 
 #include <QtCore/QTextStream>
 
@@ -45,6 +47,8 @@
 #include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
 #include "SIMPLib/DataContainers/DataContainerProxy.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/HDF5/H5HyperslabRegion.h"
 #include "SIMPLib/Montages/AbstractMontage.h"
 #include "SIMPLib/Montages/GridMontage.h"
 
@@ -365,6 +369,22 @@ int DataContainerArray::readDataContainersFromHDF5(bool preflight, hid_t dcaGid,
       }
       return -198745603;
     }
+    const H5HyperslabRegion& region = dcProxy.getReadRegion();
+    if(!region.isEmpty())
+    {
+      ImageGeom::Pointer imageGeom = dc->getGeometryAs<ImageGeom>();
+      SizeVec3Type dims = (nullptr == imageGeom) ? SizeVec3Type(0, 0, 0) : imageGeom->getDimensions();
+      if(!region.fitsWithin({dims[0], dims[1], dims[2]}))
+      {
+        if(nullptr != obs)
+        {
+          QString ss = QObject::tr("The read region for Data Container '%1' does not fit inside its Image Geometry").arg(dcProxy.getName());
+          obs->setErrorCondition(-198745605, ss);
+        }
+        H5Gclose(dcGid);
+        return -198745605;
+      }
+    }
     err = this->getDataContainer(dcProxy.getName())->readAttributeMatricesFromHDF5(preflight, dcGid, dcProxy);
     if(err < 0)
     {
@@ -694,6 +714,72 @@ DataContainerArray::Pointer DataContainerArray::deepCopy(bool forceNoAllocate) c
   return dcaCopy;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerArray::setDeferredMemoryBudget(size_t bytes)
+{
+  m_DeferredMemoryBudget = bytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DataContainerArray::getDeferredMemoryBudget() const
+{
+  return m_DeferredMemoryBudget;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DataContainerArray::releaseDeferredArrays()
+{
+  if(m_DeferredMemoryBudget == 0)
+  {
+    return 0;
+  }
+
+  size_t residentBytes = 0;
+  std::vector<IDataArray::Pointer> candidates;
+  for(const auto& dc : getDataContainers())
+  {
+    for(const auto& am : dc->getAttributeMatrices())
+    {
+      for(const auto& array : *am)
+      {
+        if(array->isDeferred() || !array->isAllocated())
+        {
+          continue;
+        }
+        residentBytes += array->getSize() * array->getTypeSize();
+        if(array->hasDeferredSource())
+        {
+          candidates.push_back(array);
+        }
+      }
+    }
+  }
+
+  // Releasing the largest arrays first keeps the number of arrays that have to be read again small
+  std::sort(candidates.begin(), candidates.end(), [](const IDataArray::Pointer& a, const IDataArray::Pointer& b) { return a->getSize() * a->getTypeSize() > b->getSize() * b->getTypeSize(); });
+
+  size_t releasedBytes = 0;
+  for(const auto& array : candidates)
+  {
+    if(residentBytes - releasedBytes <= m_DeferredMemoryBudget)
+    {
+      break;
+    }
+    size_t numBytes = array->getSize() * array->getTypeSize();
+    if(array->evict())
+    {
+      releasedBytes += numBytes;
+    }
+  }
+  return releasedBytes;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
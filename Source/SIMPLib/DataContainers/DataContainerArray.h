@@ -661,12 +661,34 @@ public:
    */
   DataContainerArray::Pointer deepCopy(bool forceNoAllocate = false) const;
 
+  /**
+   * @brief Sets the number of bytes the attribute arrays may hold in memory before arrays that were read
+   * on first access are released back to their file. Zero disables releasing arrays.
+   * @param bytes
+   */
+  void setDeferredMemoryBudget(size_t bytes);
+
+  /**
+   * @brief getDeferredMemoryBudget
+   * @return
+   */
+  size_t getDeferredMemoryBudget() const;
+
+  /**
+   * @brief Releases unmodified arrays that can be read again from their file, largest first, until the
+   * attribute arrays fit within the deferred memory budget. This must only be called while no filter is
+   * holding raw pointers into the arrays, e.g. between filters of a pipeline.
+   * @return The number of bytes that were released
+   */
+  size_t releaseDeferredArrays();
+
 protected:
   DataContainerArray();
 
 private:
   QMap<QString, IDataContainerBundle::Pointer> m_DataContainerBundles;
   MontageCollection m_MontageCollection;
+  size_t m_DeferredMemoryBudget = 0;
 
   /**
    * @brief setMontageTileFromDataContainerName
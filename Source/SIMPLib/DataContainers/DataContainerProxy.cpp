@@ -59,6 +59,8 @@ DataContainerProxy::DataContainerProxy(const DataContainerProxy& amp)
   m_Name = amp.m_Name;
   m_DCType = amp.m_DCType;
   m_AttributeMatrices = amp.m_AttributeMatrices;
+  m_ReadRegion = amp.m_ReadRegion;
+  m_DeferArrayReads = amp.m_DeferArrayReads;
 }
 
 // -----------------------------------------------------------------------------
@@ -71,7 +73,7 @@ DataContainerProxy& DataContainerProxy::operator=(const DataContainerProxy& amp)
 // -----------------------------------------------------------------------------
 bool DataContainerProxy::operator==(const DataContainerProxy& amp) const
 {
-  return m_Flag == amp.m_Flag && m_Name == amp.m_Name && m_DCType == amp.m_DCType && m_AttributeMatrices == amp.m_AttributeMatrices;
+  return m_Flag == amp.m_Flag && m_Name == amp.m_Name && m_DCType == amp.m_DCType && m_AttributeMatrices == amp.m_AttributeMatrices && m_ReadRegion == amp.m_ReadRegion;
 }
 
 // -----------------------------------------------------------------------------
@@ -105,6 +107,12 @@ void DataContainerProxy::writeJson(QJsonObject& json) const
   json["Name"] = m_Name;
   json["Type"] = static_cast<double>(m_DCType);
   json["Attribute Matricies"] = writeMap(m_AttributeMatrices);
+  if(!m_ReadRegion.isEmpty())
+  {
+    QJsonObject regionObj;
+    m_ReadRegion.writeJson(regionObj);
+    json["Read Region"] = regionObj;
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -124,6 +132,11 @@ bool DataContainerProxy::readJson(QJsonObject& json)
       m_DCType = static_cast<unsigned int>(json["Type"].toDouble());
     }
     m_AttributeMatrices = readMap(json["Attribute Matricies"].toArray());
+    m_ReadRegion = H5HyperslabRegion();
+    if(json["Read Region"].isObject())
+    {
+      m_ReadRegion.readJson(json["Read Region"].toObject());
+    }
     return true;
   }
   return false;
@@ -301,6 +314,38 @@ uint32_t DataContainerProxy::getDCType() const
   return m_DCType;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerProxy::setReadRegion(const H5HyperslabRegion& region)
+{
+  m_ReadRegion = region;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const H5HyperslabRegion& DataContainerProxy::getReadRegion() const
+{
+  return m_ReadRegion;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerProxy::setDeferArrayReads(bool defer)
+{
+  m_DeferArrayReads = defer;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataContainerProxy::getDeferArrayReads() const
+{
+  return m_DeferArrayReads;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
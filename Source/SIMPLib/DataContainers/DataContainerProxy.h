@@ -43,6 +43,7 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataContainers/AttributeMatrixProxy.h"
 #include "SIMPLib/Geometry/IGeometry.h"
+#include "SIMPLib/HDF5/H5HyperslabRegion.h"
 
 /**
  * @brief The DataContainerProxy class
@@ -196,6 +197,34 @@ public:
    */
   uint32_t getDCType() const;
 
+  /**
+   * @brief Sets the sub-volume of an Image geometry to read. Cell attribute matrices whose tuple
+   * dimensions match the geometry are read as hyperslabs and the geometry is cropped to the region.
+   * An empty region reads the whole data container.
+   * @param region
+   */
+  void setReadRegion(const H5HyperslabRegion& region);
+
+  /**
+   * @brief getReadRegion
+   * @return
+   */
+  const H5HyperslabRegion& getReadRegion() const;
+
+  /**
+   * @brief Sets whether the DataArrays of this data container are registered with their meta data only
+   * and read from the file on first access. This is a run time option of the reader and is not saved
+   * with the proxy.
+   * @param defer
+   */
+  void setDeferArrayReads(bool defer);
+
+  /**
+   * @brief getDeferArrayReads
+   * @return
+   */
+  bool getDeferArrayReads() const;
+
   /**
    * @brief Toggle the data container flag (Python Binding)
    */
@@ -229,6 +258,8 @@ private:
   QString m_Name;
   uint32_t m_DCType = static_cast<uint32_t>(IGeometry::Type::Any);
   StorageType m_AttributeMatrices;
+  H5HyperslabRegion m_ReadRegion;
+  bool m_DeferArrayReads = false;
 
   /**
    * @brief writeMap
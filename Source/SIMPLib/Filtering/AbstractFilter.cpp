@@ -36,11 +36,15 @@
 #include "AbstractFilter.h"
 
 #include <QtCore/QDebug>
+#include <QtCore/QMetaProperty>
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
+#include "SIMPLib/Filtering/ComparisonInputs.h"
+#include "SIMPLib/Filtering/ComparisonInputsAdvanced.h"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Messages/FilterErrorMessage.h"
 #include "SIMPLib/Messages/FilterProgressMessage.h"
@@ -313,6 +317,64 @@ std::list<DataArrayPath> AbstractFilter::getDeletedPaths()
   return std::list<DataArrayPath>();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::list<DataArrayPath> AbstractFilter::getConsumedPaths()
+{
+  std::list<DataArrayPath> consumedPaths;
+  // Look up the ids first so the types are registered before the property types are resolved by name
+  const int pathType = qMetaTypeId<DataArrayPath>();
+  const int pathVecType = qMetaTypeId<DataArrayPathVec>();
+  const int comparisonType = qMetaTypeId<ComparisonInputs>();
+  const int proxyType = qMetaTypeId<DataContainerArrayProxy>();
+  const int comparisonAdvancedType = qMetaTypeId<ComparisonInputsAdvanced>();
+
+  const QMetaObject* metaObject = this->metaObject();
+  for(int i = QObject::staticMetaObject.propertyCount(); i < metaObject->propertyCount(); i++)
+  {
+    QMetaProperty property = metaObject->property(i);
+    if(!property.isReadable())
+    {
+      continue;
+    }
+    const int userType = property.userType();
+    if(userType == pathType)
+    {
+      DataArrayPath path = property.read(this).value<DataArrayPath>();
+      if(!path.getDataContainerName().isEmpty())
+      {
+        consumedPaths.push_back(path);
+      }
+    }
+    else if(userType == pathVecType)
+    {
+      DataArrayPathVec paths = property.read(this).value<DataArrayPathVec>();
+      for(const DataArrayPath& path : paths)
+      {
+        if(!path.getDataContainerName().isEmpty())
+        {
+          consumedPaths.push_back(path);
+        }
+      }
+    }
+    else if(userType == comparisonType)
+    {
+      ComparisonInputs inputs = property.read(this).value<ComparisonInputs>();
+      for(const ComparisonInput_t& input : inputs.getInputs())
+      {
+        consumedPaths.emplace_back(input.dataContainerName, input.attributeMatrixName, input.attributeArrayName);
+      }
+    }
+    else if(userType == proxyType || userType == comparisonAdvancedType)
+    {
+      // The contents of these types are not simple paths so assume the filter may read anything
+      consumedPaths.emplace_back(DataArrayPath());
+    }
+  }
+  return consumedPaths;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -433,6 +495,19 @@ void AbstractFilter::copyFilterParameterInstanceVariables(AbstractFilter* filter
   filter->readFilterParameters(filterJson);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AbstractFilter::copyPreflightState(AbstractFilter* filter) const
+{
+  filter->m_ErrorCode = m_ErrorCode;
+  filter->m_WarningCode = m_WarningCode;
+  filter->m_CreatedPaths = m_CreatedPaths;
+  filter->m_RenamedPaths = m_RenamedPaths;
+  filter->setDataContainerArray(getDataContainerArray());
+  filter->setProperty("HasRenameValues", property("HasRenameValues"));
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -449,6 +524,14 @@ QString AbstractFilter::getSubGroupName() const
   return "YOUR CLASS SHOULD IMPLEMENT THIS";
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool AbstractFilter::hasSideEffects() const
+{
+  return getSubGroupName() == SIMPL::FilterSubGroups::OutputFilters;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -96,8 +96,8 @@ class SIMPLib_EXPORT AbstractFilter : public Observable
   PYB11_PROPERTY(bool InPreflight READ getInPreflight WRITE setInPreflight)
   PYB11_PROPERTY(int PipelineIndex READ getPipelineIndex WRITE setPipelineIndex)
   PYB11_METHOD(void generateHtmlSummary)
-  PYB11_METHOD(void execute)
-  PYB11_METHOD(void preflight)
+  PYB11_METHOD(void execute CALL_GUARD py::gil_scoped_release)
+  PYB11_METHOD(void preflight CALL_GUARD py::gil_scoped_release)
   PYB11_METHOD(void setDataContainerArray)
   PYB11_METHOD(void setErrorCondition ARGS code messageText)
   PYB11_METHOD(void setWarningCondition ARGS code messageText)
@@ -153,6 +153,14 @@ public:
    */
   virtual QString getSubGroupName() const;
 
+  /**
+   * @brief hasSideEffects Returns true if executing the filter does more than change the DataContainerArray,
+   * for example writing files or running other processes. The results of such a filter and of every filter
+   * after it are never restored from a result cache. The default is true for the output filters.
+   * @return
+   */
+  virtual bool hasSideEffects() const;
+
   /**
    * @brief getUuid Return the unique identifier for this filter.
    * @return A QUuid object.
@@ -417,6 +425,16 @@ public:
    */
   virtual std::list<DataArrayPath> getDeletedPaths();
 
+  /**
+   * @brief Returns the DataArrayPaths this filter reads during execute(). The default implementation
+   * collects every DataArrayPath held by the filter's properties. A path that stops at the DataContainer or
+   * AttributeMatrix level covers everything below it and an empty path covers the entire DataContainerArray.
+   * Properties whose contents cannot be inspected (e.g., a DataContainerArrayProxy) are reported as an empty path.
+   * Filters that read data they do not reference through properties must override this.
+   * @return
+   */
+  virtual std::list<DataArrayPath> getConsumedPaths();
+
   /**
    * @brief Returns a list of DataArrayPaths that have been renamed along with their corresponding renamed value
    * @return
@@ -477,6 +495,16 @@ public:
    */
   virtual void copyFilterParameterInstanceVariables(AbstractFilter* filter) const;
 
+  /**
+   * @brief Copies the state produced by preflight (the error and warning codes, the
+   * created and renamed paths and the DataContainerArray) to the given filter. This
+   * allows a copy of the filter to be preflighted on another thread. Subclasses that
+   * cache state outside of their filter parameters between preflights should override
+   * this and copy that state as well.
+   * @param filter
+   */
+  virtual void copyPreflightState(AbstractFilter* filter) const;
+
   /**
    * @brief Clears the renamed paths for the filter instance.
    */
@@ -101,6 +101,8 @@ void FilterManager::RegisterKnownFilters(FilterManager* /* fm */)
 // -----------------------------------------------------------------------------
 FilterManager::Collection FilterManager::getFactories() const
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+  loadDeferredPlugins();
   return m_Factories;
 }
 
@@ -109,6 +111,8 @@ FilterManager::Collection FilterManager::getFactories() const
 // -----------------------------------------------------------------------------
 void FilterManager::printFactoryNames() const
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+  loadDeferredPlugins();
   QList<QString> keys = m_Factories.keys();
   for(const auto& key : keys)
   {
@@ -121,6 +125,8 @@ void FilterManager::printFactoryNames() const
 // -----------------------------------------------------------------------------
 FilterManager::Collection FilterManager::getFactories(const QString& groupName)
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+  loadDeferredPlugins();
   FilterManager::Collection groupFactories;
 
   for(FilterManager::Collection::iterator factory = m_Factories.begin(); factory != m_Factories.end(); ++factory)
@@ -139,6 +145,8 @@ FilterManager::Collection FilterManager::getFactories(const QString& groupName)
 // -----------------------------------------------------------------------------
 FilterManager::Collection FilterManager::getFactories(const QString& groupName, const QString& subGroupName)
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+  loadDeferredPlugins();
   FilterManager::Collection groupFactories;
   for(FilterManager::Collection::iterator factoryIter = m_Factories.begin(); factoryIter != m_Factories.end(); ++factoryIter)
   {
@@ -154,7 +162,7 @@ FilterManager::Collection FilterManager::getFactories(const QString& groupName,
 // -----------------------------------------------------------------------------
 bool FilterManager::contains(const QUuid& uuid) const
 {
-  return m_UuidFactories.contains(uuid);
+  return getFactoryFromUuid(uuid).get() != nullptr;
 }
 
 // -----------------------------------------------------------------------------
@@ -162,6 +170,7 @@ bool FilterManager::contains(const QUuid& uuid) const
 // -----------------------------------------------------------------------------
 void FilterManager::addFilterFactory(const QString& name, IFilterFactory::Pointer factory)
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   // std::cout << this << " - Registering Filter: " << name.toStdString() << std::endl;
   QUuid uuid = factory->getUuid();
 
@@ -193,6 +202,8 @@ void FilterManager::addFilterFactory(const QString& name, IFilterFactory::Pointe
 
   m_Factories[name] = factory;
   m_UuidFactories[uuid] = factory;
+  m_DeferredClassNames.remove(name);
+  m_DeferredUuids.remove(uuid);
 }
 
 // -----------------------------------------------------------------------------
@@ -243,10 +254,25 @@ QSet<QString> FilterManager::getSubGroupNames(const QString& groupName)
 // -----------------------------------------------------------------------------
 IFilterFactory::Pointer FilterManager::getFactoryFromClassName(const QString& filterName) const
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   if(m_Factories.contains(filterName))
   {
     return m_Factories[filterName];
   }
+  if(m_DeferredClassNames.contains(filterName))
+  {
+    QString pluginPath = m_DeferredClassNames.value(filterName);
+    loadDeferredPlugin(pluginPath);
+    if(!m_Factories.contains(filterName))
+    {
+      // The plugin did not provide the filter it was recorded with so fall back to loading everything
+      loadDeferredPlugins();
+    }
+    if(m_Factories.contains(filterName))
+    {
+      return m_Factories[filterName];
+    }
+  }
   return IFilterFactory::NullPointer();
 }
 
@@ -255,10 +281,25 @@ IFilterFactory::Pointer FilterManager::getFactoryFromClassName(const QString& fi
 // -----------------------------------------------------------------------------
 IFilterFactory::Pointer FilterManager::getFactoryFromUuid(const QUuid& uuid) const
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   if(m_UuidFactories.contains(uuid))
   {
     return m_UuidFactories[uuid];
   }
+  if(m_DeferredUuids.contains(uuid))
+  {
+    QString pluginPath = m_DeferredUuids.value(uuid);
+    loadDeferredPlugin(pluginPath);
+    if(!m_UuidFactories.contains(uuid))
+    {
+      // The plugin did not provide the filter it was recorded with so fall back to loading everything
+      loadDeferredPlugins();
+    }
+    if(m_UuidFactories.contains(uuid))
+    {
+      return m_UuidFactories[uuid];
+    }
+  }
   return IFilterFactory::NullPointer();
 }
 
@@ -267,6 +308,8 @@ IFilterFactory::Pointer FilterManager::getFactoryFromUuid(const QUuid& uuid) con
 // -----------------------------------------------------------------------------
 IFilterFactory::Pointer FilterManager::getFactoryFromHumanName(const QString& humanName)
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+  loadDeferredPlugins();
   IFilterFactory::Pointer Factory;
 
   for(FilterManager::Collection::iterator factory = m_Factories.begin(); factory != m_Factories.end(); ++factory)
@@ -307,6 +350,99 @@ QJsonArray FilterManager::toJsonArray() const
   return filterArray;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterManager::addDeferredFilter(const QString& className, const QUuid& uuid, const QString& pluginPath)
+{
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+  if(className.isEmpty() || uuid.isNull() || m_Factories.contains(className) || m_UuidFactories.contains(uuid))
+  {
+    return;
+  }
+  m_DeferredClassNames[className] = pluginPath;
+  m_DeferredUuids[uuid] = pluginPath;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterManager::setDeferredPluginLoader(const DeferredPluginLoader& loader)
+{
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+  m_DeferredPluginLoader = loader;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterManager::hasDeferredPlugins() const
+{
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+  return !m_DeferredUuids.isEmpty() || !m_DeferredClassNames.isEmpty();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterManager::loadDeferredPlugins() const
+{
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+  // Each call removes every entry that belongs to the loaded plugin so this always terminates
+  while(!m_DeferredUuids.isEmpty())
+  {
+    QString pluginPath = m_DeferredUuids.first();
+    loadDeferredPlugin(pluginPath);
+  }
+  while(!m_DeferredClassNames.isEmpty())
+  {
+    QString pluginPath = m_DeferredClassNames.first();
+    loadDeferredPlugin(pluginPath);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterManager::loadDeferredPlugin(const QString& pluginPath) const
+{
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+  for(auto iter = m_DeferredClassNames.begin(); iter != m_DeferredClassNames.end();)
+  {
+    if(iter.value() == pluginPath)
+    {
+      iter = m_DeferredClassNames.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+  for(auto iter = m_DeferredUuids.begin(); iter != m_DeferredUuids.end();)
+  {
+    if(iter.value() == pluginPath)
+    {
+      iter = m_DeferredUuids.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+
+  if(!m_DeferredPluginLoader)
+  {
+    return false;
+  }
+  bool didLoad = m_DeferredPluginLoader(pluginPath);
+  if(!didLoad)
+  {
+    // The recorded plugin list is out of date so load whatever else was recorded
+    loadDeferredPlugins();
+  }
+  return didLoad;
+}
+
 // -----------------------------------------------------------------------------
 QString FilterManager::getNameOfClass() const
 {
@@ -322,7 +458,8 @@ QString FilterManager::ClassName()
 // -----------------------------------------------------------------------------
 bool FilterManager::removeFilterFactory(const QUuid& uuid)
 {
-  if(!m_UuidFactories.contains(uuid))
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+  if(!contains(uuid))
   {
     return false;
   }
@@ -342,12 +479,14 @@ bool FilterManager::removeFilterFactory(const QUuid& uuid)
 // -----------------------------------------------------------------------------
 QSet<QUuid> FilterManager::pythonFilterUuids() const
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   return m_PythonUuids;
 }
 
 // -----------------------------------------------------------------------------
 void FilterManager::addPythonFilterFactory(const QString& name, IFilterFactory::Pointer factory)
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   addFilterFactory(name, factory);
   m_PythonUuids.insert(factory->getUuid());
 }
@@ -355,6 +494,7 @@ void FilterManager::addPythonFilterFactory(const QString& name, IFilterFactory::
 // -----------------------------------------------------------------------------
 void FilterManager::clearPythonFilterFactories()
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   QSet<QUuid> pythonUuids = m_PythonUuids;
   for(const QUuid& uuid : pythonUuids)
   {
@@ -365,6 +505,7 @@ void FilterManager::clearPythonFilterFactories()
 // -----------------------------------------------------------------------------
 bool FilterManager::isPythonFilter(const QUuid& uuid) const
 {
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
   return m_PythonUuids.contains(uuid);
 }
 #endif
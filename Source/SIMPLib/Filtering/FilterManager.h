@@ -35,6 +35,9 @@
 
 #pragma once
 
+#include <functional>
+#include <mutex>
+
 #include <QtCore/QJsonArray>
 #include <QtCore/QMap>
 #include <QtCore/QMapIterator>
@@ -73,6 +76,12 @@ public:
   typedef QMap<QUuid, IFilterFactory::Pointer> UuidCollection;
   typedef QMapIterator<QUuid, IFilterFactory::Pointer> UuidCollectionIterator;
 
+  /**
+   * @brief Loads the plugin at the given path and registers its filters with this
+   * FilterManager. Returns false if the plugin could not be loaded.
+   */
+  using DeferredPluginLoader = std::function<bool(const QString& pluginPath)>;
+
   /**
    * @brief Static instance to retrieve the global instance of this class
    * @return
@@ -181,6 +190,34 @@ public:
    */
   QJsonArray toJsonArray() const;
 
+  /**
+   * @brief Records that the filter with the given class name and uuid is provided
+   * by the plugin at pluginPath without loading that plugin. The plugin is loaded
+   * through the DeferredPluginLoader the first time one of its filters is looked
+   * up, or when the full list of factories is requested.
+   * @param className
+   * @param uuid
+   * @param pluginPath
+   */
+  void addDeferredFilter(const QString& className, const QUuid& uuid, const QString& pluginPath);
+
+  /**
+   * @brief Sets the function that is used to load deferred plugins
+   * @param loader
+   */
+  void setDeferredPluginLoader(const DeferredPluginLoader& loader);
+
+  /**
+   * @brief Returns true if there are plugins that have been recorded but not yet loaded
+   * @return
+   */
+  bool hasDeferredPlugins() const;
+
+  /**
+   * @brief Loads every plugin that is still deferred.
+   */
+  void loadDeferredPlugins() const;
+
 #ifdef SIMPL_EMBED_PYTHON
   /**
    * @brief Adds a factory that creates Python filters
@@ -211,10 +248,30 @@ public:
 protected:
   FilterManager();
 
+  /**
+   * @brief Loads a single deferred plugin. If the plugin can not be loaded the
+   * remaining deferred plugins are all loaded so that the set of registered filters
+   * matches a full scan.
+   * @param pluginPath
+   * @return
+   */
+  bool loadDeferredPlugin(const QString& pluginPath) const;
+
 private:
   Collection m_Factories;
   UuidCollection m_UuidFactories;
 
+  // The deferred plugin state is mutable so that the const lookup methods can load
+  // plugins on demand. The loader registers through a non-const FilterManager pointer.
+  mutable QMap<QString, QString> m_DeferredClassNames;
+  mutable QMap<QUuid, QString> m_DeferredUuids;
+  DeferredPluginLoader m_DeferredPluginLoader;
+
+  // Guards the factory maps and the deferred plugin state. Lookups can come from several
+  // threads at once (the REST server handles each connection on its own thread) and a lookup
+  // may load a plugin, which registers its factories on the same thread, so the lock is recursive.
+  mutable std::recursive_mutex m_Mutex;
+
 #ifdef SIMPL_EMBED_PYTHON
   QSet<QUuid> m_PythonUuids;
 #endif
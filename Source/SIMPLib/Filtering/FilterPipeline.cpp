@@ -35,6 +35,13 @@
 
 #include "FilterPipeline.h"
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
@@ -45,6 +52,9 @@
 #include "SIMPLib/Filtering/BadFilter.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/PipelineDependencyGraph.h"
+#include "SIMPLib/Filtering/PipelineMemoryPlanner.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/Messages/AbstractMessageHandler.h"
 #include "SIMPLib/Messages/FilterErrorMessage.h"
 #include "SIMPLib/Messages/FilterProgressMessage.h"
@@ -56,8 +66,60 @@
 #include "SIMPLib/Messages/PipelineWarningMessage.h"
 #include "SIMPLib/Utilities/StringOperations.h"
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
+#endif
+
 #define RENAME_ENABLED 1
 
+namespace
+{
+/**
+ * @brief Returns true if the path covers the array path. Empty DataContainer, AttributeMatrix or
+ * DataArray names act as wildcards for everything below that level.
+ * @param path
+ * @param arrayPath
+ * @return
+ */
+bool PathCoversArray(const DataArrayPath& path, const DataArrayPath& arrayPath)
+{
+  if(path.getDataContainerName().isEmpty())
+  {
+    return true;
+  }
+  if(path.getDataContainerName() != arrayPath.getDataContainerName())
+  {
+    return false;
+  }
+  if(path.getAttributeMatrixName().isEmpty())
+  {
+    return true;
+  }
+  if(path.getAttributeMatrixName() != arrayPath.getAttributeMatrixName())
+  {
+    return false;
+  }
+  return path.getDataArrayName().isEmpty() || path.getDataArrayName() == arrayPath.getDataArrayName();
+}
+
+/**
+ * @brief Returns a lock on the HDF5 library mutex that is held only if the filter is an IO filter, so IO
+ * filters never call into HDF5 while a deferred array is read or another pipeline preflights on another thread.
+ * @param filter
+ * @return
+ */
+std::unique_lock<std::recursive_mutex> LockHDF5ForIOFilter(const AbstractFilter* filter)
+{
+  std::unique_lock<std::recursive_mutex> lock(H5DataArrayReader::LibraryMutex(), std::defer_lock);
+  if(filter->getGroupName() == SIMPL::FilterGroups::IOFilters)
+  {
+    lock.lock();
+  }
+  return lock;
+}
+} // namespace
+
 /**
  * @brief This message handler is used by FilterPipeline to re-emit filter progress messages as pipeline progress messages
  */
@@ -357,12 +419,28 @@ void FilterPipeline::cancel()
   }
 
   m_State = FilterPipeline::State::Canceling;
+  if(m_ExecutingConcurrently)
+  {
+    // Several filters may be running so all of them are asked to stop
+    for(const auto& filter : m_Pipeline)
+    {
+      filter->setCancel(true);
+    }
+  }
   if(nullptr != m_CurrentFilter.get())
   {
     m_CurrentFilter->setCancel(true);
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::cancelPreflight()
+{
+  m_PreflightCanceled = true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -578,6 +656,8 @@ FilterPipeline::FilterContainerType& FilterPipeline::getFilterContainer()
 // -----------------------------------------------------------------------------
 void FilterPipeline::updatePrevNextFilters()
 {
+  // Preflight results no longer describe the edited pipeline
+  m_Preflighted = false;
   FilterContainerType::iterator prev;
   FilterContainerType::iterator next;
 
@@ -763,6 +843,14 @@ int FilterPipeline::preflightPipeline()
   // Start looping through each filter in the Pipeline and preflight everything
   for(const auto& filter : m_Pipeline)
   {
+    if(m_PreflightCanceled)
+    {
+      QString ss = QObject::tr("Preflight of pipeline '%1' was canceled.").arg(getName());
+      preflightError = -204;
+      setErrorCondition(preflightError, ss);
+      break;
+    }
+
     // Do not preflight disabled filters
     if(filter->getEnabled())
     {
@@ -783,7 +871,10 @@ int FilterPipeline::preflightPipeline()
       setCurrentFilter(filter);
       connectFilterNotifications(filter.get());
       filter->clearRenamedPaths();
-      filter->preflight();
+      {
+        std::unique_lock<std::recursive_mutex> h5Lock = LockHDF5ForIOFilter(filter.get());
+        filter->preflight();
+      }
       disconnectFilterNotifications(filter.get());
 
       filter->setCancel(false); // Reset the cancel flag
@@ -846,6 +937,8 @@ int FilterPipeline::preflightPipeline()
 #endif
   }
   setCurrentFilter(AbstractFilter::NullPointer());
+  m_PreflightCanceled = false;
+  m_Preflighted = (preflightError >= 0);
 
   return preflightError;
 }
@@ -888,58 +981,150 @@ DataContainerArray::Pointer FilterPipeline::execute(DataContainerArray::Pointer
   QTextStream out(&msg);
   out << "Pipline Start: " << now.toString(Qt::ISODate);
   notifyStatusMessage(msg);
-  // Start looping through the Pipeline
-  for(const auto& filt : m_Pipeline)
+  if(nullptr != m_Profiler.get())
   {
-    int filtIndex = filt->getPipelineIndex();
-    QString ss = QObject::tr("[%1/%2] %3").arg(filtIndex + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel());
-    notifyStatusMessage(ss);
-
-    Q_EMIT filt->filterInProgress(filt.get());
+    m_Profiler->beginPipeline(getName());
+  }
 
-    // Do not execute disabled filters
-    if(filt->getEnabled())
+  // The filters' preflight results are replaced while executing so they are only used once
+  bool concurrent = m_ConcurrentExecution && m_Preflighted && nullptr == m_Profiler.get() && !m_ReleaseDeadArrays && nullptr == m_ResultCache.get();
+  m_Preflighted = false;
+#ifndef SIMPL_USE_PARALLEL_ALGORITHMS
+  concurrent = false;
+#endif
+  if(concurrent)
+  {
+    m_ExecutingConcurrently = true;
+    err = executeConcurrently();
+    m_ExecutingConcurrently = false;
+    if(err < 0)
     {
-      //      filt->setMessagePrefix(ss);
-      connectFilterNotifications(filt.get());
-      filt->setDataContainerArray(m_Dca);
-      setCurrentFilter(filt);
-      filt->execute();
-      disconnectFilterNotifications(filt.get());
-      filt->setDataContainerArray(DataContainerArray::NullPointer());
-      err = filt->getErrorCode();
-      if(err < 0)
+      Q_EMIT pipelineFinished();
+      disconnectSignalsSlots();
+      m_State = FilterPipeline::State::Idle;
+      m_ExecutionResult = FilterPipeline::ExecutionResult::Failed;
+      return m_Dca;
+    }
+  }
+  else
+  {
+    // Gather the paths each enabled filter reads so arrays can be released after their last consumer runs
+    std::vector<std::list<DataArrayPath>> consumedPaths;
+    if(m_ReleaseDeadArrays)
+    {
+      for(const auto& filt : m_Pipeline)
       {
-        ss = QObject::tr("[%1/%2] %3 caused an error during execution.").arg(filtIndex + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel());
-        setErrorCondition(err, ss);
-
-        notifyProgressMessage(100, "");
-
-        Q_EMIT filt->filterCompleted(filt.get());
-        Q_EMIT pipelineFinished();
-        disconnectSignalsSlots();
-        m_State = FilterPipeline::State::Idle;
-        m_ExecutionResult = FilterPipeline::ExecutionResult::Failed;
-        return m_Dca;
+        consumedPaths.push_back(filt->getEnabled() ? filt->getConsumedPaths() : std::list<DataArrayPath>());
       }
     }
+    size_t pipelinePosition = 0;
 
-    if(m_State == FilterPipeline::State::Canceling)
+    // Filters whose results are restored from the cache are reported but not executed
+    std::vector<QByteArray> cacheKeys;
+    size_t firstExecutedPosition = 0;
+    if(nullptr != m_ResultCache.get() && nullptr != m_Dca.get() && m_Dca->getNumDataContainers() == 0)
     {
-      // Clear cancel filter state
-      filt->setCancel(false);
-      break;
+      cacheKeys = computeResultCacheKeys();
+      firstExecutedPosition = restoreCachedResults(cacheKeys);
     }
 
-    // Emit that the filter is completed for those objects that care, even the disabled ones.
-    Q_EMIT filt->filterCompleted(filt.get());
+    // Start looping through the Pipeline
+    for(const auto& filt : m_Pipeline)
+    {
+      int filtIndex = filt->getPipelineIndex();
+      QString ss = QObject::tr("[%1/%2] %3").arg(filtIndex + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel());
+      notifyStatusMessage(ss);
+
+      Q_EMIT filt->filterInProgress(filt.get());
+
+      // Do not execute disabled filters
+      if(filt->getEnabled() && pipelinePosition >= firstExecutedPosition)
+      {
+        //      filt->setMessagePrefix(ss);
+        connectFilterNotifications(filt.get());
+        filt->setDataContainerArray(m_Dca);
+        setCurrentFilter(filt);
+        if(nullptr != m_Profiler.get())
+        {
+          m_Profiler->beginFilter(filt.get(), m_Dca.get());
+        }
+        const auto executeStart = std::chrono::steady_clock::now();
+        {
+          std::unique_lock<std::recursive_mutex> h5Lock = LockHDF5ForIOFilter(filt.get());
+          filt->execute();
+        }
+        const auto executeTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - executeStart).count();
+        if(nullptr != m_Profiler.get())
+        {
+          m_Profiler->endFilter(filt.get(), m_Dca.get());
+        }
+        disconnectFilterNotifications(filt.get());
+        filt->setDataContainerArray(DataContainerArray::NullPointer());
+        err = filt->getErrorCode();
+        if(err < 0)
+        {
+          ss = QObject::tr("[%1/%2] %3 caused an error during execution.").arg(filtIndex + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel());
+          setErrorCondition(err, ss);
+
+          notifyProgressMessage(100, "");
+
+          Q_EMIT filt->filterCompleted(filt.get());
+          Q_EMIT pipelineFinished();
+          disconnectSignalsSlots();
+          m_State = FilterPipeline::State::Idle;
+          m_ExecutionResult = FilterPipeline::ExecutionResult::Failed;
+          if(nullptr != m_Profiler.get())
+          {
+            m_Profiler->endPipeline();
+          }
+          return m_Dca;
+        }
+
+        // Arrays released as dead are needed by other pipelines sharing this prefix so nothing is stored then
+        if(pipelinePosition < cacheKeys.size() && !cacheKeys[pipelinePosition].isEmpty() && !m_ReleaseDeadArrays && executeTime >= m_ResultCache->getMinimumExecutionTime())
+        {
+          m_ResultCache->store(cacheKeys[pipelinePosition], m_Dca);
+        }
+
+        if(m_ReleaseDeadArrays && nullptr != m_Dca.get())
+        {
+          std::list<DataArrayPath> livePaths;
+          for(size_t i = pipelinePosition + 1; i < consumedPaths.size(); i++)
+          {
+            livePaths.insert(livePaths.end(), consumedPaths[i].begin(), consumedPaths[i].end());
+          }
+          releaseDeadArrays(livePaths);
+        }
+
+        // No filter is running so arrays that were read on first access can safely be released
+        if(nullptr != m_Dca.get())
+        {
+          m_Dca->releaseDeferredArrays();
+        }
+      }
+      pipelinePosition++;
+
+      if(m_State == FilterPipeline::State::Canceling)
+      {
+        // Clear cancel filter state
+        filt->setCancel(false);
+        break;
+      }
 
-    notifyProgressMessage(static_cast<int>(static_cast<float>(filtIndex + 1) / (m_Pipeline.size()) * 100.0f), "");
+      // Emit that the filter is completed for those objects that care, even the disabled ones.
+      Q_EMIT filt->filterCompleted(filt.get());
+
+      notifyProgressMessage(static_cast<int>(static_cast<float>(filtIndex + 1) / (m_Pipeline.size()) * 100.0f), "");
+    }
   }
   now = QDateTime::currentDateTime();
   msg.clear();
   out << "Pipline End: " << now.toString(Qt::ISODate);
   notifyStatusMessage(msg);
+  if(nullptr != m_Profiler.get())
+  {
+    m_Profiler->endPipeline();
+  }
 
   disconnectSignalsSlots();
 
@@ -1032,6 +1217,440 @@ DataContainerArray::Pointer FilterPipeline::getDataContainerArray()
   return m_Dca;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::setProfiler(const PipelineProfiler::Pointer& profiler)
+{
+  m_Profiler = profiler;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfiler::Pointer FilterPipeline::getProfiler() const
+{
+  return m_Profiler;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::setReleaseDeadArrays(bool value)
+{
+  m_ReleaseDeadArrays = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterPipeline::getReleaseDeadArrays() const
+{
+  return m_ReleaseDeadArrays;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::setPinnedPaths(const std::vector<DataArrayPath>& paths)
+{
+  m_PinnedPaths = paths;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<DataArrayPath> FilterPipeline::getPinnedPaths() const
+{
+  return m_PinnedPaths;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::releaseDeadArrays(const std::list<DataArrayPath>& livePaths)
+{
+  for(const auto& dc : m_Dca->getDataContainers())
+  {
+    for(const auto& am : dc->getAttributeMatrices())
+    {
+      for(const QString& arrayName : am->getAttributeArrayNames())
+      {
+        DataArrayPath arrayPath(dc->getName(), am->getName(), arrayName);
+        auto covers = [&arrayPath](const DataArrayPath& path) { return PathCoversArray(path, arrayPath); };
+        if(std::any_of(m_PinnedPaths.begin(), m_PinnedPaths.end(), covers) || std::any_of(livePaths.begin(), livePaths.end(), covers))
+        {
+          continue;
+        }
+        am->removeAttributeArray(arrayName);
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::setConcurrentExecution(bool value)
+{
+  m_ConcurrentExecution = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterPipeline::getConcurrentExecution() const
+{
+  return m_ConcurrentExecution;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::setMaxThreads(int threads)
+{
+  m_MaxThreads = threads;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int FilterPipeline::getMaxThreads() const
+{
+  return m_MaxThreads;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::setMemoryBudget(int64_t bytes)
+{
+  m_MemoryBudget = bytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t FilterPipeline::getMemoryBudget() const
+{
+  return m_MemoryBudget;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::setResultCache(const PipelineResultCache::Pointer& cache)
+{
+  m_ResultCache = cache;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineResultCache::Pointer FilterPipeline::getResultCache() const
+{
+  return m_ResultCache;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<QByteArray> FilterPipeline::computeResultCacheKeys() const
+{
+  std::vector<QByteArray> cacheKeys(static_cast<size_t>(m_Pipeline.size()));
+  QByteArray previousKey;
+  for(int i = 0; i < m_Pipeline.size(); i++)
+  {
+    const AbstractFilter::Pointer& filt = m_Pipeline[i];
+    if(!filt->getEnabled())
+    {
+      continue;
+    }
+    // Restoring a writer or a process would skip writing its file or running the process
+    if(filt->hasSideEffects())
+    {
+      break;
+    }
+    previousKey = PipelineResultCache::ComputeKey(previousKey, filt.get());
+    cacheKeys[static_cast<size_t>(i)] = previousKey;
+  }
+  return cacheKeys;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t FilterPipeline::restoreCachedResults(const std::vector<QByteArray>& cacheKeys)
+{
+  for(size_t i = cacheKeys.size(); i > 0; i--)
+  {
+    const QByteArray& key = cacheKeys[i - 1];
+    if(key.isEmpty() || !m_ResultCache->contains(key))
+    {
+      continue;
+    }
+    DataContainerArray::Pointer cachedDca = m_ResultCache->restore(key);
+    if(nullptr == cachedDca.get())
+    {
+      continue;
+    }
+    for(const auto& dc : cachedDca->getDataContainers())
+    {
+      m_Dca->addOrReplaceDataContainer(dc);
+    }
+    notifyStatusMessage(QObject::tr("Restored the results of filters 1 to %1 from the result cache").arg(i));
+    return i;
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::removeCreatedPaths(const std::vector<DataArrayPath>& createdPaths)
+{
+  for(const DataArrayPath& path : createdPaths)
+  {
+    DataContainer::Pointer dc = m_Dca->getDataContainer(path.getDataContainerName());
+    if(nullptr == dc.get())
+    {
+      continue;
+    }
+    if(path.getAttributeMatrixName().isEmpty())
+    {
+      m_Dca->removeDataContainer(path.getDataContainerName());
+      continue;
+    }
+    AttributeMatrix::Pointer am = dc->getAttributeMatrix(path.getAttributeMatrixName());
+    if(nullptr == am.get())
+    {
+      continue;
+    }
+    if(path.getDataArrayName().isEmpty())
+    {
+      dc->removeAttributeMatrix(path.getAttributeMatrixName());
+    }
+    else
+    {
+      am->removeAttributeArray(path.getDataArrayName());
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int FilterPipeline::executeConcurrently()
+{
+  int err = 0;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  enum class FilterState
+  {
+    Waiting,
+    Running,
+    Finished
+  };
+
+  const size_t count = static_cast<size_t>(m_Pipeline.size());
+  const PipelineDependencyGraph graph(m_Pipeline);
+
+  // The estimate has to come from the preflight so it is taken before any filter replaces its DataContainerArray
+  PipelineMemoryPlanner::Pointer planner = PipelineMemoryPlanner::New();
+  const bool admitByMemory = m_MemoryBudget > 0 && planner->plan(m_Pipeline);
+  const std::vector<PipelineMemoryPlanner::FilterEstimate>& estimates = planner->getFilterEstimates();
+
+  const int hardwareThreads = static_cast<int>(std::thread::hardware_concurrency());
+  const int maxThreads = std::max(1, m_MaxThreads > 0 ? m_MaxThreads : hardwareThreads);
+  // No slot is reserved for this thread; it only schedules and reports while the arena runs the filters
+  tbb::task_arena arena(maxThreads, 0);
+  tbb::task_group group;
+
+  std::vector<FilterState> states(count, FilterState::Waiting);
+  std::vector<std::vector<AbstractMessage::Pointer>> messages(count);
+  std::vector<QMetaObject::Connection> connections(count);
+  std::deque<size_t> finished;
+  std::mutex mutex;
+  std::condition_variable finishedCondition;
+
+  size_t running = 0;
+  size_t nextReport = 0;
+  bool stop = false;
+
+  // Marks the filters that completed since the last call as finished
+  auto collectFinished = [&](bool wait) {
+    std::deque<size_t> completed;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      if(wait)
+      {
+        finishedCondition.wait(lock, [&finished] { return !finished.empty(); });
+      }
+      completed.swap(finished);
+    }
+    for(size_t index : completed)
+    {
+      disconnect(connections[index]);
+      m_Pipeline[static_cast<int>(index)]->setDataContainerArray(DataContainerArray::NullPointer());
+      states[index] = FilterState::Finished;
+      running--;
+    }
+  };
+
+  auto succeeded = [this, &states](size_t index) { return states[index] == FilterState::Finished && m_Pipeline[static_cast<int>(index)]->getErrorCode() >= 0; };
+
+  while(nextReport < count && !stop)
+  {
+    // Start every filter whose dependencies finished without an error, up to the thread budget
+    for(size_t i = nextReport; i < count && running < static_cast<size_t>(maxThreads) && m_State != FilterPipeline::State::Canceling; i++)
+    {
+      AbstractFilter::Pointer filt = m_Pipeline[static_cast<int>(i)];
+      if(states[i] != FilterState::Waiting || !filt->getEnabled())
+      {
+        continue;
+      }
+      const std::vector<size_t>& dependencies = graph.getDependencies(i);
+      if(!std::all_of(dependencies.begin(), dependencies.end(), succeeded))
+      {
+        continue;
+      }
+      // A filter that runs ahead of an earlier filter that may still fail has to be undoable, which only holds
+      // for filters that create objects without deleting or renaming any or writing files
+      bool ahead = false;
+      for(size_t j = nextReport; j < i && !ahead; j++)
+      {
+        ahead = m_Pipeline[static_cast<int>(j)]->getEnabled() && !succeeded(j);
+      }
+      if(ahead && !graph.isUndoable(i))
+      {
+        continue;
+      }
+      if(admitByMemory && running > 0)
+      {
+        // Everything up to the last reported filter is live; the filters started since then add what they create
+        int64_t committedBytes = nextReport > 0 ? estimates[nextReport - 1].liveBytes : 0;
+        for(size_t j = nextReport; j < count; j++)
+        {
+          if(states[j] != FilterState::Waiting)
+          {
+            committedBytes += estimates[j].createdBytes;
+          }
+        }
+        if(committedBytes + estimates[i].createdBytes > m_MemoryBudget)
+        {
+          break;
+        }
+      }
+
+      states[i] = FilterState::Running;
+      running++;
+      filt->setDataContainerArray(m_Dca);
+      // Hold the filter's messages until it is reported so they arrive in pipeline order
+      connections[i] = connect(filt.get(), &AbstractFilter::messageGenerated, [&messages, &mutex, i](const AbstractMessage::Pointer& msg) {
+        std::lock_guard<std::mutex> lock(mutex);
+        messages[i].push_back(msg);
+      });
+      arena.execute([&, filt, i] {
+        group.run([&, filt, i] {
+          {
+            std::unique_lock<std::recursive_mutex> h5Lock = LockHDF5ForIOFilter(filt.get());
+            filt->execute();
+          }
+          std::lock_guard<std::mutex> lock(mutex);
+          finished.push_back(i);
+          finishedCondition.notify_one();
+        });
+      });
+    }
+
+    // Report the finished filters in pipeline order exactly as a sequential execution does
+    while(nextReport < count)
+    {
+      AbstractFilter::Pointer filt = m_Pipeline[static_cast<int>(nextReport)];
+      if(filt->getEnabled() && states[nextReport] != FilterState::Finished)
+      {
+        break;
+      }
+
+      int filtIndex = filt->getPipelineIndex();
+      QString ss = QObject::tr("[%1/%2] %3").arg(filtIndex + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel());
+      notifyStatusMessage(ss);
+
+      Q_EMIT filt->filterInProgress(filt.get());
+
+      if(filt->getEnabled())
+      {
+        setCurrentFilter(filt);
+        connectFilterNotifications(filt.get());
+        for(const auto& msg : messages[nextReport])
+        {
+          Q_EMIT filt->messageGenerated(msg);
+        }
+        disconnectFilterNotifications(filt.get());
+        messages[nextReport].clear();
+
+        err = filt->getErrorCode();
+        if(err < 0)
+        {
+          ss = QObject::tr("[%1/%2] %3 caused an error during execution.").arg(filtIndex + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel());
+          setErrorCondition(err, ss);
+
+          notifyProgressMessage(100, "");
+
+          Q_EMIT filt->filterCompleted(filt.get());
+          stop = true;
+          break;
+        }
+
+        // Arrays read on first access can only be released while no filter is running
+        if(0 == running && nullptr != m_Dca.get())
+        {
+          m_Dca->releaseDeferredArrays();
+        }
+      }
+
+      if(m_State == FilterPipeline::State::Canceling)
+      {
+        stop = true;
+        break;
+      }
+
+      // Emit that the filter is completed for those objects that care, even the disabled ones.
+      Q_EMIT filt->filterCompleted(filt.get());
+
+      notifyProgressMessage(static_cast<int>(static_cast<float>(filtIndex + 1) / (m_Pipeline.size()) * 100.0f), "");
+      nextReport++;
+    }
+
+    if(stop || nextReport == count || 0 == running)
+    {
+      break;
+    }
+    collectFinished(true);
+  }
+
+  // Filters started ahead of a failing or canceled one still have to finish before the pipeline returns
+  arena.execute([&group] { group.wait(); });
+  collectFinished(false);
+  // A sequential execution stops at the failing or canceled filter, so nothing the filters after it created may remain
+  for(size_t i = count; i > nextReport + 1 && nullptr != m_Dca.get(); i--)
+  {
+    if(states[i - 1] == FilterState::Finished)
+    {
+      removeCreatedPaths(graph.getCreatedPaths(i - 1));
+    }
+  }
+  for(const auto& filt : m_Pipeline)
+  {
+    filt->setCancel(false);
+  }
+  if(nullptr != m_Dca.get())
+  {
+    m_Dca->releaseDeferredArrays();
+  }
+#endif
+  return err;
+}
+
 // -----------------------------------------------------------------------------
 FilterPipeline::Pointer FilterPipeline::NullPointer()
 {
@@ -35,7 +35,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <list>
 #include <memory>
+#include <vector>
 
 #include <QtCore/QJsonObject>
 #include <QtCore/QList>
@@ -46,6 +49,8 @@
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Observer.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/PipelineProfiler.h"
+#include "SIMPLib/Filtering/PipelineResultCache.h"
 
 class IObserver;
 class FilterPipelineMessageHandler;
@@ -75,8 +80,8 @@ class SIMPLib_EXPORT FilterPipeline : public Observable
   PYB11_PROPERTY(State State READ getState)
   PYB11_PROPERTY(ExecutionResult ExecutionResult READ getExecutionResult)
   PYB11_PROPERTY(QString Name READ getName WRITE setName)
-  PYB11_METHOD(DataContainerArrayShPtrType run)
-  PYB11_METHOD(void preflightPipeline)
+  PYB11_METHOD(DataContainerArrayShPtrType run CALL_GUARD py::gil_scoped_release)
+  PYB11_METHOD(void preflightPipeline CALL_GUARD py::gil_scoped_release)
   PYB11_METHOD(bool pushFront ARGS AbstractFilter)
   PYB11_METHOD(bool pushBack ARGS AbstractFilter)
   PYB11_METHOD(bool popFront)
@@ -217,6 +222,107 @@ public:
 
   virtual DataContainerArrayShPtrType getDataContainerArray();
 
+  /**
+   * @brief Sets the profiler that records per filter timings and memory use during execute().
+   * Profiling is off when no profiler is set, which is the default.
+   * @param profiler
+   */
+  void setProfiler(const PipelineProfiler::Pointer& profiler);
+
+  /**
+   * @brief Returns the profiler used during execute(), if any
+   * @return
+   */
+  PipelineProfiler::Pointer getProfiler() const;
+
+  /**
+   * @brief Sets whether execute() removes arrays from the DataContainerArray as soon as no later enabled filter
+   * consumes them (see AbstractFilter::getConsumedPaths()). Only arrays held by AttributeMatrices are released;
+   * DataContainers, AttributeMatrices and geometries are left in place. This is off by default because callers
+   * commonly inspect the DataContainerArray returned by execute().
+   * @param value
+   */
+  void setReleaseDeadArrays(bool value);
+
+  /**
+   * @brief Returns whether execute() releases arrays that no later filter consumes
+   * @return
+   */
+  bool getReleaseDeadArrays() const;
+
+  /**
+   * @brief Sets the paths that are never released by execute(), regardless of liveness. A path naming a
+   * DataContainer or AttributeMatrix pins everything below it.
+   * @param paths
+   */
+  void setPinnedPaths(const std::vector<DataArrayPath>& paths);
+
+  /**
+   * @brief Returns the paths that are never released by execute()
+   * @return
+   */
+  std::vector<DataArrayPath> getPinnedPaths() const;
+
+  /**
+   * @brief Sets whether execute() runs filters that do not depend on each other at the same time. The
+   * dependencies are computed by PipelineDependencyGraph from the preflight results, so the pipeline must be
+   * preflighted after its last change. Messages are reported in pipeline order and are the same as for a
+   * sequential run. Filters run one after the other when the pipeline was not preflighted, when parallel
+   * algorithms are not available, when a profiler is set or when dead arrays are released.
+   * @param value
+   */
+  void setConcurrentExecution(bool value);
+
+  /**
+   * @brief Returns whether execute() runs independent filters at the same time
+   * @return
+   */
+  bool getConcurrentExecution() const;
+
+  /**
+   * @brief Sets the number of threads shared by the filters during a concurrent execution. This also bounds
+   * the number of filters running at once. A value of 0 uses every hardware thread.
+   * @param threads
+   */
+  void setMaxThreads(int threads);
+
+  /**
+   * @brief Returns the number of threads used during a concurrent execution
+   * @return
+   */
+  int getMaxThreads() const;
+
+  /**
+   * @brief Sets the cache execute() restores the results of the longest cached prefix of the pipeline from
+   * and stores the results of slow filters in. The cache is only used when execute() starts from an empty
+   * DataContainerArray, and only for the filters before the first filter with side effects because restoring
+   * a writer would skip the file it writes (see AbstractFilter::hasSideEffects()). Nothing is stored while dead arrays are released. Filters run one after
+   * the other when a cache is set.
+   * @param cache
+   */
+  void setResultCache(const PipelineResultCache::Pointer& cache);
+
+  /**
+   * @brief Returns the cache used during execute(), if any
+   * @return
+   */
+  PipelineResultCache::Pointer getResultCache() const;
+
+  /**
+   * @brief Sets the number of bytes the filters of a concurrent execution may hold at once according to the
+   * PipelineMemoryPlanner estimate of the preflight. A filter waits to start while the estimate of what the
+   * running filters create plus what it creates would exceed the budget, unless nothing else is running.
+   * A value of 0 disables the check.
+   * @param bytes
+   */
+  void setMemoryBudget(int64_t bytes);
+
+  /**
+   * @brief Returns the memory budget used to admit filters during a concurrent execution
+   * @return
+   */
+  int64_t getMemoryBudget() const;
+
   /**
    * @brief
    */
@@ -316,6 +422,12 @@ public Q_SLOTS:
    */
   virtual void cancel();
 
+  /**
+   * @brief Requests that a running preflightPipeline() stop before the next filter.
+   * This may be called from a different thread than the one running the preflight.
+   */
+  void cancelPreflight();
+
   void setName(const QString& name);
 
 protected:
@@ -362,10 +474,20 @@ private:
 
   FilterPipeline::State m_State = FilterPipeline::State::Idle;
   FilterPipeline::ExecutionResult m_ExecutionResult = FilterPipeline::ExecutionResult::Invalid;
+  std::atomic_bool m_PreflightCanceled = {false};
 
   QVector<QObject*> m_MessageReceivers;
 
   DataContainerArrayShPtrType m_Dca;
+  PipelineProfiler::Pointer m_Profiler;
+  bool m_ReleaseDeadArrays = false;
+  std::vector<DataArrayPath> m_PinnedPaths;
+  bool m_ConcurrentExecution = false;
+  int m_MaxThreads = 0;
+  std::atomic_bool m_ExecutingConcurrently = {false};
+  bool m_Preflighted = false;
+  PipelineResultCache::Pointer m_ResultCache;
+  int64_t m_MemoryBudget = 0;
 
   int m_ErrorCode = 0;
   int m_WarningCode = 0;
@@ -373,6 +495,41 @@ private:
   void connectSignalsSlots();
   void disconnectSignalsSlots();
 
+  /**
+   * @brief Removes every AttributeMatrix array that is neither pinned nor covered by one of the live paths
+   * @param livePaths Paths consumed by the filters that have not executed yet
+   */
+  void releaseDeadArrays(const std::list<DataArrayPath>& livePaths);
+
+  /**
+   * @brief Runs the enabled filters as their dependencies allow and reports each one in pipeline order. Only
+   * filters whose effect can be undone run ahead of an earlier filter that has not succeeded yet, and their
+   * objects are removed again when the pipeline stops, so a failed or canceled execution leaves the same
+   * DataContainerArray as a sequential one.
+   * @return The error code of the first failing filter or 0
+   */
+  int executeConcurrently();
+
+  /**
+   * @brief Removes the given objects from the DataContainerArray when they exist
+   * @param createdPaths
+   */
+  void removeCreatedPaths(const std::vector<DataArrayPath>& createdPaths);
+
+  /**
+   * @brief Computes the result cache key of every filter. Disabled filters, filters with side effects and every
+   * filter after the first filter with side effects get an empty key.
+   * @return
+   */
+  std::vector<QByteArray> computeResultCacheKeys() const;
+
+  /**
+   * @brief Replaces the contents of the DataContainerArray with the longest cached prefix of the pipeline
+   * @param cacheKeys
+   * @return The number of filters whose results were restored
+   */
+  size_t restoreCachedResults(const std::vector<QByteArray>& cacheKeys);
+
 public:
   FilterPipeline(const FilterPipeline&) = delete;            // Copy Constructor Not Implemented
   FilterPipeline(FilterPipeline&&) = delete;                 // Move Constructor Not Implemented
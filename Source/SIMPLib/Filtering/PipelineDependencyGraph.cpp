@@ -0,0 +1,232 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "PipelineDependencyGraph.h"
+
+#include "SIMPLib/Common/Constants.h"
+
+namespace
+{
+/**
+ * @brief Returns the container that is modified when the object at the path is created, deleted or renamed
+ * @param path
+ * @return
+ */
+DataArrayPath ParentPath(const DataArrayPath& path)
+{
+  if(!path.getDataArrayName().isEmpty())
+  {
+    return DataArrayPath(path.getDataContainerName(), path.getAttributeMatrixName(), "");
+  }
+  if(!path.getAttributeMatrixName().isEmpty())
+  {
+    return DataArrayPath(path.getDataContainerName(), "", "");
+  }
+  // Adding or removing a DataContainer modifies the DataContainerArray itself
+  return DataArrayPath();
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineDependencyGraph::PipelineDependencyGraph(const QList<AbstractFilter::Pointer>& filters)
+{
+  const size_t count = static_cast<size_t>(filters.size());
+  m_Footprints.resize(count);
+  m_Dependencies.resize(count);
+  m_IOFilters.resize(count, false);
+  m_CreatedPaths.resize(count);
+  m_Undoable.resize(count, false);
+
+  std::vector<bool> enabled(count, false);
+  for(size_t i = 0; i < count; i++)
+  {
+    AbstractFilter* filter = filters[static_cast<int>(i)].get();
+    enabled[i] = filter->getEnabled();
+    if(enabled[i])
+    {
+      m_Footprints[i] = CreateFootprint(filter);
+      m_IOFilters[i] = (filter->getGroupName() == SIMPL::FilterGroups::IOFilters);
+      if(nullptr != filter->getDataContainerArray())
+      {
+        std::list<DataArrayPath> createdPaths = filter->getCreatedPaths();
+        m_CreatedPaths[i].assign(createdPaths.begin(), createdPaths.end());
+        m_Undoable[i] = !m_IOFilters[i] && !filter->hasSideEffects() && filter->getDeletedPaths().empty() && filter->getRenamedPaths().empty();
+      }
+    }
+  }
+
+  for(size_t j = 0; j < count; j++)
+  {
+    if(!enabled[j])
+    {
+      continue;
+    }
+    for(size_t i = 0; i < j; i++)
+    {
+      if(enabled[i] && conflicts(i, j))
+      {
+        m_Dependencies[j].push_back(i);
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineDependencyGraph::~PipelineDependencyGraph() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PipelineDependencyGraph::size() const
+{
+  return m_Dependencies.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<size_t>& PipelineDependencyGraph::getDependencies(size_t index) const
+{
+  return m_Dependencies[index];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<DataArrayPath>& PipelineDependencyGraph::getFootprint(size_t index) const
+{
+  return m_Footprints[index];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<DataArrayPath>& PipelineDependencyGraph::getCreatedPaths(size_t index) const
+{
+  return m_CreatedPaths[index];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineDependencyGraph::isUndoable(size_t index) const
+{
+  return m_Undoable[index];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineDependencyGraph::PathsOverlap(const DataArrayPath& path1, const DataArrayPath& path2)
+{
+  if(path1.getDataContainerName().isEmpty() || path2.getDataContainerName().isEmpty())
+  {
+    return true;
+  }
+  if(path1.getDataContainerName() != path2.getDataContainerName())
+  {
+    return false;
+  }
+  if(path1.getAttributeMatrixName().isEmpty() || path2.getAttributeMatrixName().isEmpty())
+  {
+    return true;
+  }
+  if(path1.getAttributeMatrixName() != path2.getAttributeMatrixName())
+  {
+    return false;
+  }
+  if(path1.getDataArrayName().isEmpty() || path2.getDataArrayName().isEmpty())
+  {
+    return true;
+  }
+  return path1.getDataArrayName() == path2.getDataArrayName();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<DataArrayPath> PipelineDependencyGraph::CreateFootprint(AbstractFilter* filter)
+{
+  std::vector<DataArrayPath> footprint;
+  // Created paths are only known once the filter has been preflighted
+  if(nullptr == filter->getDataContainerArray())
+  {
+    footprint.emplace_back(DataArrayPath());
+    return footprint;
+  }
+
+  for(const DataArrayPath& path : filter->getConsumedPaths())
+  {
+    footprint.push_back(path);
+  }
+  for(const DataArrayPath& path : filter->getCreatedPaths())
+  {
+    footprint.push_back(ParentPath(path));
+  }
+  for(const DataArrayPath& path : filter->getDeletedPaths())
+  {
+    footprint.push_back(ParentPath(path));
+  }
+  for(const DataArrayPath::RenameType& rename : filter->getRenamedPaths())
+  {
+    footprint.push_back(ParentPath(rename.first));
+    footprint.push_back(ParentPath(rename.second));
+  }
+  return footprint;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineDependencyGraph::conflicts(size_t index1, size_t index2) const
+{
+  // IO filters share file handles. Their HDF5 calls, and those of deferred array reads from any other
+  // filter, are also serialized by H5DataArrayReader::LibraryMutex().
+  if(m_IOFilters[index1] && m_IOFilters[index2])
+  {
+    return true;
+  }
+  for(const DataArrayPath& path1 : m_Footprints[index1])
+  {
+    for(const DataArrayPath& path2 : m_Footprints[index2])
+    {
+      if(PathsOverlap(path1, path2))
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
@@ -0,0 +1,135 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <vector>
+
+#include <QtCore/QList>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+/**
+ * @brief The PipelineDependencyGraph class computes which filters of a preflighted pipeline depend on
+ * which earlier filters. Each enabled filter is given a footprint made of the paths it consumes
+ * (AbstractFilter::getConsumedPaths()) and the paths it creates, deletes or renames. Created, deleted and
+ * renamed paths are widened to their parent container because adding or removing an object modifies that
+ * container. Consumed paths are treated as writes since filters are free to modify their inputs in place.
+ * Two filters conflict when their footprints overlap or when both are IO filters. A filter depends on every
+ * earlier enabled filter it conflicts with, so running the filters in any order that respects the
+ * dependencies produces the same DataContainerArray as running them in pipeline order.
+ */
+class SIMPLib_EXPORT PipelineDependencyGraph
+{
+public:
+  /**
+   * @brief Builds the graph for the given filters. The filters must have been preflighted; a filter without a
+   * preflight DataContainerArray is assumed to touch everything.
+   * @param filters
+   */
+  explicit PipelineDependencyGraph(const QList<AbstractFilter::Pointer>& filters);
+  ~PipelineDependencyGraph();
+
+  /**
+   * @brief Returns the number of filters in the graph
+   * @return
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns the positions of the earlier filters that must finish before the filter at the given position starts
+   * @param index
+   * @return
+   */
+  const std::vector<size_t>& getDependencies(size_t index) const;
+
+  /**
+   * @brief Returns the paths the filter at the given position reads or modifies. An empty path means everything.
+   * @param index
+   * @return
+   */
+  const std::vector<DataArrayPath>& getFootprint(size_t index) const;
+
+  /**
+   * @brief Returns the paths the filter at the given position creates according to its preflight
+   * @param index
+   * @return
+   */
+  const std::vector<DataArrayPath>& getCreatedPaths(size_t index) const;
+
+  /**
+   * @brief Returns true if the effect of the filter at the given position on the DataContainerArray is removed
+   * again by deleting its created paths. That is not the case for filters that delete or rename objects, IO
+   * filters, filters with side effects and filters that were not preflighted.
+   * @param index
+   * @return
+   */
+  bool isUndoable(size_t index) const;
+
+  /**
+   * @brief Returns true if the two paths overlap. Empty DataContainer, AttributeMatrix or DataArray names
+   * match everything below that level.
+   * @param path1
+   * @param path2
+   * @return
+   */
+  static bool PathsOverlap(const DataArrayPath& path1, const DataArrayPath& path2);
+
+private:
+  std::vector<std::vector<DataArrayPath>> m_Footprints;
+  std::vector<std::vector<DataArrayPath>> m_CreatedPaths;
+  std::vector<bool> m_Undoable;
+  std::vector<std::vector<size_t>> m_Dependencies;
+  std::vector<bool> m_IOFilters;
+
+  /**
+   * @brief Collects the footprint of a single filter
+   * @param filter
+   * @return
+   */
+  static std::vector<DataArrayPath> CreateFootprint(AbstractFilter* filter);
+
+  /**
+   * @brief Returns true if the filters at the two positions may not run at the same time
+   * @param index1
+   * @param index2
+   * @return
+   */
+  bool conflicts(size_t index1, size_t index2) const;
+
+public:
+  PipelineDependencyGraph(const PipelineDependencyGraph&) = default;            // Copy Constructor
+  PipelineDependencyGraph(PipelineDependencyGraph&&) = default;                 // Move Constructor
+  PipelineDependencyGraph& operator=(const PipelineDependencyGraph&) = default; // Copy Assignment
+  PipelineDependencyGraph& operator=(PipelineDependencyGraph&&) = default;      // Move Assignment
+};
@@ -0,0 +1,359 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "PipelineMemoryPlanner.h"
+
+#include <QtCore/QJsonArray>
+
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/EdgeGeom.h"
+#include "SIMPLib/Geometry/HexahedralGeom.h"
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Geometry/VertexGeom.h"
+
+namespace
+{
+/**
+ * @brief Formats a byte count for messages
+ * @param bytes
+ * @return
+ */
+QString FormatBytes(int64_t bytes)
+{
+  const double mebibytes = static_cast<double>(bytes) / (1024.0 * 1024.0);
+  if(mebibytes >= 1024.0)
+  {
+    return QString("%1 GB").arg(mebibytes / 1024.0, 0, 'f', 2);
+  }
+  return QString("%1 MB").arg(mebibytes, 0, 'f', 1);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineMemoryPlanner::PipelineMemoryPlanner() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineMemoryPlanner::~PipelineMemoryPlanner() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineMemoryPlanner::plan(const QList<AbstractFilter::Pointer>& filters)
+{
+  m_FilterEstimates.clear();
+  m_PeakBytes = 0;
+  m_PeakFilterIndex = -1;
+
+  bool valid = true;
+  std::map<QString, int64_t> liveObjects;
+  int64_t liveBytes = 0;
+  for(const auto& filter : filters)
+  {
+    FilterEstimate estimate;
+    estimate.pipelineIndex = filter->getPipelineIndex();
+    estimate.className = filter->getNameOfClass();
+    estimate.humanLabel = filter->getHumanLabel();
+    estimate.enabled = filter->getEnabled();
+
+    DataContainerArray::Pointer dca = filter->getDataContainerArray();
+    if(estimate.enabled && nullptr == dca.get())
+    {
+      valid = false;
+    }
+    if(estimate.enabled && nullptr != dca.get())
+    {
+      std::map<QString, int64_t> objects = EstimateObjectBytes(dca.get());
+      // An object counts as created when it is new or grew, and as released when it is gone or shrank
+      for(const auto& object : objects)
+      {
+        auto previous = liveObjects.find(object.first);
+        const int64_t previousBytes = (previous == liveObjects.end()) ? 0 : previous->second;
+        if(object.second > previousBytes)
+        {
+          estimate.createdBytes += object.second - previousBytes;
+        }
+        else
+        {
+          estimate.releasedBytes += previousBytes - object.second;
+        }
+      }
+      for(const auto& previous : liveObjects)
+      {
+        if(objects.find(previous.first) == objects.end())
+        {
+          estimate.releasedBytes += previous.second;
+        }
+      }
+      estimate.peakBytes = liveBytes + estimate.createdBytes;
+      liveBytes += estimate.createdBytes - estimate.releasedBytes;
+      liveObjects.swap(objects);
+    }
+    else
+    {
+      estimate.peakBytes = liveBytes;
+    }
+    estimate.liveBytes = liveBytes;
+
+    if(m_PeakFilterIndex < 0 || estimate.peakBytes > m_PeakBytes)
+    {
+      m_PeakBytes = estimate.peakBytes;
+      m_PeakFilterIndex = estimate.pipelineIndex;
+    }
+    m_FilterEstimates.push_back(estimate);
+  }
+  return valid;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<PipelineMemoryPlanner::FilterEstimate>& PipelineMemoryPlanner::getFilterEstimates() const
+{
+  return m_FilterEstimates;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t PipelineMemoryPlanner::getPeakBytes() const
+{
+  return m_PeakBytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t PipelineMemoryPlanner::getPeakFilterIndex() const
+{
+  return m_PeakFilterIndex;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineMemoryPlanner::setBudget(int64_t bytes)
+{
+  m_Budget = bytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t PipelineMemoryPlanner::getBudget() const
+{
+  return m_Budget;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineMemoryPlanner::exceedsBudget() const
+{
+  return m_Budget > 0 && m_PeakBytes > m_Budget;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineMemoryPlanner::getSummary() const
+{
+  QString peakLabel;
+  for(const FilterEstimate& estimate : m_FilterEstimates)
+  {
+    if(estimate.pipelineIndex == m_PeakFilterIndex)
+    {
+      peakLabel = estimate.humanLabel;
+    }
+  }
+  QString summary = QString("Predicted peak memory is %1 during filter %2 (%3)").arg(FormatBytes(m_PeakBytes)).arg(m_PeakFilterIndex + 1).arg(peakLabel);
+  if(m_Budget > 0)
+  {
+    summary += QString(exceedsBudget() ? ", which exceeds the budget of %1" : ", within the budget of %1").arg(FormatBytes(m_Budget));
+  }
+  return summary;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineMemoryPlanner::toJson() const
+{
+  QJsonArray filters;
+  for(const FilterEstimate& estimate : m_FilterEstimates)
+  {
+    QJsonObject obj;
+    obj["Index"] = estimate.pipelineIndex;
+    obj["ClassName"] = estimate.className;
+    obj["HumanLabel"] = estimate.humanLabel;
+    obj["Enabled"] = estimate.enabled;
+    obj["LiveBytes"] = static_cast<double>(estimate.liveBytes);
+    obj["PeakBytes"] = static_cast<double>(estimate.peakBytes);
+    obj["CreatedBytes"] = static_cast<double>(estimate.createdBytes);
+    obj["ReleasedBytes"] = static_cast<double>(estimate.releasedBytes);
+    filters.append(obj);
+  }
+
+  QJsonObject json;
+  json["Filters"] = filters;
+  json["PeakBytes"] = static_cast<double>(m_PeakBytes);
+  json["PeakFilterIndex"] = m_PeakFilterIndex;
+  json["BudgetBytes"] = static_cast<double>(m_Budget);
+  json["ExceedsBudget"] = exceedsBudget();
+  return json;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t PipelineMemoryPlanner::EstimateArrayBytes(const IDataArray* array)
+{
+  if(nullptr == array)
+  {
+    return 0;
+  }
+  // Preflight arrays are not allocated so the size comes from the tuple and component counts
+  return static_cast<int64_t>(array->getNumberOfTuples()) * array->getNumberOfComponents() * static_cast<int64_t>(array->getTypeSize());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t PipelineMemoryPlanner::EstimateGeometryBytes(const IGeometry* geometry)
+{
+  if(nullptr == geometry)
+  {
+    return 0;
+  }
+
+  int64_t bytes = 0;
+  if(const auto* vertexGeom = dynamic_cast<const VertexGeom*>(geometry))
+  {
+    // Implicit vertices are computed from the grid and hold no list until accessed
+    if(!vertexGeom->hasImplicitVertices())
+    {
+      bytes += EstimateArrayBytes(vertexGeom->getVertices().get());
+    }
+  }
+  else if(const auto* edgeGeom = dynamic_cast<const EdgeGeom*>(geometry))
+  {
+    bytes += EstimateArrayBytes(edgeGeom->getVertices().get());
+    bytes += EstimateArrayBytes(edgeGeom->getEdges().get());
+  }
+  else if(const auto* triangleGeom = dynamic_cast<const TriangleGeom*>(geometry))
+  {
+    bytes += EstimateArrayBytes(triangleGeom->getVertices().get());
+    bytes += EstimateArrayBytes(triangleGeom->getTriangles().get());
+  }
+  else if(const auto* quadGeom = dynamic_cast<const QuadGeom*>(geometry))
+  {
+    bytes += EstimateArrayBytes(quadGeom->getVertices().get());
+    bytes += EstimateArrayBytes(quadGeom->getQuads().get());
+  }
+  else if(const auto* tetGeom = dynamic_cast<const TetrahedralGeom*>(geometry))
+  {
+    bytes += EstimateArrayBytes(tetGeom->getVertices().get());
+    bytes += EstimateArrayBytes(tetGeom->getTetrahedra().get());
+  }
+  else if(const auto* hexGeom = dynamic_cast<const HexahedralGeom*>(geometry))
+  {
+    bytes += EstimateArrayBytes(hexGeom->getVertices().get());
+    bytes += EstimateArrayBytes(hexGeom->getHexahedra().get());
+  }
+  // Image and rectilinear grid geometries store no per element lists
+  return bytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::map<QString, int64_t> PipelineMemoryPlanner::EstimateObjectBytes(const DataContainerArray* dca)
+{
+  std::map<QString, int64_t> objects;
+  if(nullptr == dca)
+  {
+    return objects;
+  }
+  for(const auto& dc : dca->getDataContainers())
+  {
+    const int64_t geometryBytes = EstimateGeometryBytes(dc->getGeometry().get());
+    if(geometryBytes > 0)
+    {
+      objects[dc->getName() + "|_Geometry"] = geometryBytes;
+    }
+    for(const auto& am : dc->getAttributeMatrices())
+    {
+      for(const auto& array : *am)
+      {
+        objects[DataArrayPath(dc->getName(), am->getName(), array->getName()).serialize()] = EstimateArrayBytes(array.get());
+      }
+    }
+  }
+  return objects;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineMemoryPlanner::Pointer PipelineMemoryPlanner::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineMemoryPlanner::Pointer PipelineMemoryPlanner::New()
+{
+  Pointer sharedPtr(new(PipelineMemoryPlanner));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineMemoryPlanner::getNameOfClass() const
+{
+  return QString("PipelineMemoryPlanner");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineMemoryPlanner::ClassName()
+{
+  return QString("PipelineMemoryPlanner");
+}
@@ -0,0 +1,191 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QList>
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+class DataContainerArray;
+class IDataArray;
+class IGeometry;
+
+/**
+ * @brief The PipelineMemoryPlanner class predicts how much memory the arrays and geometries of a pipeline
+ * will need from its preflight results. Preflight records the type, tuple count and component count of every
+ * array each filter creates without allocating them, which is enough to compute
+ *
+ * - the bytes live after each filter,
+ * - the bytes created and released by each filter,
+ * - the peak of each filter, taken as the bytes live before it plus the bytes it creates since its inputs
+ *   are still held while its outputs are written, and the peak of the whole pipeline.
+ *
+ * The estimate covers array and geometry storage only. Temporary buffers inside filters are not known to
+ * preflight, and NeighborList and StringDataArray contents are counted as one element per tuple, so the
+ * estimate is a lower bound for pipelines that use them.
+ */
+class SIMPLib_EXPORT PipelineMemoryPlanner
+{
+public:
+  using Self = PipelineMemoryPlanner;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  static Pointer NullPointer();
+
+  static Pointer New();
+
+  /**
+   * @brief Returns the name of the class for PipelineMemoryPlanner
+   */
+  QString getNameOfClass() const;
+  /**
+   * @brief Returns the name of the class for PipelineMemoryPlanner
+   */
+  static QString ClassName();
+
+  virtual ~PipelineMemoryPlanner();
+
+  /**
+   * @brief The estimate for a single filter
+   */
+  struct FilterEstimate
+  {
+    int32_t pipelineIndex = -1;
+    QString className;
+    QString humanLabel;
+    bool enabled = true;
+    int64_t liveBytes = 0;
+    int64_t peakBytes = 0;
+    int64_t createdBytes = 0;
+    int64_t releasedBytes = 0;
+  };
+
+  /**
+   * @brief Computes the estimates from the DataContainerArray each filter holds after preflight. Call it right
+   * after FilterPipeline::preflightPipeline() succeeded.
+   * @param filters
+   * @return False if a filter has no preflight results
+   */
+  bool plan(const QList<AbstractFilter::Pointer>& filters);
+
+  /**
+   * @brief Returns the estimate of every filter in pipeline order
+   * @return
+   */
+  const std::vector<FilterEstimate>& getFilterEstimates() const;
+
+  /**
+   * @brief Returns the predicted peak of the pipeline in bytes
+   * @return
+   */
+  int64_t getPeakBytes() const;
+
+  /**
+   * @brief Returns the pipeline index of the filter the peak is predicted for, or -1 for an empty pipeline
+   * @return
+   */
+  int32_t getPeakFilterIndex() const;
+
+  /**
+   * @brief Sets the memory budget in bytes. A budget of 0 means there is no budget.
+   * @param bytes
+   */
+  void setBudget(int64_t bytes);
+
+  /**
+   * @brief Returns the memory budget in bytes
+   * @return
+   */
+  int64_t getBudget() const;
+
+  /**
+   * @brief Returns true if there is a budget and the predicted peak exceeds it
+   * @return
+   */
+  bool exceedsBudget() const;
+
+  /**
+   * @brief Returns a message describing the predicted peak and the budget
+   * @return
+   */
+  QString getSummary() const;
+
+  /**
+   * @brief Returns the estimates as JSON
+   * @return
+   */
+  QJsonObject toJson() const;
+
+  /**
+   * @brief Returns the bytes the array needs once it is allocated
+   * @param array
+   * @return
+   */
+  static int64_t EstimateArrayBytes(const IDataArray* array);
+
+  /**
+   * @brief Returns the bytes the vertex and element lists of the geometry need once they are allocated
+   * @param geometry
+   * @return
+   */
+  static int64_t EstimateGeometryBytes(const IGeometry* geometry);
+
+  /**
+   * @brief Returns the bytes every array and geometry of the DataContainerArray needs, keyed by path
+   * @param dca
+   * @return
+   */
+  static std::map<QString, int64_t> EstimateObjectBytes(const DataContainerArray* dca);
+
+protected:
+  PipelineMemoryPlanner();
+
+private:
+  std::vector<FilterEstimate> m_FilterEstimates;
+  int64_t m_PeakBytes = 0;
+  int32_t m_PeakFilterIndex = -1;
+  int64_t m_Budget = 0;
+
+public:
+  PipelineMemoryPlanner(const PipelineMemoryPlanner&) = delete;            // Copy Constructor Not Implemented
+  PipelineMemoryPlanner(PipelineMemoryPlanner&&) = delete;                 // Move Constructor Not Implemented
+  PipelineMemoryPlanner& operator=(const PipelineMemoryPlanner&) = delete; // Copy Assignment Not Implemented
+  PipelineMemoryPlanner& operator=(PipelineMemoryPlanner&&) = delete;      // Move Assignment Not Implemented
+};
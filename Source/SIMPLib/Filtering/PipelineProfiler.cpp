@@ -0,0 +1,517 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "PipelineProfiler.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+// windows.h has to come first
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+#if defined(__APPLE__)
+#include <mach/mach.h>
+#endif
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+// CPU time (user + system) of the whole process in nanoseconds
+// -----------------------------------------------------------------------------
+int64_t ProcessCpuTimeNs()
+{
+#if defined(_WIN32)
+  FILETIME creationTime;
+  FILETIME exitTime;
+  FILETIME kernelTime;
+  FILETIME userTime;
+  if(GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime) == 0)
+  {
+    return 0;
+  }
+  auto toNs = [](const FILETIME& ft) { return ((static_cast<int64_t>(ft.dwHighDateTime) << 32) | static_cast<int64_t>(ft.dwLowDateTime)) * 100; };
+  return toNs(kernelTime) + toNs(userTime);
+#else
+  struct rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage) != 0)
+  {
+    return 0;
+  }
+  auto toNs = [](const struct timeval& tv) { return static_cast<int64_t>(tv.tv_sec) * 1000000000LL + static_cast<int64_t>(tv.tv_usec) * 1000LL; };
+  return toNs(usage.ru_utime) + toNs(usage.ru_stime);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+// Current resident set size of the process in bytes, 0 if unknown
+// -----------------------------------------------------------------------------
+int64_t ResidentBytes()
+{
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters;
+  if(GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) == 0)
+  {
+    return 0;
+  }
+  return static_cast<int64_t>(counters.WorkingSetSize);
+#elif defined(__APPLE__)
+  mach_task_basic_info info;
+  mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+  if(task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) != KERN_SUCCESS)
+  {
+    return 0;
+  }
+  return static_cast<int64_t>(info.resident_size);
+#else
+  FILE* file = fopen("/proc/self/statm", "r");
+  if(nullptr == file)
+  {
+    return 0;
+  }
+  long long pages = 0;
+  long long residentPages = 0;
+  int count = fscanf(file, "%lld %lld", &pages, &residentPages);
+  fclose(file);
+  if(count != 2)
+  {
+    return 0;
+  }
+  return static_cast<int64_t>(residentPages) * static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+// -----------------------------------------------------------------------------
+// Peak resident set size of the process in bytes, 0 if unknown
+// -----------------------------------------------------------------------------
+int64_t PeakResidentBytes()
+{
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters;
+  if(GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) == 0)
+  {
+    return 0;
+  }
+  return static_cast<int64_t>(counters.PeakWorkingSetSize);
+#else
+  struct rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage) != 0)
+  {
+    return 0;
+  }
+#if defined(__APPLE__)
+  return static_cast<int64_t>(usage.ru_maxrss); // bytes
+#else
+  return static_cast<int64_t>(usage.ru_maxrss) * 1024; // kilobytes
+#endif
+#endif
+}
+
+// -----------------------------------------------------------------------------
+// Sums the bytes held by the resident arrays and collects the paths of all arrays
+// -----------------------------------------------------------------------------
+int64_t ScanArrays(const DataContainerArray* dca, std::vector<QString>& paths)
+{
+  paths.clear();
+  if(nullptr == dca)
+  {
+    return 0;
+  }
+  int64_t numBytes = 0;
+  for(const auto& dc : dca->getDataContainers())
+  {
+    for(const auto& am : dc->getAttributeMatrices())
+    {
+      for(const auto& array : *am)
+      {
+        paths.push_back(dc->getName() + "/" + am->getName() + "/" + array->getName());
+        if(array->isAllocated() && !array->isDeferred())
+        {
+          numBytes += static_cast<int64_t>(array->getSize() * array->getTypeSize());
+        }
+      }
+    }
+  }
+  std::sort(paths.begin(), paths.end());
+  return numBytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double NsToMs(int64_t ns)
+{
+  return static_cast<double>(ns) * 1.0E-6;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double NsToUs(int64_t ns)
+{
+  return static_cast<double>(ns) * 1.0E-3;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+PipelineProfiler::PipelineProfiler() = default;
+
+// -----------------------------------------------------------------------------
+PipelineProfiler::~PipelineProfiler() = default;
+
+// -----------------------------------------------------------------------------
+PipelineProfiler::Pointer PipelineProfiler::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+PipelineProfiler::Pointer PipelineProfiler::New()
+{
+  Pointer sharedPtr(new(PipelineProfiler));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+QString PipelineProfiler::getNameOfClass() const
+{
+  return QString("PipelineProfiler");
+}
+
+// -----------------------------------------------------------------------------
+QString PipelineProfiler::ClassName()
+{
+  return QString("PipelineProfiler");
+}
+
+// -----------------------------------------------------------------------------
+void PipelineProfiler::beginPipeline(const QString& pipelineName)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_PipelineName = pipelineName;
+  m_FilterRecords.clear();
+  m_RegionRecords.clear();
+  m_ArrayBytesAfterFilter.clear();
+  m_Current = FilterRecord();
+  m_PipelineWallNs = 0;
+  m_PipelineCpuNs = 0;
+  m_PipelineCpuStart = ProcessCpuTimeNs();
+  m_PipelineStart = std::chrono::steady_clock::now();
+  m_Running = true;
+  SetThreadObserver(this);
+}
+
+// -----------------------------------------------------------------------------
+void PipelineProfiler::endPipeline()
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  if(!m_Running)
+  {
+    return;
+  }
+  m_PipelineWallNs = elapsedNs(std::chrono::steady_clock::now());
+  m_PipelineCpuNs = ProcessCpuTimeNs() - m_PipelineCpuStart;
+  m_Running = false;
+  if(ThreadObserver() == this)
+  {
+    SetThreadObserver(nullptr);
+  }
+}
+
+// -----------------------------------------------------------------------------
+void PipelineProfiler::beginFilter(const AbstractFilter* filter, const DataContainerArray* dca)
+{
+  // Walking the arrays is done outside of the timed section
+  std::vector<QString> arrayPaths;
+  int64_t arrayBytes = ScanArrays(dca, arrayPaths);
+
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_Current = FilterRecord();
+  m_Current.pipelineIndex = filter->getPipelineIndex();
+  m_Current.className = filter->getNameOfClass();
+  m_Current.humanLabel = filter->getHumanLabel();
+  m_FilterArraysStart.swap(arrayPaths);
+  m_FilterArrayBytesStart = arrayBytes;
+  m_FilterResidentStart = ResidentBytes();
+  m_FilterPeakResidentStart = PeakResidentBytes();
+  m_FilterCpuStart = ProcessCpuTimeNs();
+  m_FilterStart = std::chrono::steady_clock::now();
+}
+
+// -----------------------------------------------------------------------------
+void PipelineProfiler::endFilter(const AbstractFilter* filter, const DataContainerArray* dca)
+{
+  std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+  int64_t cpuStop = ProcessCpuTimeNs();
+  int64_t residentStop = ResidentBytes();
+  int64_t peakResidentStop = PeakResidentBytes();
+
+  std::vector<QString> arrayPaths;
+  int64_t arrayBytes = ScanArrays(dca, arrayPaths);
+
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  FilterRecord record = m_Current;
+  record.errorCode = filter->getErrorCode();
+  record.startNs = elapsedNs(m_FilterStart);
+  record.wallNs = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - m_FilterStart).count();
+  record.cpuNs = cpuStop - m_FilterCpuStart;
+  record.residentDelta = residentStop - m_FilterResidentStart;
+  record.peakResidentDelta = peakResidentStop - m_FilterPeakResidentStart;
+  record.arrayBytesDelta = arrayBytes - m_FilterArrayBytesStart;
+
+  std::vector<QString> changed;
+  std::set_difference(arrayPaths.begin(), arrayPaths.end(), m_FilterArraysStart.begin(), m_FilterArraysStart.end(), std::back_inserter(changed));
+  record.arraysCreated = static_cast<int32_t>(changed.size());
+  changed.clear();
+  std::set_difference(m_FilterArraysStart.begin(), m_FilterArraysStart.end(), arrayPaths.begin(), arrayPaths.end(), std::back_inserter(changed));
+  record.arraysRemoved = static_cast<int32_t>(changed.size());
+
+  m_FilterRecords.push_back(record);
+  m_ArrayBytesAfterFilter.push_back(arrayBytes);
+  m_Current = FilterRecord();
+  m_FilterArraysStart.clear();
+}
+
+// -----------------------------------------------------------------------------
+void PipelineProfiler::parallelRegionFinished(const char* name, const std::chrono::steady_clock::time_point& start, const std::chrono::steady_clock::time_point& stop, size_t rangeSize,
+                                              bool parallel)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  RegionRecord record;
+  record.name = QString::fromLatin1(name);
+  record.filterIndex = m_Current.pipelineIndex;
+  record.startNs = elapsedNs(start);
+  record.wallNs = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+  record.rangeSize = rangeSize;
+  record.parallel = parallel;
+  m_RegionRecords.push_back(record);
+}
+
+// -----------------------------------------------------------------------------
+int64_t PipelineProfiler::elapsedNs(const std::chrono::steady_clock::time_point& timePoint) const
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(timePoint - m_PipelineStart).count();
+}
+
+// -----------------------------------------------------------------------------
+std::vector<PipelineProfiler::FilterRecord> PipelineProfiler::getFilterRecords() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_FilterRecords;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<PipelineProfiler::RegionRecord> PipelineProfiler::getRegionRecords() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_RegionRecords;
+}
+
+// -----------------------------------------------------------------------------
+int64_t PipelineProfiler::getPipelineWallTime() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_PipelineWallNs;
+}
+
+// -----------------------------------------------------------------------------
+QJsonObject PipelineProfiler::toJson() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+
+  QJsonArray filters;
+  for(const auto& record : m_FilterRecords)
+  {
+    QJsonObject filterObj;
+    filterObj["Index"] = record.pipelineIndex;
+    filterObj["Filter"] = record.className;
+    filterObj["HumanLabel"] = record.humanLabel;
+    filterObj["ErrorCode"] = record.errorCode;
+    filterObj["Start_ms"] = NsToMs(record.startNs);
+    filterObj["WallTime_ms"] = NsToMs(record.wallNs);
+    filterObj["CpuTime_ms"] = NsToMs(record.cpuNs);
+    filterObj["WallTimeFraction"] = m_PipelineWallNs > 0 ? static_cast<double>(record.wallNs) / static_cast<double>(m_PipelineWallNs) : 0.0;
+    filterObj["ResidentDelta_bytes"] = static_cast<qint64>(record.residentDelta);
+    filterObj["PeakResidentDelta_bytes"] = static_cast<qint64>(record.peakResidentDelta);
+    filterObj["ArrayBytesDelta_bytes"] = static_cast<qint64>(record.arrayBytesDelta);
+    filterObj["ArraysCreated"] = record.arraysCreated;
+    filterObj["ArraysRemoved"] = record.arraysRemoved;
+
+    QJsonArray regions;
+    for(const auto& region : m_RegionRecords)
+    {
+      if(region.filterIndex != record.pipelineIndex)
+      {
+        continue;
+      }
+      QJsonObject regionObj;
+      regionObj["Name"] = region.name;
+      regionObj["Start_ms"] = NsToMs(region.startNs);
+      regionObj["WallTime_ms"] = NsToMs(region.wallNs);
+      regionObj["RangeSize"] = static_cast<qint64>(region.rangeSize);
+      regionObj["Parallel"] = region.parallel;
+      regions.append(regionObj);
+    }
+    filterObj["ParallelRegions"] = regions;
+    filters.append(filterObj);
+  }
+
+  QJsonObject root;
+  root["PipelineName"] = m_PipelineName;
+  root["WallTime_ms"] = NsToMs(m_PipelineWallNs);
+  root["CpuTime_ms"] = NsToMs(m_PipelineCpuNs);
+  root["PeakResident_bytes"] = static_cast<qint64>(PeakResidentBytes());
+  root["Filters"] = filters;
+  return root;
+}
+
+// -----------------------------------------------------------------------------
+QJsonObject PipelineProfiler::toChromeTrace() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+
+  const qint64 pid = QCoreApplication::applicationPid();
+  const int tid = 1;
+  QJsonArray events;
+
+  QJsonObject processName;
+  processName["name"] = QString("process_name");
+  processName["ph"] = QString("M");
+  processName["pid"] = pid;
+  processName["tid"] = tid;
+  processName["args"] = QJsonObject({{"name", m_PipelineName.isEmpty() ? QString("FilterPipeline") : m_PipelineName}});
+  events.append(processName);
+
+  QJsonObject pipelineEvent;
+  pipelineEvent["name"] = m_PipelineName.isEmpty() ? QString("Pipeline") : m_PipelineName;
+  pipelineEvent["cat"] = QString("pipeline");
+  pipelineEvent["ph"] = QString("X");
+  pipelineEvent["ts"] = 0.0;
+  pipelineEvent["dur"] = NsToUs(m_PipelineWallNs);
+  pipelineEvent["pid"] = pid;
+  pipelineEvent["tid"] = tid;
+  pipelineEvent["args"] = QJsonObject({{"CpuTime_ms", NsToMs(m_PipelineCpuNs)}});
+  events.append(pipelineEvent);
+
+  for(size_t i = 0; i < m_FilterRecords.size(); i++)
+  {
+    const FilterRecord& record = m_FilterRecords[i];
+    QJsonObject args;
+    args["Filter"] = record.className;
+    args["Index"] = record.pipelineIndex;
+    args["ErrorCode"] = record.errorCode;
+    args["CpuTime_ms"] = NsToMs(record.cpuNs);
+    args["ResidentDelta_bytes"] = static_cast<qint64>(record.residentDelta);
+    args["PeakResidentDelta_bytes"] = static_cast<qint64>(record.peakResidentDelta);
+    args["ArrayBytesDelta_bytes"] = static_cast<qint64>(record.arrayBytesDelta);
+    args["ArraysCreated"] = record.arraysCreated;
+    args["ArraysRemoved"] = record.arraysRemoved;
+
+    QJsonObject event;
+    event["name"] = record.humanLabel;
+    event["cat"] = QString("filter");
+    event["ph"] = QString("X");
+    event["ts"] = NsToUs(record.startNs);
+    event["dur"] = NsToUs(record.wallNs);
+    event["pid"] = pid;
+    event["tid"] = tid;
+    event["args"] = args;
+    events.append(event);
+
+    // Counter track showing the bytes held by the arrays after each filter
+    QJsonObject counter;
+    counter["name"] = QString("Array Memory");
+    counter["ph"] = QString("C");
+    counter["ts"] = NsToUs(record.startNs + record.wallNs);
+    counter["pid"] = pid;
+    counter["args"] = QJsonObject({{"MB", static_cast<double>(m_ArrayBytesAfterFilter[i]) / (1024.0 * 1024.0)}});
+    events.append(counter);
+  }
+
+  for(const auto& region : m_RegionRecords)
+  {
+    QJsonObject event;
+    event["name"] = region.name;
+    event["cat"] = QString("parallel");
+    event["ph"] = QString("X");
+    event["ts"] = NsToUs(region.startNs);
+    event["dur"] = NsToUs(region.wallNs);
+    event["pid"] = pid;
+    event["tid"] = tid;
+    event["args"] = QJsonObject({{"RangeSize", static_cast<qint64>(region.rangeSize)}, {"Parallel", region.parallel}, {"FilterIndex", region.filterIndex}});
+    events.append(event);
+  }
+
+  QJsonObject root;
+  root["traceEvents"] = events;
+  root["displayTimeUnit"] = QString("ms");
+  return root;
+}
+
+// -----------------------------------------------------------------------------
+bool PipelineProfiler::writeSummary(const QString& filePath) const
+{
+  QFile file(filePath);
+  if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+  {
+    return false;
+  }
+  QByteArray json = QJsonDocument(toJson()).toJson();
+  return file.write(json) == json.size();
+}
+
+// -----------------------------------------------------------------------------
+bool PipelineProfiler::writeChromeTrace(const QString& filePath) const
+{
+  QFile file(filePath);
+  if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+  {
+    return false;
+  }
+  QByteArray json = QJsonDocument(toChromeTrace()).toJson(QJsonDocument::Compact);
+  return file.write(json) == json.size();
+}
@@ -0,0 +1,225 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/ParallelRegionObserver.h"
+
+class AbstractFilter;
+class DataContainerArray;
+
+/**
+ * @brief The PipelineProfiler class records how long each filter of an executing FilterPipeline took and
+ * what it did to memory. It is opt-in: attach one with FilterPipeline::setProfiler() before calling
+ * execute(). For every enabled filter it records
+ *
+ * - the wall clock time and the CPU time of the whole process, so CPU time above the wall time means the
+ *   filter ran multithreaded,
+ * - the change of the process resident set size and of its peak,
+ * - the change of the bytes held by the arrays of the DataContainerArray and the arrays created and removed.
+ *
+ * While a pipeline is executing, every ParallelDataAlgorithm, ParallelData2DAlgorithm and
+ * ParallelData3DAlgorithm run on the pipeline's thread is recorded as a region of the current filter.
+ *
+ * The results can be exported as a JSON summary or as a Chrome trace (load it in chrome://tracing or
+ * https://ui.perfetto.dev).
+ */
+class SIMPLib_EXPORT PipelineProfiler : public ParallelRegionObserver
+{
+public:
+  using Self = PipelineProfiler;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  static Pointer NullPointer();
+
+  static Pointer New();
+
+  /**
+   * @brief Returns the name of the class for PipelineProfiler
+   */
+  QString getNameOfClass() const;
+  /**
+   * @brief Returns the name of the class for PipelineProfiler
+   */
+  static QString ClassName();
+
+  /**
+   * @brief Measurements for one executed filter. Times are in nanoseconds relative to the pipeline start,
+   * memory deltas in bytes.
+   */
+  struct FilterRecord
+  {
+    int32_t pipelineIndex = -1;
+    QString className;
+    QString humanLabel;
+    int32_t errorCode = 0;
+    int64_t startNs = 0;
+    int64_t wallNs = 0;
+    int64_t cpuNs = 0;
+    int64_t residentDelta = 0;
+    int64_t peakResidentDelta = 0;
+    int64_t arrayBytesDelta = 0;
+    int32_t arraysCreated = 0;
+    int32_t arraysRemoved = 0;
+  };
+
+  /**
+   * @brief One parallel algorithm run inside a filter
+   */
+  struct RegionRecord
+  {
+    QString name;
+    int32_t filterIndex = -1;
+    int64_t startNs = 0;
+    int64_t wallNs = 0;
+    size_t rangeSize = 0;
+    bool parallel = false;
+  };
+
+  ~PipelineProfiler() override;
+
+  /**
+   * @brief Clears previous results and starts timing a pipeline. Installs this profiler as the observer of
+   * parallel regions on the calling thread.
+   * @param pipelineName
+   */
+  void beginPipeline(const QString& pipelineName);
+
+  /**
+   * @brief Stops timing the pipeline
+   */
+  void endPipeline();
+
+  /**
+   * @brief Takes the measurements before a filter executes
+   * @param filter
+   * @param dca The DataContainerArray the filter will operate on
+   */
+  void beginFilter(const AbstractFilter* filter, const DataContainerArray* dca);
+
+  /**
+   * @brief Takes the measurements after a filter executed and stores its record
+   * @param filter
+   * @param dca The DataContainerArray the filter operated on
+   */
+  void endFilter(const AbstractFilter* filter, const DataContainerArray* dca);
+
+  /**
+   * @brief Returns the records of the executed filters in execution order
+   * @return
+   */
+  std::vector<FilterRecord> getFilterRecords() const;
+
+  /**
+   * @brief Returns the recorded parallel regions in the order they finished
+   * @return
+   */
+  std::vector<RegionRecord> getRegionRecords() const;
+
+  /**
+   * @brief Returns the wall clock time of the last profiled pipeline in nanoseconds
+   * @return
+   */
+  int64_t getPipelineWallTime() const;
+
+  /**
+   * @brief Returns a summary with one entry per filter, including its parallel regions
+   * @return
+   */
+  QJsonObject toJson() const;
+
+  /**
+   * @brief Returns the results in the Chrome trace event format
+   * @return
+   */
+  QJsonObject toChromeTrace() const;
+
+  /**
+   * @brief Writes toJson() to a file
+   * @param filePath
+   * @return False if the file could not be written
+   */
+  bool writeSummary(const QString& filePath) const;
+
+  /**
+   * @brief Writes toChromeTrace() to a file
+   * @param filePath
+   * @return False if the file could not be written
+   */
+  bool writeChromeTrace(const QString& filePath) const;
+
+protected:
+  PipelineProfiler();
+
+  /**
+   * @brief Records the parallel region as part of the filter that is currently executing
+   */
+  void parallelRegionFinished(const char* name, const std::chrono::steady_clock::time_point& start, const std::chrono::steady_clock::time_point& stop, size_t rangeSize, bool parallel) override;
+
+  int64_t elapsedNs(const std::chrono::steady_clock::time_point& timePoint) const;
+
+private:
+  mutable std::mutex m_Mutex;
+  QString m_PipelineName;
+  std::chrono::steady_clock::time_point m_PipelineStart;
+  int64_t m_PipelineWallNs = 0;
+  int64_t m_PipelineCpuStart = 0;
+  int64_t m_PipelineCpuNs = 0;
+  bool m_Running = false;
+
+  FilterRecord m_Current;
+  std::chrono::steady_clock::time_point m_FilterStart;
+  int64_t m_FilterCpuStart = 0;
+  int64_t m_FilterResidentStart = 0;
+  int64_t m_FilterPeakResidentStart = 0;
+  int64_t m_FilterArrayBytesStart = 0;
+  std::vector<QString> m_FilterArraysStart;
+
+  std::vector<FilterRecord> m_FilterRecords;
+  std::vector<RegionRecord> m_RegionRecords;
+  std::vector<int64_t> m_ArrayBytesAfterFilter;
+
+public:
+  PipelineProfiler(const PipelineProfiler&) = delete;            // Copy Constructor Not Implemented
+  PipelineProfiler(PipelineProfiler&&) = delete;                 // Move Constructor Not Implemented
+  PipelineProfiler& operator=(const PipelineProfiler&) = delete; // Copy Assignment Not Implemented
+  PipelineProfiler& operator=(PipelineProfiler&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,373 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "PipelineResultCache.h"
+
+#include <algorithm>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
+#include "SIMPLib/SIMPLibVersion.h"
+#include "SIMPLib/CoreFilters/DataContainerReader.h"
+#include "SIMPLib/CoreFilters/DataContainerWriter.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+namespace
+{
+const QString k_EntrySuffix("dream3d");
+
+/**
+ * @brief Adds the size and modification time of a file to the hash
+ * @param fileInfo
+ * @param hash
+ */
+void AddFileFingerprint(const QFileInfo& fileInfo, QCryptographicHash& hash)
+{
+  hash.addData(fileInfo.absoluteFilePath().toUtf8());
+  hash.addData(QByteArray::number(fileInfo.size()));
+  hash.addData(QByteArray::number(fileInfo.lastModified().toMSecsSinceEpoch()));
+}
+
+/**
+ * @brief Adds a fingerprint of every file or directory path found in the JSON value to the hash. Relative
+ * paths are resolved against the working directory the same way the filters open them, so the fingerprint
+ * follows the file that is actually read. For a directory, such as the input directory of an image stack,
+ * the files directly inside it are used.
+ * @param value
+ * @param hash
+ */
+void AddPathFingerprints(const QJsonValue& value, QCryptographicHash& hash)
+{
+  if(value.isObject())
+  {
+    const QJsonObject object = value.toObject();
+    for(auto iter = object.begin(); iter != object.end(); ++iter)
+    {
+      AddPathFingerprints(iter.value(), hash);
+    }
+  }
+  else if(value.isArray())
+  {
+    for(const QJsonValue& item : value.toArray())
+    {
+      AddPathFingerprints(item, hash);
+    }
+  }
+  else if(value.isString())
+  {
+    const QString path = value.toString();
+    if(path.isEmpty())
+    {
+      return;
+    }
+    // Any other string that happens to name an existing file only adds a harmless fingerprint
+    QFileInfo fileInfo(QDir::current().absoluteFilePath(path));
+    if(fileInfo.isFile())
+    {
+      AddFileFingerprint(fileInfo, hash);
+    }
+    else if(fileInfo.isDir())
+    {
+      for(const QFileInfo& entry : QDir(fileInfo.absoluteFilePath()).entryInfoList(QDir::Files, QDir::Name))
+      {
+        AddFileFingerprint(entry, hash);
+      }
+    }
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineResultCache::PipelineResultCache() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineResultCache::~PipelineResultCache() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineResultCache::setCacheDirectory(const QString& path)
+{
+  m_CacheDirectory = path;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineResultCache::getCacheDirectory() const
+{
+  return m_CacheDirectory;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineResultCache::setMaximumSize(int64_t bytes)
+{
+  m_MaximumSize = bytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t PipelineResultCache::getMaximumSize() const
+{
+  return m_MaximumSize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineResultCache::setMinimumExecutionTime(int64_t milliseconds)
+{
+  m_MinimumExecutionTime = milliseconds;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t PipelineResultCache::getMinimumExecutionTime() const
+{
+  return m_MinimumExecutionTime;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray PipelineResultCache::ComputeKey(const QByteArray& previousKey, const AbstractFilter* filter)
+{
+  QCryptographicHash hash(QCryptographicHash::Sha256);
+  hash.addData(previousKey);
+  // Entries written by another version of SIMPL may not be readable or may hold different results
+  hash.addData(SIMPLib::Version::Complete().toUtf8());
+  hash.addData(filter->getUuid().toByteArray());
+  hash.addData(filter->getFilterVersion().toUtf8());
+  hash.addData(filter->getCompiledLibraryName().toUtf8());
+
+  QJsonObject parameters;
+  filter->writeFilterParameters(parameters);
+  hash.addData(QJsonDocument(parameters).toJson(QJsonDocument::Compact));
+  AddPathFingerprints(parameters, hash);
+
+  return hash.result().toHex();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineResultCache::entryFilePath(const QByteArray& key) const
+{
+  return QDir(m_CacheDirectory).absoluteFilePath(QString::fromLatin1(key) + "." + k_EntrySuffix);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineResultCache::contains(const QByteArray& key) const
+{
+  return !m_CacheDirectory.isEmpty() && QFileInfo(entryFilePath(key)).isFile();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer PipelineResultCache::restore(const QByteArray& key)
+{
+  if(!contains(key))
+  {
+    return DataContainerArray::NullPointer();
+  }
+  const QString filePath = entryFilePath(key);
+
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  DataContainerReader::Pointer reader = DataContainerReader::New();
+  reader->setDataContainerArray(dca);
+  reader->setInputFile(filePath);
+  reader->setInputFileDataContainerArrayProxy(reader->readDataContainerArrayStructure(filePath));
+  reader->execute();
+  if(reader->getErrorCode() < 0)
+  {
+    // An unreadable entry is of no use to anyone
+    QFile::remove(filePath);
+    return DataContainerArray::NullPointer();
+  }
+
+  // The modification time records when the entry was last used
+  QFile file(filePath);
+  if(file.open(QIODevice::ReadWrite))
+  {
+    file.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+  }
+  return dca;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineResultCache::store(const QByteArray& key, const DataContainerArray::Pointer& dca)
+{
+  if(m_CacheDirectory.isEmpty() || nullptr == dca.get() || !QDir().mkpath(m_CacheDirectory))
+  {
+    return false;
+  }
+
+  // Write under a temporary name so an interrupted write never looks like a valid entry
+  const QString filePath = entryFilePath(key);
+  const QString tempFilePath = filePath + ".tmp";
+  DataContainerWriter::Pointer writer = DataContainerWriter::New();
+  writer->setDataContainerArray(dca);
+  writer->setOutputFile(tempFilePath);
+  writer->setWriteXdmfFile(false);
+  writer->setWritePipeline(false);
+  writer->execute();
+  if(writer->getErrorCode() < 0)
+  {
+    QFile::remove(tempFilePath);
+    return false;
+  }
+
+  QFile::remove(filePath);
+  if(!QFile::rename(tempFilePath, filePath))
+  {
+    QFile::remove(tempFilePath);
+    return false;
+  }
+
+  evict();
+  return contains(key);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineResultCache::evict()
+{
+  if(m_CacheDirectory.isEmpty())
+  {
+    return;
+  }
+
+  // Least recently used entries first
+  QFileInfoList entries = QDir(m_CacheDirectory).entryInfoList(QStringList() << ("*." + k_EntrySuffix), QDir::Files, QDir::Time | QDir::Reversed);
+  int64_t cacheSize = 0;
+  for(const QFileInfo& entry : entries)
+  {
+    cacheSize += entry.size();
+  }
+  for(const QFileInfo& entry : entries)
+  {
+    if(cacheSize <= m_MaximumSize)
+    {
+      break;
+    }
+    if(QFile::remove(entry.absoluteFilePath()))
+    {
+      cacheSize -= entry.size();
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineResultCache::clear()
+{
+  if(m_CacheDirectory.isEmpty())
+  {
+    return;
+  }
+  for(const QFileInfo& entry : QDir(m_CacheDirectory).entryInfoList(QStringList() << ("*." + k_EntrySuffix), QDir::Files))
+  {
+    QFile::remove(entry.absoluteFilePath());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t PipelineResultCache::getCacheSize() const
+{
+  int64_t cacheSize = 0;
+  if(m_CacheDirectory.isEmpty())
+  {
+    return cacheSize;
+  }
+  for(const QFileInfo& entry : QDir(m_CacheDirectory).entryInfoList(QStringList() << ("*." + k_EntrySuffix), QDir::Files))
+  {
+    cacheSize += entry.size();
+  }
+  return cacheSize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineResultCache::Pointer PipelineResultCache::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineResultCache::Pointer PipelineResultCache::New()
+{
+  Pointer sharedPtr(new(PipelineResultCache));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineResultCache::getNameOfClass() const
+{
+  return QString("PipelineResultCache");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineResultCache::ClassName()
+{
+  return QString("PipelineResultCache");
+}
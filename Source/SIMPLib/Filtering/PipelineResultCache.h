@@ -0,0 +1,184 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+
+class AbstractFilter;
+class DataContainerArray;
+
+/**
+ * @brief The PipelineResultCache class stores the DataContainerArray produced by a prefix of a pipeline in a
+ * directory on disk so a later execution of a pipeline with the same prefix can restore it instead of running
+ * those filters again. Attach one with FilterPipeline::setResultCache() before calling execute().
+ *
+ * Entries are addressed by a chained key: the key of a filter hashes the key of the previous enabled filter
+ * together with the filter's UUID, version, library and JSON parameters, and with the size and modification
+ * time of every file or directory named in those parameters. Changing a filter or one of the files it reads
+ * therefore changes its key and the keys of every filter after it.
+ *
+ * Each entry is a .dream3d file. When the directory grows beyond the maximum size the least recently used
+ * entries are removed; restoring an entry marks it as used.
+ */
+class SIMPLib_EXPORT PipelineResultCache
+{
+public:
+  using Self = PipelineResultCache;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  static Pointer NullPointer();
+
+  static Pointer New();
+
+  /**
+   * @brief Returns the name of the class for PipelineResultCache
+   */
+  QString getNameOfClass() const;
+  /**
+   * @brief Returns the name of the class for PipelineResultCache
+   */
+  static QString ClassName();
+
+  virtual ~PipelineResultCache();
+
+  /**
+   * @brief Sets the directory the entries are stored in. It is created when the first entry is stored.
+   * @param path
+   */
+  void setCacheDirectory(const QString& path);
+
+  /**
+   * @brief Returns the directory the entries are stored in
+   * @return
+   */
+  QString getCacheDirectory() const;
+
+  /**
+   * @brief Sets the number of bytes the entries may use before the least recently used ones are removed
+   * @param bytes
+   */
+  void setMaximumSize(int64_t bytes);
+
+  /**
+   * @brief Returns the number of bytes the entries may use
+   * @return
+   */
+  int64_t getMaximumSize() const;
+
+  /**
+   * @brief Sets how long a filter has to run, in milliseconds, before the state after it is stored. Storing
+   * the state after quick filters costs more than running them again.
+   * @param milliseconds
+   */
+  void setMinimumExecutionTime(int64_t milliseconds);
+
+  /**
+   * @brief Returns how long a filter has to run before the state after it is stored
+   * @return
+   */
+  int64_t getMinimumExecutionTime() const;
+
+  /**
+   * @brief Computes the key of a filter from the key of the previous enabled filter. Pass an empty key for
+   * the first filter of a pipeline.
+   * @param previousKey
+   * @param filter
+   * @return
+   */
+  static QByteArray ComputeKey(const QByteArray& previousKey, const AbstractFilter* filter);
+
+  /**
+   * @brief Returns true if there is an entry for the key
+   * @param key
+   * @return
+   */
+  bool contains(const QByteArray& key) const;
+
+  /**
+   * @brief Reads the entry for the key and marks it as used
+   * @param key
+   * @return The stored DataContainerArray or a null pointer if there is no readable entry
+   */
+  std::shared_ptr<DataContainerArray> restore(const QByteArray& key);
+
+  /**
+   * @brief Stores the DataContainerArray under the key and removes the least recently used entries that no
+   * longer fit
+   * @param key
+   * @param dca
+   * @return True if the entry was written
+   */
+  bool store(const QByteArray& key, const std::shared_ptr<DataContainerArray>& dca);
+
+  /**
+   * @brief Removes the least recently used entries until the remaining ones fit in the maximum size
+   */
+  void evict();
+
+  /**
+   * @brief Removes every entry
+   */
+  void clear();
+
+  /**
+   * @brief Returns the number of bytes used by the entries
+   * @return
+   */
+  int64_t getCacheSize() const;
+
+protected:
+  PipelineResultCache();
+
+private:
+  QString m_CacheDirectory;
+  int64_t m_MaximumSize = 10LL * 1024 * 1024 * 1024;
+  int64_t m_MinimumExecutionTime = 1000;
+
+  /**
+   * @brief Returns the file that holds the entry for the key
+   * @param key
+   * @return
+   */
+  QString entryFilePath(const QByteArray& key) const;
+
+public:
+  PipelineResultCache(const PipelineResultCache&) = delete;            // Copy Constructor Not Implemented
+  PipelineResultCache(PipelineResultCache&&) = delete;                 // Move Constructor Not Implemented
+  PipelineResultCache& operator=(const PipelineResultCache&) = delete; // Copy Assignment Not Implemented
+  PipelineResultCache& operator=(PipelineResultCache&&) = delete;      // Move Assignment Not Implemented
+};
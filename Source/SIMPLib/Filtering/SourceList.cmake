@@ -27,6 +27,10 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FilterFactory.hpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FilterManager.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IFilterFactory.hpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineDependencyGraph.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineMemoryPlanner.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineProfiler.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineResultCache.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/QMetaObjectUtilities.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ThresholdFilterHelper.h
 )
@@ -44,6 +48,10 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/CorePlugin.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FilterManager.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FilterPipeline.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineDependencyGraph.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineMemoryPlanner.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineProfiler.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineResultCache.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/QMetaObjectUtilities.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ThresholdFilterHelper.cpp
 )
@@ -33,7 +33,15 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
 #include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
 
 //#include "Applications/DREAM3D/DREAM3DApplication.h"
 
@@ -51,10 +59,77 @@
 #include "SIMPLib/TestFilters/ThresholdExample.h"
 #endif
 
+#include "SIMPLib/CoreFilters/CopyObject.h"
+#include "SIMPLib/CoreFilters/CreateAttributeMatrix.h"
+#include "SIMPLib/CoreFilters/CreateDataArray.h"
+#include "SIMPLib/CoreFilters/CreateDataContainer.h"
+#include "SIMPLib/CoreFilters/DataContainerReader.h"
+#include "SIMPLib/CoreFilters/DataContainerWriter.h"
+#include "SIMPLib/CoreFilters/ExecuteProcess.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/FilterParameters/DynamicTableData.h"
+#include "SIMPLib/Filtering/PipelineDependencyGraph.h"
+#include "SIMPLib/Filtering/PipelineMemoryPlanner.h"
+#include "SIMPLib/Filtering/PipelineProfiler.h"
+#include "SIMPLib/Filtering/PipelineResultCache.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
 #include "SIMPLib/Testing/UnitTestSupport.hpp"
 
+/**
+ * @brief Records the text of every message a pipeline reports
+ */
+class MessageRecorder : public Observer
+{
+public:
+  void processPipelineMessage(const AbstractMessage::Pointer& pm) override
+  {
+    m_Messages.push_back(pm->generateMessageString());
+  }
+
+  std::vector<QString> m_Messages;
+};
+
+/**
+ * @brief Fails during execution after a delay without touching the DataContainerArray, so the filters after
+ * it run ahead when the pipeline executes concurrently
+ */
+class DelayedFailureFilter : public AbstractFilter
+{
+public:
+  static std::shared_ptr<DelayedFailureFilter> New()
+  {
+    return std::shared_ptr<DelayedFailureFilter>(new DelayedFailureFilter());
+  }
+
+  QString getNameOfClass() const override
+  {
+    return QString("DelayedFailureFilter");
+  }
+
+  QUuid getUuid() const override
+  {
+    return QUuid("{4c1b3f0e-7d2a-4a8e-9f61-2b5d8c3e9a10}");
+  }
+
+  void execute() override
+  {
+    clearErrorCode();
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    setErrorCondition(-1000, "The filter failed on purpose");
+  }
+
+protected:
+  DelayedFailureFilter() = default;
+
+  void dataCheck() override
+  {
+    clearErrorCode();
+    clearWarningCode();
+  }
+};
+
 class FilterPipelineTest
 {
 public:
@@ -84,6 +159,15 @@ public:
   {
     return UnitTest::TestTempDir + QString("/FilterPipelineTest.dream3d");
   }
+  QString outputCacheDirectory()
+  {
+    return UnitTest::TestTempDir + QString("/FilterPipelineTestCache");
+  }
+
+  QString relativeInputFile()
+  {
+    return UnitTest::TestTempDir + QString("/FilterPipelineTestRelativeInput.txt");
+  }
 
   // -----------------------------------------------------------------------------
   //
@@ -92,6 +176,8 @@ public:
   {
 #if REMOVE_TEST_FILES
     QFile::remove(outputDREAM3DFile());
+    QDir(outputCacheDirectory()).removeRecursively();
+    QFile::remove(relativeInputFile());
 #endif
   }
 
@@ -151,6 +237,530 @@ public:
 #endif
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPipelineProfiler()
+  {
+    const QString dcName("ProfiledDataContainer");
+    const QString amName("CellData");
+
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    CreateDataContainer::Pointer createDc = CreateDataContainer::New();
+    createDc->setDataContainerName(DataArrayPath(dcName, "", ""));
+    pipeline->pushBack(createDc);
+
+    CreateAttributeMatrix::Pointer createAm = CreateAttributeMatrix::New();
+    createAm->setCreatedAttributeMatrix(DataArrayPath(dcName, amName, ""));
+    createAm->setAttributeMatrixType(static_cast<int>(AttributeMatrix::Type::Cell));
+    createAm->setTupleDimensions(DynamicTableData(std::vector<std::vector<double>>(1, {10.0, 2.0, 1.0})));
+    pipeline->pushBack(createAm);
+
+    for(int32_t numComps = 1; numComps <= 2; numComps++)
+    {
+      CreateDataArray::Pointer createArray = CreateDataArray::New();
+      createArray->setScalarType(SIMPL::ScalarTypes::Type::Float);
+      createArray->setNumberOfComponents(numComps);
+      createArray->setNewArray(DataArrayPath(dcName, amName, QString("Array%1").arg(numComps)));
+      createArray->setInitializationValue("1");
+      pipeline->pushBack(createArray);
+    }
+
+    // Without a profiler nothing is recorded
+    DREAM3D_REQUIRE(pipeline->getProfiler().get() == nullptr)
+
+    PipelineProfiler::Pointer profiler = PipelineProfiler::New();
+    pipeline->setProfiler(profiler);
+    DREAM3D_REQUIRE_EQUAL(pipeline->preflightPipeline(), 0)
+    pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+
+    std::vector<PipelineProfiler::FilterRecord> records = profiler->getFilterRecords();
+    DREAM3D_REQUIRE_EQUAL(records.size(), 4)
+    for(size_t i = 0; i < records.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(records[i].pipelineIndex, static_cast<int32_t>(i))
+      DREAM3D_REQUIRE_EQUAL(records[i].errorCode, 0)
+      DREAM3D_REQUIRE(records[i].wallNs >= 0)
+      DREAM3D_REQUIRE(records[i].startNs + records[i].wallNs <= profiler->getPipelineWallTime())
+    }
+    DREAM3D_REQUIRE_EQUAL(records[0].className, QString("CreateDataContainer"))
+    DREAM3D_REQUIRE_EQUAL(records[0].arraysCreated, 0)
+    DREAM3D_REQUIRE_EQUAL(records[2].arraysCreated, 1)
+    DREAM3D_REQUIRE_EQUAL(records[2].arrayBytesDelta, static_cast<int64_t>(20 * sizeof(float)))
+    DREAM3D_REQUIRE_EQUAL(records[3].arraysCreated, 1)
+    DREAM3D_REQUIRE_EQUAL(records[3].arraysRemoved, 0)
+    DREAM3D_REQUIRE_EQUAL(records[3].arrayBytesDelta, static_cast<int64_t>(40 * sizeof(float)))
+
+    QJsonObject summary = profiler->toJson();
+    DREAM3D_REQUIRE_EQUAL(summary["Filters"].toArray().size(), 4)
+    // Process name, pipeline, and one slice plus one memory counter per filter
+    QJsonObject trace = profiler->toChromeTrace();
+    DREAM3D_REQUIRE_EQUAL(trace["traceEvents"].toArray().size(), 2 + 2 * 4)
+
+    // Parallel algorithms run while a filter is being profiled are recorded as its regions
+    profiler->beginPipeline("Regions");
+    profiler->beginFilter(createDc.get(), nullptr);
+    std::vector<int32_t> values(1000, 0);
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, values.size());
+    dataAlg.execute([&values](const SIMPLRange& range) {
+      for(size_t i = range.min(); i < range.max(); i++)
+      {
+        values[i] = 1;
+      }
+    });
+    profiler->endFilter(createDc.get(), nullptr);
+    profiler->endPipeline();
+
+    std::vector<PipelineProfiler::RegionRecord> regions = profiler->getRegionRecords();
+    DREAM3D_REQUIRE_EQUAL(regions.size(), 1)
+    DREAM3D_REQUIRE_EQUAL(regions[0].name, QString("ParallelDataAlgorithm"))
+    DREAM3D_REQUIRE_EQUAL(regions[0].rangeSize, values.size())
+    DREAM3D_REQUIRE_EQUAL(regions[0].filterIndex, createDc->getPipelineIndex())
+
+    // Once the pipeline has ended, parallel algorithms are no longer recorded
+    dataAlg.execute([](const SIMPLRange&) {});
+    DREAM3D_REQUIRE_EQUAL(profiler->getRegionRecords().size(), 1)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FilterPipeline::Pointer CreateLivenessPipeline(const QString& dcName, const QString& amName)
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    CreateDataContainer::Pointer createDc = CreateDataContainer::New();
+    createDc->setDataContainerName(DataArrayPath(dcName, "", ""));
+    pipeline->pushBack(createDc);
+
+    CreateAttributeMatrix::Pointer createAm = CreateAttributeMatrix::New();
+    createAm->setCreatedAttributeMatrix(DataArrayPath(dcName, amName, ""));
+    createAm->setAttributeMatrixType(static_cast<int>(AttributeMatrix::Type::Cell));
+    createAm->setTupleDimensions(DynamicTableData(std::vector<std::vector<double>>(1, {10.0, 2.0, 1.0})));
+    pipeline->pushBack(createAm);
+
+    for(int32_t i = 1; i <= 3; i++)
+    {
+      CreateDataArray::Pointer createArray = CreateDataArray::New();
+      createArray->setScalarType(SIMPL::ScalarTypes::Type::Int32);
+      createArray->setNumberOfComponents(1);
+      createArray->setNewArray(DataArrayPath(dcName, amName, QString("Array%1").arg(i)));
+      createArray->setInitializationValue("1");
+      pipeline->pushBack(createArray);
+    }
+
+    // Array1 is read by this filter and must still be present when it runs
+    CopyObject::Pointer copyArray = CopyObject::New();
+    copyArray->setObjectToCopy(2);
+    copyArray->setAttributeArrayToCopy(DataArrayPath(dcName, amName, "Array1"));
+    copyArray->setCopiedObjectName("Array1Copy");
+    pipeline->pushBack(copyArray);
+
+    CreateDataArray::Pointer createLast = CreateDataArray::New();
+    createLast->setScalarType(SIMPL::ScalarTypes::Type::Int32);
+    createLast->setNumberOfComponents(1);
+    createLast->setNewArray(DataArrayPath(dcName, amName, "Array4"));
+    createLast->setInitializationValue("1");
+    pipeline->pushBack(createLast);
+
+    return pipeline;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestReleaseDeadArrays()
+  {
+    const QString dcName("LivenessDataContainer");
+    const QString amName("CellData");
+
+    // Nothing is released unless asked for
+    FilterPipeline::Pointer pipeline = CreateLivenessPipeline(dcName, amName);
+    DREAM3D_REQUIRE_EQUAL(pipeline->getReleaseDeadArrays(), false)
+    DREAM3D_REQUIRE_EQUAL(pipeline->preflightPipeline(), 0)
+    DataContainerArray::Pointer dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+    AttributeMatrix::Pointer am = dca->getAttributeMatrix(DataArrayPath(dcName, amName, ""));
+    DREAM3D_REQUIRE_VALID_POINTER(am.get())
+    DREAM3D_REQUIRE_EQUAL(am->getNumAttributeArrays(), 5)
+
+    // The consumer of Array1 still runs and every array without a later consumer is released
+    pipeline = CreateLivenessPipeline(dcName, amName);
+    pipeline->setReleaseDeadArrays(true);
+    pipeline->setPinnedPaths({DataArrayPath(dcName, amName, "Array2")});
+    DREAM3D_REQUIRE_EQUAL(pipeline->preflightPipeline(), 0)
+    dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+    am = dca->getAttributeMatrix(DataArrayPath(dcName, amName, ""));
+    DREAM3D_REQUIRE_VALID_POINTER(am.get())
+    DREAM3D_REQUIRE_EQUAL(am->getNumAttributeArrays(), 1)
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("Array2"), true)
+
+    // Pinning the AttributeMatrix keeps every array below it
+    pipeline = CreateLivenessPipeline(dcName, amName);
+    pipeline->setReleaseDeadArrays(true);
+    pipeline->setPinnedPaths({DataArrayPath(dcName, amName, "")});
+    dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+    am = dca->getAttributeMatrix(DataArrayPath(dcName, amName, ""));
+    DREAM3D_REQUIRE_EQUAL(am->getNumAttributeArrays(), 5)
+
+    // A consumer that names only the AttributeMatrix keeps all of its arrays alive until it runs
+    CopyObject::Pointer copyAm = CopyObject::New();
+    copyAm->setAttributeMatrixToCopy(DataArrayPath(dcName, amName, ""));
+    std::list<DataArrayPath> consumed = copyAm->getConsumedPaths();
+    DREAM3D_REQUIRE_EQUAL(consumed.size(), 1)
+    DREAM3D_REQUIRE(consumed.front() == DataArrayPath(dcName, amName, ""))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FilterPipeline::Pointer CreateBranchingPipeline(const QString& dcName)
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    CreateDataContainer::Pointer createDc = CreateDataContainer::New();
+    createDc->setDataContainerName(DataArrayPath(dcName, "", ""));
+    pipeline->pushBack(createDc);
+
+    for(const QString& amName : {QString("A"), QString("B")})
+    {
+      CreateAttributeMatrix::Pointer createAm = CreateAttributeMatrix::New();
+      createAm->setCreatedAttributeMatrix(DataArrayPath(dcName, amName, ""));
+      createAm->setAttributeMatrixType(static_cast<int>(AttributeMatrix::Type::Cell));
+      createAm->setTupleDimensions(DynamicTableData(std::vector<std::vector<double>>(1, {1000.0, 1.0, 1.0})));
+      pipeline->pushBack(createAm);
+    }
+
+    const std::vector<DataArrayPath> newArrays = {DataArrayPath(dcName, "A", "X"), DataArrayPath(dcName, "B", "Y"), DataArrayPath(dcName, "A", "Z")};
+    for(const DataArrayPath& newArray : newArrays)
+    {
+      CreateDataArray::Pointer createArray = CreateDataArray::New();
+      createArray->setScalarType(SIMPL::ScalarTypes::Type::Float);
+      createArray->setNumberOfComponents(3);
+      createArray->setNewArray(newArray);
+      createArray->setInitializationValue("2");
+      pipeline->pushBack(createArray);
+    }
+
+    CopyObject::Pointer copyArray = CopyObject::New();
+    copyArray->setObjectToCopy(2);
+    copyArray->setAttributeArrayToCopy(DataArrayPath(dcName, "B", "Y"));
+    copyArray->setCopiedObjectName("YCopy");
+    pipeline->pushBack(copyArray);
+
+    return pipeline;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDependencyGraph()
+  {
+    DREAM3D_REQUIRE(PipelineDependencyGraph::PathsOverlap(DataArrayPath("DC", "A", "X"), DataArrayPath("DC", "A", "")))
+    DREAM3D_REQUIRE(PipelineDependencyGraph::PathsOverlap(DataArrayPath("DC", "A", "X"), DataArrayPath()))
+    DREAM3D_REQUIRE(!PipelineDependencyGraph::PathsOverlap(DataArrayPath("DC", "A", "X"), DataArrayPath("DC", "A", "Y")))
+    DREAM3D_REQUIRE(!PipelineDependencyGraph::PathsOverlap(DataArrayPath("DC", "A", ""), DataArrayPath("DC", "B", "Y")))
+
+    FilterPipeline::Pointer pipeline = CreateBranchingPipeline("GraphDataContainer");
+    DREAM3D_REQUIRE_EQUAL(pipeline->preflightPipeline(), 0)
+    PipelineDependencyGraph graph(pipeline->getFilterContainer());
+    DREAM3D_REQUIRE_EQUAL(graph.size(), 7)
+    DREAM3D_REQUIRE(graph.getDependencies(0).empty())
+    // Creating the AttributeMatrices modifies the DataContainer that every later filter works in
+    DREAM3D_REQUIRE(graph.getDependencies(3) == std::vector<size_t>({0, 1, 2}))
+    DREAM3D_REQUIRE(graph.getDependencies(4) == std::vector<size_t>({0, 1, 2}))
+    DREAM3D_REQUIRE(graph.getDependencies(5) == std::vector<size_t>({0, 1, 2, 3}))
+    DREAM3D_REQUIRE(graph.getDependencies(6) == std::vector<size_t>({0, 1, 2, 4}))
+
+    // Disabled filters take no part in the graph
+    pipeline->getFilterContainer()[5]->setEnabled(false);
+    DREAM3D_REQUIRE_EQUAL(pipeline->preflightPipeline(), 0)
+    PipelineDependencyGraph disabledGraph(pipeline->getFilterContainer());
+    DREAM3D_REQUIRE(disabledGraph.getDependencies(5).empty())
+    DREAM3D_REQUIRE(disabledGraph.getDependencies(6) == std::vector<size_t>({0, 1, 2, 4}))
+
+    // Executing clears the preflight results so every filter is assumed to touch everything
+    pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+    PipelineDependencyGraph executedGraph(pipeline->getFilterContainer());
+    DREAM3D_REQUIRE(executedGraph.getDependencies(4) == std::vector<size_t>({0, 1, 2, 3}))
+    DREAM3D_REQUIRE(executedGraph.getDependencies(6) == std::vector<size_t>({0, 1, 2, 3, 4}))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::vector<QString> ExecuteBranchingPipeline(bool concurrent, DataContainerArray::Pointer& dca)
+  {
+    FilterPipeline::Pointer pipeline = CreateBranchingPipeline("ConcurrentDataContainer");
+    pipeline->setConcurrentExecution(concurrent);
+    pipeline->setMaxThreads(4);
+    DREAM3D_REQUIRE_EQUAL(pipeline->preflightPipeline(), 0)
+
+    MessageRecorder recorder;
+    pipeline->addMessageReceiver(&recorder);
+    dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+    DREAM3D_REQUIRE(pipeline->getExecutionResult() == FilterPipeline::ExecutionResult::Completed)
+
+    // The start and end messages carry the time of day
+    std::vector<QString> messages;
+    for(const QString& message : recorder.m_Messages)
+    {
+      if(!message.contains("Pipline Start") && !message.contains("Pipline End"))
+      {
+        messages.push_back(message);
+      }
+    }
+    return messages;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestConcurrentExecution()
+  {
+    DataContainerArray::Pointer sequentialDca;
+    std::vector<QString> sequentialMessages = ExecuteBranchingPipeline(false, sequentialDca);
+    DataContainerArray::Pointer concurrentDca;
+    std::vector<QString> concurrentMessages = ExecuteBranchingPipeline(true, concurrentDca);
+
+    DREAM3D_REQUIRE(!sequentialMessages.empty())
+    DREAM3D_REQUIRE_EQUAL(sequentialMessages.size(), concurrentMessages.size())
+    for(size_t i = 0; i < sequentialMessages.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(sequentialMessages[i], concurrentMessages[i])
+    }
+
+    for(const QString& arrayPath : {QString("A|X"), QString("A|Z"), QString("B|Y"), QString("B|YCopy")})
+    {
+      DataArrayPath path("ConcurrentDataContainer|" + arrayPath);
+      FloatArrayType::Pointer sequentialArray = sequentialDca->getPrereqArrayFromPath<FloatArrayType>(nullptr, path, {3});
+      FloatArrayType::Pointer concurrentArray = concurrentDca->getPrereqArrayFromPath<FloatArrayType>(nullptr, path, {3});
+      DREAM3D_REQUIRE_VALID_POINTER(sequentialArray.get())
+      DREAM3D_REQUIRE_VALID_POINTER(concurrentArray.get())
+      DREAM3D_REQUIRE_EQUAL(sequentialArray->getSize(), concurrentArray->getSize())
+      DREAM3D_REQUIRE(std::equal(sequentialArray->begin(), sequentialArray->end(), concurrentArray->begin()))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer ExecuteFailingPipeline(bool concurrent)
+  {
+    const QString dcName("FailingDataContainer");
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    CreateDataContainer::Pointer createDc = CreateDataContainer::New();
+    createDc->setDataContainerName(DataArrayPath(dcName, "", ""));
+    pipeline->pushBack(createDc);
+    CreateAttributeMatrix::Pointer createAm = CreateAttributeMatrix::New();
+    createAm->setCreatedAttributeMatrix(DataArrayPath(dcName, "A", ""));
+    createAm->setAttributeMatrixType(static_cast<int>(AttributeMatrix::Type::Cell));
+    createAm->setTupleDimensions(DynamicTableData(std::vector<std::vector<double>>(1, {1000.0, 1.0, 1.0})));
+    pipeline->pushBack(createAm);
+    pipeline->pushBack(DelayedFailureFilter::New());
+    for(const QString& arrayName : {QString("X"), QString("Y")})
+    {
+      CreateDataArray::Pointer createArray = CreateDataArray::New();
+      createArray->setScalarType(SIMPL::ScalarTypes::Type::Float);
+      createArray->setNumberOfComponents(1);
+      createArray->setNewArray(DataArrayPath(dcName, "A", arrayName));
+      createArray->setInitializationValue("2");
+      pipeline->pushBack(createArray);
+    }
+    pipeline->setConcurrentExecution(concurrent);
+    pipeline->setMaxThreads(4);
+    DREAM3D_REQUIRE_EQUAL(pipeline->preflightPipeline(), 0)
+
+    DataContainerArray::Pointer dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), -1000)
+    DREAM3D_REQUIRE(dca->doesAttributeMatrixExist(DataArrayPath(dcName, "A", "")))
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestConcurrentExecutionFailure()
+  {
+    // The arrays are independent of the failing filter but a sequential execution never creates them
+    for(bool concurrent : {false, true})
+    {
+      DataContainerArray::Pointer dca = ExecuteFailingPipeline(concurrent);
+      AttributeMatrix::Pointer am = dca->getAttributeMatrix(DataArrayPath("FailingDataContainer", "A", ""));
+      DREAM3D_REQUIRE_EQUAL(am->getNumAttributeArrays(), 0)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::vector<QString> ExecuteCachedPipeline(const FilterPipeline::Pointer& pipeline, const PipelineResultCache::Pointer& cache, DataContainerArray::Pointer& dca)
+  {
+    pipeline->setResultCache(cache);
+    DREAM3D_REQUIRE_EQUAL(pipeline->preflightPipeline(), 0)
+    MessageRecorder recorder;
+    pipeline->addMessageReceiver(&recorder);
+    dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+    return recorder.m_Messages;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestResultCache()
+  {
+    const QString dcName("CacheDataContainer");
+    QDir(outputCacheDirectory()).removeRecursively();
+    PipelineResultCache::Pointer cache = PipelineResultCache::New();
+    cache->setCacheDirectory(outputCacheDirectory());
+    cache->setMinimumExecutionTime(0);
+    DREAM3D_REQUIRE_EQUAL(cache->getCacheSize(), 0)
+
+    // The first run stores the state after every filter
+    FilterPipeline::Pointer pipeline = CreateBranchingPipeline(dcName);
+    DataContainerArray::Pointer firstDca;
+    std::vector<QString> messages = ExecuteCachedPipeline(pipeline, cache, firstDca);
+    std::vector<QByteArray> keys;
+    QByteArray previousKey;
+    for(const auto& filter : pipeline->getFilterContainer())
+    {
+      previousKey = PipelineResultCache::ComputeKey(previousKey, filter.get());
+      DREAM3D_REQUIRE(cache->contains(previousKey))
+      keys.push_back(previousKey);
+    }
+    DREAM3D_REQUIRE(cache->getCacheSize() > 0)
+    DREAM3D_REQUIRE(std::none_of(messages.begin(), messages.end(), [](const QString& message) { return message.contains("result cache"); }))
+
+    // An identical pipeline restores everything
+    DataContainerArray::Pointer cachedDca;
+    messages = ExecuteCachedPipeline(CreateBranchingPipeline(dcName), cache, cachedDca);
+    DREAM3D_REQUIRE(std::any_of(messages.begin(), messages.end(), [](const QString& message) { return message.contains("filters 1 to 7 from the result cache"); }))
+    for(const QString& arrayPath : {QString("A|X"), QString("A|Z"), QString("B|Y"), QString("B|YCopy")})
+    {
+      DataArrayPath path(dcName + "|" + arrayPath);
+      FloatArrayType::Pointer firstArray = firstDca->getPrereqArrayFromPath<FloatArrayType>(nullptr, path, {3});
+      FloatArrayType::Pointer cachedArray = cachedDca->getPrereqArrayFromPath<FloatArrayType>(nullptr, path, {3});
+      DREAM3D_REQUIRE_VALID_POINTER(firstArray.get())
+      DREAM3D_REQUIRE_VALID_POINTER(cachedArray.get())
+      DREAM3D_REQUIRE_EQUAL(firstArray->getSize(), cachedArray->getSize())
+      DREAM3D_REQUIRE(std::equal(firstArray->begin(), firstArray->end(), cachedArray->begin()))
+    }
+
+    // Editing the last filter changes its key only, so the state after the sixth filter is restored
+    pipeline = CreateBranchingPipeline(dcName);
+    pipeline->getFilterContainer()[6]->setProperty("CopiedObjectName", "YCopy2");
+    DataContainerArray::Pointer editedDca;
+    messages = ExecuteCachedPipeline(pipeline, cache, editedDca);
+    DREAM3D_REQUIRE(std::any_of(messages.begin(), messages.end(), [](const QString& message) { return message.contains("filters 1 to 6 from the result cache"); }))
+    DREAM3D_REQUIRE(editedDca->doesAttributeArrayExist(DataArrayPath(dcName, "B", "YCopy2")))
+    DREAM3D_REQUIRE(!editedDca->doesAttributeArrayExist(DataArrayPath(dcName, "B", "YCopy")))
+    DREAM3D_REQUIRE(PipelineResultCache::ComputeKey(keys[5], pipeline->getFilterContainer()[6].get()) != keys[6])
+
+    // Only the most recently used entries are kept when the cache is over its size
+    QDir cacheDir(outputCacheDirectory());
+    const QDateTime past = QDateTime::currentDateTime().addDays(-1);
+    for(const QFileInfo& entry : cacheDir.entryInfoList(QDir::Files))
+    {
+      QFile file(entry.absoluteFilePath());
+      DREAM3D_REQUIRE(file.open(QIODevice::ReadWrite))
+      file.setFileTime(past, QFileDevice::FileModificationTime);
+    }
+    DREAM3D_REQUIRE_VALID_POINTER(cache->restore(keys[3]).get())
+    const qint64 keptSize = QFileInfo(cacheDir.absoluteFilePath(QString::fromLatin1(keys[3]) + ".dream3d")).size();
+    cache->setMaximumSize(keptSize);
+    cache->evict();
+    DREAM3D_REQUIRE(cache->contains(keys[3]))
+    DREAM3D_REQUIRE(!cache->contains(keys[2]))
+    DREAM3D_REQUIRE(!cache->contains(keys[6]))
+    DREAM3D_REQUIRE_EQUAL(cache->getCacheSize(), keptSize)
+
+    cache->clear();
+    DREAM3D_REQUIRE_EQUAL(cache->getCacheSize(), 0)
+
+    // Only filters that do nothing but change the DataContainerArray are restored
+    DREAM3D_REQUIRE(!CreateDataArray::New()->hasSideEffects())
+    DREAM3D_REQUIRE(DataContainerWriter::New()->hasSideEffects())
+    DREAM3D_REQUIRE(ExecuteProcess::New()->hasSideEffects())
+
+    // A relative path is fingerprinted like the file it refers to
+    QFile inputFile(relativeInputFile());
+    DREAM3D_REQUIRE(inputFile.open(QIODevice::WriteOnly))
+    inputFile.write("1");
+    inputFile.close();
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setInputFile(QDir::current().relativeFilePath(relativeInputFile()));
+    const QByteArray relativeKey = PipelineResultCache::ComputeKey(QByteArray(), reader.get());
+    DREAM3D_REQUIRE(inputFile.open(QIODevice::WriteOnly))
+    inputFile.write("12");
+    inputFile.close();
+    DREAM3D_REQUIRE(PipelineResultCache::ComputeKey(QByteArray(), reader.get()) != relativeKey)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMemoryPlanner()
+  {
+    const QString dcName("MemoryDataContainer");
+    FilterPipeline::Pointer pipeline = CreateBranchingPipeline(dcName);
+
+    // Nothing can be predicted before the pipeline is preflighted
+    PipelineMemoryPlanner::Pointer planner = PipelineMemoryPlanner::New();
+    pipeline->getFilterContainer()[0]->setDataContainerArray(DataContainerArray::NullPointer());
+    DREAM3D_REQUIRE(!planner->plan(pipeline->getFilterContainer()))
+
+    DREAM3D_REQUIRE_EQUAL(pipeline->preflightPipeline(), 0)
+    DREAM3D_REQUIRE(planner->plan(pipeline->getFilterContainer()))
+
+    // Each float array holds 1000 tuples of 3 components
+    const int64_t arrayBytes = 1000 * 3 * sizeof(float);
+    const std::vector<PipelineMemoryPlanner::FilterEstimate>& estimates = planner->getFilterEstimates();
+    DREAM3D_REQUIRE_EQUAL(estimates.size(), 7)
+    const std::vector<int64_t> liveBytes = {0, 0, 0, arrayBytes, 2 * arrayBytes, 3 * arrayBytes, 4 * arrayBytes};
+    for(size_t i = 0; i < estimates.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(estimates[i].pipelineIndex, static_cast<int32_t>(i))
+      DREAM3D_REQUIRE_EQUAL(estimates[i].liveBytes, liveBytes[i])
+      DREAM3D_REQUIRE_EQUAL(estimates[i].releasedBytes, 0)
+    }
+    DREAM3D_REQUIRE_EQUAL(estimates[6].createdBytes, arrayBytes)
+    DREAM3D_REQUIRE_EQUAL(planner->getPeakBytes(), 4 * arrayBytes)
+    DREAM3D_REQUIRE_EQUAL(planner->getPeakFilterIndex(), 6)
+
+    DREAM3D_REQUIRE(!planner->exceedsBudget())
+    planner->setBudget(4 * arrayBytes);
+    DREAM3D_REQUIRE(!planner->exceedsBudget())
+    planner->setBudget(3 * arrayBytes);
+    DREAM3D_REQUIRE(planner->exceedsBudget())
+    DREAM3D_REQUIRE(planner->getSummary().contains("exceeds the budget"))
+    DREAM3D_REQUIRE_EQUAL(planner->toJson()["Filters"].toArray().size(), 7)
+
+    // A disabled filter carries the live bytes of the filter before it
+    pipeline->getFilterContainer()[5]->setEnabled(false);
+    DREAM3D_REQUIRE_EQUAL(pipeline->preflightPipeline(), 0)
+    DREAM3D_REQUIRE(planner->plan(pipeline->getFilterContainer()))
+    DREAM3D_REQUIRE_EQUAL(planner->getFilterEstimates()[5].liveBytes, 2 * arrayBytes)
+    DREAM3D_REQUIRE_EQUAL(planner->getPeakBytes(), 3 * arrayBytes)
+
+    // A budget smaller than the peak only serializes a concurrent execution
+    pipeline->getFilterContainer()[5]->setEnabled(true);
+    pipeline->setConcurrentExecution(true);
+    pipeline->setMaxThreads(4);
+    pipeline->setMemoryBudget(arrayBytes);
+    DREAM3D_REQUIRE_EQUAL(pipeline->preflightPipeline(), 0)
+    DataContainerArray::Pointer dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+    for(const QString& arrayPath : {QString("A|X"), QString("A|Z"), QString("B|Y"), QString("B|YCopy")})
+    {
+      DREAM3D_REQUIRE(dca->doesAttributeArrayExist(DataArrayPath(dcName + "|" + arrayPath)))
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -165,6 +775,13 @@ public:
 #endif
 
     DREAM3D_REGISTER_TEST(TestPipelinePushPop());
+    DREAM3D_REGISTER_TEST(TestPipelineProfiler());
+    DREAM3D_REGISTER_TEST(TestReleaseDeadArrays());
+    DREAM3D_REGISTER_TEST(TestDependencyGraph());
+    DREAM3D_REGISTER_TEST(TestConcurrentExecution());
+    DREAM3D_REGISTER_TEST(TestConcurrentExecutionFailure());
+    DREAM3D_REGISTER_TEST(TestResultCache());
+    DREAM3D_REGISTER_TEST(TestMemoryPlanner());
 
 #if REMOVE_TEST_FILES
 //  DREAM3D_REGISTER_TEST( RemoveTestFiles() );
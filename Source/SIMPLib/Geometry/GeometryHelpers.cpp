@@ -31,6 +31,77 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "GeometryHelpers.h"
 
+#include <limits>
+#include <memory>
+
+#include "SIMPLib/Geometry/EdgeGeom.h"
+#include "SIMPLib/Geometry/HexahedralGeom.h"
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+
+namespace
+{
+constexpr uint32_t k_CurveBits = 21;
+constexpr uint32_t k_MaxCurveCoord = (1u << k_CurveBits) - 1;
+
+/**
+ * @brief Spreads the low 21 bits of a value so there are two zero bits between each of them
+ * @param value
+ * @return
+ */
+uint64_t SpreadBits(uint32_t value)
+{
+  uint64_t x = value & k_MaxCurveCoord;
+  x = (x | x << 32) & 0x1f00000000ffffull;
+  x = (x | x << 16) & 0x1f0000ff0000ffull;
+  x = (x | x << 8) & 0x100f00f00f00f00full;
+  x = (x | x << 4) & 0x10c30c30c30c30c3ull;
+  x = (x | x << 2) & 0x1249249249249249ull;
+  return x;
+}
+
+/**
+ * @brief Gathers the tuples of a DataArray<T> from a copy of its buffer in a single parallel pass
+ * @param array
+ * @param order
+ * @return False if the array is not a DataArray<T>
+ */
+template <typename T>
+bool GatherDataArrayTuples(IDataArray* array, const std::vector<MeshIndexType>& order)
+{
+  auto* dataArray = dynamic_cast<DataArray<T>*>(array);
+  if(nullptr == dataArray)
+  {
+    return false;
+  }
+  const size_t numComps = static_cast<size_t>(dataArray->getNumberOfComponents());
+  T* data = dataArray->getPointer(0);
+  std::unique_ptr<T[]> original(new T[dataArray->getSize()]);
+  std::copy_n(data, dataArray->getSize(), original.get());
+  const T* source = original.get();
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, order.size());
+  dataAlg.execute([data, source, numComps, &order](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      std::copy_n(source + order[i] * numComps, numComps, data + i * numComps);
+    }
+  });
+  return true;
+}
+
+/**
+ * @brief Runs GatherDataArrayTuples for the first of Types that the array is a DataArray of
+ */
+template <typename... Types>
+bool GatherAnyDataArrayTuples(IDataArray* array, const std::vector<MeshIndexType>& order)
+{
+  return (... || GatherDataArrayTuples<Types>(array, order));
+}
+} // namespace
+
 namespace GeometryHelpers
 {
 
@@ -103,4 +174,229 @@ int GeomIO::WriteListToHDF5(hid_t parentId, const IDataArray::Pointer& list)
   return err;
 }
 
+// -----------------------------------------------------------------------------
+uint64_t Reordering::MortonKey(uint32_t x, uint32_t y, uint32_t z)
+{
+  return SpreadBits(x) | (SpreadBits(y) << 1) | (SpreadBits(z) << 2);
+}
+
+// -----------------------------------------------------------------------------
+uint64_t Reordering::HilbertKey(uint32_t x, uint32_t y, uint32_t z)
+{
+  // Skilling's transform ("Programming the Hilbert curve", 2004) turns the axes into the transposed Hilbert index
+  uint32_t axes[3] = {x & k_MaxCurveCoord, y & k_MaxCurveCoord, z & k_MaxCurveCoord};
+  for(uint32_t q = 1u << (k_CurveBits - 1); q > 1; q >>= 1)
+  {
+    uint32_t p = q - 1;
+    for(uint32_t& axis : axes)
+    {
+      if((axis & q) != 0)
+      {
+        axes[0] ^= p;
+      }
+      else
+      {
+        uint32_t t = (axes[0] ^ axis) & p;
+        axes[0] ^= t;
+        axis ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  axes[1] ^= axes[0];
+  axes[2] ^= axes[1];
+  uint32_t t = 0;
+  for(uint32_t q = 1u << (k_CurveBits - 1); q > 1; q >>= 1)
+  {
+    if((axes[2] & q) != 0)
+    {
+      t ^= q - 1;
+    }
+  }
+  for(uint32_t& axis : axes)
+  {
+    axis ^= t;
+  }
+
+  // The first axis holds the most significant bit of each level
+  return (SpreadBits(axes[0]) << 2) | (SpreadBits(axes[1]) << 1) | SpreadBits(axes[2]);
+}
+
+// -----------------------------------------------------------------------------
+std::vector<MeshIndexType> Reordering::SortAlongCurve(const float* coords, size_t numPoints, Curve curve)
+{
+  std::vector<MeshIndexType> order(numPoints);
+  if(numPoints == 0)
+  {
+    return order;
+  }
+
+  float minCoord[3] = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+  float maxCoord[3] = {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+  for(size_t i = 0; i < numPoints; i++)
+  {
+    for(size_t d = 0; d < 3; d++)
+    {
+      minCoord[d] = std::min(minCoord[d], coords[3 * i + d]);
+      maxCoord[d] = std::max(maxCoord[d], coords[3 * i + d]);
+    }
+  }
+  double scale[3] = {0.0, 0.0, 0.0};
+  for(size_t d = 0; d < 3; d++)
+  {
+    double extent = static_cast<double>(maxCoord[d]) - static_cast<double>(minCoord[d]);
+    scale[d] = (extent > 0.0) ? k_MaxCurveCoord / extent : 0.0;
+  }
+
+  // Sorting the index along with the key keeps points that share a key in their original order
+  std::vector<std::pair<uint64_t, MeshIndexType>> keys(numPoints);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numPoints);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      uint32_t cell[3] = {0, 0, 0};
+      for(size_t d = 0; d < 3; d++)
+      {
+        double value = (static_cast<double>(coords[3 * i + d]) - minCoord[d]) * scale[d];
+        // Written so that NaN coordinates land in the first cell
+        cell[d] = (value > 0.0) ? static_cast<uint32_t>(std::min(value, static_cast<double>(k_MaxCurveCoord))) : 0;
+      }
+      uint64_t key = (curve == Curve::Hilbert) ? HilbertKey(cell[0], cell[1], cell[2]) : MortonKey(cell[0], cell[1], cell[2]);
+      keys[i] = std::make_pair(key, static_cast<MeshIndexType>(i));
+    }
+  });
+  std::sort(keys.begin(), keys.end());
+
+  for(size_t i = 0; i < numPoints; i++)
+  {
+    order[i] = keys[i].second;
+  }
+  return order;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<MeshIndexType> Reordering::InvertOrder(const std::vector<MeshIndexType>& order)
+{
+  std::vector<MeshIndexType> inverse(order.size());
+  for(size_t i = 0; i < order.size(); i++)
+  {
+    inverse[order[i]] = static_cast<MeshIndexType>(i);
+  }
+  return inverse;
+}
+
+// -----------------------------------------------------------------------------
+bool Reordering::PermuteTuples(IDataArray* array, const std::vector<MeshIndexType>& order)
+{
+  if(nullptr == array || array->getNumberOfTuples() != order.size())
+  {
+    return false;
+  }
+  if(order.empty())
+  {
+    return true;
+  }
+  if(GatherAnyDataArrayTuples<float, double, int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t, size_t, bool>(array, order))
+  {
+    return true;
+  }
+
+  // Lists, strings and packed bits have no flat buffer so their tuples are copied one at a time
+  IDataArray::Pointer original = array->deepCopy();
+  for(size_t i = 0; i < order.size(); i++)
+  {
+    if(!array->copyFromArray(i, original, order[i], 1))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+bool Reordering::ReorderGeometry(IGeometry* geometry, Curve curve, std::vector<MeshIndexType>& vertexOrder, std::vector<MeshIndexType>& elementOrder)
+{
+  vertexOrder.clear();
+  elementOrder.clear();
+
+  SharedVertexList::Pointer vertices = SharedVertexList::NullPointer();
+  MeshIndexArrayType::Pointer elements = MeshIndexArrayType::NullPointer();
+  if(auto* edgeGeom = dynamic_cast<EdgeGeom*>(geometry))
+  {
+    vertices = edgeGeom->getVertices();
+    elements = edgeGeom->getEdges();
+  }
+  else if(auto* triangleGeom = dynamic_cast<TriangleGeom*>(geometry))
+  {
+    vertices = triangleGeom->getVertices();
+    elements = triangleGeom->getTriangles();
+  }
+  else if(auto* quadGeom = dynamic_cast<QuadGeom*>(geometry))
+  {
+    vertices = quadGeom->getVertices();
+    elements = quadGeom->getQuads();
+  }
+  else if(auto* tetGeom = dynamic_cast<TetrahedralGeom*>(geometry))
+  {
+    vertices = tetGeom->getVertices();
+    elements = tetGeom->getTetrahedra();
+  }
+  else if(auto* hexGeom = dynamic_cast<HexahedralGeom*>(geometry))
+  {
+    vertices = hexGeom->getVertices();
+    elements = hexGeom->getHexahedra();
+  }
+  if(nullptr == vertices.get() || nullptr == elements.get())
+  {
+    return false;
+  }
+
+  // Vertices first so the element centroids below are taken from the final vertex positions
+  vertexOrder = SortAlongCurve(vertices->getPointer(0), vertices->getNumberOfTuples(), curve);
+  if(!PermuteTuples(vertices.get(), vertexOrder))
+  {
+    return false;
+  }
+  const std::vector<MeshIndexType> newVertexIds = InvertOrder(vertexOrder);
+  MeshIndexType* connectivity = elements->getPointer(0);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, elements->getSize());
+  dataAlg.execute([connectivity, &newVertexIds](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      connectivity[i] = newVertexIds[connectivity[i]];
+    }
+  });
+
+  size_t numElems = elements->getNumberOfTuples();
+  FloatArrayType::Pointer centroids = FloatArrayType::CreateArray(numElems, std::vector<size_t>(1, 3), "Centroids", true);
+  Topology::FindElementCentroids<MeshIndexType>(elements, vertices, centroids);
+  elementOrder = SortAlongCurve(centroids->getPointer(0), numElems, curve);
+  if(!PermuteTuples(elements.get(), elementOrder))
+  {
+    return false;
+  }
+
+  // Everything derived from the connectivity is in the old order
+  geometry->deleteElementsContainingVert();
+  geometry->deleteElementNeighbors();
+  geometry->deleteElementCentroids();
+  geometry->deleteElementSizes();
+  if(auto* geom2D = dynamic_cast<IGeometry2D*>(geometry))
+  {
+    geom2D->deleteEdges();
+    geom2D->deleteUnsharedEdges();
+  }
+  else if(auto* geom3D = dynamic_cast<IGeometry3D*>(geometry))
+  {
+    geom3D->deleteEdges();
+    geom3D->deleteFaces();
+    geom3D->deleteUnsharedEdges();
+    geom3D->deleteUnsharedFaces();
+  }
+  return true;
+}
+
 } // namespace GeometryHelpers
@@ -31,10 +31,12 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <map>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <QtCore/QString>
 
@@ -47,6 +49,7 @@
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/Math/GeometryMath.h"
 #include "SIMPLib/Math/MatrixMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 class IDataArray;
 using IDataArrayShPtrType = std::shared_ptr<IDataArray>;
@@ -991,7 +994,10 @@ public:
 };
 
 /**
- * @brief The Topology class
+ * @brief The Topology class computes per element quantities of unstructured meshes. Every element only
+ * depends on its own vertices, so the elements are split into ranges that run in parallel when SIMPLib is
+ * built with TBB. The arithmetic for an element is the same no matter how the range is split, which keeps
+ * the results bitwise identical to a serial run.
  */
 class Topology
 {
@@ -1010,24 +1016,32 @@ public:
   {
     size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
-    size_t numDims = 3;
+    const T* elems = elemList->getPointer(0);
+    const float* vertex = vertices->getPointer(0);
     float* elementCentroids = centroids->getPointer(0);
-    float* vertex = vertices->getPointer(0);
 
-    for(size_t i = 0; i < numDims; i++)
-    {
-      for(size_t j = 0; j < numElems; j++)
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numElems);
+    dataAlg.execute([=](const SIMPLRange& range) {
+      const float numVerts = static_cast<float>(numVertsPerElem);
+      for(size_t j = range.min(); j < range.max(); j++)
       {
-        T* Elem = elemList->getTuplePointer(j);
-        float vertPos = 0.0;
+        const T* elem = elems + numVertsPerElem * j;
+        float x = 0.0f;
+        float y = 0.0f;
+        float z = 0.0f;
         for(size_t k = 0; k < numVertsPerElem; k++)
         {
-          vertPos += vertex[3 * Elem[k] + i];
+          const float* vert = vertex + 3 * elem[k];
+          x += vert[0];
+          y += vert[1];
+          z += vert[2];
         }
-        vertPos /= static_cast<float>(numVertsPerElem);
-        elementCentroids[numDims * j + i] = vertPos;
+        elementCentroids[3 * j + 0] = x / numVerts;
+        elementCentroids[3 * j + 1] = y / numVerts;
+        elementCentroids[3 * j + 2] = z / numVerts;
       }
-    }
+    });
   }
 
   /**
@@ -1039,83 +1053,56 @@ public:
   template <typename T>
   static void Find2DElementAreas(typename DataArray<T>::Pointer elemList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer areas)
   {
-    float nx, ny, nz;
-    int32_t projection;
-
     size_t numElems = elemList->getNumberOfTuples();
     int64_t numVertsPerElem = static_cast<int64_t>(elemList->getNumberOfComponents());
     if(numVertsPerElem < 3)
     {
       return;
     }
-    float* vertex = vertices->getPointer(0);
+    const T* elems = elemList->getPointer(0);
+    const float* vertex = vertices->getPointer(0);
     float* elemAreas = areas->getPointer(0);
-    float normal[3] = {0.0f, 0.0f, 0.0f};
-    std::vector<float> coords(3 * numVertsPerElem, 0.0f);
-    float vert0[3] = {0.0f, 0.0f, 0.0f};
-    float vert1[3] = {0.0f, 0.0f, 0.0f};
-    float vert2[3] = {0.0f, 0.0f, 0.0f};
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      float area = 0.0f;
-      T* elem = elemList->getTuplePointer(i);
-
-      // Create a contiguous vertex coordinates list
-      // This simplifies the pointer arithmetic a bit
-      for(int64_t j = 0; j < numVertsPerElem; j++)
-      {
-        std::copy(vertex + (3 * elem[j]), vertex + (3 * elem[j] + 3), coords.begin() + (3 * j));
-      }
 
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numElems);
+    dataAlg.execute([=](const SIMPLRange& range) {
+      std::vector<float> coords(3 * numVertsPerElem, 0.0f);
       float* coordinates = coords.data();
-      GeometryMath::FindPolygonNormal(coordinates, numVertsPerElem, normal);
-      MatrixMath::Normalize3x1(normal);
-
-      nx = (normal[0] > 0.0 ? normal[0] : -normal[0]);
-      ny = (normal[1] > 0.0 ? normal[1] : -normal[1]);
-      nz = (normal[2] > 0.0 ? normal[2] : -normal[2]);
-      projection = (nx > ny ? (nx > nz ? 0 : 2) : (ny > nz ? 1 : 2));
-
-      for(int64_t j = 0; j < numVertsPerElem; j++)
+      for(size_t i = range.min(); i < range.max(); i++)
       {
-        std::copy(coordinates + (3 * j), coordinates + (3 * j + 3), vert0);
-        std::copy(coordinates + (3 * ((j + 1) % numVertsPerElem)), coordinates + (3 * ((j + 1) % numVertsPerElem) + 3), vert1);
-        std::copy(coordinates + (3 * ((j + 2) % numVertsPerElem)), coordinates + (3 * ((j + 2) % numVertsPerElem) + 3), vert2);
+        const T* elem = elems + numVertsPerElem * i;
 
-        switch(projection)
+        // Create a contiguous vertex coordinates list
+        // This simplifies the pointer arithmetic a bit
+        for(int64_t j = 0; j < numVertsPerElem; j++)
         {
-        case 0: {
-          area += coordinates[3 * ((j + 1) % numVertsPerElem) + 1] * (coordinates[3 * ((j + 2) % numVertsPerElem) + 2] - coordinates[3 * j + 2]);
-          continue;
-        }
-        case 1: {
-          area += coordinates[3 * ((j + 1) % numVertsPerElem) + 0] * (coordinates[3 * ((j + 2) % numVertsPerElem) + 2] - coordinates[3 * j + 2]);
-          continue;
-        }
-        case 2: {
-          area += coordinates[3 * ((j + 1) % numVertsPerElem) + 0] * (coordinates[3 * ((j + 2) % numVertsPerElem) + 1] - coordinates[3 * j + 1]);
-          continue;
+          std::copy(vertex + (3 * elem[j]), vertex + (3 * elem[j] + 3), coordinates + (3 * j));
         }
+
+        // Polygons with more than 3 vertices accumulate into the normal so it has to start from zero
+        float normal[3] = {0.0f, 0.0f, 0.0f};
+        GeometryMath::FindPolygonNormal(coordinates, numVertsPerElem, normal);
+        MatrixMath::Normalize3x1(normal);
+
+        float nx = (normal[0] > 0.0 ? normal[0] : -normal[0]);
+        float ny = (normal[1] > 0.0 ? normal[1] : -normal[1]);
+        float nz = (normal[2] > 0.0 ? normal[2] : -normal[2]);
+        int32_t projection = (nx > ny ? (nx > nz ? 0 : 2) : (ny > nz ? 1 : 2));
+
+        // Project onto the plane the polygon is most parallel to and use the shoelace formula there
+        size_t u = (projection == 0 ? 1 : 0);
+        size_t v = (projection == 2 ? 1 : 2);
+        float area = 0.0f;
+        for(int64_t j = 0; j < numVertsPerElem; j++)
+        {
+          area += coordinates[3 * ((j + 1) % numVertsPerElem) + u] * (coordinates[3 * ((j + 2) % numVertsPerElem) + v] - coordinates[3 * j + v]);
         }
-      }
 
-      switch(projection)
-      {
-      case 0: {
-        area /= (2.0f * nx);
-        break;
-      }
-      case 1: {
-        area /= (2.0f * ny);
-        break;
-      }
-      case 2: {
-        area /= (2.0f * nz);
-      }
+        float scale = (projection == 0 ? nx : (projection == 1 ? ny : nz));
+        area /= (2.0f * scale);
+        elemAreas[i] = fabsf(area);
       }
-      elemAreas[i] = fabsf(area);
-    }
+    });
   }
 
   /**
@@ -1128,23 +1115,21 @@ public:
   static void FindTetVolumes(typename DataArray<T>::Pointer tetList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer volumes)
   {
     size_t numTets = tetList->getNumberOfTuples();
-    float* vertex = vertices->getPointer(0);
+    const T* tets = tetList->getPointer(0);
+    const float* vertex = vertices->getPointer(0);
     float* volumePtr = volumes->getPointer(0);
 
-    for(size_t i = 0; i < numTets; i++)
-    {
-      T* tet = tetList->getTuplePointer(i);
-      float vert0[3] = {vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2]};
-      float vert1[3] = {vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2]};
-      float vert2[3] = {vertex[3 * tet[2] + 0], vertex[3 * tet[2] + 1], vertex[3 * tet[2] + 2]};
-      float vert3[3] = {vertex[3 * tet[3] + 0], vertex[3 * tet[3] + 1], vertex[3 * tet[3] + 2]};
-
-      float vertMatrix[3][3] = {{vert1[0] - vert0[0], vert2[0] - vert0[0], vert3[0] - vert0[0]},
-                                {vert1[1] - vert0[1], vert2[1] - vert0[1], vert3[1] - vert0[1]},
-                                {vert1[2] - vert0[2], vert2[2] - vert0[2], vert3[2] - vert0[2]}};
-
-      volumePtr[i] = (MatrixMath::Determinant3x3(vertMatrix) / 6.0f);
-    }
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numTets);
+    dataAlg.execute([=](const SIMPLRange& range) {
+      for(size_t i = range.min(); i < range.max(); i++)
+      {
+        const T* tet = tets + 4 * i;
+        float vertMatrix[3][3];
+        TetEdgeMatrix(vertex, tet[0], tet[1], tet[2], tet[3], vertMatrix);
+        volumePtr[i] = (MatrixMath::Determinant3x3(vertMatrix) / 6.0f);
+      }
+    });
   }
 
   /**
@@ -1156,64 +1141,30 @@ public:
   template <typename T>
   static void FindHexVolumes(typename DataArray<T>::Pointer hexList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer volumes)
   {
+    // Each hexahedron is subdivided into 5 tetrahedra whose volumes are summed
+    static constexpr size_t k_SubTets[5][4] = {{0, 1, 3, 4}, {1, 4, 5, 6}, {1, 3, 6, 3}, {1, 3, 6, 2}, {3, 6, 7, 4}};
+
     size_t numHexas = hexList->getNumberOfTuples();
-    float* vertex = vertices->getPointer(0);
+    const T* hexas = hexList->getPointer(0);
+    const float* vertex = vertices->getPointer(0);
     float* volumePtr = volumes->getPointer(0);
 
-    for(size_t i = 0; i < numHexas; i++)
-    {
-      // Subdivide each hexahedron into 5 tetrahedra & sum their volumes
-      std::vector<std::vector<int64_t>> subTets(5, std::vector<int64_t>(4, 0));
-      T* hex = hexList->getTuplePointer(i);
-
-      // First tetrahedron from hexahedron vertices (0, 1, 3, 4);
-      subTets[0][0] = hex[0];
-      subTets[0][1] = hex[1];
-      subTets[0][2] = hex[3];
-      subTets[0][3] = hex[4];
-
-      // Second tetrahedron from hexahedron vertices (1, 4, 5, 6);
-      subTets[1][0] = hex[1];
-      subTets[1][1] = hex[4];
-      subTets[1][2] = hex[5];
-      subTets[1][3] = hex[6];
-
-      // Third tetrahedron from hexahedron vertices (1, 4, 6, 3);
-      subTets[2][0] = hex[1];
-      subTets[2][1] = hex[3];
-      subTets[2][2] = hex[6];
-      subTets[2][3] = hex[3];
-
-      // Fourth tetrahedron from hexahedron vertices (1, 3, 6, 2);
-      subTets[3][0] = hex[1];
-      subTets[3][1] = hex[3];
-      subTets[3][2] = hex[6];
-      subTets[3][3] = hex[2];
-
-      // Fifth tetrahedron from hexahedron vertices (3, 6, 7, 4);
-      subTets[4][0] = hex[3];
-      subTets[4][1] = hex[6];
-      subTets[4][2] = hex[7];
-      subTets[4][3] = hex[4];
-
-      float volume = 0.0f;
-
-      for(auto&& tet : subTets)
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numHexas);
+    dataAlg.execute([=](const SIMPLRange& range) {
+      for(size_t i = range.min(); i < range.max(); i++)
       {
-        float vert0[3] = {vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2]};
-        float vert1[3] = {vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2]};
-        float vert2[3] = {vertex[3 * tet[2] + 0], vertex[3 * tet[2] + 1], vertex[3 * tet[2] + 2]};
-        float vert3[3] = {vertex[3 * tet[3] + 0], vertex[3 * tet[3] + 1], vertex[3 * tet[3] + 2]};
-
-        float vertMatrix[3][3] = {{vert1[0] - vert0[0], vert2[0] - vert0[0], vert3[0] - vert0[0]},
-                                  {vert1[1] - vert0[1], vert2[1] - vert0[1], vert3[1] - vert0[1]},
-                                  {vert1[2] - vert0[2], vert2[2] - vert0[2], vert3[2] - vert0[2]}};
-
-        volume += (MatrixMath::Determinant3x3(vertMatrix) / 6.0f);
+        const T* hex = hexas + 8 * i;
+        float volume = 0.0f;
+        for(const auto& tet : k_SubTets)
+        {
+          float vertMatrix[3][3];
+          TetEdgeMatrix(vertex, hex[tet[0]], hex[tet[1]], hex[tet[2]], hex[tet[3]], vertMatrix);
+          volume += (MatrixMath::Determinant3x3(vertMatrix) / 6.0f);
+        }
+        volumePtr[i] = volume;
       }
-
-      volumePtr[i] = volume;
-    }
+    });
   }
 
   /**
@@ -1226,24 +1177,23 @@ public:
   static void FindTetJacobians(typename DataArray<T>::Pointer tetList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer jacobians)
   {
     size_t numTets = tetList->getNumberOfTuples();
-    float* vertex = vertices->getPointer(0);
+    const T* tets = tetList->getPointer(0);
+    const float* vertex = vertices->getPointer(0);
     float* jacobianPtr = jacobians->getPointer(0);
 
-    for(size_t i = 0; i < numTets; i++)
-    {
-      T* tet = tetList->getTuplePointer(i);
-      // get vert positions
-      float vert0[3] = {vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2]};
-      float vert1[3] = {vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2]};
-      float vert2[3] = {vertex[3 * tet[2] + 0], vertex[3 * tet[2] + 1], vertex[3 * tet[2] + 2]};
-      float vert3[3] = {vertex[3 * tet[3] + 0], vertex[3 * tet[3] + 1], vertex[3 * tet[3] + 2]};
-      // build jacobian matrix
-      float vertMatrix[3][3] = {{vert1[0] - vert0[0], vert2[0] - vert0[0], vert3[0] - vert0[0]},
-                                {vert1[1] - vert0[1], vert2[1] - vert0[1], vert3[1] - vert0[1]},
-                                {vert1[2] - vert0[2], vert2[2] - vert0[2], vert3[2] - vert0[2]}};
-      // find jacobian, which is determinant of the jacobian matrix
-      jacobianPtr[i] = MatrixMath::Determinant3x3(vertMatrix);
-    }
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numTets);
+    dataAlg.execute([=](const SIMPLRange& range) {
+      for(size_t i = range.min(); i < range.max(); i++)
+      {
+        const T* tet = tets + 4 * i;
+        // build jacobian matrix
+        float vertMatrix[3][3];
+        TetEdgeMatrix(vertex, tet[0], tet[1], tet[2], tet[3], vertMatrix);
+        // find jacobian, which is determinant of the jacobian matrix
+        jacobianPtr[i] = MatrixMath::Determinant3x3(vertMatrix);
+      }
+    });
   }
 
   /**
@@ -1256,70 +1206,82 @@ public:
   static void FindTetMinDihedralAngles(typename DataArray<T>::Pointer tetList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer minAngles)
   {
     size_t numTets = tetList->getNumberOfTuples();
-    float* vertex = vertices->getPointer(0);
+    const T* tets = tetList->getPointer(0);
+    const float* vertex = vertices->getPointer(0);
     float* minAnglesPtr = minAngles->getPointer(0);
 
-    for(size_t i = 0; i < numTets; i++)
-    {
-      T* tet = tetList->getTuplePointer(i);
-      // get vert positions
-      float vert0[3] = {vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2]};
-      float vert1[3] = {vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2]};
-      float vert2[3] = {vertex[3 * tet[2] + 0], vertex[3 * tet[2] + 1], vertex[3 * tet[2] + 2]};
-      float vert3[3] = {vertex[3 * tet[3] + 0], vertex[3 * tet[3] + 1], vertex[3 * tet[3] + 2]};
-      // find 5 edges needed to find 4 face normals
-      float v10[3] = {(vert1[0] - vert0[0]), (vert1[1] - vert0[1]), (vert1[2] - vert0[2])};
-      float v20[3] = {(vert2[0] - vert0[0]), (vert2[1] - vert0[1]), (vert2[2] - vert0[2])};
-      float v30[3] = {(vert3[0] - vert0[0]), (vert3[1] - vert0[1]), (vert3[2] - vert0[2])};
-      float v21[3] = {(vert2[0] - vert1[0]), (vert2[1] - vert1[1]), (vert2[2] - vert1[2])};
-      float v31[3] = {(vert3[0] - vert1[0]), (vert3[1] - vert1[1]), (vert3[2] - vert1[2])};
-      // find 4 face-to-face normals
-      float norm1[3] = {(v10[1] * v20[2] - v10[2] * v20[1]), (v10[2] * v20[0] - v10[0] * v20[2]), (v10[0] * v20[1] - v10[1] * v20[0])};
-      float norm2[3] = {(v30[1] * v10[2] - v30[2] * v10[1]), (v30[2] * v10[0] - v30[0] * v10[2]), (v30[0] * v10[1] - v30[1] * v10[0])};
-      float norm3[3] = {(v20[1] * v30[2] - v20[2] * v30[1]), (v20[2] * v30[0] - v20[0] * v30[2]), (v20[0] * v30[1] - v20[1] * v30[0])};
-      float norm4[3] = {(v31[1] * v21[2] - v31[2] * v21[1]), (v31[2] * v21[0] - v31[0] * v21[2]), (v31[0] * v21[1] - v31[1] * v21[0])};
-      // find the magnitudes of each normal
-      float norm1mag = sqrtf(norm1[0] * norm1[0] + norm1[1] * norm1[1] + norm1[2] * norm1[2]);
-      float norm2mag = sqrtf(norm2[0] * norm2[0] + norm2[1] * norm2[1] + norm2[2] * norm2[2]);
-      float norm3mag = sqrtf(norm3[0] * norm3[0] + norm3[1] * norm3[1] + norm3[2] * norm3[2]);
-      float norm4mag = sqrtf(norm4[0] * norm4[0] + norm4[1] * norm4[1] + norm4[2] * norm4[2]);
-      // find angles between faces
-      float ang1 = (norm1[0] * norm2[0] + norm1[1] * norm2[1] + norm1[2] * norm2[2]) / (norm1mag * norm2mag);
-      float ang2 = (norm1[0] * norm3[0] + norm1[1] * norm3[1] + norm1[2] * norm3[2]) / (norm1mag * norm3mag);
-      float ang3 = (norm1[0] * norm4[0] + norm1[1] * norm4[1] + norm1[2] * norm4[2]) / (norm1mag * norm4mag);
-      float ang4 = (norm2[0] * norm3[0] + norm2[1] * norm3[1] + norm2[2] * norm3[2]) / (norm2mag * norm3mag);
-      float ang5 = (norm2[0] * norm4[0] + norm2[1] * norm4[1] + norm2[2] * norm4[2]) / (norm2mag * norm4mag);
-      float ang6 = (norm3[0] * norm4[0] + norm3[1] * norm4[1] + norm3[2] * norm4[2]) / (norm3mag * norm4mag);
-      // find the maximum ang value, which will be the minimum angle after the acos
-      float minAng = ang1;
-      if(ang2 > minAng)
-      {
-        minAng = ang2;
-      }
-      if(ang3 > minAng)
-      {
-        minAng = ang3;
-      }
-      if(ang4 > minAng)
-      {
-        minAng = ang4;
-      }
-      if(ang5 > minAng)
-      {
-        minAng = ang5;
-      }
-      if(ang6 > minAng)
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numTets);
+    dataAlg.execute([=](const SIMPLRange& range) {
+      for(size_t i = range.min(); i < range.max(); i++)
       {
-        minAng = ang6;
+        const T* tet = tets + 4 * i;
+        // get vert positions
+        const float* vert0 = vertex + 3 * tet[0];
+        const float* vert1 = vertex + 3 * tet[1];
+        const float* vert2 = vertex + 3 * tet[2];
+        const float* vert3 = vertex + 3 * tet[3];
+        // find 5 edges needed to find 4 face normals
+        float v10[3] = {(vert1[0] - vert0[0]), (vert1[1] - vert0[1]), (vert1[2] - vert0[2])};
+        float v20[3] = {(vert2[0] - vert0[0]), (vert2[1] - vert0[1]), (vert2[2] - vert0[2])};
+        float v30[3] = {(vert3[0] - vert0[0]), (vert3[1] - vert0[1]), (vert3[2] - vert0[2])};
+        float v21[3] = {(vert2[0] - vert1[0]), (vert2[1] - vert1[1]), (vert2[2] - vert1[2])};
+        float v31[3] = {(vert3[0] - vert1[0]), (vert3[1] - vert1[1]), (vert3[2] - vert1[2])};
+        // find 4 face-to-face normals
+        float norm1[3] = {(v10[1] * v20[2] - v10[2] * v20[1]), (v10[2] * v20[0] - v10[0] * v20[2]), (v10[0] * v20[1] - v10[1] * v20[0])};
+        float norm2[3] = {(v30[1] * v10[2] - v30[2] * v10[1]), (v30[2] * v10[0] - v30[0] * v10[2]), (v30[0] * v10[1] - v30[1] * v10[0])};
+        float norm3[3] = {(v20[1] * v30[2] - v20[2] * v30[1]), (v20[2] * v30[0] - v20[0] * v30[2]), (v20[0] * v30[1] - v20[1] * v30[0])};
+        float norm4[3] = {(v31[1] * v21[2] - v31[2] * v21[1]), (v31[2] * v21[0] - v31[0] * v21[2]), (v31[0] * v21[1] - v31[1] * v21[0])};
+        // find the magnitudes of each normal
+        float norm1mag = sqrtf(norm1[0] * norm1[0] + norm1[1] * norm1[1] + norm1[2] * norm1[2]);
+        float norm2mag = sqrtf(norm2[0] * norm2[0] + norm2[1] * norm2[1] + norm2[2] * norm2[2]);
+        float norm3mag = sqrtf(norm3[0] * norm3[0] + norm3[1] * norm3[1] + norm3[2] * norm3[2]);
+        float norm4mag = sqrtf(norm4[0] * norm4[0] + norm4[1] * norm4[1] + norm4[2] * norm4[2]);
+        // find angles between faces
+        float ang1 = (norm1[0] * norm2[0] + norm1[1] * norm2[1] + norm1[2] * norm2[2]) / (norm1mag * norm2mag);
+        float ang2 = (norm1[0] * norm3[0] + norm1[1] * norm3[1] + norm1[2] * norm3[2]) / (norm1mag * norm3mag);
+        float ang3 = (norm1[0] * norm4[0] + norm1[1] * norm4[1] + norm1[2] * norm4[2]) / (norm1mag * norm4mag);
+        float ang4 = (norm2[0] * norm3[0] + norm2[1] * norm3[1] + norm2[2] * norm3[2]) / (norm2mag * norm3mag);
+        float ang5 = (norm2[0] * norm4[0] + norm2[1] * norm4[1] + norm2[2] * norm4[2]) / (norm2mag * norm4mag);
+        float ang6 = (norm3[0] * norm4[0] + norm3[1] * norm4[1] + norm3[2] * norm4[2]) / (norm3mag * norm4mag);
+        // find the maximum ang value, which will be the minimum angle after the acos
+        float minAng = std::max({ang1, ang2, ang3, ang4, ang5, ang6});
+
+        minAnglesPtr[i] = SIMPLib::Constants::k_180OverPiD * acosf(minAng);
       }
+    });
+  }
 
-      minAnglesPtr[i] = SIMPLib::Constants::k_180OverPiD * acosf(minAng);
+private:
+  /**
+   * @brief Fills the matrix whose columns are the edges from the first vertex of a tetrahedron to the other three
+   * @param vertex
+   * @param v0
+   * @param v1
+   * @param v2
+   * @param v3
+   * @param vertMatrix
+   */
+  template <typename T>
+  static void TetEdgeMatrix(const float* vertex, T v0, T v1, T v2, T v3, float vertMatrix[3][3])
+  {
+    const float* vert0 = vertex + 3 * v0;
+    const float* vert1 = vertex + 3 * v1;
+    const float* vert2 = vertex + 3 * v2;
+    const float* vert3 = vertex + 3 * v3;
+    for(size_t d = 0; d < 3; d++)
+    {
+      vertMatrix[d][0] = vert1[d] - vert0[d];
+      vertMatrix[d][1] = vert2[d] - vert0[d];
+      vertMatrix[d][2] = vert3[d] - vert0[d];
     }
   }
 };
 
 /**
- * @brief The Generic class
+ * @brief The Generic class interpolates attribute values between the vertices and elements of unstructured
+ * meshes. Like the Topology kernels, every output tuple is computed on its own so the tuples are split into
+ * ranges that run in parallel with bitwise identical results.
  */
 class Generic
 {
@@ -1339,27 +1301,36 @@ public:
     Q_ASSERT(outElemArray->getComponentDimensions() == inVertexArray->getComponentDimensions());
     Q_ASSERT(elemList->getNumberOfTuples() == outElemArray->getNumberOfTuples());
 
-    K* vertArray = inVertexArray->getPointer(0);
+    const T* elems = elemList->getPointer(0);
+    const K* vertArray = inVertexArray->getPointer(0);
     float* elemArray = outElemArray->getPointer(0);
 
     size_t numElems = outElemArray->getNumberOfTuples();
     size_t numDims = inVertexArray->getNumberOfComponents();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
 
-    for(size_t i = 0; i < numDims; i++)
-    {
-      for(size_t j = 0; j < numElems; j++)
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numElems);
+    dataAlg.execute([=](const SIMPLRange& range) {
+      for(size_t j = range.min(); j < range.max(); j++)
       {
-        T* Elem = elemList->getTuplePointer(j);
-        float vertValue = 0.0;
+        const T* elem = elems + numVertsPerElem * j;
+        float* elemValues = elemArray + numDims * j;
+        std::fill(elemValues, elemValues + numDims, 0.0f);
         for(size_t k = 0; k < numVertsPerElem; k++)
         {
-          vertValue += vertArray[numDims * Elem[k] + i];
+          const K* vertValues = vertArray + numDims * elem[k];
+          for(size_t i = 0; i < numDims; i++)
+          {
+            elemValues[i] += vertValues[i];
+          }
+        }
+        for(size_t i = 0; i < numDims; i++)
+        {
+          elemValues[i] /= static_cast<float>(numVertsPerElem);
         }
-        vertValue /= static_cast<float>(numVertsPerElem);
-        elemArray[numDims * j + i] = vertValue;
       }
-    }
+    });
   }
 
   /**
@@ -1377,48 +1348,50 @@ public:
     Q_ASSERT(outElemArray->getNumberOfTuples() == elemList->getNumberOfTuples());
     Q_ASSERT(outElemArray->getComponentDimensions() == inVertexArray->getComponentDimensions());
 
-    K* vertArray = inVertexArray->getPointer(0);
+    const T* elems = elemList->getPointer(0);
+    const K* vertArray = inVertexArray->getPointer(0);
     float* elemArray = outElemArray->getPointer(0);
-    float* elementCentroids = centroids->getPointer(0);
-    float* vertex = vertices->getPointer(0);
+    const float* elementCentroids = centroids->getPointer(0);
+    const float* vertex = vertices->getPointer(0);
 
     size_t numElems = outElemArray->getNumberOfTuples();
     size_t cDims = inVertexArray->getNumberOfComponents();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
     size_t numDims = 3;
 
-    // Vector to hold vertex-centroid distances, 4 per cell
-    std::vector<float> vertCentDist(numElems * numVertsPerElem);
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* Elem = elemList->getTuplePointer(i);
-      for(size_t j = 0; j < numVertsPerElem; j++)
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numElems);
+    dataAlg.execute([=](const SIMPLRange& range) {
+      // Vertex-centroid distances of the current element
+      std::vector<float> vertCentDist(numVertsPerElem);
+      for(size_t j = range.min(); j < range.max(); j++)
       {
-        for(size_t k = 0; k < numDims; k++)
+        const T* elem = elems + numVertsPerElem * j;
+        const float* centroid = elementCentroids + numDims * j;
+        float sumDist = 0.0f;
+        for(size_t k = 0; k < numVertsPerElem; k++)
         {
-          vertCentDist[numVertsPerElem * i + j] += (vertex[numDims * Elem[j] + k] - elementCentroids[numDims * i + k]) * (vertex[numDims * Elem[j] + k] - elementCentroids[numDims * i + k]);
+          const float* vert = vertex + numDims * elem[k];
+          float dist = 0.0f;
+          for(size_t d = 0; d < numDims; d++)
+          {
+            dist += (vert[d] - centroid[d]) * (vert[d] - centroid[d]);
+          }
+          vertCentDist[k] = sqrtf(dist);
+          sumDist += vertCentDist[k];
         }
-        vertCentDist[numVertsPerElem * i + j] = sqrtf(vertCentDist[numVertsPerElem * i + j]);
-      }
-    }
 
-    for(size_t i = 0; i < cDims; i++)
-    {
-      for(size_t j = 0; j < numElems; j++)
-      {
-        T* Elem = elemList->getTuplePointer(j);
-        float vertValue = 0.0;
-        float sumDist = 0.0;
-        for(size_t k = 0; k < numVertsPerElem; k++)
+        for(size_t i = 0; i < cDims; i++)
         {
-          vertValue += vertArray[cDims * Elem[k] + i] * vertCentDist[numVertsPerElem * j + k];
-          sumDist += vertCentDist[numVertsPerElem * j + k];
+          float vertValue = 0.0f;
+          for(size_t k = 0; k < numVertsPerElem; k++)
+          {
+            vertValue += vertArray[cDims * elem[k] + i] * vertCentDist[k];
+          }
+          elemArray[cDims * j + i] = vertValue / sumDist;
         }
-        vertValue /= static_cast<float>(sumDist);
-        elemArray[cDims * j + i] = vertValue;
       }
-    }
+    });
   }
 
   template <typename T, typename K, typename L, typename M>
@@ -1428,27 +1401,107 @@ public:
     Q_ASSERT(outVertexArray->getNumberOfTuples() == vertices->getNumberOfTuples());
     Q_ASSERT(outVertexArray->getComponentDimensions() == inElemArray->getComponentDimensions());
 
-    K* elemArray = inElemArray->getPointer(0);
+    const DynamicListArray<L, T>* elemsContaining = elemsContainingVert.get();
+    const K* elemArray = inElemArray->getPointer(0);
     M* vertArray = outVertexArray->getPointer(0);
 
     size_t numVerts = vertices->getNumberOfTuples();
     size_t cDims = inElemArray->getNumberOfComponents();
 
-    for(size_t i = 0; i < cDims; i++)
-    {
-      for(size_t j = 0; j < numVerts; j++)
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numVerts);
+    dataAlg.execute([=](const SIMPLRange& range) {
+      for(size_t j = range.min(); j < range.max(); j++)
       {
-        L numElemsPerVert = elemsContainingVert->getNumberOfElements(j);
-        T* elemIdxs = elemsContainingVert->getElementListPointer(j);
-        M vertValue = 0.0;
+        L numElemsPerVert = elemsContaining->getNumberOfElements(j);
+        const T* elemIdxs = elemsContaining->getElementListPointer(j);
         double weight = 1.0 / numElemsPerVert;
+        M* vertValues = vertArray + cDims * j;
+        std::fill(vertValues, vertValues + cDims, static_cast<M>(0.0));
         for(size_t k = 0; k < numElemsPerVert; k++)
         {
-          vertValue += static_cast<M>(elemArray[cDims * elemIdxs[k] + i] * weight);
+          const K* elemValues = elemArray + cDims * elemIdxs[k];
+          for(size_t i = 0; i < cDims; i++)
+          {
+            vertValues[i] += static_cast<M>(elemValues[i] * weight);
+          }
         }
-        vertArray[cDims * j + i] = vertValue;
       }
-    }
+    });
   }
 };
+
+/**
+ * @brief The Reordering class sorts the vertices and elements of unstructured geometries along a space filling
+ * curve so that elements which are close in space are also close in memory. Coordinates are quantized to 21 bits
+ * per axis inside their bounding box and mapped to a 63 bit Morton (Z-order) or Hilbert key. Permutations are
+ * returned as new to old maps: order[newIndex] is the index the item had before reordering.
+ */
+class SIMPLib_EXPORT Reordering
+{
+public:
+  Reordering() = default;
+  virtual ~Reordering() = default;
+
+  enum class Curve : int
+  {
+    Morton = 0,
+    Hilbert = 1
+  };
+
+  /**
+   * @brief Interleaves the low 21 bits of three quantized coordinates into a Morton key with x in the lowest bit
+   * @param x
+   * @param y
+   * @param z
+   * @return
+   */
+  static uint64_t MortonKey(uint32_t x, uint32_t y, uint32_t z);
+
+  /**
+   * @brief Returns the distance along a 3D Hilbert curve of the cell at the low 21 bits of three quantized coordinates
+   * @param x
+   * @param y
+   * @param z
+   * @return
+   */
+  static uint64_t HilbertKey(uint32_t x, uint32_t y, uint32_t z);
+
+  /**
+   * @brief Returns the order that sorts the points along the curve. Points with the same key keep their relative order.
+   * @param coords Interleaved XYZ coordinates
+   * @param numPoints
+   * @param curve
+   * @return
+   */
+  static std::vector<MeshIndexType> SortAlongCurve(const float* coords, size_t numPoints, Curve curve);
+
+  /**
+   * @brief Turns a new to old order into an old to new map, or the reverse
+   * @param order
+   * @return
+   */
+  static std::vector<MeshIndexType> InvertOrder(const std::vector<MeshIndexType>& order);
+
+  /**
+   * @brief Moves the tuples of the array so that tuple i holds what tuple order[i] held before
+   * @param array
+   * @param order
+   * @return False if the array does not have one tuple per entry of the order or its tuples could not be copied
+   */
+  static bool PermuteTuples(IDataArray* array, const std::vector<MeshIndexType>& order);
+
+  /**
+   * @brief Reorders the vertices and then the elements of an Edge, Triangle, Quadrilateral, Tetrahedral or Hexahedral
+   * geometry. The connectivity is renumbered to the new vertex order, and the lists derived from it (elements containing
+   * each vertex, neighbors, centroids, sizes, edges and faces) are deleted so they are found again in the new order.
+   * Attribute matrices live in the DataContainer, so permuting them with the returned orders is up to the caller.
+   * @param geometry
+   * @param curve
+   * @param vertexOrder The new to old vertex order
+   * @param elementOrder The new to old element order
+   * @return False when the geometry has no vertex or element list to reorder or they could not be permuted
+   */
+  static bool ReorderGeometry(IGeometry* geometry, Curve curve, std::vector<MeshIndexType>& vertexOrder, std::vector<MeshIndexType>& elementOrder);
+};
 } // namespace GeometryHelpers
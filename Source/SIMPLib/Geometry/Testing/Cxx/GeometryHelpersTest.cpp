@@ -0,0 +1,307 @@
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class GeometryHelpersTest
+{
+public:
+  GeometryHelpersTest() = default;
+
+  virtual ~GeometryHelpersTest() = default;
+
+  using ElementKernel = std::function<void(MeshIndexArrayType::Pointer, FloatArrayType::Pointer, FloatArrayType::Pointer)>;
+
+  static constexpr size_t k_NumVertices = 500;
+  static constexpr size_t k_NumElements = 3000;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FloatArrayType::Pointer CreateVertices()
+  {
+    std::mt19937 generator(13);
+    std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+    FloatArrayType::Pointer vertices = FloatArrayType::CreateArray(k_NumVertices, std::vector<size_t>(1, 3), "Vertices", true);
+    std::generate(vertices->begin(), vertices->end(), [&]() { return distribution(generator); });
+    return vertices;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  MeshIndexArrayType::Pointer CreateElements(size_t numVertsPerElem)
+  {
+    std::mt19937 generator(static_cast<uint32_t>(numVertsPerElem));
+    MeshIndexArrayType::Pointer elements = MeshIndexArrayType::CreateArray(k_NumElements, std::vector<size_t>(1, numVertsPerElem), "Elements", true);
+    std::vector<MeshIndexType> vertIds(k_NumVertices);
+    std::iota(vertIds.begin(), vertIds.end(), 0);
+    for(size_t i = 0; i < k_NumElements; i++)
+    {
+      std::shuffle(vertIds.begin(), vertIds.end(), generator);
+      std::copy(vertIds.begin(), vertIds.begin() + numVertsPerElem, elements->getTuplePointer(i));
+    }
+    return elements;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  MeshIndexArrayType::Pointer ExtractElement(const MeshIndexArrayType::Pointer& elements, size_t index)
+  {
+    size_t numVertsPerElem = elements->getNumberOfComponents();
+    MeshIndexArrayType::Pointer element = MeshIndexArrayType::CreateArray(1, std::vector<size_t>(1, numVertsPerElem), "Element", true);
+    std::copy(elements->getTuplePointer(index), elements->getTuplePointer(index) + numVertsPerElem, element->getTuplePointer(0));
+    return element;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Runs the kernel over the whole mesh, which is split into ranges when TBB is available, and once for
+  // every element on its own. The values have to match bit for bit.
+  // -----------------------------------------------------------------------------
+  void CheckElementIndependence(const MeshIndexArrayType::Pointer& elements, const FloatArrayType::Pointer& vertices, size_t numComps, const ElementKernel& kernel)
+  {
+    FloatArrayType::Pointer values = FloatArrayType::CreateArray(elements->getNumberOfTuples(), std::vector<size_t>(1, numComps), "Values", true);
+    kernel(elements, vertices, values);
+
+    FloatArrayType::Pointer value = FloatArrayType::CreateArray(1, std::vector<size_t>(1, numComps), "Value", true);
+    for(size_t i = 0; i < elements->getNumberOfTuples(); i++)
+    {
+      kernel(ExtractElement(elements, i), vertices, value);
+      DREAM3D_REQUIRE_EQUAL(std::memcmp(value->getTuplePointer(0), values->getTuplePointer(i), numComps * sizeof(float)), 0)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTopologyKernels()
+  {
+    FloatArrayType::Pointer vertices = CreateVertices();
+    MeshIndexArrayType::Pointer tris = CreateElements(3);
+    MeshIndexArrayType::Pointer quads = CreateElements(4);
+    MeshIndexArrayType::Pointer tets = CreateElements(4);
+    MeshIndexArrayType::Pointer hexas = CreateElements(8);
+
+    for(const auto& elements : {tris, quads, tets, hexas})
+    {
+      CheckElementIndependence(elements, vertices, 3, GeometryHelpers::Topology::FindElementCentroids<MeshIndexType>);
+    }
+    // Quadrilateral areas used to depend on the normal of the element before
+    CheckElementIndependence(tris, vertices, 1, GeometryHelpers::Topology::Find2DElementAreas<MeshIndexType>);
+    CheckElementIndependence(quads, vertices, 1, GeometryHelpers::Topology::Find2DElementAreas<MeshIndexType>);
+    CheckElementIndependence(tets, vertices, 1, GeometryHelpers::Topology::FindTetVolumes<MeshIndexType>);
+    CheckElementIndependence(tets, vertices, 1, GeometryHelpers::Topology::FindTetJacobians<MeshIndexType>);
+    CheckElementIndependence(tets, vertices, 1, GeometryHelpers::Topology::FindTetMinDihedralAngles<MeshIndexType>);
+    CheckElementIndependence(hexas, vertices, 1, GeometryHelpers::Topology::FindHexVolumes<MeshIndexType>);
+
+    // A unit right triangle and a unit square
+    FloatArrayType::Pointer square = FloatArrayType::CreateArray(4, std::vector<size_t>(1, 3), "Square", true);
+    const std::vector<float> squareCoords = {0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f};
+    std::copy(squareCoords.begin(), squareCoords.end(), square->begin());
+    MeshIndexArrayType::Pointer squareElems = MeshIndexArrayType::CreateArray(1, std::vector<size_t>(1, 4), "SquareElems", true);
+    std::iota(squareElems->begin(), squareElems->end(), 0);
+    FloatArrayType::Pointer area = FloatArrayType::CreateArray(1, std::vector<size_t>(1, 1), "Area", true);
+    GeometryHelpers::Topology::Find2DElementAreas<MeshIndexType>(squareElems, square, area);
+    DREAM3D_REQUIRE_EQUAL(area->getValue(0), 1.0f)
+    FloatArrayType::Pointer centroid = FloatArrayType::CreateArray(1, std::vector<size_t>(1, 3), "Centroid", true);
+    GeometryHelpers::Topology::FindElementCentroids<MeshIndexType>(squareElems, square, centroid);
+    DREAM3D_REQUIRE_EQUAL(centroid->getValue(0), 0.5f)
+    DREAM3D_REQUIRE_EQUAL(centroid->getValue(1), 0.5f)
+    DREAM3D_REQUIRE_EQUAL(centroid->getValue(2), 0.0f)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestGenericKernels()
+  {
+    FloatArrayType::Pointer vertices = CreateVertices();
+    MeshIndexArrayType::Pointer tets = CreateElements(4);
+
+    CheckElementIndependence(tets, vertices, 3, GeometryHelpers::Generic::AverageVertexArrayValues<MeshIndexType, float>);
+
+    // The vertex coordinates double as the vertex array so the weights and the values both vary
+    CheckElementIndependence(tets, vertices, 3, [](MeshIndexArrayType::Pointer elements, FloatArrayType::Pointer verts, FloatArrayType::Pointer values) {
+      FloatArrayType::Pointer centroids = FloatArrayType::CreateArray(elements->getNumberOfTuples(), std::vector<size_t>(1, 3), "Centroids", true);
+      GeometryHelpers::Topology::FindElementCentroids<MeshIndexType>(elements, verts, centroids);
+      GeometryHelpers::Generic::WeightedAverageVertexArrayValues<MeshIndexType, float>(elements, verts, centroids, verts, values);
+    });
+
+    // Averaging the element centroids back onto the vertices of a single tetrahedron returns its centroid
+    MeshIndexArrayType::Pointer tet = ExtractElement(tets, 0);
+    FloatArrayType::Pointer tetVerts = FloatArrayType::CreateArray(4, std::vector<size_t>(1, 3), "TetVerts", true);
+    for(size_t i = 0; i < 4; i++)
+    {
+      std::copy(vertices->getTuplePointer(tet->getValue(i)), vertices->getTuplePointer(tet->getValue(i)) + 3, tetVerts->getTuplePointer(i));
+      tet->setValue(i, i);
+    }
+    FloatArrayType::Pointer centroid = FloatArrayType::CreateArray(1, std::vector<size_t>(1, 3), "Centroid", true);
+    GeometryHelpers::Topology::FindElementCentroids<MeshIndexType>(tet, tetVerts, centroid);
+    ElementDynamicList::Pointer tetsContainingVert = ElementDynamicList::New();
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, MeshIndexType>(tet, tetsContainingVert, 4);
+    DoubleArrayType::Pointer vertValues = DoubleArrayType::CreateArray(4, std::vector<size_t>(1, 3), "VertValues", true);
+    GeometryHelpers::Generic::AverageCellArrayValues<MeshIndexType, float, uint16_t, double>(tetsContainingVert, tetVerts, centroid, vertValues);
+    for(size_t i = 0; i < 4; i++)
+    {
+      for(size_t j = 0; j < 3; j++)
+      {
+        DREAM3D_REQUIRE_EQUAL(vertValues->getComponent(i, j), static_cast<double>(centroid->getValue(j)))
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCurveKeys()
+  {
+    using Reordering = GeometryHelpers::Reordering;
+
+    // Morton keys interleave the bits with x lowest
+    DREAM3D_REQUIRE_EQUAL(Reordering::MortonKey(1, 0, 0), 1)
+    DREAM3D_REQUIRE_EQUAL(Reordering::MortonKey(0, 1, 0), 2)
+    DREAM3D_REQUIRE_EQUAL(Reordering::MortonKey(0, 0, 1), 4)
+    DREAM3D_REQUIRE_EQUAL(Reordering::MortonKey(3, 0, 0), 9)
+    DREAM3D_REQUIRE_EQUAL(Reordering::MortonKey(0, 3, 5), 278) // y in bits 1 and 4, z in bits 2 and 8
+
+    // The curve enters the corner 16^3 block first, so its cells take the keys 0 to 4095 and consecutive keys
+    // are face neighbors
+    const uint32_t dim = 16;
+    std::vector<std::array<uint32_t, 3>> cells(dim * dim * dim, {{dim, dim, dim}});
+    for(uint32_t z = 0; z < dim; z++)
+    {
+      for(uint32_t y = 0; y < dim; y++)
+      {
+        for(uint32_t x = 0; x < dim; x++)
+        {
+          uint64_t key = Reordering::HilbertKey(x, y, z);
+          DREAM3D_REQUIRED(key, <, cells.size())
+          DREAM3D_REQUIRE_EQUAL(cells[key][0], dim)
+          cells[key] = {{x, y, z}};
+        }
+      }
+    }
+    for(size_t i = 1; i < cells.size(); i++)
+    {
+      uint32_t distance = 0;
+      for(size_t j = 0; j < 3; j++)
+      {
+        distance += (cells[i][j] > cells[i - 1][j]) ? cells[i][j] - cells[i - 1][j] : cells[i - 1][j] - cells[i][j];
+      }
+      DREAM3D_REQUIRE_EQUAL(distance, 1)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestReorderGeometry()
+  {
+    using Reordering = GeometryHelpers::Reordering;
+
+    FloatArrayType::Pointer vertices = CreateVertices();
+    MeshIndexArrayType::Pointer tets = CreateElements(4);
+    FloatArrayType::Pointer originalVerts = std::dynamic_pointer_cast<FloatArrayType>(vertices->deepCopy());
+    MeshIndexArrayType::Pointer originalTets = std::dynamic_pointer_cast<MeshIndexArrayType>(tets->deepCopy());
+
+    for(auto curve : {Reordering::Curve::Morton, Reordering::Curve::Hilbert})
+    {
+      FloatArrayType::Pointer verts = std::dynamic_pointer_cast<FloatArrayType>(originalVerts->deepCopy());
+      MeshIndexArrayType::Pointer elems = std::dynamic_pointer_cast<MeshIndexArrayType>(originalTets->deepCopy());
+      TetrahedralGeom::Pointer geom = TetrahedralGeom::CreateGeometry(elems, verts, "Tets");
+      geom->findElementsContainingVert();
+
+      std::vector<MeshIndexType> vertexOrder;
+      std::vector<MeshIndexType> elementOrder;
+      DREAM3D_REQUIRE(Reordering::ReorderGeometry(geom.get(), curve, vertexOrder, elementOrder))
+      DREAM3D_REQUIRE_EQUAL(vertexOrder.size(), k_NumVertices)
+      DREAM3D_REQUIRE_EQUAL(elementOrder.size(), k_NumElements)
+      DREAM3D_REQUIRE_NULL_POINTER(geom->getElementsContainingVert())
+
+      // Both orders are permutations
+      std::vector<MeshIndexType> sorted = vertexOrder;
+      std::sort(sorted.begin(), sorted.end());
+      for(size_t i = 0; i < sorted.size(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(sorted[i], i)
+      }
+      sorted = elementOrder;
+      std::sort(sorted.begin(), sorted.end());
+      for(size_t i = 0; i < sorted.size(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(sorted[i], i)
+      }
+
+      // Every new vertex and every corner of every new element is where it was before
+      SharedVertexList::Pointer newVerts = geom->getVertices();
+      for(size_t i = 0; i < k_NumVertices; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(std::memcmp(newVerts->getTuplePointer(i), originalVerts->getTuplePointer(vertexOrder[i]), 3 * sizeof(float)), 0)
+      }
+      SharedTetList::Pointer newTets = geom->getTetrahedra();
+      for(size_t i = 0; i < k_NumElements; i++)
+      {
+        for(size_t j = 0; j < 4; j++)
+        {
+          DREAM3D_REQUIRE_EQUAL(vertexOrder[newTets->getComponent(i, j)], originalTets->getComponent(elementOrder[i], j))
+        }
+      }
+
+      std::vector<MeshIndexType> inverse = Reordering::InvertOrder(vertexOrder);
+      for(size_t i = 0; i < k_NumVertices; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(inverse[vertexOrder[i]], i)
+      }
+
+      // An order that does not match the number of tuples leaves the array alone
+      FloatArrayType::Pointer permuted = std::dynamic_pointer_cast<FloatArrayType>(originalVerts->deepCopy());
+      std::vector<MeshIndexType> shortOrder(vertexOrder.begin(), vertexOrder.end() - 1);
+      DREAM3D_REQUIRE(!Reordering::PermuteTuples(permuted.get(), shortOrder))
+      DREAM3D_REQUIRE(std::equal(permuted->begin(), permuted->end(), originalVerts->begin()))
+      DREAM3D_REQUIRE(Reordering::PermuteTuples(permuted.get(), vertexOrder))
+
+      // Lists are moved a tuple at a time from source offsets anywhere in the array
+      NeighborList<int32_t>::Pointer lists = NeighborList<int32_t>::CreateArray(k_NumVertices, "Lists", true);
+      for(size_t i = 0; i < k_NumVertices; i++)
+      {
+        for(size_t j = 0; j <= i % 3; j++)
+        {
+          lists->addEntry(static_cast<int>(i), static_cast<int32_t>(i));
+        }
+      }
+      DREAM3D_REQUIRE(Reordering::PermuteTuples(lists.get(), vertexOrder))
+      for(size_t i = 0; i < k_NumVertices; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(lists->getListSize(static_cast<int>(i)), static_cast<int>(vertexOrder[i] % 3 + 1))
+        DREAM3D_REQUIRE_EQUAL(lists->getList(static_cast<int>(i))->front(), static_cast<int32_t>(vertexOrder[i]))
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### GeometryHelpersTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestTopologyKernels());
+    DREAM3D_REGISTER_TEST(TestGenericKernels());
+    DREAM3D_REGISTER_TEST(TestCurveKeys());
+    DREAM3D_REGISTER_TEST(TestReorderGeometry());
+  }
+
+private:
+  GeometryHelpersTest(const GeometryHelpersTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const GeometryHelpersTest&) = delete;      // Move assignment Not Implemented
+};
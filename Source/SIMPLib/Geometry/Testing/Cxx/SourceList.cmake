@@ -1,5 +1,6 @@
 
 set(TEST_${SUBDIR_NAME}_NAMES
+  GeometryHelpersTest
   ImageGeomTest
   RectGridGeomTest
 )
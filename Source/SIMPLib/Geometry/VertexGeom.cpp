@@ -44,8 +44,17 @@
 
 #include <QtCore/QTextStream>
 
+#include "H5Support/H5Lite.h"
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/H5Utilities.h"
+#include "H5Support/QH5Utilities.h"
+
 #include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/RectGridGeom.h"
 #include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/HDF5/VTKH5Constants.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 // -----------------------------------------------------------------------------
 //
@@ -104,11 +113,100 @@ VertexGeom::Pointer VertexGeom::CreateGeometry(const SharedVertexList::Pointer&
   return ptr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexGeom::Pointer VertexGeom::CreateGeometry(const IGeometryGrid& grid, const QString& name, bool allocate)
+{
+  if(name.isEmpty())
+  {
+    return VertexGeom::NullPointer();
+  }
+  auto d = new VertexGeom();
+  d->setImplicitVertices(grid, allocate);
+  d->setName(name);
+  Pointer ptr(d);
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexGeom::setImplicitVertices(const IGeometryGrid& grid, bool allocate)
+{
+  // Keep a copy so later changes to the source grid do not move these vertices
+  m_ImplicitGrid = std::dynamic_pointer_cast<IGeometryGrid>(grid.deepCopy());
+  m_VertexList = SharedVertexList::NullPointer();
+  m_ImplicitVerticesExpanded = false;
+  m_AllocateImplicitVertices = allocate;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VertexGeom::hasImplicitVertices() const
+{
+  return m_ImplicitGrid.get() != nullptr && !m_ImplicitVerticesExpanded.load(std::memory_order_acquire);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IGeometryGrid::Pointer VertexGeom::getImplicitGrid() const
+{
+  return m_ImplicitGrid;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexGeom::expandImplicitVertices() const
+{
+  QMutexLocker locker(&m_ExpandMutex);
+  if(m_ImplicitVerticesExpanded.load(std::memory_order_acquire))
+  {
+    return;
+  }
+
+  SizeVec3Type dims = m_ImplicitGrid->getDimensions();
+  size_t numVertices = dims[0] * dims[1] * dims[2];
+  std::vector<size_t> vertDims = {3};
+  if(!m_AllocateImplicitVertices)
+  {
+    // Preflight only needs the shape of the list
+    if(nullptr == m_VertexList.get())
+    {
+      m_VertexList = SharedVertexList::CreateArray(numVertices, vertDims, SIMPL::Geometry::SharedVertexList, false);
+    }
+    return;
+  }
+  SharedVertexList::Pointer vertices = SharedVertexList::CreateArray(numVertices, vertDims, SIMPL::Geometry::SharedVertexList, true);
+  float* coords = vertices->getPointer(0);
+  const IGeometryGrid* grid = m_ImplicitGrid.get();
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numVertices);
+  dataAlg.execute([coords, grid](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      grid->getCoords(i, coords + 3 * i);
+    }
+  });
+
+  m_VertexList = vertices;
+  m_ImplicitVerticesExpanded.store(true, std::memory_order_release);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void VertexGeom::initializeWithZeros()
 {
+  if(hasImplicitVertices())
+  {
+    setVertices(VertexGeom::CreateSharedVertexList(getNumberOfVertices()));
+    return;
+  }
   m_VertexList->initializeWithZeros();
 }
 
@@ -138,7 +236,7 @@ void VertexGeom::addOrReplaceAttributeMatrix(const QString& name, AttributeMatri
 // -----------------------------------------------------------------------------
 size_t VertexGeom::getNumberOfElements() const
 {
-  return m_VertexList->getNumberOfTuples();
+  return getNumberOfVertices();
 }
 
 // -----------------------------------------------------------------------------
@@ -310,7 +408,62 @@ int VertexGeom::writeGeometryToHDF5(hid_t parentId, bool writeXdmf) const
   herr_t err = 0;
   std::vector<size_t> tDims(1, 0);
 
-  if(m_VertexList.get() != nullptr)
+  if(hasImplicitVertices())
+  {
+    // Only the grid is written. The Xdmf describes it as a structured mesh so no vertex or index list is needed.
+    hid_t gridId = QH5Utilities::createGroup(parentId, SIMPL::Geometry::ImplicitVertexGrid);
+    if(gridId < 0)
+    {
+      return -1;
+    }
+    H5ScopedGroupSentinel gSentinel(gridId, false);
+    err = QH5Lite::writeStringAttribute(parentId, SIMPL::Geometry::ImplicitVertexGrid, SIMPL::Geometry::GeometryTypeName, m_ImplicitGrid->getGeometryTypeAsString());
+    if(err < 0)
+    {
+      return err;
+    }
+
+    SizeVec3Type dims = m_ImplicitGrid->getDimensions();
+    int64_t volDims[3] = {static_cast<int64_t>(dims[0]), static_cast<int64_t>(dims[1]), static_cast<int64_t>(dims[2])};
+    int32_t rank = 1;
+    hsize_t h5Dims[1] = {3};
+    err = H5Lite::writePointerDataset(gridId, H5_DIMENSIONS, rank, h5Dims, volDims);
+    if(err < 0)
+    {
+      return err;
+    }
+    if(auto image = std::dynamic_pointer_cast<ImageGeom>(m_ImplicitGrid))
+    {
+      FloatVec3Type origin = image->getOrigin();
+      FloatVec3Type spacing = image->getSpacing();
+      err = H5Lite::writePointerDataset(gridId, H5_ORIGIN, rank, h5Dims, origin.data());
+      if(err < 0)
+      {
+        return err;
+      }
+      err = H5Lite::writePointerDataset(gridId, H5_SPACING, rank, h5Dims, spacing.data());
+      if(err < 0)
+      {
+        return err;
+      }
+    }
+    else if(auto rectGrid = std::dynamic_pointer_cast<RectGridGeom>(m_ImplicitGrid))
+    {
+      for(const FloatArrayType::Pointer& bounds : {rectGrid->getXBounds(), rectGrid->getYBounds(), rectGrid->getZBounds()})
+      {
+        if(bounds.get() == nullptr)
+        {
+          continue;
+        }
+        err = GeometryHelpers::GeomIO::WriteListToHDF5(gridId, bounds);
+        if(err < 0)
+        {
+          return err;
+        }
+      }
+    }
+  }
+  else if(m_VertexList.get() != nullptr)
   {
     err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_VertexList);
     if(err < 0)
@@ -376,6 +529,57 @@ int VertexGeom::writeXdmf(QTextStream& out, QString dcName, QString hdfFileName)
   }
 #endif
 
+  if(hasImplicitVertices())
+  {
+    // The cell centers of a grid are the nodes of a grid with the same dimensions
+    SizeVec3Type dims = m_ImplicitGrid->getDimensions();
+    if(auto image = std::dynamic_pointer_cast<ImageGeom>(m_ImplicitGrid))
+    {
+      float origin[3] = {0.0f, 0.0f, 0.0f};
+      image->getCoords(static_cast<size_t>(0), origin);
+      FloatVec3Type spacing = image->getSpacing();
+      out << "    <Topology TopologyType=\"3DCoRectMesh\" Dimensions=\"" << dims[2] << " " << dims[1] << " " << dims[0] << " \"></Topology>"
+          << "\n";
+      out << "    <Geometry Type=\"ORIGIN_DXDYDZ\">"
+          << "\n";
+      out << "      <!-- Origin  Z, Y, X -->"
+          << "\n";
+      out << R"(      <DataItem Format="XML" Dimensions="3">)" << origin[2] << " " << origin[1] << " " << origin[0] << "</DataItem>"
+          << "\n";
+      out << "      <!-- DxDyDz (Spacing/Spacing) Z, Y, X -->"
+          << "\n";
+      out << R"(      <DataItem Format="XML" Dimensions="3">)" << spacing[2] << " " << spacing[1] << " " << spacing[0] << "</DataItem>"
+          << "\n";
+      out << "    </Geometry>"
+          << "\n";
+    }
+    else
+    {
+      out << "    <Topology TopologyType=\"3DRectMesh\" Dimensions=\"" << dims[2] << " " << dims[1] << " " << dims[0] << " \"></Topology>"
+          << "\n";
+      out << "    <Geometry Type=\"VxVyVz\">"
+          << "\n";
+      for(size_t axis = 0; axis < 3; axis++)
+      {
+        out << R"(      <DataItem Format="XML" Dimensions=")" << dims[axis] << R"(" NumberType="Float" Precision="4">)";
+        size_t idx[3] = {0, 0, 0};
+        float coords[3] = {0.0f, 0.0f, 0.0f};
+        for(idx[axis] = 0; idx[axis] < dims[axis]; idx[axis]++)
+        {
+          m_ImplicitGrid->getCoords(idx, coords);
+          out << " " << coords[axis];
+        }
+        out << " </DataItem>"
+            << "\n";
+      }
+      out << "    </Geometry>"
+          << "\n";
+    }
+    out << ""
+        << "\n";
+    return err;
+  }
+
   out << R"(    <Topology TopologyType="Polyvertex" NumberOfElements=")" << getNumberOfVertices() << "\">"
       << "\n";
   out << R"(      <DataItem Format="HDF" NumberType="Int" Dimensions=")" << getNumberOfVertices() << "\">"
@@ -437,6 +641,49 @@ ToolTipGenerator VertexGeom::getToolTipGenerator() const
 int VertexGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 {
   herr_t err = 0;
+  if(H5Utilities::isGroup(parentId, SIMPL::Geometry::ImplicitVertexGrid.toStdString()))
+  {
+    QString gridTypeName;
+    err = QH5Lite::readStringAttribute(parentId, SIMPL::Geometry::ImplicitVertexGrid, SIMPL::Geometry::GeometryTypeName, gridTypeName);
+    if(err < 0)
+    {
+      return err;
+    }
+    IGeometryGrid::Pointer grid = IGeometryGrid::NullPointer();
+    if(gridTypeName.compare(SIMPL::Geometry::ImageGeometry) == 0)
+    {
+      grid = ImageGeom::New();
+    }
+    else if(gridTypeName.compare(SIMPL::Geometry::RectGridGeometry) == 0)
+    {
+      grid = RectGridGeom::New();
+    }
+    else
+    {
+      return -1;
+    }
+    hid_t gridId = H5Gopen(parentId, SIMPL::Geometry::ImplicitVertexGrid.toLatin1().data(), H5P_DEFAULT);
+    if(gridId < 0)
+    {
+      return -1;
+    }
+    H5ScopedGroupSentinel gSentinel(gridId, false);
+    err = grid->readGeometryFromHDF5(gridId, preflight);
+    if(err < 0)
+    {
+      return err;
+    }
+    FloatArrayType::Pointer vertexSizes = GeometryHelpers::GeomIO::ReadListFromHDF5<FloatArrayType>(SIMPL::StringConstants::VertexSizes, parentId, preflight, err);
+    if(err < 0 && err != -2)
+    {
+      return -1;
+    }
+
+    setImplicitVertices(*grid, !preflight);
+    setElementSizes(vertexSizes);
+    return 1;
+  }
+
   SharedVertexList::Pointer vertices = GeometryHelpers::GeomIO::ReadListFromHDF5<SharedVertexList>(SIMPL::Geometry::SharedVertexList, parentId, preflight, err);
   if(vertices.get() == nullptr)
   {
@@ -459,6 +706,15 @@ int VertexGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 // -----------------------------------------------------------------------------
 IGeometry::Pointer VertexGeom::deepCopy(bool forceNoAllocate) const
 {
+  if(hasImplicitVertices())
+  {
+    FloatArrayType::Pointer elementSizes = std::dynamic_pointer_cast<FloatArrayType>((getElementSizes().get() == nullptr) ? nullptr : getElementSizes()->deepCopy(forceNoAllocate));
+    VertexGeom::Pointer vertexCopy = VertexGeom::CreateGeometry(*m_ImplicitGrid, getName(), m_AllocateImplicitVertices && !forceNoAllocate);
+    vertexCopy->setElementSizes(elementSizes);
+    vertexCopy->setSpatialDimensionality(getSpatialDimensionality());
+    return vertexCopy;
+  }
+
   SharedVertexList::Pointer verts = std::dynamic_pointer_cast<SharedVertexList>((getVertices().get() == nullptr) ? nullptr : getVertices()->deepCopy(forceNoAllocate));
   FloatArrayType::Pointer elementSizes = std::dynamic_pointer_cast<FloatArrayType>((getElementSizes().get() == nullptr) ? nullptr : getElementSizes()->deepCopy(forceNoAllocate));
 
@@ -473,13 +729,86 @@ IGeometry::Pointer VertexGeom::deepCopy(bool forceNoAllocate) const
 //
 // -----------------------------------------------------------------------------
 
-// Shared ops includes
-#ifdef GEOM_CLASS_NAME
-#undef GEOM_CLASS_NAME
-#endif
+// Shared vertex ops. These are the SharedVertexOps.cpp functions with the implicit vertices added.
+// -----------------------------------------------------------------------------
+SharedVertexList::Pointer VertexGeom::CreateSharedVertexList(size_t numVertices, bool allocate)
+{
+  std::vector<size_t> vertDims = {3};
+  SharedVertexList::Pointer vertices = SharedVertexList::CreateArray(numVertices, vertDims, SIMPL::Geometry::SharedVertexList, allocate);
+  vertices->initializeWithZeros();
+  return vertices;
+}
 
-#define GEOM_CLASS_NAME VertexGeom
-#include "SIMPLib/Geometry/SharedVertexOps.cpp"
+// -----------------------------------------------------------------------------
+void VertexGeom::resizeVertexList(size_t newNumVertices)
+{
+  getVertices()->resizeTuples(newNumVertices);
+}
+
+// -----------------------------------------------------------------------------
+void VertexGeom::setVertices(SharedVertexList::Pointer vertices)
+{
+  if(vertices.get() != nullptr)
+  {
+    if(vertices->getName() != SIMPL::Geometry::SharedVertexList)
+    {
+      vertices->setName(SIMPL::Geometry::SharedVertexList);
+    }
+  }
+  m_ImplicitGrid = IGeometryGrid::NullPointer();
+  m_ImplicitVerticesExpanded = false;
+  m_VertexList = vertices;
+}
+
+// -----------------------------------------------------------------------------
+SharedVertexList::Pointer VertexGeom::getVertices() const
+{
+  if(hasImplicitVertices())
+  {
+    expandImplicitVertices();
+  }
+  return m_VertexList;
+}
+
+// -----------------------------------------------------------------------------
+void VertexGeom::setCoords(size_t vertId, float coords[3])
+{
+  float* Vert = getVertices()->getTuplePointer(vertId);
+  Vert[0] = coords[0];
+  Vert[1] = coords[1];
+  Vert[2] = coords[2];
+}
+
+// -----------------------------------------------------------------------------
+void VertexGeom::getCoords(size_t vertId, float coords[3]) const
+{
+  if(hasImplicitVertices())
+  {
+    m_ImplicitGrid->getCoords(vertId, coords);
+    return;
+  }
+  float* Vert = m_VertexList->getTuplePointer(vertId);
+  coords[0] = Vert[0];
+  coords[1] = Vert[1];
+  coords[2] = Vert[2];
+}
+
+// -----------------------------------------------------------------------------
+float* VertexGeom::getVertexPointer(size_t i) const
+{
+  return getVertices()->getTuplePointer(i);
+}
+
+// -----------------------------------------------------------------------------
+size_t VertexGeom::getNumberOfVertices() const
+{
+  if(hasImplicitVertices())
+  {
+    SizeVec3Type dims = m_ImplicitGrid->getDimensions();
+    return dims[0] * dims[1] * dims[2];
+  }
+  return m_VertexList->getNumberOfTuples();
+}
 
 // -----------------------------------------------------------------------------
 VertexGeom::Pointer VertexGeom::NullPointer()
@@ -35,8 +35,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 
+#include <QtCore/QMutex>
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/SIMPLib.h"
@@ -44,6 +46,7 @@
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataContainers/AttributeMatrix.h"
 #include "SIMPLib/Geometry/IGeometry.h"
+#include "SIMPLib/Geometry/IGeometryGrid.h"
 
 /**
  * @brief The VertexGeom class represents a point cloud
@@ -61,6 +64,7 @@ class SIMPLib_EXPORT VertexGeom : public IGeometry
   PYB11_METHOD(void getCoords size_t,vertId float,coords[3])
   PYB11_METHOD(size_t getNumberOfVertices)
   PYB11_METHOD(size_t getNumberOfElements)
+  PYB11_METHOD(bool hasImplicitVertices)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
   // clang-format on
@@ -102,6 +106,38 @@ public:
    */
   static Pointer CreateGeometry(const SharedVertexList::Pointer& vertices, const QString& name);
 
+  /**
+   * @brief Creates a VertexGeom with one implicit vertex at the center of each cell of the grid. See setImplicitVertices().
+   * @param grid
+   * @param name
+   * @param allocate
+   * @return
+   */
+  static Pointer CreateGeometry(const IGeometryGrid& grid, const QString& name, bool allocate = true);
+
+  /**
+   * @brief Replaces the vertex list with one vertex at the center of each cell of a copy of the grid. The coordinates
+   * are computed from the grid on each getCoords() call and are only stored once something asks for the vertex list
+   * itself through getVertices(), getVertexPointer(), setCoords() or resizeVertexList(). While the vertices are implicit
+   * the geometry is written to HDF5 and Xdmf as the grid instead of as a vertex list.
+   * @param grid
+   * @param allocate False while preflighting. getVertices() then returns a vertex list of the right shape that is not
+   * allocated, and the coordinates are never computed.
+   */
+  void setImplicitVertices(const IGeometryGrid& grid, bool allocate = true);
+
+  /**
+   * @brief Returns true while the vertices are computed from a grid and have not been stored in a vertex list
+   * @return
+   */
+  bool hasImplicitVertices() const;
+
+  /**
+   * @brief Returns the copy of the grid that the implicit vertices are computed from, or a null pointer
+   * @return
+   */
+  IGeometryGrid::Pointer getImplicitGrid() const;
+
   // -----------------------------------------------------------------------------
   // Inherited from SharedVertexOps
   // -----------------------------------------------------------------------------
@@ -339,8 +375,18 @@ protected:
   void setElementSizes(FloatArrayType::Pointer elementSizes) override;
 
 private:
-  SharedVertexList::Pointer m_VertexList;
+  /**
+   * @brief Computes and stores the vertex list from the implicit grid, once. If the implicit vertices are not
+   * allocated, only an unallocated vertex list of the right shape is stored and the vertices stay implicit.
+   */
+  void expandImplicitVertices() const;
+
+  mutable SharedVertexList::Pointer m_VertexList;
   FloatArrayType::Pointer m_VertexSizes;
+  IGeometryGrid::Pointer m_ImplicitGrid;
+  mutable std::atomic<bool> m_ImplicitVerticesExpanded = {false};
+  bool m_AllocateImplicitVertices = true;
+  mutable QMutex m_ExpandMutex;
 
 public:
   VertexGeom(const VertexGeom&) = delete;            // Copy Constructor Not Implemented
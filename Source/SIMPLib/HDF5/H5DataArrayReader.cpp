@@ -35,16 +35,23 @@
 
 #include "H5DataArrayReader.h"
 
+#include <algorithm>
+#include <mutex>
+#include <numeric>
+#include <type_traits>
 #include <vector>
 
+#include "H5Support/H5ScopedSentinel.h"
 #include "H5Support/QH5Lite.h"
 #include "H5Support/QH5Utilities.h"
 
 #include <QtCore/QDebug>
 
+#include "SIMPLib/DataArrays/BitMaskArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/DataArrays/StringDataArray.h"
+#include "SIMPLib/HDF5/H5HyperslabRegion.h"
 
 #define MIKESTEMP 1
 
@@ -80,6 +87,149 @@ IDataArray::Pointer readH5Dataset(hid_t locId, const QString& datasetPath, const
   }
   return ptr;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+hid_t nativeType()
+{
+  if constexpr(std::is_same<T, bool>::value || std::is_same<T, uint8_t>::value)
+  {
+    return H5T_NATIVE_UINT8;
+  }
+  else if constexpr(std::is_same<T, int8_t>::value)
+  {
+    return H5T_NATIVE_INT8;
+  }
+  else if constexpr(std::is_same<T, uint16_t>::value)
+  {
+    return H5T_NATIVE_UINT16;
+  }
+  else if constexpr(std::is_same<T, int16_t>::value)
+  {
+    return H5T_NATIVE_INT16;
+  }
+  else if constexpr(std::is_same<T, uint32_t>::value)
+  {
+    return H5T_NATIVE_UINT32;
+  }
+  else if constexpr(std::is_same<T, int32_t>::value)
+  {
+    return H5T_NATIVE_INT32;
+  }
+  else if constexpr(std::is_same<T, uint64_t>::value)
+  {
+    return H5T_NATIVE_UINT64;
+  }
+  else if constexpr(std::is_same<T, int64_t>::value)
+  {
+    return H5T_NATIVE_INT64;
+  }
+  else if constexpr(std::is_same<T, float>::value)
+  {
+    return H5T_NATIVE_FLOAT;
+  }
+  else
+  {
+    static_assert(std::is_same<T, double>::value, "Unsupported type for a hyperslab read");
+    return H5T_NATIVE_DOUBLE;
+  }
+}
+
+/**
+ * @brief Builds the HDF5 file space selection for a tuple region. The dataset is expected
+ * to be laid out like H5DataArrayWriter writes it: the tuple dimensions in reverse (slowest first)
+ * followed by the component dimensions, which are always selected in full.
+ */
+bool buildHyperslab(const std::vector<hsize_t>& h5Dims, const std::vector<size_t>& tDims, const std::vector<size_t>& cDims, const H5HyperslabRegion& region, std::vector<hsize_t>& offset,
+                    std::vector<hsize_t>& count, std::vector<hsize_t>& stride)
+{
+  size_t tRank = tDims.size();
+  if(h5Dims.size() < tRank || !region.fitsWithin(tDims))
+  {
+    return false;
+  }
+  for(size_t i = 0; i < tRank; i++)
+  {
+    if(h5Dims[i] != tDims[tRank - 1 - i])
+    {
+      return false;
+    }
+  }
+  size_t numComponents = std::accumulate(cDims.begin(), cDims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+  size_t h5Components = std::accumulate(h5Dims.begin() + tRank, h5Dims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+  if(numComponents != h5Components)
+  {
+    return false;
+  }
+
+  offset.assign(h5Dims.size(), 0);
+  count = h5Dims;
+  stride.assign(h5Dims.size(), 1);
+  for(size_t i = 0; i < tRank; i++)
+  {
+    size_t d = tRank - 1 - i;
+    offset[i] = region.getOffset()[d];
+    count[i] = region.getCount()[d];
+    stride[i] = region.getStride()[d];
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+IDataArray::Pointer readH5DatasetRegion(hid_t locId, const QString& datasetPath, const std::vector<size_t>& tDims, const std::vector<size_t>& cDims, const H5HyperslabRegion& region,
+                                        bool metaDataOnly)
+{
+  hid_t datasetId = H5Dopen(locId, datasetPath.toLatin1().data(), H5P_DEFAULT);
+  if(datasetId < 0)
+  {
+    return IDataArray::NullPointer();
+  }
+  hid_t fileSpaceId = H5Dget_space(datasetId);
+  int rank = H5Sget_simple_extent_ndims(fileSpaceId);
+  std::vector<hsize_t> h5Dims(static_cast<size_t>(std::max(rank, 0)), 0);
+  H5Sget_simple_extent_dims(fileSpaceId, h5Dims.data(), nullptr);
+
+  std::vector<hsize_t> offset;
+  std::vector<hsize_t> count;
+  std::vector<hsize_t> stride;
+  IDataArray::Pointer ptr = IDataArray::NullPointer();
+  if(!buildHyperslab(h5Dims, tDims, cDims, region, offset, count, stride))
+  {
+    qDebug() << "The requested region does not fit the dimensions of dataset " << datasetPath;
+  }
+  else if(metaDataOnly)
+  {
+    ptr = DataArray<T>::CreateArray(region.getTupleDims(), cDims, datasetPath, false);
+  }
+  else
+  {
+    typename DataArray<T>::Pointer data = DataArray<T>::CreateArray(region.getTupleDims(), cDims, datasetPath, true);
+    herr_t err = H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, offset.data(), stride.data(), count.data(), nullptr);
+    if(err >= 0)
+    {
+      hid_t memSpaceId = H5Screate_simple(static_cast<int>(count.size()), count.data(), nullptr);
+      err = H5Dread(datasetId, nativeType<T>(), memSpaceId, fileSpaceId, H5P_DEFAULT, data->getVoidPointer(0));
+      H5Sclose(memSpaceId);
+    }
+    if(err < 0)
+    {
+      qDebug() << "readH5DatasetRegion read error: " << __FILE__ << "(" << __LINE__ << ")";
+    }
+    else
+    {
+      ptr = data;
+    }
+  }
+
+  H5Sclose(fileSpaceId);
+  H5Dclose(datasetId);
+  return ptr;
+}
 } // namespace Detail
 
 // -----------------------------------------------------------------------------
@@ -176,13 +326,8 @@ IDataArray::Pointer H5DataArrayReader::ReadStringDataArray(hid_t gid, const QStr
   // dimensions does not make sense.
   StringDataArray::Pointer strTemp = StringDataArray::CreateArray(dims[0], name, true);
 
-  std::vector<std::string> strings;
-  err = H5Lite::readVectorOfStringDataset(gid, name.toStdString(), strings);
-  // Copy the data into
-  for(std::vector<std::string>::size_type i = 0; i < strings.size(); i++)
-  {
-    strTemp->setValue(i, QString::fromStdString(strings[i]));
-  }
+  // The UTF-8 bytes are read straight into the array's buffer
+  err = strTemp->readH5Data(gid);
   if(err < 0)
   {
     err = H5Tclose(typeId);
@@ -194,6 +339,30 @@ IDataArray::Pointer H5DataArrayReader::ReadStringDataArray(hid_t gid, const QStr
   return ptr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer H5DataArrayReader::ReadBitMaskArray(hid_t gid, const QString& name, bool metaDataOnly)
+{
+  QString classType;
+  int version = 0;
+  std::vector<size_t> tDims;
+  std::vector<size_t> cDims;
+
+  herr_t err = ReadRequiredAttributes(gid, name, classType, version, tDims, cDims);
+  if(err < 0)
+  {
+    return IDataArray::NullPointer();
+  }
+
+  BitMaskArray::Pointer ptr = BitMaskArray::CreateArray(tDims, cDims, name, !metaDataOnly);
+  if(!metaDataOnly && ptr->readH5Data(gid) < 0)
+  {
+    return IDataArray::NullPointer();
+  }
+  return ptr;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -390,6 +559,121 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
   return ptr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString& name, const H5HyperslabRegion& region, bool metaDataOnly)
+{
+  QString classType;
+  int version = 0;
+  std::vector<size_t> tDims;
+  std::vector<size_t> cDims;
+
+  herr_t err = ReadRequiredAttributes(gid, name, classType, version, tDims, cDims);
+  if(err < 0)
+  {
+    return IDataArray::NullPointer();
+  }
+
+  // A region that selects every tuple is just a normal read
+  if(region.coversAll(tDims))
+  {
+    return ReadIDataArray(gid, name, metaDataOnly);
+  }
+
+  if(classType.compare("DataArray<bool>") == 0)
+  {
+    return Detail::readH5DatasetRegion<bool>(gid, name, tDims, cDims, region, metaDataOnly);
+  }
+  return ReadDatasetRegion(gid, name, tDims, cDims, region, metaDataOnly);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer H5DataArrayReader::ReadDatasetRegion(hid_t gid, const QString& name, const std::vector<size_t>& tDims, const std::vector<size_t>& cDims, const H5HyperslabRegion& region,
+                                                         bool metaDataOnly)
+{
+  H5T_class_t attr_type;
+  size_t attr_size;
+  QVector<hsize_t> dims;
+  IDataArray::Pointer ptr = IDataArray::NullPointer();
+
+  hid_t typeId = QH5Lite::getDatasetType(gid, name);
+  if(typeId < 0)
+  {
+    return ptr;
+  }
+  herr_t err = QH5Lite::getDatasetInfo(gid, name, dims, attr_type, attr_size);
+  if(err < 0)
+  {
+    qDebug() << "Error in getDatasetInfo method in ReadDatasetRegion.";
+    H5Tclose(typeId);
+    return ptr;
+  }
+
+  switch(attr_type)
+  {
+  case H5T_INTEGER:
+    if((H5Tequal(typeId, H5T_STD_U8BE) != 0) || (H5Tequal(typeId, H5T_STD_U8LE) != 0))
+    {
+      ptr = Detail::readH5DatasetRegion<uint8_t>(gid, name, tDims, cDims, region, metaDataOnly);
+    }
+    else if((H5Tequal(typeId, H5T_STD_U16BE) != 0) || (H5Tequal(typeId, H5T_STD_U16LE) != 0))
+    {
+      ptr = Detail::readH5DatasetRegion<uint16_t>(gid, name, tDims, cDims, region, metaDataOnly);
+    }
+    else if((H5Tequal(typeId, H5T_STD_U32BE) != 0) || (H5Tequal(typeId, H5T_STD_U32LE) != 0))
+    {
+      ptr = Detail::readH5DatasetRegion<uint32_t>(gid, name, tDims, cDims, region, metaDataOnly);
+    }
+    else if((H5Tequal(typeId, H5T_STD_U64BE) != 0) || (H5Tequal(typeId, H5T_STD_U64LE) != 0))
+    {
+      ptr = Detail::readH5DatasetRegion<uint64_t>(gid, name, tDims, cDims, region, metaDataOnly);
+    }
+    else if((H5Tequal(typeId, H5T_STD_I8BE) != 0) || (H5Tequal(typeId, H5T_STD_I8LE) != 0))
+    {
+      ptr = Detail::readH5DatasetRegion<int8_t>(gid, name, tDims, cDims, region, metaDataOnly);
+    }
+    else if((H5Tequal(typeId, H5T_STD_I16BE) != 0) || (H5Tequal(typeId, H5T_STD_I16LE) != 0))
+    {
+      ptr = Detail::readH5DatasetRegion<int16_t>(gid, name, tDims, cDims, region, metaDataOnly);
+    }
+    else if((H5Tequal(typeId, H5T_STD_I32BE) != 0) || (H5Tequal(typeId, H5T_STD_I32LE) != 0))
+    {
+      ptr = Detail::readH5DatasetRegion<int32_t>(gid, name, tDims, cDims, region, metaDataOnly);
+    }
+    else if((H5Tequal(typeId, H5T_STD_I64BE) != 0) || (H5Tequal(typeId, H5T_STD_I64LE) != 0))
+    {
+      ptr = Detail::readH5DatasetRegion<int64_t>(gid, name, tDims, cDims, region, metaDataOnly);
+    }
+    else
+    {
+      qDebug() << "Unknown Type: " << typeId << " at " << name;
+    }
+    break;
+  case H5T_FLOAT:
+    if(attr_size == 4)
+    {
+      ptr = Detail::readH5DatasetRegion<float>(gid, name, tDims, cDims, region, metaDataOnly);
+    }
+    else if(attr_size == 8)
+    {
+      ptr = Detail::readH5DatasetRegion<double>(gid, name, tDims, cDims, region, metaDataOnly);
+    }
+    else
+    {
+      qDebug() << "Unknown Floating point type";
+    }
+    break;
+  default:
+    qDebug() << "Error: ReadDatasetRegion() Unsupported dataset type: " << attr_type << "(" << QString::fromStdString(H5Utilities::HDFClassTypeAsStr(attr_type)) << ")";
+  }
+
+  H5Tclose(typeId);
+  return ptr;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -547,3 +831,51 @@ IDataArray::Pointer H5DataArrayReader::ReadNeighborListData(hid_t gid, const QSt
   }
   return iDataArray;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::function<IDataArray::Pointer()> H5DataArrayReader::CreateDeferredLoader(hid_t gid, const QString& name)
+{
+  ssize_t fileNameLength = H5Fget_name(gid, nullptr, 0);
+  ssize_t groupPathLength = H5Iget_name(gid, nullptr, 0);
+  if(fileNameLength <= 0 || groupPathLength <= 0)
+  {
+    return {};
+  }
+  std::vector<char> buffer(static_cast<size_t>(std::max(fileNameLength, groupPathLength)) + 1, 0);
+  H5Fget_name(gid, buffer.data(), buffer.size());
+  QString filePath = QString::fromLocal8Bit(buffer.data());
+  H5Iget_name(gid, buffer.data(), buffer.size());
+  QString groupPath = QString::fromUtf8(buffer.data());
+
+  return [filePath, groupPath, name]() -> IDataArray::Pointer {
+    // Deferred arrays may be first touched from worker threads while an IO filter is running
+    std::lock_guard<std::recursive_mutex> lock(LibraryMutex());
+
+    hid_t fileId = QH5Utilities::openFile(filePath, true); // Open the file Read Only
+    if(fileId < 0)
+    {
+      qDebug() << "Error opening file " << filePath << " to read the deferred array " << name;
+      return IDataArray::NullPointer();
+    }
+    H5ScopedFileSentinel sentinel(fileId, true);
+    hid_t groupId = H5Gopen(fileId, groupPath.toUtf8().constData(), H5P_DEFAULT);
+    if(groupId < 0)
+    {
+      qDebug() << "Error opening group " << groupPath << " to read the deferred array " << name;
+      return IDataArray::NullPointer();
+    }
+    sentinel.addGroupId(groupId);
+    return ReadIDataArray(groupId, name, false);
+  };
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::recursive_mutex& H5DataArrayReader::LibraryMutex()
+{
+  static std::recursive_mutex mutex;
+  return mutex;
+}
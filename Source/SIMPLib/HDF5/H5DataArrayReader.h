@@ -37,13 +37,17 @@
 
 #include <hdf5.h>
 
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include <QtCore/QString>
 
 #include "SIMPLib/SIMPLib.h"
 
 class IDataArray;
+class H5HyperslabRegion;
 using IDataArrayShPtrType = std::shared_ptr<IDataArray>;
 
 /**
@@ -77,6 +81,33 @@ public:
    */
   static IDataArrayShPtrType ReadIDataArray(hid_t gid, const QString& name, bool metaDataOnly = false);
 
+  /**
+   * @brief ReadIDataArray Reads only the tuples selected by a region from a DataArray stored in the HDF5 file.
+   * The returned array has the region counts as its tuple dimensions. A region that covers every tuple falls
+   * back to a normal read.
+   * @param gid The HDF5 Group to read the data array from
+   * @param name The name of the data set
+   * @param region The tuple region to read, in SIMPL (XYZ) tuple dimension order
+   * @param metaDataOnly Read just the meta data about the DataArray or actually read all the data
+   * @return Null if the data set is not a numeric DataArray or the region does not fit its tuple dimensions
+   */
+  static IDataArrayShPtrType ReadIDataArray(hid_t gid, const QString& name, const H5HyperslabRegion& region, bool metaDataOnly = false);
+
+  /**
+   * @brief ReadDatasetRegion Reads the tuples selected by a region from a plain numeric HDF5 data set that has
+   * no SIMPL attributes. The data set must be laid out as the reversed tuple dimensions followed by
+   * dimensions whose product equals the number of components.
+   * @param gid The HDF5 Group to read the data set from
+   * @param name The name of the data set
+   * @param tDims The full tuple dimensions of the data set, in SIMPL (XYZ) order
+   * @param cDims The component dimensions of the created array
+   * @param region The tuple region to read
+   * @param metaDataOnly Create the array without reading or allocating any data
+   * @return
+   */
+  static IDataArrayShPtrType ReadDatasetRegion(hid_t gid, const QString& name, const std::vector<size_t>& tDims, const std::vector<size_t>& cDims, const H5HyperslabRegion& region,
+                                               bool metaDataOnly = false);
+
   /**
    * @brief ReadNeighborListData
    * @param gid The HDF5 Group to read the data array from
@@ -95,6 +126,34 @@ public:
    */
   static IDataArrayShPtrType ReadStringDataArray(hid_t gid, const QString& name, bool metaDataOnly = false);
 
+  /**
+   * @brief ReadBitMaskArray
+   * @param gid The HDF5 Group to read the data array from
+   * @param name The name of the data set
+   * @param metaDataOnly Read just the meta data about the DataArray or actually read all the data
+   * @return
+   */
+  static IDataArrayShPtrType ReadBitMaskArray(hid_t gid, const QString& name, bool metaDataOnly = false);
+
+  /**
+   * @brief CreateDeferredLoader Creates a loader for IDataArray::setDeferredLoader() that reads a DataArray
+   * from the same file and group later on. The loader reopens the file by name so the group id does not need
+   * to stay open, but the file must not be modified before the data is read.
+   * @param gid The HDF5 Group that holds the data set
+   * @param name The name of the data set
+   * @return An empty function if the file name or group path could not be determined
+   */
+  static std::function<IDataArrayShPtrType()> CreateDeferredLoader(hid_t gid, const QString& name);
+
+  /**
+   * @brief LibraryMutex Returns the process wide mutex that serializes calls into the HDF5 library, which is
+   * not guaranteed to be built thread safe. The deferred loaders take it for every read and FilterPipeline
+   * holds it while an IO filter preflights or executes. It is recursive because an IO filter may read
+   * deferred arrays itself.
+   * @return
+   */
+  static std::recursive_mutex& LibraryMutex();
+
 protected:
   H5DataArrayReader();
 
@@ -0,0 +1,294 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "H5HyperslabRegion.h"
+
+#include <QtCore/QJsonArray>
+
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+QJsonArray ToJsonArray(const std::vector<size_t>& values)
+{
+  QJsonArray array;
+  for(size_t value : values)
+  {
+    array.push_back(static_cast<double>(value));
+  }
+  return array;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<size_t> FromJsonArray(const QJsonArray& array)
+{
+  std::vector<size_t> values;
+  values.reserve(static_cast<size_t>(array.size()));
+  for(const QJsonValue& value : array)
+  {
+    values.push_back(static_cast<size_t>(value.toDouble()));
+  }
+  return values;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5HyperslabRegion::H5HyperslabRegion() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5HyperslabRegion::~H5HyperslabRegion() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5HyperslabRegion::H5HyperslabRegion(const std::vector<size_t>& offset, const std::vector<size_t>& count, const std::vector<size_t>& stride)
+: m_Offset(offset)
+, m_Count(count)
+, m_Stride(stride)
+{
+  if(m_Stride.empty())
+  {
+    m_Stride.assign(m_Count.size(), 1);
+  }
+  for(size_t& s : m_Stride)
+  {
+    s = (s == 0) ? 1 : s;
+  }
+  if(m_Offset.size() != m_Count.size() || m_Stride.size() != m_Count.size())
+  {
+    m_Offset.clear();
+    m_Count.clear();
+    m_Stride.clear();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5HyperslabRegion H5HyperslabRegion::FromImageIndexBounds(const SizeVec3Type& minIndex, const SizeVec3Type& maxIndex, const SizeVec3Type& stride)
+{
+  std::vector<size_t> offset(3, 0);
+  std::vector<size_t> count(3, 0);
+  std::vector<size_t> strides(3, 1);
+  for(size_t i = 0; i < 3; i++)
+  {
+    if(minIndex[i] > maxIndex[i])
+    {
+      return {};
+    }
+    strides[i] = (stride[i] == 0) ? 1 : stride[i];
+    offset[i] = minIndex[i];
+    count[i] = (maxIndex[i] - minIndex[i]) / strides[i] + 1;
+  }
+  return {offset, count, strides};
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5HyperslabRegion::isEmpty() const
+{
+  return m_Count.empty();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t H5HyperslabRegion::getRank() const
+{
+  return m_Count.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<size_t>& H5HyperslabRegion::getOffset() const
+{
+  return m_Offset;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<size_t>& H5HyperslabRegion::getCount() const
+{
+  return m_Count;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<size_t>& H5HyperslabRegion::getStride() const
+{
+  return m_Stride;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> H5HyperslabRegion::getTupleDims() const
+{
+  return m_Count;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t H5HyperslabRegion::getNumberOfTuples() const
+{
+  if(m_Count.empty())
+  {
+    return 0;
+  }
+  size_t numTuples = 1;
+  for(size_t c : m_Count)
+  {
+    numTuples *= c;
+  }
+  return numTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5HyperslabRegion::fitsWithin(const std::vector<size_t>& tDims) const
+{
+  if(m_Count.empty() || tDims.size() != m_Count.size())
+  {
+    return false;
+  }
+  for(size_t i = 0; i < m_Count.size(); i++)
+  {
+    if(m_Count[i] == 0)
+    {
+      return false;
+    }
+    size_t lastIndex = m_Offset[i] + (m_Count[i] - 1) * m_Stride[i];
+    if(m_Offset[i] >= tDims[i] || lastIndex >= tDims[i])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5HyperslabRegion::coversAll(const std::vector<size_t>& tDims) const
+{
+  if(m_Count.empty())
+  {
+    return true;
+  }
+  if(tDims.size() != m_Count.size())
+  {
+    return false;
+  }
+  for(size_t i = 0; i < m_Count.size(); i++)
+  {
+    if(m_Offset[i] != 0 || m_Count[i] != tDims[i] || (m_Stride[i] != 1 && m_Count[i] > 1))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5HyperslabRegion::cropImageGeometry(ImageGeom& geom) const
+{
+  if(m_Count.size() != 3)
+  {
+    return;
+  }
+  FloatVec3Type origin = geom.getOrigin();
+  FloatVec3Type spacing = geom.getSpacing();
+  for(size_t i = 0; i < 3; i++)
+  {
+    origin[i] = origin[i] + static_cast<float>(m_Offset[i]) * spacing[i];
+    spacing[i] = spacing[i] * static_cast<float>(m_Stride[i]);
+  }
+  geom.setOrigin(origin);
+  geom.setSpacing(spacing);
+  geom.setDimensions(m_Count[0], m_Count[1], m_Count[2]);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5HyperslabRegion::writeJson(QJsonObject& json) const
+{
+  json["Offset"] = ToJsonArray(m_Offset);
+  json["Count"] = ToJsonArray(m_Count);
+  json["Stride"] = ToJsonArray(m_Stride);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5HyperslabRegion::readJson(const QJsonObject& json)
+{
+  if(!json["Offset"].isArray() || !json["Count"].isArray() || !json["Stride"].isArray())
+  {
+    return false;
+  }
+  H5HyperslabRegion region(FromJsonArray(json["Offset"].toArray()), FromJsonArray(json["Count"].toArray()), FromJsonArray(json["Stride"].toArray()));
+  if(region.isEmpty() && !json["Count"].toArray().isEmpty())
+  {
+    return false;
+  }
+  *this = region;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5HyperslabRegion::operator==(const H5HyperslabRegion& rhs) const
+{
+  return m_Offset == rhs.m_Offset && m_Count == rhs.m_Count && m_Stride == rhs.m_Stride;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5HyperslabRegion::operator!=(const H5HyperslabRegion& rhs) const
+{
+  return !(*this == rhs);
+}
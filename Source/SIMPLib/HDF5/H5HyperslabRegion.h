@@ -0,0 +1,145 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <vector>
+
+#include <QtCore/QJsonObject>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLArray.hpp"
+
+class ImageGeom;
+
+/**
+ * @brief The H5HyperslabRegion class describes a strided sub-block of a data array's
+ * tuple space that should be read from an HDF5 dataset instead of the whole dataset.
+ *
+ * The offset, count and stride vectors are stored in SIMPL tuple dimension order
+ * (X fastest, i.e. the same order as the "TupleDimensions" attribute and ImageGeom).
+ * An empty region (rank 0) means "read everything".
+ */
+class SIMPLib_EXPORT H5HyperslabRegion
+{
+public:
+  H5HyperslabRegion();
+  ~H5HyperslabRegion();
+
+  /**
+   * @brief Creates a region from per dimension offset, count and stride values. An empty
+   * stride vector is treated as a stride of 1 in every dimension.
+   * @param offset
+   * @param count
+   * @param stride
+   */
+  H5HyperslabRegion(const std::vector<size_t>& offset, const std::vector<size_t>& count, const std::vector<size_t>& stride = {});
+
+  H5HyperslabRegion(const H5HyperslabRegion&) = default;
+  H5HyperslabRegion(H5HyperslabRegion&&) = default;
+  H5HyperslabRegion& operator=(const H5HyperslabRegion&) = default;
+  H5HyperslabRegion& operator=(H5HyperslabRegion&&) = default;
+
+  /**
+   * @brief Creates a 3D region from inclusive ImageGeom index bounds. Any stride value of
+   * zero is treated as 1. Returns an empty region if a minimum index is larger than its maximum.
+   * @param minIndex Inclusive minimum X, Y, Z voxel index
+   * @param maxIndex Inclusive maximum X, Y, Z voxel index
+   * @param stride Voxel stride along X, Y, Z
+   * @return
+   */
+  static H5HyperslabRegion FromImageIndexBounds(const SizeVec3Type& minIndex, const SizeVec3Type& maxIndex, const SizeVec3Type& stride = SizeVec3Type(1, 1, 1));
+
+  /**
+   * @brief Returns true if the region does not select anything, which readers treat as "read the whole dataset"
+   */
+  bool isEmpty() const;
+
+  /**
+   * @brief Returns the number of tuple dimensions the region was defined for
+   */
+  size_t getRank() const;
+
+  const std::vector<size_t>& getOffset() const;
+  const std::vector<size_t>& getCount() const;
+  const std::vector<size_t>& getStride() const;
+
+  /**
+   * @brief Returns the tuple dimensions of an array read through this region, which are the per dimension counts.
+   */
+  std::vector<size_t> getTupleDims() const;
+
+  /**
+   * @brief Returns the total number of tuples selected by the region
+   */
+  size_t getNumberOfTuples() const;
+
+  /**
+   * @brief Returns true if every selected index lies inside an array with the given tuple dimensions.
+   * @param tDims
+   */
+  bool fitsWithin(const std::vector<size_t>& tDims) const;
+
+  /**
+   * @brief Returns true if the region selects every tuple of an array with the given tuple dimensions.
+   * @param tDims
+   */
+  bool coversAll(const std::vector<size_t>& tDims) const;
+
+  /**
+   * @brief Updates an ImageGeom that describes the full dataset so that it describes only the
+   * selected sub-volume: the origin moves to the first selected voxel, the spacing is multiplied
+   * by the stride and the dimensions become the per axis counts. Nothing is done if the region is not 3D.
+   * @param geom
+   */
+  void cropImageGeometry(ImageGeom& geom) const;
+
+  /**
+   * @brief Writes the region to a json object
+   * @param json
+   */
+  void writeJson(QJsonObject& json) const;
+
+  /**
+   * @brief Reads the region from a json object
+   * @param json
+   * @return false if the json does not hold a consistent region
+   */
+  bool readJson(const QJsonObject& json);
+
+  bool operator==(const H5HyperslabRegion& rhs) const;
+  bool operator!=(const H5HyperslabRegion& rhs) const;
+
+private:
+  std::vector<size_t> m_Offset;
+  std::vector<size_t> m_Count;
+  std::vector<size_t> m_Stride;
+};
@@ -5,6 +5,7 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/HDF5/H5BoundaryStatsDataDelegate.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5DataArrayReader.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5DataArrayWriter.hpp
+  ${SIMPLib_SOURCE_DIR}/HDF5/H5HyperslabRegion.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5Macros.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5MatrixStatsDataDelegate.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5PrecipitateStatsDataDelegate.h
@@ -18,6 +19,7 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
 set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/HDF5/H5BoundaryStatsDataDelegate.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5DataArrayReader.cpp
+  ${SIMPLib_SOURCE_DIR}/HDF5/H5HyperslabRegion.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5MatrixStatsDataDelegate.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5PrecipitateStatsDataDelegate.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5PrimaryStatsDataDelegate.cpp
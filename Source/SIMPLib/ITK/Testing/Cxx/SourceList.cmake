@@ -3,6 +3,7 @@ set(TEST_${SUBDIR_NAME}_NAMES
   itkDream3DTransformContainerToTransformTest
   itkTransformToDream3DTransformContainerTest
   itkTransformToDream3DITransformContainerTest
+  itkDream3DImageRegionStreamingTest
 )
 
 include( ${CMP_SOURCE_DIR}/ITKSupport/IncludeITK.cmake)
@@ -0,0 +1,163 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <itkCastImageFilter.h>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/ITK/itkDream3DDataStreamingWriter.h"
+#include "SIMPLib/ITK/itkDream3DImageRegionSource.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class itkDream3DImageRegionStreamingTest
+{
+public:
+  itkDream3DImageRegionStreamingTest() = default;
+  ~itkDream3DImageRegionStreamingTest() = default;
+
+  using SourceType = itk::Dream3DImageRegionSource<float, 3>;
+
+  const SizeVec3Type k_Dims = SizeVec3Type(7, 5, 9);
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  ImageGeom::Pointer createGeometry()
+  {
+    ImageGeom::Pointer imageGeom = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    imageGeom->setDimensions(k_Dims);
+    imageGeom->setSpacing(FloatVec3Type(0.5f, 1.0f, 2.0f));
+    imageGeom->setOrigin(FloatVec3Type(1.0f, 2.0f, 3.0f));
+    return imageGeom;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FloatArrayType::Pointer createArray(size_t numTuples)
+  {
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(numTuples, "Values", true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      array->setValue(i, static_cast<float>(i) * 0.25f);
+    }
+    return array;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestWholeRegionIsNotCopied()
+  {
+    ImageGeom::Pointer imageGeom = createGeometry();
+    FloatArrayType::Pointer array = createArray(imageGeom->getNumberOfElements());
+
+    SourceType::Pointer source = SourceType::New();
+    source->SetImageGeometry(imageGeom);
+    source->SetDataArray(array);
+    source->Update();
+
+    SourceType::ImageType* image = source->GetOutput();
+    DREAM3D_REQUIRE_EQUAL(image->GetBufferPointer(), array->getPointer(0))
+    DREAM3D_REQUIRE_EQUAL(image->GetLargestPossibleRegion().GetSize(2), k_Dims[2])
+    DREAM3D_REQUIRE_EQUAL(image->GetSpacing()[0], 0.5)
+    DREAM3D_REQUIRE_EQUAL(image->GetOrigin()[2], 3.0)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestStreamThroughFilter()
+  {
+    ImageGeom::Pointer imageGeom = createGeometry();
+    size_t numElements = imageGeom->getNumberOfElements();
+    FloatArrayType::Pointer array = createArray(numElements);
+
+    SourceType::Pointer source = SourceType::New();
+    source->SetImageGeometry(imageGeom);
+    source->SetDataArray(array);
+
+    using CastFilterType = itk::CastImageFilter<SourceType::ImageType, itk::Image<double, 3>>;
+    CastFilterType::Pointer cast = CastFilterType::New();
+    cast->SetInput(source->GetOutput());
+
+    using WriterType = itk::Dream3DDataStreamingWriter<double, 3>;
+    DoubleArrayType::Pointer result = DoubleArrayType::CreateArray(numElements, "Result", true);
+    result->initializeWithValue(-1.0);
+    WriterType::Pointer writer = WriterType::New();
+    writer->SetInput(cast->GetOutput());
+    writer->SetDataArray(result);
+    writer->SetNumberOfStreamDivisions(3);
+    writer->Update();
+
+    // The source only ever produced the last slab
+    SourceType::ImageType::RegionType buffered = source->GetOutput()->GetBufferedRegion();
+    DREAM3D_REQUIRE_EQUAL(buffered.GetSize(2), 3)
+    DREAM3D_REQUIRE_EQUAL(buffered.GetIndex(2), 6)
+    DREAM3D_REQUIRE(source->GetOutput()->GetBufferPointer() != array->getPointer(0))
+
+    for(size_t i = 0; i < numElements; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(result->getValue(i), static_cast<double>(array->getValue(i)))
+    }
+
+    // A destination of the wrong size is rejected
+    DoubleArrayType::Pointer tooSmall = DoubleArrayType::CreateArray(numElements - 1, "TooSmall", true);
+    writer->SetDataArray(tooSmall);
+    bool caught = false;
+    try
+    {
+      writer->Update();
+    } catch(itk::ExceptionObject&)
+    {
+      caught = true;
+    }
+    DREAM3D_REQUIRE_EQUAL(caught, true)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    std::cout << "#### itkDream3DImageRegionStreamingTest Starting ####" << std::endl;
+    DREAM3D_REGISTER_TEST(TestWholeRegionIsNotCopied());
+    DREAM3D_REGISTER_TEST(TestStreamThroughFilter());
+  }
+
+private:
+  itkDream3DImageRegionStreamingTest(const itkDream3DImageRegionStreamingTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const itkDream3DImageRegionStreamingTest&) = delete;                     // Move assignment Not Implemented
+};
@@ -0,0 +1,130 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include "itkConfigure.h"
+#if defined(ITK_VERSION_MAJOR) && ITK_VERSION_MAJOR == 4
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wself-assign-field"
+#endif
+#endif
+
+#include <itkImage.h>
+#include <itkImageRegionSplitterBase.h>
+#include <itkNumericTraits.h>
+#include <itkNumericTraitsRGBAPixel.h>
+#include <itkNumericTraitsRGBPixel.h>
+#include <itkNumericTraitsVectorPixel.h>
+#include <itkProcessObject.h>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/ITK/itkSupportConstants.h"
+
+namespace itk
+{
+/**
+ * @brief Pulls its input image through the upstream pipeline in NumberOfStreamDivisions pieces and
+ * copies every piece straight into a DataArray, which must already hold one tuple per pixel of the
+ * input's largest possible region. Combined with a Dream3DImageRegionSource and streamable filters
+ * only one slab of the volume is buffered at a time. Filters that cannot stream enlarge their
+ * requested region and the result is still correct, only without the memory bound.
+ *
+ * The destination must not be the source array unless every filter in between is pixel-wise, as
+ * later pieces would otherwise read neighbors that have already been overwritten.
+ *
+ * Like itk::ImageFileWriter, calling Update() runs the streaming loop. Progress is reported after
+ * every piece and the loop stops when AbortGenerateData is set, e.g. by a Dream3DFilterInterruption.
+ */
+template <typename PixelType, unsigned int VDimension>
+class Dream3DDataStreamingWriter : public ProcessObject
+{
+public:
+  /** Standard class typedefs. */
+  using Self = Dream3DDataStreamingWriter;
+  using Superclass = ProcessObject;
+  using Pointer = SmartPointer<Self>;
+
+  using ImageType = typename itk::Image<PixelType, VDimension>;
+  using RegionType = typename ImageType::RegionType;
+  using ValueType = typename itk::NumericTraits<PixelType>::ValueType;
+  using DataArrayPixelType = typename ::DataArray<ValueType>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+  itkTypeMacro(Dream3DDataStreamingWriter, ProcessObject);
+
+  virtual void SetInput(const ImageType* input);
+  const ImageType* GetInput();
+
+  /**
+   * @brief Sets the array that receives the pixels of the input image
+   */
+  void SetDataArray(const typename DataArrayPixelType::Pointer& dataArray);
+
+  itkSetMacro(NumberOfStreamDivisions, unsigned int);
+  itkGetConstMacro(NumberOfStreamDivisions, unsigned int);
+
+  /** Splitter used to divide the largest possible region. Defaults to splitting along the slowest dimension. */
+  itkSetObjectMacro(RegionSplitter, ImageRegionSplitterBase);
+  itkGetModifiableObjectMacro(RegionSplitter, ImageRegionSplitterBase);
+
+  /**
+   * @brief Streams the input into the DataArray
+   */
+  void Update() override;
+
+protected:
+  Dream3DDataStreamingWriter();
+  ~Dream3DDataStreamingWriter() override;
+
+  void VerifyPreconditions() ITKv5_CONST override;
+
+private:
+  using Superclass::SetInput;
+
+  typename DataArrayPixelType::Pointer m_DataArray;
+  unsigned int m_NumberOfStreamDivisions = 8;
+  ImageRegionSplitterBase::Pointer m_RegionSplitter;
+
+public:
+  Dream3DDataStreamingWriter(const Dream3DDataStreamingWriter&) = delete;            // Copy Constructor Not Implemented
+  Dream3DDataStreamingWriter(Dream3DDataStreamingWriter&&) = delete;                 // Move Constructor Not Implemented
+  Dream3DDataStreamingWriter& operator=(const Dream3DDataStreamingWriter&) = delete; // Copy Assignment Not Implemented
+  Dream3DDataStreamingWriter& operator=(Dream3DDataStreamingWriter&&) = delete;      // Move Assignment Not Implemented
+};
+} // namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkDream3DDataStreamingWriter.hxx"
+#endif
@@ -0,0 +1,134 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include "itkDream3DDataStreamingWriter.h"
+
+#include <itkImageRegionSplitterSlowDimension.h>
+
+#include "SIMPLib/ITK/itkDream3DImageRegionCopy.h"
+
+namespace itk
+{
+
+template <typename PixelType, unsigned int VDimension>
+Dream3DDataStreamingWriter<PixelType, VDimension>::Dream3DDataStreamingWriter()
+: m_RegionSplitter(ImageRegionSplitterSlowDimension::New().GetPointer())
+{
+  this->SetNumberOfRequiredInputs(1);
+}
+
+template <typename PixelType, unsigned int VDimension>
+Dream3DDataStreamingWriter<PixelType, VDimension>::~Dream3DDataStreamingWriter() = default;
+
+template <typename PixelType, unsigned int VDimension>
+void Dream3DDataStreamingWriter<PixelType, VDimension>::SetInput(const ImageType* input)
+{
+  // Process object is not const-correct so the const_cast is required here
+  this->ProcessObject::SetNthInput(0, const_cast<ImageType*>(input));
+}
+
+template <typename PixelType, unsigned int VDimension>
+const typename Dream3DDataStreamingWriter<PixelType, VDimension>::ImageType* Dream3DDataStreamingWriter<PixelType, VDimension>::GetInput()
+{
+  return itkDynamicCastInDebugMode<const ImageType*>(this->GetPrimaryInput());
+}
+
+template <typename PixelType, unsigned int VDimension>
+void Dream3DDataStreamingWriter<PixelType, VDimension>::SetDataArray(const typename DataArrayPixelType::Pointer& dataArray)
+{
+  if(dataArray != m_DataArray)
+  {
+    m_DataArray = dataArray;
+    this->Modified();
+  }
+}
+
+template <typename PixelType, unsigned int VDimension>
+void Dream3DDataStreamingWriter<PixelType, VDimension>::VerifyPreconditions() ITKv5_CONST
+{
+  if(m_DataArray == nullptr)
+  {
+    itkExceptionMacro("DataArray not set!");
+  }
+  if(m_DataArray->getNumberOfComponents() * sizeof(ValueType) != sizeof(PixelType))
+  {
+    itkExceptionMacro("Number of components of DataArray (" + m_DataArray->getName().toStdString() + ") does not match the pixel type");
+  }
+  if(m_RegionSplitter.IsNull())
+  {
+    itkExceptionMacro("RegionSplitter not set!");
+  }
+  Superclass::VerifyPreconditions();
+}
+
+template <typename PixelType, unsigned int VDimension>
+void Dream3DDataStreamingWriter<PixelType, VDimension>::Update()
+{
+  this->VerifyPreconditions();
+
+  ImageType* inputPtr = const_cast<ImageType*>(this->GetInput());
+  inputPtr->UpdateOutputInformation();
+  const RegionType largestRegion = inputPtr->GetLargestPossibleRegion();
+  if(m_DataArray->getNumberOfTuples() != largestRegion.GetNumberOfPixels())
+  {
+    itkExceptionMacro("DataArray (" + m_DataArray->getName().toStdString() + ") does not have one tuple per pixel of the input image");
+  }
+  PixelType* destination = reinterpret_cast<PixelType*>(m_DataArray->getPointer(0));
+
+  const unsigned int numPieces = m_RegionSplitter->GetNumberOfSplits(largestRegion, std::max(m_NumberOfStreamDivisions, 1u));
+
+  this->SetAbortGenerateData(false);
+  this->InvokeEvent(StartEvent());
+  this->UpdateProgress(0.0f);
+  for(unsigned int piece = 0; piece < numPieces && !this->GetAbortGenerateData(); piece++)
+  {
+    RegionType streamRegion = largestRegion;
+    m_RegionSplitter->GetSplit(piece, numPieces, streamRegion);
+
+    inputPtr->SetRequestedRegion(streamRegion);
+    inputPtr->PropagateRequestedRegion();
+    inputPtr->UpdateOutputData();
+
+    // The upstream filters may have buffered more than was requested
+    Dream3DCopyImageRegion<PixelType, VDimension>(inputPtr->GetBufferPointer(), inputPtr->GetBufferedRegion(), destination, largestRegion, streamRegion);
+
+    this->UpdateProgress(static_cast<float>(piece + 1) / static_cast<float>(numPieces));
+  }
+  this->InvokeEvent(EndEvent());
+
+  // Lets upstream filters free their last piece if their ReleaseDataFlag is set
+  this->ReleaseInputs();
+}
+
+} // namespace itk
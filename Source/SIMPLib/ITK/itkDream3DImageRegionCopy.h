@@ -0,0 +1,81 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+
+#include <itkImageRegion.h>
+
+namespace itk
+{
+/**
+ * @brief Copies the pixels of region from source to destination. Both buffers hold their pixels in
+ * ITK (x fastest) order and cover sourceRegion and destinationRegion respectively, which must both
+ * contain region. The copy is done one row of the fastest dimension at a time.
+ * @param source
+ * @param sourceRegion Region covered by source
+ * @param destination
+ * @param destinationRegion Region covered by destination
+ * @param region Region to copy
+ */
+template <typename PixelType, unsigned int VDimension>
+void Dream3DCopyImageRegion(const PixelType* source, const ImageRegion<VDimension>& sourceRegion, PixelType* destination, const ImageRegion<VDimension>& destinationRegion,
+                            const ImageRegion<VDimension>& region)
+{
+  const SizeValueType numPixels = region.GetNumberOfPixels();
+  if(numPixels == 0)
+  {
+    return;
+  }
+
+  const SizeValueType rowLength = region.GetSize(0);
+  const SizeValueType numRows = numPixels / rowLength;
+  typename ImageRegion<VDimension>::IndexType index = region.GetIndex();
+  for(SizeValueType row = 0; row < numRows; row++)
+  {
+    const PixelType* sourceRow = source + sourceRegion.ComputeOffset(index);
+    std::copy(sourceRow, sourceRow + rowLength, destination + destinationRegion.ComputeOffset(index));
+
+    // Step to the first pixel of the next row, carrying into the slower dimensions
+    for(unsigned int dim = 1; dim < VDimension; dim++)
+    {
+      index[dim]++;
+      if(index[dim] < region.GetIndex(dim) + static_cast<IndexValueType>(region.GetSize(dim)))
+      {
+        break;
+      }
+      index[dim] = region.GetIndex(dim);
+    }
+  }
+}
+} // namespace itk
@@ -0,0 +1,117 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include "itkConfigure.h"
+#if defined(ITK_VERSION_MAJOR) && ITK_VERSION_MAJOR == 4
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wself-assign-field"
+#endif
+#endif
+
+#include <itkImageSource.h>
+#include <itkNumericTraits.h>
+#include <itkNumericTraitsRGBAPixel.h>
+#include <itkNumericTraitsRGBPixel.h>
+#include <itkNumericTraitsVectorPixel.h>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/ITK/itkImportDream3DImageContainer.h"
+#include "SIMPLib/ITK/itkSupportConstants.h"
+
+namespace itk
+{
+/**
+ * @brief Presents a cell array of an ImageGeom as an ITK image source that honors the requested region
+ * of its output. When a downstream filter or a Dream3DDataStreamingWriter requests a sub-region, only
+ * that region is copied out of the DataArray, so a streamed pipeline never holds the whole volume in a
+ * second buffer. When the largest possible region is requested the output wraps the DataArray buffer
+ * without copying, like InPlaceDream3DDataToImageFilter, and downstream in-place filters may then write
+ * into the array.
+ */
+template <typename PixelType, unsigned int VDimension>
+class Dream3DImageRegionSource : public ImageSource<itk::Image<PixelType, VDimension>>
+{
+public:
+  /** Standard class typedefs. */
+  using Self = Dream3DImageRegionSource;
+  using Pointer = SmartPointer<Self>;
+
+  using ImageType = typename itk::Image<PixelType, VDimension>;
+  using ImagePointer = typename ImageType::Pointer;
+  using RegionType = typename ImageType::RegionType;
+  using ImportImageContainerType = ImportDream3DImageContainer<itk::SizeValueType, PixelType>;
+  using ValueType = typename itk::NumericTraits<PixelType>::ValueType;
+  using DataArrayPixelType = typename ::DataArray<ValueType>;
+  using Superclass = typename itk::ImageSource<ImageType>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+  itkTypeMacro(Dream3DImageRegionSource, ImageSource);
+
+  /**
+   * @brief Sets the geometry giving the origin, spacing and dimensions of the image
+   */
+  void SetImageGeometry(const ImageGeom::Pointer& imageGeom);
+
+  /**
+   * @brief Sets the cell array holding the pixels of the image
+   */
+  void SetDataArray(const typename DataArrayPixelType::Pointer& dataArray);
+
+protected:
+  Dream3DImageRegionSource();
+  ~Dream3DImageRegionSource() override;
+
+  void VerifyPreconditions() ITKv5_CONST override;
+
+  void GenerateOutputInformation() override;
+  void GenerateData() override;
+
+private:
+  ImageGeom::Pointer m_ImageGeometry;
+  typename DataArrayPixelType::Pointer m_DataArray;
+
+public:
+  Dream3DImageRegionSource(const Dream3DImageRegionSource&) = delete;            // Copy Constructor Not Implemented
+  Dream3DImageRegionSource(Dream3DImageRegionSource&&) = delete;                 // Move Constructor Not Implemented
+  Dream3DImageRegionSource& operator=(const Dream3DImageRegionSource&) = delete; // Copy Assignment Not Implemented
+  Dream3DImageRegionSource& operator=(Dream3DImageRegionSource&&) = delete;      // Move Assignment Not Implemented
+};
+} // namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkDream3DImageRegionSource.hxx"
+#endif
@@ -0,0 +1,145 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include "itkDream3DImageRegionSource.h"
+
+#include "SIMPLib/ITK/itkDream3DImageRegionCopy.h"
+
+namespace itk
+{
+
+template <typename PixelType, unsigned int VDimension>
+Dream3DImageRegionSource<PixelType, VDimension>::Dream3DImageRegionSource() = default;
+
+template <typename PixelType, unsigned int VDimension>
+Dream3DImageRegionSource<PixelType, VDimension>::~Dream3DImageRegionSource() = default;
+
+template <typename PixelType, unsigned int VDimension>
+void Dream3DImageRegionSource<PixelType, VDimension>::SetImageGeometry(const ImageGeom::Pointer& imageGeom)
+{
+  if(imageGeom != m_ImageGeometry)
+  {
+    m_ImageGeometry = imageGeom;
+    this->Modified();
+  }
+}
+
+template <typename PixelType, unsigned int VDimension>
+void Dream3DImageRegionSource<PixelType, VDimension>::SetDataArray(const typename DataArrayPixelType::Pointer& dataArray)
+{
+  if(dataArray != m_DataArray)
+  {
+    m_DataArray = dataArray;
+    this->Modified();
+  }
+}
+
+template <typename PixelType, unsigned int VDimension>
+void Dream3DImageRegionSource<PixelType, VDimension>::VerifyPreconditions() ITKv5_CONST
+{
+  if(VDimension != 2 && VDimension != 3)
+  {
+    itkExceptionMacro("Dimension must be 2 or 3.");
+  }
+  if(m_ImageGeometry == nullptr)
+  {
+    itkExceptionMacro("ImageGeometry not set!");
+  }
+  if(m_DataArray == nullptr)
+  {
+    itkExceptionMacro("DataArray not set!");
+  }
+  if(m_DataArray->getNumberOfTuples() != m_ImageGeometry->getNumberOfElements())
+  {
+    itkExceptionMacro("DataArray (" + m_DataArray->getName().toStdString() + ") does not have one tuple per cell of the ImageGeometry");
+  }
+  if(m_DataArray->getNumberOfComponents() * sizeof(ValueType) != sizeof(PixelType))
+  {
+    itkExceptionMacro("Number of components of DataArray (" + m_DataArray->getName().toStdString() + ") does not match the pixel type");
+  }
+  Superclass::VerifyPreconditions();
+}
+
+template <typename PixelType, unsigned int VDimension>
+void Dream3DImageRegionSource<PixelType, VDimension>::GenerateOutputInformation()
+{
+  Superclass::GenerateOutputInformation();
+
+  FloatVec3Type torigin = m_ImageGeometry->getOrigin();
+  FloatVec3Type tspacing = m_ImageGeometry->getSpacing();
+  SizeVec3Type tDims = m_ImageGeometry->getDimensions();
+  typename ImageType::PointType origin;
+  typename ImageType::SizeType size;
+  typename ImageType::SpacingType spacing;
+  typename ImageType::DirectionType direction;
+  direction.SetIdentity();
+  for(size_t i = 0; i < VDimension; i++)
+  {
+    spacing[i] = tspacing[i];
+    origin[i] = torigin[i];
+    size[i] = tDims[i];
+  }
+
+  ImagePointer outputPtr = this->GetOutput();
+  outputPtr->SetSpacing(spacing);
+  outputPtr->SetOrigin(origin);
+  outputPtr->SetDirection(direction);
+  outputPtr->SetLargestPossibleRegion(RegionType(size));
+}
+
+template <typename PixelType, unsigned int VDimension>
+void Dream3DImageRegionSource<PixelType, VDimension>::GenerateData()
+{
+  ImagePointer outputPtr = this->GetOutput();
+  const RegionType largestRegion = outputPtr->GetLargestPossibleRegion();
+  const RegionType requestedRegion = outputPtr->GetRequestedRegion();
+  PixelType* buffer = reinterpret_cast<PixelType*>(m_DataArray->getPointer(0));
+
+  if(requestedRegion == largestRegion)
+  {
+    // Wrap the whole array without taking ownership of it
+    typename ImportImageContainerType::Pointer container = ImportImageContainerType::New();
+    container->SetImportPointer(buffer, largestRegion.GetNumberOfPixels(), false);
+    outputPtr->SetBufferedRegion(largestRegion);
+    outputPtr->SetPixelContainer(container);
+    return;
+  }
+
+  // Only the requested slab is copied out of the array
+  outputPtr->SetBufferedRegion(requestedRegion);
+  outputPtr->Allocate();
+  Dream3DCopyImageRegion<PixelType, VDimension>(buffer, largestRegion, outputPtr->GetBufferPointer(), requestedRegion, requestedRegion);
+}
+
+} // namespace itk
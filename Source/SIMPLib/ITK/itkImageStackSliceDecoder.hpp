@@ -0,0 +1,139 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstring>
+
+#include <QtCore/QObject>
+#include <QtCore/QString>
+
+#include <itkImage.h>
+#include <itkImageFileReader.h>
+#include <itkImageIOBase.h>
+#include <itkImageIOFactory.h>
+#include <itkRGBAPixel.h>
+#include <itkRGBPixel.h>
+
+#include "SIMPLib/Utilities/ImageStackReader.h"
+
+namespace ITKDream3DHelper
+{
+
+/**
+ * @brief Reads filePath with imageIO straight into destination, which holds numPixels pixels
+ */
+template <typename PixelType>
+int32_t ReadImageSliceInto(const QString& filePath, const itk::ImageIOBase::Pointer& imageIO, void* destination, size_t numPixels, QString& message)
+{
+  using ImageType = itk::Image<PixelType, 3>;
+  using ReaderType = itk::ImageFileReader<ImageType>;
+
+  typename ReaderType::Pointer reader = ReaderType::New();
+  reader->SetImageIO(imageIO);
+  reader->SetFileName(filePath.toLocal8Bit().constData());
+  reader->GetOutput()->GetPixelContainer()->SetImportPointer(static_cast<PixelType*>(destination), numPixels, false);
+  try
+  {
+    reader->Update();
+  } catch(itk::ExceptionObject& err)
+  {
+    message = QObject::tr("Failed to read image '%1': %2").arg(filePath).arg(err.GetDescription());
+    return -5;
+  }
+
+  // The reader only keeps the imported buffer when the sizes agree, copy the pixels otherwise
+  const PixelType* buffer = reader->GetOutput()->GetBufferPointer();
+  if(buffer != destination)
+  {
+    ::memcpy(destination, buffer, numPixels * sizeof(PixelType));
+  }
+  return 0;
+}
+
+/**
+ * @brief Decodes one scalar, RGB or RGBA image file into numBytes bytes at destination. The file must
+ * hold exactly numBytes bytes of TComponent values. Meant to be used as an ImageStackReader::SliceDecoder.
+ */
+template <typename TComponent>
+int32_t ReadImageSlice(const QString& filePath, void* destination, size_t numBytes, QString& message)
+{
+  itk::ImageIOBase::Pointer imageIO = itk::ImageIOFactory::CreateImageIO(filePath.toLocal8Bit().constData(), itk::ImageIOFactory::ReadMode);
+  if(nullptr == imageIO)
+  {
+    message = QObject::tr("Unable to read image '%1'").arg(filePath);
+    return -2;
+  }
+
+  try
+  {
+    imageIO->SetFileName(filePath.toLocal8Bit().constData());
+    imageIO->ReadImageInformation();
+  } catch(itk::ExceptionObject& err)
+  {
+    message = QObject::tr("Failed to read image '%1': %2").arg(filePath).arg(err.GetDescription());
+    return -5;
+  }
+
+  const size_t numPixels = static_cast<size_t>(imageIO->GetImageSizeInPixels());
+  const size_t numComponents = imageIO->GetNumberOfComponents();
+  if(numPixels * numComponents * sizeof(TComponent) != numBytes)
+  {
+    message = QObject::tr("Image '%1' has %2 pixels with %3 components, which does not match the size of the slice").arg(filePath).arg(numPixels).arg(numComponents);
+    return -3;
+  }
+
+  switch(imageIO->GetPixelType())
+  {
+  case itk::ImageIOBase::SCALAR:
+    return ReadImageSliceInto<TComponent>(filePath, imageIO, destination, numPixels, message);
+  case itk::ImageIOBase::RGB:
+    return ReadImageSliceInto<itk::RGBPixel<TComponent>>(filePath, imageIO, destination, numPixels, message);
+  case itk::ImageIOBase::RGBA:
+    return ReadImageSliceInto<itk::RGBAPixel<TComponent>>(filePath, imageIO, destination, numPixels, message);
+  default:
+    break;
+  }
+  message = QObject::tr("Unsupported pixel type in image '%1'").arg(filePath);
+  return -4;
+}
+
+/**
+ * @brief Returns a SliceDecoder reading images of TComponent values with ITK
+ */
+template <typename TComponent>
+ImageStackReader::SliceDecoder CreateImageSliceDecoder()
+{
+  return &ReadImageSlice<TComponent>;
+}
+
+} // namespace ITKDream3DHelper
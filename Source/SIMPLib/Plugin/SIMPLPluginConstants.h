@@ -18,6 +18,12 @@ const QString Completed("Completed");
 const QString ErrorLog("ErrorLog");
 const QString WarningLog("WarningLog");
 const QString StatusLog("StatusLog");
+const QString Profile("Profile");
+const QString ProfileSummary("ProfileSummary");
+const QString ProfileTrace("ProfileTrace");
+const QString MemoryBudget("MemoryBudget");
+const QString RefuseOverBudget("RefuseOverBudget");
+const QString MemoryEstimate("MemoryEstimate");
 const QString OutputLinks("OutputLinks");
 const QString Message("Message");
 const QString Code("Code");
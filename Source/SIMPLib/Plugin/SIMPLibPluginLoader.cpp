@@ -41,14 +41,208 @@
 
 // Qt Includes
 #include <QtCore/QCoreApplication>
+#include <QtCore/QDateTime>
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
 #include <QtCore/QPluginLoader>
+#include <QtCore/QSaveFile>
+#include <QtCore/QSet>
+#include <QtCore/QStandardPaths>
 #include <QtCore/QStringList>
 
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/PluginManager.h"
+#include "SIMPLib/SIMPLibVersion.h"
+
+namespace
+{
+const QString k_ManifestVersion("Version");
+const QString k_ManifestPlugins("Plugins");
+const QString k_ManifestPath("Path");
+const QString k_ManifestSize("Size");
+const QString k_ManifestLastModified("LastModified");
+const QString k_ManifestFilters("Filters");
+const QString k_ManifestClassName("ClassName");
+const QString k_ManifestUuid("Uuid");
+
+// -----------------------------------------------------------------------------
+QJsonObject CreateManifestEntry(const QString& path)
+{
+  QFileInfo fi(path);
+  QJsonObject entry;
+  entry[k_ManifestPath] = path;
+  entry[k_ManifestSize] = QString::number(fi.size());
+  entry[k_ManifestLastModified] = QString::number(fi.lastModified().toMSecsSinceEpoch());
+  entry[k_ManifestFilters] = QJsonArray();
+  return entry;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Loads the plugin at the given path and registers its filters. Returns
+ * false if the file could not be loaded or is not an ISIMPLibPlugin.
+ */
+bool LoadPlugin(FilterManager* filterManager, const QString& path, bool quiet)
+{
+  if(!quiet)
+  {
+    qDebug() << "Plugin Being Loaded:" << path;
+  }
+  QPluginLoader loader(path);
+  QObject* plugin = loader.instance();
+  if(!quiet)
+  {
+    qDebug() << "    Pointer: " << plugin << "\n";
+  }
+  if(plugin == nullptr)
+  {
+    if(!quiet)
+    {
+      QString message("The plugin did not load with the following error\n");
+      message.append(loader.errorString());
+      message.append("\n\n");
+      message.append("Possible causes include missing libraries that plugin depends on.");
+      qDebug() << message;
+    }
+    return false;
+  }
+
+  ISIMPLibPlugin* ipPlugin = qobject_cast<ISIMPLibPlugin*>(plugin);
+  if(ipPlugin == nullptr)
+  {
+    return false;
+  }
+  ipPlugin->registerFilters(filterManager);
+  ipPlugin->setDidLoad(true);
+  ipPlugin->setLocation(path);
+  PluginManager::Instance()->addPlugin(ipPlugin);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Loads every plugin in pluginFilePaths. Only the first plugin with a given
+ * file name is registered. If manifestPlugins is not null an entry is appended for
+ * every path that lists the filters that plugin registered.
+ */
+void LoadAllPlugins(FilterManager* filterManager, const QStringList& pluginFilePaths, bool quiet, QJsonArray* manifestPlugins)
+{
+  QStringList pluginFileNames;
+  for(const QString& path : pluginFilePaths)
+  {
+    QJsonObject entry = CreateManifestEntry(path);
+    QString fileName = QFileInfo(path).fileName();
+    if(pluginFileNames.contains(fileName, Qt::CaseSensitive))
+    {
+      if(manifestPlugins != nullptr)
+      {
+        manifestPlugins->append(entry);
+      }
+      continue;
+    }
+
+    FilterManager::Collection before = filterManager->getFactories();
+    if(LoadPlugin(filterManager, path, quiet))
+    {
+      pluginFileNames += fileName;
+    }
+    if(manifestPlugins == nullptr)
+    {
+      continue;
+    }
+
+    QJsonArray filters;
+    FilterManager::Collection after = filterManager->getFactories();
+    for(auto iter = after.constBegin(); iter != after.constEnd(); ++iter)
+    {
+      if(!before.contains(iter.key()))
+      {
+        QJsonObject filter;
+        filter[k_ManifestClassName] = iter.key();
+        filter[k_ManifestUuid] = iter.value()->getUuid().toString();
+        filters.append(filter);
+      }
+    }
+    entry[k_ManifestFilters] = filters;
+    manifestPlugins->append(entry);
+  }
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Reads the manifest and returns its plugin entries if it was written by this
+ * version of SIMPLib and describes exactly the plugin files that are on disk.
+ */
+bool ReadManifest(const QString& manifestPath, const QStringList& pluginFilePaths, QJsonArray& manifestPlugins)
+{
+  QFile file(manifestPath);
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    return false;
+  }
+  QJsonParseError parseError;
+  QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &parseError);
+  if(parseError.error != QJsonParseError::NoError || !doc.isObject())
+  {
+    return false;
+  }
+  QJsonObject root = doc.object();
+  if(root[k_ManifestVersion].toString() != SIMPLib::Version::Complete())
+  {
+    return false;
+  }
+
+  manifestPlugins = root[k_ManifestPlugins].toArray();
+  if(manifestPlugins.size() != pluginFilePaths.size())
+  {
+    return false;
+  }
+  QSet<QString> onDisk;
+  for(const QString& path : pluginFilePaths)
+  {
+    onDisk.insert(path);
+  }
+  for(const auto& value : manifestPlugins)
+  {
+    QJsonObject entry = value.toObject();
+    QString path = entry[k_ManifestPath].toString();
+    if(!onDisk.contains(path))
+    {
+      return false;
+    }
+    QJsonObject current = CreateManifestEntry(path);
+    if(entry[k_ManifestSize] != current[k_ManifestSize] || entry[k_ManifestLastModified] != current[k_ManifestLastModified])
+    {
+      return false;
+    }
+    onDisk.remove(path);
+  }
+  return onDisk.isEmpty();
+}
+
+// -----------------------------------------------------------------------------
+void WriteManifest(const QString& manifestPath, const QJsonArray& manifestPlugins, bool quiet)
+{
+  QDir().mkpath(QFileInfo(manifestPath).absolutePath());
+  QJsonObject root;
+  root[k_ManifestVersion] = SIMPLib::Version::Complete();
+  root[k_ManifestPlugins] = manifestPlugins;
+
+  QSaveFile file(manifestPath);
+  if(!file.open(QIODevice::WriteOnly) || file.write(QJsonDocument(root).toJson()) < 0 || !file.commit())
+  {
+    if(!quiet)
+    {
+      qDebug() << "Could not write the plugin manifest" << manifestPath;
+    }
+  }
+}
+} // namespace
 
 // -----------------------------------------------------------------------------
 //
@@ -63,7 +257,7 @@ SIMPLibPluginLoader::~SIMPLibPluginLoader() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void SIMPLibPluginLoader::LoadPluginFilters(FilterManager* filterManager, bool quiet)
+QStringList SIMPLibPluginLoader::FindPluginFilePaths(bool quiet)
 {
   QStringList pluginDirs;
   pluginDirs << qApp->applicationDirPath();
@@ -233,48 +427,82 @@ void SIMPLibPluginLoader::LoadPluginFilters(FilterManager* filterManager, bool q
     }
   }
 
-  FilterManager::RegisterKnownFilters(filterManager);
+  return pluginFilePaths;
+}
 
-  PluginManager* pluginManager = PluginManager::Instance();
-  QStringList pluginFileNames;
-  QVector<ISIMPLibPlugin*> loadedPlugins;
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLibPluginLoader::LoadPluginFilters(FilterManager* filterManager, bool quiet)
+{
+  QStringList pluginFilePaths = FindPluginFilePaths(quiet);
+
+  FilterManager::RegisterKnownFilters(filterManager);
 
   // Now that we have a sorted list of plugins, go ahead and load them all from the
   // file system and add each to the toolbar and menu
-  for(QString path : pluginFilePaths)
+  LoadAllPlugins(filterManager, pluginFilePaths, quiet, nullptr);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLibPluginLoader::LoadPluginFiltersLazily(FilterManager* filterManager, bool quiet)
+{
+  QStringList pluginFilePaths = FindPluginFilePaths(quiet);
+
+  FilterManager::RegisterKnownFilters(filterManager);
+
+  QString manifestPath = ManifestFilePath();
+  QJsonArray manifestPlugins;
+  if(!ReadManifest(manifestPath, pluginFilePaths, manifestPlugins))
   {
     if(!quiet)
     {
-      qDebug() << "Plugin Being Loaded:" << path;
-    }
-    QPluginLoader loader(path);
-    QFileInfo fi(path);
-    QString fileName = fi.fileName();
-    QObject* plugin = loader.instance();
-    if(!quiet)
-    {
-      qDebug() << "    Pointer: " << plugin << "\n";
+      qDebug() << "Plugin manifest is missing or out of date. Loading all plugins.";
     }
-    if((plugin != nullptr) && !pluginFileNames.contains(fileName, Qt::CaseSensitive))
+    manifestPlugins = QJsonArray();
+    LoadAllPlugins(filterManager, pluginFilePaths, quiet, &manifestPlugins);
+    WriteManifest(manifestPath, manifestPlugins, quiet);
+    return;
+  }
+
+  for(const auto& value : manifestPlugins)
+  {
+    QJsonObject entry = value.toObject();
+    QString path = entry[k_ManifestPath].toString();
+    for(const auto& filterValue : entry[k_ManifestFilters].toArray())
     {
-      ISIMPLibPlugin* ipPlugin = qobject_cast<ISIMPLibPlugin*>(plugin);
-      if(ipPlugin != nullptr)
-      {
-        loadedPlugins.push_back(ipPlugin);
-        ipPlugin->registerFilters(filterManager);
-        ipPlugin->setDidLoad(true);
-        ipPlugin->setLocation(path);
-        pluginManager->addPlugin(ipPlugin);
-      }
-      pluginFileNames += fileName;
+      QJsonObject filter = filterValue.toObject();
+      filterManager->addDeferredFilter(filter[k_ManifestClassName].toString(), QUuid(filter[k_ManifestUuid].toString()), path);
     }
-    else if(!quiet)
+  }
+
+  filterManager->setDeferredPluginLoader([filterManager, manifestPath, quiet](const QString& pluginPath) {
+    bool didLoad = LoadPlugin(filterManager, pluginPath, quiet);
+    if(!didLoad)
     {
-      QString message("The plugin did not load with the following error\n");
-      message.append(loader.errorString());
-      message.append("\n\n");
-      message.append("Possible causes include missing libraries that plugin depends on.");
-      qDebug() << message;
+      // Force a full scan the next time the application starts
+      QFile::remove(manifestPath);
     }
+    return didLoad;
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString SIMPLibPluginLoader::ManifestFilePath()
+{
+  QByteArray manifestEnvPath = qgetenv("SIMPL_PLUGIN_MANIFEST");
+  if(!manifestEnvPath.isEmpty())
+  {
+    return QString::fromLocal8Bit(manifestEnvPath);
+  }
+  QString cacheDir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+  if(cacheDir.isEmpty())
+  {
+    cacheDir = QDir::tempPath();
   }
+  return cacheDir + "/SIMPLibPluginManifest.json";
 }
@@ -35,6 +35,9 @@
 
 #pragma once
 
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
 #include "SIMPLib/SIMPLib.h"
 
 class FilterManager;
@@ -56,6 +59,32 @@ public:
    */
   static void LoadPluginFilters(FilterManager* filterManager, bool quiet = false);
 
+  /**
+   * @brief LoadPluginFiltersLazily Registers the filters of every plugin that is
+   * listed in the plugin manifest without loading the plugins themselves. A plugin
+   * is loaded the first time the FilterManager is asked for one of its filters. If
+   * the manifest is missing or does not match the plugins that are on disk then all
+   * the plugins are loaded as in LoadPluginFilters and the manifest is rewritten.
+   * @param filterManager The FilterManager object to load the filters into
+   * @param quiet Dump progress to std::cout
+   */
+  static void LoadPluginFiltersLazily(FilterManager* filterManager, bool quiet = false);
+
+  /**
+   * @brief FindPluginFilePaths Returns the paths of all the plugin files in the
+   * plugin search directories
+   * @param quiet Dump progress to std::cout
+   * @return
+   */
+  static QStringList FindPluginFilePaths(bool quiet = false);
+
+  /**
+   * @brief ManifestFilePath Returns the path of the cached plugin manifest. The
+   * SIMPL_PLUGIN_MANIFEST environment variable overrides the default location.
+   * @return
+   */
+  static QString ManifestFilePath();
+
 protected:
   SIMPLibPluginLoader();
 
@@ -0,0 +1,150 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <iostream>
+
+#include <QtCore/QUuid>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class DeferredPluginLoadingTest
+{
+public:
+  DeferredPluginLoadingTest() = default;
+  virtual ~DeferredPluginLoadingTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestAlreadyRegistered()
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer factory = fm->getFactoryFromClassName("CreateDataArray");
+    DREAM3D_REQUIRE(factory.get() != nullptr)
+
+    // A filter that is already registered is never deferred
+    fm->addDeferredFilter("CreateDataArray", factory->getUuid(), "Fake.plugin");
+    DREAM3D_REQUIRE_EQUAL(fm->hasDeferredPlugins(), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLoadOnLookup()
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer factory = fm->getFactoryFromClassName("CreateDataArray");
+    DREAM3D_REQUIRE(factory.get() != nullptr)
+    QUuid uuid = factory->getUuid();
+
+    DREAM3D_REQUIRE_EQUAL(fm->removeFilterFactory(uuid), true)
+    fm->addDeferredFilter("CreateDataArray", uuid, "Fake.plugin");
+    DREAM3D_REQUIRE_EQUAL(fm->hasDeferredPlugins(), true)
+
+    int loadCount = 0;
+    QString loadedPath;
+    fm->setDeferredPluginLoader([&](const QString& pluginPath) {
+      loadCount++;
+      loadedPath = pluginPath;
+      fm->addFilterFactory("CreateDataArray", factory);
+      return true;
+    });
+
+    DREAM3D_REQUIRE(fm->getFactoryFromUuid(uuid) == factory)
+    DREAM3D_REQUIRE_EQUAL(loadCount, 1)
+    DREAM3D_REQUIRE_EQUAL(loadedPath, QString("Fake.plugin"))
+    DREAM3D_REQUIRE_EQUAL(fm->hasDeferredPlugins(), false)
+
+    // The plugin is only loaded once
+    DREAM3D_REQUIRE(fm->getFactoryFromClassName("CreateDataArray") == factory)
+    DREAM3D_REQUIRE_EQUAL(loadCount, 1)
+
+    fm->setDeferredPluginLoader(FilterManager::DeferredPluginLoader());
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestStaleManifestFallback()
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer factory = fm->getFactoryFromClassName("CreateDataArray");
+    DREAM3D_REQUIRE(factory.get() != nullptr)
+    QUuid uuid = factory->getUuid();
+    QUuid missingUuid = QUuid::createUuid();
+
+    DREAM3D_REQUIRE_EQUAL(fm->removeFilterFactory(uuid), true)
+    fm->addDeferredFilter("MissingFilter", missingUuid, "Stale.plugin");
+    fm->addDeferredFilter("CreateDataArray", uuid, "Other.plugin");
+
+    QStringList loadedPaths;
+    fm->setDeferredPluginLoader([&](const QString& pluginPath) {
+      loadedPaths << pluginPath;
+      if(pluginPath == "Other.plugin")
+      {
+        fm->addFilterFactory("CreateDataArray", factory);
+      }
+      return true;
+    });
+
+    // Stale.plugin no longer provides the filter so every remaining plugin is loaded
+    DREAM3D_REQUIRE(fm->getFactoryFromUuid(missingUuid).get() == nullptr)
+    DREAM3D_REQUIRE_EQUAL(loadedPaths.size(), 2)
+    DREAM3D_REQUIRE_EQUAL(fm->hasDeferredPlugins(), false)
+    DREAM3D_REQUIRE(fm->getFactoryFromUuid(uuid) == factory)
+    DREAM3D_REQUIRE_EQUAL(loadedPaths.size(), 2)
+
+    fm->setDeferredPluginLoader(FilterManager::DeferredPluginLoader());
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### DeferredPluginLoadingTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestAlreadyRegistered());
+    DREAM3D_REGISTER_TEST(TestLoadOnLookup());
+    DREAM3D_REGISTER_TEST(TestStaleManifestFallback());
+  }
+
+public:
+  DeferredPluginLoadingTest(const DeferredPluginLoadingTest&) = delete;            // Copy Constructor Not Implemented
+  DeferredPluginLoadingTest(DeferredPluginLoadingTest&&) = delete;                 // Move Constructor Not Implemented
+  DeferredPluginLoadingTest& operator=(const DeferredPluginLoadingTest&) = delete; // Copy Assignment Not Implemented
+  DeferredPluginLoadingTest& operator=(DeferredPluginLoadingTest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -44,6 +44,7 @@
 #include "SIMPLib/FilterParameters/OutputPathFilterParameter.h"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/PipelineProfiler.h"
 #include "SIMPLib/Plugin/PluginManager.h"
 #include "SIMPLib/Plugin/SIMPLPluginConstants.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
@@ -181,6 +182,14 @@ void ExecutePipelineController::serviceJSON(QJsonObject pipelineObj)
   pipeline->addMessageReceiver(&obs);
   pipeline->addMessageReceiver(&listener);
 
+  // Optional per filter profiling, returned with the response
+  PipelineProfiler::Pointer profiler = PipelineProfiler::NullPointer();
+  if(pipelineObj[SIMPL::JSON::Profile].toBool(false))
+  {
+    profiler = PipelineProfiler::New();
+    pipeline->setProfiler(profiler);
+  }
+
   int err = pipeline->preflightPipeline();
   qDebug() << "Preflight Error: " << err;
 
@@ -210,6 +219,12 @@ void ExecutePipelineController::serviceJSON(QJsonObject pipelineObj)
 
   m_ResponseObj[SIMPL::JSON::PipelineErrors] = errors;
   m_ResponseObj[SIMPL::JSON::PipelineWarnings] = warnings;
+
+  if(nullptr != profiler.get())
+  {
+    m_ResponseObj[SIMPL::JSON::ProfileSummary] = profiler->toJson();
+    m_ResponseObj[SIMPL::JSON::ProfileTrace] = profiler->toChromeTrace();
+  }
   // m_ResponseObj["StatusMessages"] = statusMsgs;
 
   //  // **************************************************************************
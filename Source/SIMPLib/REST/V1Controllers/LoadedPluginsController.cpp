@@ -69,6 +69,8 @@ void LoadedPluginsController::service(HttpRequest& request, HttpResponse& respon
     return;
   }
 
+  // Plugins may have been deferred at startup, make sure every one of them is in the PluginManager
+  FilterManager::Instance()->loadDeferredPlugins();
   PluginManager* pm = PluginManager::Instance();
   rootObj[SIMPL::JSON::ErrorMessage] = "";
   rootObj[SIMPL::JSON::ErrorCode] = 0;
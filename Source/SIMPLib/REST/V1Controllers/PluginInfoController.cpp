@@ -131,6 +131,8 @@ void PluginInfoController::service(HttpRequest& request, HttpResponse& response)
     return;
   }
 
+  // Plugins may have been deferred at startup, make sure every one of them is in the PluginManager
+  FilterManager::Instance()->loadDeferredPlugins();
   PluginManager* pm = PluginManager::Instance();
   ISIMPLibPlugin* plugin = pm->findPlugin(pluginName);
 
@@ -39,6 +39,7 @@
 
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/PipelineMemoryPlanner.h"
 #include "SIMPLib/Plugin/PluginManager.h"
 #include "SIMPLib/Plugin/SIMPLPluginConstants.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
@@ -186,6 +187,29 @@ void PreflightPipelineController::service(HttpRequest& request, HttpResponse& re
     msg->visit(&msgHandler);
   }
 
+  // Predict the peak memory from the preflight results so a client can decide whether to execute the pipeline
+  PipelineMemoryPlanner::Pointer planner = PipelineMemoryPlanner::New();
+  planner->setBudget(static_cast<int64_t>(requestObj[SIMPL::JSON::MemoryBudget].toDouble(0.0) * 1024 * 1024));
+  if(completed && planner->plan(pipeline->getFilterContainer()))
+  {
+    rootObj[SIMPL::JSON::MemoryEstimate] = planner->toJson();
+    if(planner->exceedsBudget())
+    {
+      QJsonObject obj;
+      obj.insert(SIMPL::JSON::Code, -60);
+      obj.insert(SIMPL::JSON::Message, planner->getSummary());
+      if(requestObj[SIMPL::JSON::RefuseOverBudget].toBool(false))
+      {
+        errors.push_back(obj);
+        rootObj[SIMPL::JSON::Completed] = false;
+      }
+      else
+      {
+        warnings.push_back(obj);
+      }
+    }
+  }
+
   rootObj[SIMPL::JSON::PipelineErrors] = errors;
   rootObj[SIMPL::JSON::PipelineWarnings] = warnings;
 
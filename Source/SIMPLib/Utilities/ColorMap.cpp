@@ -0,0 +1,164 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ColorMap.h"
+
+#include <algorithm>
+
+#include <QtCore/QJsonArray>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ColorMap::ColorMap() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ColorMap::ColorMap(const QJsonArray& controlPoints)
+{
+  const size_t numComponents = 4;
+  const size_t numPoints = static_cast<size_t>(controlPoints.count()) / numComponents;
+  m_Positions.resize(numPoints);
+  m_Colors.resize(numPoints * 3);
+
+  // Presets are stored with single precision, so every value is rounded to float first
+  for(size_t i = 0; i < numPoints; i++)
+  {
+    m_Positions[i] = static_cast<float>(controlPoints[static_cast<int>(numComponents * i)].toDouble());
+    for(size_t j = 0; j < 3; j++)
+    {
+      m_Colors[i * 3 + j] = static_cast<float>(controlPoints[static_cast<int>(numComponents * i + j + 1)].toDouble());
+    }
+  }
+
+  // Normalize the positions to [0, 1]
+  if(numPoints > 1)
+  {
+    const float min = m_Positions.front();
+    const float max = m_Positions.back();
+    for(auto& position : m_Positions)
+    {
+      position = (max > min) ? (position - min) / (max - min) : 0.0f;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ColorMap::~ColorMap() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ColorMap::getNumberOfControlPoints() const
+{
+  return m_Positions.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ColorMap::isValid() const
+{
+  return !m_Positions.empty();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ColorMap::mapNormalized(float value, uint8_t* rgb) const
+{
+  const size_t numPoints = m_Positions.size();
+  if(numPoints == 0)
+  {
+    rgb[0] = rgb[1] = rgb[2] = 0;
+    return;
+  }
+  if(numPoints == 1)
+  {
+    for(size_t c = 0; c < 3; c++)
+    {
+      rgb[c] = static_cast<uint8_t>(m_Colors[c] * 255);
+    }
+    return;
+  }
+
+  // The negated comparison also sends NaN to the start of the color map
+  if(!(value > 0.0f))
+  {
+    value = 0.0f;
+  }
+  else if(value > 1.0f)
+  {
+    value = 1.0f;
+  }
+
+  // The right control point is the first one that is not below value
+  size_t rightIndex = static_cast<size_t>(std::lower_bound(m_Positions.begin(), m_Positions.end(), value) - m_Positions.begin());
+  rightIndex = std::min(rightIndex, numPoints - 1);
+  size_t leftIndex = 0;
+  if(rightIndex == 0)
+  {
+    rightIndex = 1;
+  }
+  else
+  {
+    leftIndex = rightIndex - 1;
+  }
+
+  // Find the fractional distance traveled between the left and right control points
+  const float width = m_Positions[rightIndex] - m_Positions[leftIndex];
+  const float fraction = (width > 0.0f) ? (value - m_Positions[leftIndex]) / width : 0.0f;
+
+  const double* leftColor = m_Colors.data() + leftIndex * 3;
+  const double* rightColor = m_Colors.data() + rightIndex * 3;
+  for(size_t c = 0; c < 3; c++)
+  {
+    rgb[c] = static_cast<uint8_t>((leftColor[c] * (1.0 - fraction) + rightColor[c] * fraction) * 255);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<uint8_t> ColorMap::createLookupTable(size_t tableSize) const
+{
+  std::vector<uint8_t> table(tableSize * 3, 0);
+  const float step = (tableSize > 1) ? 1.0f / static_cast<float>(tableSize - 1) : 0.0f;
+  for(size_t i = 0; i < tableSize; i++)
+  {
+    mapNormalized(static_cast<float>(i) * step, table.data() + i * 3);
+  }
+  return table;
+}
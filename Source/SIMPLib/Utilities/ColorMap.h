@@ -0,0 +1,368 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Utilities/DataArrayReductions.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+class QJsonArray;
+
+/**
+ * @brief The ColorMap class maps scalar values to RGB colors by linear interpolation between the control
+ * points of a color preset. The control points are given in the preset format used by GenerateColorTable,
+ * a flat list of (x, r, g, b) quadruplets with the colors in the 0-1 range.
+ *
+ * Values are normalized against a [min, max] range before being mapped. Two mapping modes are provided:
+ *
+ * - mapValues(values, numValues, min, max, rgb) reproduces the interpolation exactly. Integer data whose
+ *   range spans fewer than k_MaxExactTableSize values is mapped through a table holding one color per
+ *   possible value, so each element costs a subtraction and a copy. Other data is interpolated per value.
+ * - mapValues(values, numValues, min, max, table, rgb) maps through a table created by createLookupTable()
+ *   with a single multiply and index per element. Values are quantized to the table resolution.
+ *
+ * Both modes run over the values in parallel and write into a caller supplied buffer of 3 * numValues bytes.
+ */
+class SIMPLib_EXPORT ColorMap
+{
+public:
+  /**
+   * @brief Default number of entries of a quantized lookup table
+   */
+  static constexpr size_t k_DefaultTableSize = 4096;
+
+  /**
+   * @brief Largest integer range that is mapped through an exact per value table
+   */
+  static constexpr size_t k_MaxExactTableSize = 65536;
+
+  ColorMap();
+
+  /**
+   * @brief Creates the color map from preset control points
+   * @param controlPoints Flat list of (x, r, g, b) quadruplets
+   */
+  explicit ColorMap(const QJsonArray& controlPoints);
+
+  ~ColorMap();
+
+  ColorMap(const ColorMap&) = default;
+  ColorMap(ColorMap&&) = default;
+  ColorMap& operator=(const ColorMap&) = default;
+  ColorMap& operator=(ColorMap&&) = default;
+
+  /**
+   * @brief Returns the number of control points
+   * @return
+   */
+  size_t getNumberOfControlPoints() const;
+
+  /**
+   * @brief Returns true if the color map has at least one control point
+   * @return
+   */
+  bool isValid() const;
+
+  /**
+   * @brief Writes the color of a normalized value to rgb[0..2]. Values outside [0, 1] and NaN values
+   * are clamped to the ends of the color map.
+   * @param value
+   * @param rgb
+   */
+  void mapNormalized(float value, uint8_t* rgb) const;
+
+  /**
+   * @brief Returns a table of tableSize colors sampled at evenly spaced normalized values, the first
+   * at 0 and the last at 1.
+   * @param tableSize
+   * @return
+   */
+  std::vector<uint8_t> createLookupTable(size_t tableSize = k_DefaultTableSize) const;
+
+  /**
+   * @brief Maps numValues values normalized against [min, max] using exact interpolation
+   * @param values
+   * @param numValues
+   * @param min
+   * @param max
+   * @param rgb Output buffer of 3 * numValues bytes
+   */
+  template <typename T>
+  void mapValues(const T* values, size_t numValues, T min, T max, uint8_t* rgb) const
+  {
+    if constexpr(std::is_integral<T>::value)
+    {
+      if(static_cast<double>(max) - static_cast<double>(min) < static_cast<double>(k_MaxExactTableSize))
+      {
+        // One entry per integer in [min, max] computed with the same normalization as the per value path
+        size_t numEntries = static_cast<size_t>(static_cast<uint64_t>(max) - static_cast<uint64_t>(min)) + 1;
+        float range = Offset(max, min);
+        std::vector<uint8_t> table(numEntries * 3);
+        for(size_t i = 0; i < numEntries; i++)
+        {
+          mapNormalized(static_cast<float>(i) / range, table.data() + i * 3);
+        }
+        Run(numValues, ExactTableImpl<T>(values, min, max, table.data(), rgb));
+        return;
+      }
+    }
+    Run(numValues, InterpolateImpl<T>(this, values, min, max, rgb));
+  }
+
+  /**
+   * @brief Maps numValues values normalized against [min, max] through a table created by createLookupTable()
+   * @param values
+   * @param numValues
+   * @param min
+   * @param max
+   * @param lookupTable
+   * @param rgb Output buffer of 3 * numValues bytes
+   */
+  template <typename T>
+  void mapValues(const T* values, size_t numValues, T min, T max, const std::vector<uint8_t>& lookupTable, uint8_t* rgb) const
+  {
+    if(lookupTable.size() < 3)
+    {
+      return;
+    }
+    Run(numValues, QuantizedImpl<T>(values, min, max, lookupTable, rgb));
+  }
+
+  /**
+   * @brief Maps a single component array into a three component color array. The value range is found
+   * with a parallel min/max pass. NaN values are mapped to the first color.
+   * @param values
+   * @param rgb Must have three components and at least as many tuples as values
+   * @param tableSize Uses a quantized lookup table of this size if non zero, exact interpolation otherwise
+   * @return False if the arrays do not have the expected layout or the color map is not valid
+   */
+  template <typename T>
+  bool mapArray(const DataArray<T>& values, DataArray<uint8_t>& rgb, size_t tableSize = 0) const
+  {
+    if(!isValid() || values.getNumberOfComponents() != 1 || rgb.getNumberOfComponents() != 3 || rgb.getNumberOfTuples() < values.getNumberOfTuples())
+    {
+      return false;
+    }
+    size_t numValues = values.getNumberOfTuples();
+    if(numValues == 0)
+    {
+      return true;
+    }
+
+    DataArrayReductions::MinMaxResult<T> range = DataArrayReductions::MinMax(values.data(), numValues);
+    T min = range.isValid() ? range.min : T{};
+    T max = range.isValid() ? range.max : T{};
+    if(tableSize > 0)
+    {
+      mapValues(values.data(), numValues, min, max, createLookupTable(tableSize), rgb.data());
+    }
+    else
+    {
+      mapValues(values.data(), numValues, min, max, rgb.data());
+    }
+    return true;
+  }
+
+private:
+  std::vector<float> m_Positions;
+  std::vector<double> m_Colors;
+
+  /**
+   * @brief Returns value - min as a float, computing the difference in the widest type of the same kind
+   */
+  template <typename T>
+  static float Offset(T value, T min)
+  {
+    if constexpr(std::is_floating_point<T>::value)
+    {
+      return static_cast<float>(value - min);
+    }
+    else if constexpr(std::is_signed<T>::value)
+    {
+      return static_cast<float>(static_cast<int64_t>(value) - static_cast<int64_t>(min));
+    }
+    else
+    {
+      return static_cast<float>(static_cast<uint64_t>(value) - static_cast<uint64_t>(min));
+    }
+  }
+
+  template <typename Body>
+  static void Run(size_t numValues, const Body& body)
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numValues);
+    dataAlg.execute(body);
+  }
+
+  /**
+   * @brief Interpolates every value
+   */
+  template <typename T>
+  class InterpolateImpl
+  {
+  public:
+    InterpolateImpl(const ColorMap* colorMap, const T* values, T min, T max, uint8_t* rgb)
+    : m_ColorMap(colorMap)
+    , m_Values(values)
+    , m_Min(min)
+    , m_Range(Offset(max, min))
+    , m_Rgb(rgb)
+    {
+    }
+
+    void convert(size_t start, size_t end) const
+    {
+      for(size_t i = start; i < end; i++)
+      {
+        m_ColorMap->mapNormalized(Offset(m_Values[i], m_Min) / m_Range, m_Rgb + i * 3);
+      }
+    }
+
+    void operator()(const SIMPLRange& range) const
+    {
+      convert(range.min(), range.max());
+    }
+
+  private:
+    const ColorMap* m_ColorMap;
+    const T* m_Values;
+    T m_Min;
+    float m_Range;
+    uint8_t* m_Rgb;
+  };
+
+  /**
+   * @brief Copies the color of every value from a table holding one entry per integer in [min, max]
+   */
+  template <typename T>
+  class ExactTableImpl
+  {
+  public:
+    ExactTableImpl(const T* values, T min, T max, const uint8_t* table, uint8_t* rgb)
+    : m_Values(values)
+    , m_Min(min)
+    , m_Max(max)
+    , m_Table(table)
+    , m_Rgb(rgb)
+    {
+    }
+
+    void convert(size_t start, size_t end) const
+    {
+      size_t last = static_cast<size_t>(static_cast<uint64_t>(m_Max) - static_cast<uint64_t>(m_Min));
+      for(size_t i = start; i < end; i++)
+      {
+        T value = m_Values[i];
+        size_t index = 0;
+        if(value > m_Max)
+        {
+          index = last;
+        }
+        else if(value > m_Min)
+        {
+          index = static_cast<size_t>(static_cast<uint64_t>(value) - static_cast<uint64_t>(m_Min));
+        }
+        const uint8_t* color = m_Table + index * 3;
+        uint8_t* out = m_Rgb + i * 3;
+        out[0] = color[0];
+        out[1] = color[1];
+        out[2] = color[2];
+      }
+    }
+
+    void operator()(const SIMPLRange& range) const
+    {
+      convert(range.min(), range.max());
+    }
+
+  private:
+    const T* m_Values;
+    T m_Min;
+    T m_Max;
+    const uint8_t* m_Table;
+    uint8_t* m_Rgb;
+  };
+
+  /**
+   * @brief Copies the color of every value from a table sampled at evenly spaced normalized values
+   */
+  template <typename T>
+  class QuantizedImpl
+  {
+  public:
+    QuantizedImpl(const T* values, T min, T max, const std::vector<uint8_t>& table, uint8_t* rgb)
+    : m_Values(values)
+    , m_Min(static_cast<double>(min))
+    , m_Last(table.size() / 3 - 1)
+    , m_Table(table.data())
+    , m_Rgb(rgb)
+    {
+      double range = static_cast<double>(max) - m_Min;
+      m_Scale = range > 0.0 ? static_cast<double>(m_Last) / range : 0.0;
+    }
+
+    void convert(size_t start, size_t end) const
+    {
+      for(size_t i = start; i < end; i++)
+      {
+        double position = (static_cast<double>(m_Values[i]) - m_Min) * m_Scale + 0.5;
+        // The negated comparison also sends NaN to the first entry
+        size_t index = !(position > 0.0) ? 0 : (position >= static_cast<double>(m_Last) ? m_Last : static_cast<size_t>(position));
+        const uint8_t* color = m_Table + index * 3;
+        uint8_t* out = m_Rgb + i * 3;
+        out[0] = color[0];
+        out[1] = color[1];
+        out[2] = color[2];
+      }
+    }
+
+    void operator()(const SIMPLRange& range) const
+    {
+      convert(range.min(), range.max());
+    }
+
+  private:
+    const T* m_Values;
+    double m_Min;
+    size_t m_Last;
+    double m_Scale = 0.0;
+    const uint8_t* m_Table;
+    uint8_t* m_Rgb;
+  };
+};
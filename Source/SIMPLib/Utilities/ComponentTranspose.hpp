@@ -0,0 +1,321 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @brief Kernels that move components between one interleaved (array of structures) array and
+ * several separate arrays. The tuples are processed in fixed size blocks and the blocks are handed out
+ * in parallel. Within a block every separate array is visited before moving on, so the block of the
+ * interleaved array stays in cache while it is being filled or drained.
+ */
+namespace ComponentTranspose
+{
+/**
+ * @brief Number of tuples processed together by one task
+ */
+constexpr size_t k_TupleBlockSize = 2048;
+
+/**
+ * @brief Describes one of the separate arrays: its data pointer, the number of components it has per
+ * tuple and the component in the interleaved tuple that its first component maps to.
+ */
+template <typename T>
+struct ComponentSlice
+{
+  T* data = nullptr;
+  size_t numComps = 1;
+  size_t interleavedOffset = 0;
+};
+
+/**
+ * @brief Returns the number of tuple blocks needed for numTuples
+ */
+inline size_t GetNumberOfBlocks(size_t numTuples)
+{
+  return (numTuples + k_TupleBlockSize - 1) / k_TupleBlockSize;
+}
+
+/**
+ * @brief The InterleaveImpl class copies each slice into its components of the interleaved array. When
+ * block minimums and maximums are requested each block records them for every interleaved component,
+ * so the final values can be merged in block order and do not depend on the thread count.
+ */
+template <typename T>
+class InterleaveImpl
+{
+public:
+  InterleaveImpl(const std::vector<ComponentSlice<const T>>& inputs, T* output, size_t outputComps, size_t numTuples, T* blockMins, T* blockMaxs)
+  : m_Inputs(inputs)
+  , m_Output(output)
+  , m_OutputComps(outputComps)
+  , m_NumTuples(numTuples)
+  , m_BlockMins(blockMins)
+  , m_BlockMaxs(blockMaxs)
+  {
+  }
+  InterleaveImpl(const InterleaveImpl&) = default;           // Copy Constructor Not Implemented
+  InterleaveImpl(InterleaveImpl&&) = default;                // Move Constructor Not Implemented
+  InterleaveImpl& operator=(const InterleaveImpl&) = delete; // Copy Assignment Not Implemented
+  InterleaveImpl& operator=(InterleaveImpl&&) = delete;      // Move Assignment Not Implemented
+  ~InterleaveImpl() = default;
+
+  void convert(size_t startBlock, size_t endBlock) const
+  {
+    for(size_t block = startBlock; block < endBlock; block++)
+    {
+      size_t start = block * k_TupleBlockSize;
+      size_t end = std::min(start + k_TupleBlockSize, m_NumTuples);
+      for(const auto& input : m_Inputs)
+      {
+        const size_t numComps = input.numComps;
+        T* output = m_Output + input.interleavedOffset;
+        for(size_t c = 0; c < numComps; c++)
+        {
+          const T* src = input.data + c;
+          T* dest = output + c;
+          T minVal = std::numeric_limits<T>::max();
+          T maxVal = std::numeric_limits<T>::lowest();
+          for(size_t t = start; t < end; t++)
+          {
+            T value = src[t * numComps];
+            dest[t * m_OutputComps] = value;
+            minVal = (value < minVal) ? value : minVal;
+            maxVal = (value > maxVal) ? value : maxVal;
+          }
+          if(nullptr != m_BlockMins)
+          {
+            m_BlockMins[block * m_OutputComps + input.interleavedOffset + c] = minVal;
+            m_BlockMaxs[block * m_OutputComps + input.interleavedOffset + c] = maxVal;
+          }
+        }
+      }
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    convert(range.min(), range.max());
+  }
+
+private:
+  const std::vector<ComponentSlice<const T>>& m_Inputs;
+  T* m_Output;
+  size_t m_OutputComps;
+  size_t m_NumTuples;
+  T* m_BlockMins;
+  T* m_BlockMaxs;
+};
+
+/**
+ * @brief The DeinterleaveImpl class copies components of the interleaved array out into each slice
+ */
+template <typename T>
+class DeinterleaveImpl
+{
+public:
+  DeinterleaveImpl(const T* input, size_t inputComps, const std::vector<ComponentSlice<T>>& outputs, size_t numTuples)
+  : m_Input(input)
+  , m_InputComps(inputComps)
+  , m_Outputs(outputs)
+  , m_NumTuples(numTuples)
+  {
+  }
+  DeinterleaveImpl(const DeinterleaveImpl&) = default;           // Copy Constructor Not Implemented
+  DeinterleaveImpl(DeinterleaveImpl&&) = default;                // Move Constructor Not Implemented
+  DeinterleaveImpl& operator=(const DeinterleaveImpl&) = delete; // Copy Assignment Not Implemented
+  DeinterleaveImpl& operator=(DeinterleaveImpl&&) = delete;      // Move Assignment Not Implemented
+  ~DeinterleaveImpl() = default;
+
+  void convert(size_t startBlock, size_t endBlock) const
+  {
+    for(size_t block = startBlock; block < endBlock; block++)
+    {
+      size_t start = block * k_TupleBlockSize;
+      size_t end = std::min(start + k_TupleBlockSize, m_NumTuples);
+      for(const auto& output : m_Outputs)
+      {
+        const size_t numComps = output.numComps;
+        const T* input = m_Input + output.interleavedOffset;
+        for(size_t c = 0; c < numComps; c++)
+        {
+          const T* src = input + c;
+          T* dest = output.data + c;
+          for(size_t t = start; t < end; t++)
+          {
+            dest[t * numComps] = src[t * m_InputComps];
+          }
+        }
+      }
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    convert(range.min(), range.max());
+  }
+
+private:
+  const T* m_Input;
+  size_t m_InputComps;
+  const std::vector<ComponentSlice<T>>& m_Outputs;
+  size_t m_NumTuples;
+};
+
+/**
+ * @brief The NormalizeImpl class rescales each component of an interleaved array into [0, 1] in place.
+ * Components whose minimum equals their maximum are set to zero.
+ */
+template <typename T>
+class NormalizeImpl
+{
+public:
+  NormalizeImpl(T* data, size_t numComps, const T* minVals, const T* maxVals)
+  : m_Data(data)
+  , m_NumComps(numComps)
+  , m_MinVals(minVals)
+  , m_MaxVals(maxVals)
+  {
+  }
+  NormalizeImpl(const NormalizeImpl&) = default;           // Copy Constructor Not Implemented
+  NormalizeImpl(NormalizeImpl&&) = default;                // Move Constructor Not Implemented
+  NormalizeImpl& operator=(const NormalizeImpl&) = delete; // Copy Assignment Not Implemented
+  NormalizeImpl& operator=(NormalizeImpl&&) = delete;      // Move Assignment Not Implemented
+  ~NormalizeImpl() = default;
+
+  void convert(size_t start, size_t end) const
+  {
+    for(size_t t = start; t < end; t++)
+    {
+      T* tuple = m_Data + t * m_NumComps;
+      for(size_t c = 0; c < m_NumComps; c++)
+      {
+        if(m_MaxVals[c] == m_MinVals[c])
+        {
+          tuple[c] = static_cast<T>(0);
+        }
+        else
+        {
+          tuple[c] = (tuple[c] - m_MinVals[c]) / (m_MaxVals[c] - m_MinVals[c]);
+        }
+      }
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    convert(range.min(), range.max());
+  }
+
+private:
+  T* m_Data;
+  size_t m_NumComps;
+  const T* m_MinVals;
+  const T* m_MaxVals;
+};
+
+/**
+ * @brief Interleaves the input slices into output, which has outputComps components per tuple
+ * @param inputs The separate arrays and where their components go in each output tuple
+ * @param output The interleaved array
+ * @param outputComps The number of components per tuple of the output
+ * @param numTuples The number of tuples of every array
+ */
+template <typename T>
+void Interleave(const std::vector<ComponentSlice<const T>>& inputs, T* output, size_t outputComps, size_t numTuples)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, GetNumberOfBlocks(numTuples));
+  dataAlg.execute(InterleaveImpl<T>(inputs, output, outputComps, numTuples, nullptr, nullptr));
+}
+
+/**
+ * @brief Interleaves the input slices into output and then rescales every output component into [0, 1].
+ * The per component minimum and maximum are gathered while interleaving, so the inputs are only read once.
+ * The inputs must cover every output component.
+ * @param inputs The separate arrays and where their components go in each output tuple
+ * @param output The interleaved array
+ * @param outputComps The number of components per tuple of the output
+ * @param numTuples The number of tuples of every array
+ */
+template <typename T>
+void InterleaveAndNormalize(const std::vector<ComponentSlice<const T>>& inputs, T* output, size_t outputComps, size_t numTuples)
+{
+  // Plain buffers rather than std::vector so this also works for bool
+  size_t numBlocks = GetNumberOfBlocks(numTuples);
+  std::unique_ptr<T[]> blockMins(new T[numBlocks * outputComps]);
+  std::unique_ptr<T[]> blockMaxs(new T[numBlocks * outputComps]);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numBlocks);
+  dataAlg.execute(InterleaveImpl<T>(inputs, output, outputComps, numTuples, blockMins.get(), blockMaxs.get()));
+
+  std::unique_ptr<T[]> minVals(new T[outputComps]);
+  std::unique_ptr<T[]> maxVals(new T[outputComps]);
+  std::fill_n(minVals.get(), outputComps, std::numeric_limits<T>::max());
+  std::fill_n(maxVals.get(), outputComps, std::numeric_limits<T>::lowest());
+  for(size_t block = 0; block < numBlocks; block++)
+  {
+    for(size_t c = 0; c < outputComps; c++)
+    {
+      minVals[c] = std::min(minVals[c], blockMins[block * outputComps + c]);
+      maxVals[c] = std::max(maxVals[c], blockMaxs[block * outputComps + c]);
+    }
+  }
+
+  ParallelDataAlgorithm normalizeAlg;
+  normalizeAlg.setRange(0, numTuples);
+  normalizeAlg.execute(NormalizeImpl<T>(output, outputComps, minVals.get(), maxVals.get()));
+}
+
+/**
+ * @brief Copies components of the interleaved input out into each of the output slices
+ * @param input The interleaved array
+ * @param inputComps The number of components per tuple of the input
+ * @param outputs The separate arrays and which input components they receive
+ * @param numTuples The number of tuples of every array
+ */
+template <typename T>
+void Deinterleave(const T* input, size_t inputComps, const std::vector<ComponentSlice<T>>& outputs, size_t numTuples)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, GetNumberOfBlocks(numTuples));
+  dataAlg.execute(DeinterleaveImpl<T>(input, inputComps, outputs, numTuples));
+}
+} // namespace ComponentTranspose
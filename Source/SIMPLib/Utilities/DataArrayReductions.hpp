@@ -0,0 +1,508 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @brief Parallel reductions over DataArray values: min/max with their locations, compensated sums,
+ * mean/variance and fixed bin histograms.
+ *
+ * The data is split into fixed size blocks. Each block is reduced on its own and the block results are
+ * merged serially in block order, so the result is the same regardless of how many threads were used.
+ * NaN values are skipped by every reduction.
+ *
+ * Every function accepts either a DataArray and a component (-1 meaning every element of the array) or a
+ * raw pointer with the number of tuples, the number of components per tuple and the component to reduce.
+ */
+namespace DataArrayReductions
+{
+/**
+ * @brief Number of values reduced together by one task
+ */
+constexpr size_t k_BlockSize = 16384;
+
+/**
+ * @brief Largest number of partial histograms kept at once, so the scratch space of Histogram grows
+ * with the number of bins but not with the number of tuples
+ */
+constexpr size_t k_MaxHistogramChunks = 64;
+
+/**
+ * @brief Holds the smallest and largest values and the index of their first occurrence
+ */
+template <typename T>
+struct MinMaxResult
+{
+  T min = std::numeric_limits<T>::max();
+  T max = std::numeric_limits<T>::lowest();
+  size_t minIndex = std::numeric_limits<size_t>::max();
+  size_t maxIndex = std::numeric_limits<size_t>::max();
+  size_t count = 0;
+
+  /**
+   * @brief Returns false if no value was reduced
+   */
+  bool isValid() const
+  {
+    return count > 0;
+  }
+};
+
+/**
+ * @brief Holds the running count, mean and sum of squared differences of Welford's algorithm
+ */
+struct MeanVarianceResult
+{
+  size_t count = 0;
+  double mean = 0.0;
+  double m2 = 0.0;
+
+  /**
+   * @brief Returns the population variance
+   */
+  double variance() const
+  {
+    return count > 0 ? m2 / static_cast<double>(count) : 0.0;
+  }
+
+  /**
+   * @brief Returns the sample (Bessel corrected) variance
+   */
+  double sampleVariance() const
+  {
+    return count > 1 ? m2 / static_cast<double>(count - 1) : 0.0;
+  }
+
+  /**
+   * @brief Returns the population standard deviation
+   */
+  double standardDeviation() const
+  {
+    return std::sqrt(variance());
+  }
+};
+
+/**
+ * @brief Returns true if value is NaN. Always false for non floating point types.
+ */
+template <typename T>
+inline bool IsNaN(T value)
+{
+  if constexpr(std::is_floating_point<T>::value)
+  {
+    return std::isnan(value);
+  }
+  else
+  {
+    return false;
+  }
+}
+
+/**
+ * @brief Returns the number of blocks needed for numValues
+ */
+inline size_t GetNumberOfBlocks(size_t numValues)
+{
+  return (numValues + k_BlockSize - 1) / k_BlockSize;
+}
+
+/**
+ * @brief The BlockReduceImpl class hands each block of tuples in the range to a reduction function
+ * that stores its result in the slot belonging to that block
+ */
+template <typename BlockFunction>
+class BlockReduceImpl
+{
+public:
+  BlockReduceImpl(const BlockFunction& function, size_t numTuples)
+  : m_Function(function)
+  , m_NumTuples(numTuples)
+  {
+  }
+  BlockReduceImpl(const BlockReduceImpl&) = default;           // Copy Constructor Not Implemented
+  BlockReduceImpl(BlockReduceImpl&&) = default;                // Move Constructor Not Implemented
+  BlockReduceImpl& operator=(const BlockReduceImpl&) = delete; // Copy Assignment Not Implemented
+  BlockReduceImpl& operator=(BlockReduceImpl&&) = delete;      // Move Assignment Not Implemented
+  ~BlockReduceImpl() = default;
+
+  void convert(size_t startBlock, size_t endBlock) const
+  {
+    for(size_t block = startBlock; block < endBlock; block++)
+    {
+      size_t start = block * k_BlockSize;
+      size_t end = std::min(start + k_BlockSize, m_NumTuples);
+      m_Function(block, start, end);
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    convert(range.min(), range.max());
+  }
+
+private:
+  const BlockFunction& m_Function;
+  size_t m_NumTuples;
+};
+
+/**
+ * @brief Runs function(block, startTuple, endTuple) for every block of numTuples
+ */
+template <typename BlockFunction>
+void ForEachBlock(size_t numTuples, const BlockFunction& function)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, GetNumberOfBlocks(numTuples));
+  dataAlg.execute(BlockReduceImpl<BlockFunction>(function, numTuples));
+}
+
+/**
+ * @brief Adds value to sum using Neumaier's variant of Kahan summation
+ */
+inline void CompensatedAdd(double value, double& sum, double& compensation)
+{
+  double newSum = sum + value;
+  if(std::abs(sum) >= std::abs(value))
+  {
+    compensation += (sum - newSum) + value;
+  }
+  else
+  {
+    compensation += (value - newSum) + sum;
+  }
+  sum = newSum;
+}
+
+/**
+ * @brief Merges the partial Welford result b into a (Chan et al.)
+ */
+inline void MergeMeanVariance(MeanVarianceResult& a, const MeanVarianceResult& b)
+{
+  if(b.count == 0)
+  {
+    return;
+  }
+  if(a.count == 0)
+  {
+    a = b;
+    return;
+  }
+  double countA = static_cast<double>(a.count);
+  double countB = static_cast<double>(b.count);
+  double total = countA + countB;
+  double delta = b.mean - a.mean;
+  a.mean += delta * countB / total;
+  a.m2 += b.m2 + delta * delta * countA * countB / total;
+  a.count += b.count;
+}
+
+/**
+ * @brief Returns the smallest and largest values and the tuple index of their first occurrence
+ * @param data Pointer to the first tuple
+ * @param numTuples Number of tuples
+ * @param numComps Number of components per tuple
+ * @param comp Component to reduce
+ */
+template <typename T>
+MinMaxResult<T> MinMax(const T* data, size_t numTuples, size_t numComps = 1, size_t comp = 0)
+{
+  std::vector<MinMaxResult<T>> blockResults(GetNumberOfBlocks(numTuples));
+  auto reduceBlock = [&](size_t block, size_t start, size_t end) {
+    MinMaxResult<T> result;
+    for(size_t i = start; i < end; i++)
+    {
+      T value = data[i * numComps + comp];
+      if(IsNaN(value))
+      {
+        continue;
+      }
+      if(value < result.min || result.count == 0)
+      {
+        result.min = value;
+        result.minIndex = i;
+      }
+      if(value > result.max || result.count == 0)
+      {
+        result.max = value;
+        result.maxIndex = i;
+      }
+      result.count++;
+    }
+    blockResults[block] = result;
+  };
+  ForEachBlock(numTuples, reduceBlock);
+
+  // Strict comparisons keep the earliest index when values tie
+  MinMaxResult<T> result;
+  for(const auto& blockResult : blockResults)
+  {
+    if(blockResult.count == 0)
+    {
+      continue;
+    }
+    if(blockResult.min < result.min || result.count == 0)
+    {
+      result.min = blockResult.min;
+      result.minIndex = blockResult.minIndex;
+    }
+    if(blockResult.max > result.max || result.count == 0)
+    {
+      result.max = blockResult.max;
+      result.maxIndex = blockResult.maxIndex;
+    }
+    result.count += blockResult.count;
+  }
+  return result;
+}
+
+/**
+ * @brief Returns the compensated sum of the values
+ * @param data Pointer to the first tuple
+ * @param numTuples Number of tuples
+ * @param numComps Number of components per tuple
+ * @param comp Component to reduce
+ */
+template <typename T>
+double Sum(const T* data, size_t numTuples, size_t numComps = 1, size_t comp = 0)
+{
+  size_t numBlocks = GetNumberOfBlocks(numTuples);
+  std::vector<double> blockSums(numBlocks, 0.0);
+  std::vector<double> blockCompensations(numBlocks, 0.0);
+  auto reduceBlock = [&](size_t block, size_t start, size_t end) {
+    double sum = 0.0;
+    double compensation = 0.0;
+    for(size_t i = start; i < end; i++)
+    {
+      T value = data[i * numComps + comp];
+      if(!IsNaN(value))
+      {
+        CompensatedAdd(static_cast<double>(value), sum, compensation);
+      }
+    }
+    blockSums[block] = sum;
+    blockCompensations[block] = compensation;
+  };
+  ForEachBlock(numTuples, reduceBlock);
+
+  double sum = 0.0;
+  double compensation = 0.0;
+  for(size_t block = 0; block < numBlocks; block++)
+  {
+    CompensatedAdd(blockSums[block], sum, compensation);
+    CompensatedAdd(blockCompensations[block], sum, compensation);
+  }
+  return sum + compensation;
+}
+
+/**
+ * @brief Returns the count, mean and variance of the values using Welford's algorithm
+ * @param data Pointer to the first tuple
+ * @param numTuples Number of tuples
+ * @param numComps Number of components per tuple
+ * @param comp Component to reduce
+ */
+template <typename T>
+MeanVarianceResult MeanVariance(const T* data, size_t numTuples, size_t numComps = 1, size_t comp = 0)
+{
+  std::vector<MeanVarianceResult> blockResults(GetNumberOfBlocks(numTuples));
+  auto reduceBlock = [&](size_t block, size_t start, size_t end) {
+    MeanVarianceResult result;
+    for(size_t i = start; i < end; i++)
+    {
+      T value = data[i * numComps + comp];
+      if(IsNaN(value))
+      {
+        continue;
+      }
+      result.count++;
+      double delta = static_cast<double>(value) - result.mean;
+      result.mean += delta / static_cast<double>(result.count);
+      result.m2 += delta * (static_cast<double>(value) - result.mean);
+    }
+    blockResults[block] = result;
+  };
+  ForEachBlock(numTuples, reduceBlock);
+
+  MeanVarianceResult result;
+  for(const auto& blockResult : blockResults)
+  {
+    MergeMeanVariance(result, blockResult);
+  }
+  return result;
+}
+
+/**
+ * @brief Counts the values falling in each of numBins equal width bins spanning [rangeMin, rangeMax].
+ * Values equal to rangeMax go in the last bin and values outside the range are not counted.
+ * @param data Pointer to the first tuple
+ * @param numTuples Number of tuples
+ * @param numComps Number of components per tuple
+ * @param comp Component to reduce
+ * @param numBins Number of bins
+ * @param rangeMin Lower edge of the first bin
+ * @param rangeMax Upper edge of the last bin
+ */
+template <typename T>
+std::vector<size_t> Histogram(const T* data, size_t numTuples, size_t numComps, size_t comp, size_t numBins, double rangeMin, double rangeMax)
+{
+  std::vector<size_t> histogram(numBins, 0);
+  if(numBins == 0 || rangeMax < rangeMin)
+  {
+    return histogram;
+  }
+
+  // Each task fills the partial histogram of one chunk of whole blocks. The chunk count is capped so the
+  // scratch space is at most k_MaxHistogramChunks * numBins counts. Counts are integers, so the result does
+  // not depend on how the tuples were split.
+  size_t numBlocks = GetNumberOfBlocks(numTuples);
+  size_t numChunks = std::min(numBlocks, k_MaxHistogramChunks);
+  size_t blocksPerChunk = numChunks > 0 ? (numBlocks + numChunks - 1) / numChunks : 0;
+  size_t chunkSize = blocksPerChunk * k_BlockSize;
+  std::vector<size_t> chunkHistograms(numChunks * numBins, 0);
+  double scale = (rangeMax > rangeMin) ? static_cast<double>(numBins) / (rangeMax - rangeMin) : 0.0;
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numChunks);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      size_t* counts = chunkHistograms.data() + chunk * numBins;
+      size_t start = chunk * chunkSize;
+      size_t end = std::min(start + chunkSize, numTuples);
+      for(size_t i = start; i < end; i++)
+      {
+        double value = static_cast<double>(data[i * numComps + comp]);
+        if(!(value >= rangeMin && value <= rangeMax))
+        {
+          continue;
+        }
+        size_t bin = static_cast<size_t>((value - rangeMin) * scale);
+        bin = (bin < numBins) ? bin : numBins - 1;
+        counts[bin]++;
+      }
+    }
+  });
+
+  for(size_t chunk = 0; chunk < numChunks; chunk++)
+  {
+    const size_t* counts = chunkHistograms.data() + chunk * numBins;
+    for(size_t bin = 0; bin < numBins; bin++)
+    {
+      histogram[bin] += counts[bin];
+    }
+  }
+  return histogram;
+}
+
+/**
+ * @brief Returns the stride/offset pair that selects component of array, or every element when component is -1
+ */
+template <typename T>
+inline std::pair<size_t, size_t> GetTupleLayout(const DataArray<T>& array, int32_t component, size_t& numValues)
+{
+  if(component < 0)
+  {
+    numValues = array.getSize();
+    return {1, 0};
+  }
+  numValues = array.getNumberOfTuples();
+  return {static_cast<size_t>(array.getNumberOfComponents()), static_cast<size_t>(component)};
+}
+
+/**
+ * @brief Returns the smallest and largest values of array. The indices are element indices when component
+ * is -1 and tuple indices otherwise.
+ */
+template <typename T>
+MinMaxResult<T> MinMax(const DataArray<T>& array, int32_t component = -1)
+{
+  size_t numValues = 0;
+  auto layout = GetTupleLayout(array, component, numValues);
+  return MinMax(array.data(), numValues, layout.first, layout.second);
+}
+
+/**
+ * @brief Returns the compensated sum of array
+ */
+template <typename T>
+double Sum(const DataArray<T>& array, int32_t component = -1)
+{
+  size_t numValues = 0;
+  auto layout = GetTupleLayout(array, component, numValues);
+  return Sum(array.data(), numValues, layout.first, layout.second);
+}
+
+/**
+ * @brief Returns the count, mean and variance of array
+ */
+template <typename T>
+MeanVarianceResult MeanVariance(const DataArray<T>& array, int32_t component = -1)
+{
+  size_t numValues = 0;
+  auto layout = GetTupleLayout(array, component, numValues);
+  return MeanVariance(array.data(), numValues, layout.first, layout.second);
+}
+
+/**
+ * @brief Returns a numBins histogram of array over [rangeMin, rangeMax]
+ */
+template <typename T>
+std::vector<size_t> Histogram(const DataArray<T>& array, size_t numBins, double rangeMin, double rangeMax, int32_t component = -1)
+{
+  size_t numValues = 0;
+  auto layout = GetTupleLayout(array, component, numValues);
+  return Histogram(array.data(), numValues, layout.first, layout.second, numBins, rangeMin, rangeMax);
+}
+
+/**
+ * @brief Returns a numBins histogram of array spanning its own minimum and maximum
+ */
+template <typename T>
+std::vector<size_t> Histogram(const DataArray<T>& array, size_t numBins, int32_t component = -1)
+{
+  MinMaxResult<T> range = MinMax(array, component);
+  if(!range.isValid())
+  {
+    return std::vector<size_t>(numBins, 0);
+  }
+  return Histogram(array, numBins, static_cast<double>(range.min), static_cast<double>(range.max), component);
+}
+} // namespace DataArrayReductions
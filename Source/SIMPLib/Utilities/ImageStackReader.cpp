@@ -0,0 +1,297 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ImageStackReader.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <QtCore/QObject>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
+
+namespace
+{
+/**
+ * @brief Returns true if array is a DataArray of one of Types. Only those store their elements
+ * contiguously with getSize() * getTypeSize() bytes behind getVoidPointer(0).
+ */
+template <typename... Types>
+bool IsDataArrayOf(IDataArray& array)
+{
+  return (... || (dynamic_cast<DataArray<Types>*>(&array) != nullptr));
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageStackReader::ImageStackReader() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageStackReader::~ImageStackReader() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageStackReader::setFileList(const QVector<QString>& fileList)
+{
+  m_FileList = fileList;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<QString> ImageStackReader::getFileList() const
+{
+  return m_FileList;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageStackReader::setDecoder(const SliceDecoder& decoder)
+{
+  m_Decoder = decoder;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageStackReader::setSliceObserver(const SliceObserver& observer)
+{
+  m_SliceObserver = observer;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageStackReader::setCancelCheck(const std::function<bool()>& cancelCheck)
+{
+  m_CancelCheck = cancelCheck;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageStackReader::setNumberOfThreads(uint32_t numThreads)
+{
+  m_NumberOfThreads = numThreads;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint32_t ImageStackReader::getNumberOfThreads() const
+{
+  return m_NumberOfThreads;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageStackReader::setPrefetchWindow(size_t window)
+{
+  m_PrefetchWindow = window;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ImageStackReader::getPrefetchWindow() const
+{
+  return m_PrefetchWindow;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageStackReader::setStopOnError(bool stopOnError)
+{
+  m_StopOnError = stopOnError;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ImageStackReader::getStopOnError() const
+{
+  return m_StopOnError;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<ImageStackReader::SliceStatus> ImageStackReader::read(void* destination, size_t sliceBytes) const
+{
+  const size_t numSlices = static_cast<size_t>(m_FileList.size());
+  std::vector<SliceStatus> statuses(numSlices);
+  for(size_t i = 0; i < numSlices; i++)
+  {
+    statuses[i].filePath = m_FileList[static_cast<int>(i)];
+  }
+  if(numSlices == 0)
+  {
+    return statuses;
+  }
+  if(!m_Decoder)
+  {
+    statuses[0].errorCode = k_NoDecoderError;
+    statuses[0].message = QObject::tr("No slice decoder was set");
+    return statuses;
+  }
+
+  uint32_t numThreads = (m_NumberOfThreads > 0) ? m_NumberOfThreads : std::max(std::thread::hardware_concurrency(), 1u);
+  numThreads = static_cast<uint32_t>(std::min(static_cast<size_t>(numThreads), numSlices));
+  const size_t window = (m_PrefetchWindow > 0) ? m_PrefetchWindow : 2 * static_cast<size_t>(numThreads);
+  uint8_t* buffer = static_cast<uint8_t*>(destination);
+
+  std::mutex mutex;
+  std::condition_variable sliceFinished;
+  size_t nextToStart = 0;
+  size_t nextToReport = 0;
+  bool stop = false;
+  bool canceled = false;
+  std::vector<bool> finished(numSlices, false);
+
+  auto readSlices = [&]() {
+    while(true)
+    {
+      size_t index = 0;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        sliceFinished.wait(lock, [&]() { return stop || nextToStart >= numSlices || nextToStart < nextToReport + window; });
+        if(stop || nextToStart >= numSlices)
+        {
+          return;
+        }
+        if(m_CancelCheck && m_CancelCheck())
+        {
+          stop = true;
+          canceled = true;
+          sliceFinished.notify_all();
+          return;
+        }
+        index = nextToStart++;
+      }
+
+      // Decode outside of the lock, straight into this slice's part of the buffer
+      SliceStatus& status = statuses[index];
+      try
+      {
+        status.errorCode = m_Decoder(status.filePath, buffer + index * sliceBytes, sliceBytes, status.message);
+      } catch(const std::exception& e)
+      {
+        // Every started slice has to finish or the threads waiting on the window never wake up
+        status.errorCode = k_DecoderExceptionError;
+        status.message = QObject::tr("Failed to read '%1': %2").arg(status.filePath).arg(e.what());
+      }
+      status.read = (status.errorCode >= 0);
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        finished[index] = true;
+        while(nextToReport < numSlices && finished[nextToReport])
+        {
+          const SliceStatus& reported = statuses[nextToReport];
+          if(m_SliceObserver)
+          {
+            m_SliceObserver(nextToReport, reported);
+          }
+          if(reported.errorCode < 0 && m_StopOnError)
+          {
+            stop = true;
+          }
+          nextToReport++;
+        }
+      }
+      sliceFinished.notify_all();
+    }
+  };
+
+  ParallelTaskAlgorithm taskAlg;
+  taskAlg.setMaxThreads(numThreads);
+  for(uint32_t i = 0; i < numThreads; i++)
+  {
+    taskAlg.execute(readSlices);
+  }
+  taskAlg.wait();
+
+  if(canceled)
+  {
+    for(size_t i = nextToStart; i < numSlices; i++)
+    {
+      statuses[i].errorCode = k_CanceledError;
+      statuses[i].message = QObject::tr("Reading was canceled before '%1' was read").arg(statuses[i].filePath);
+    }
+  }
+  return statuses;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<ImageStackReader::SliceStatus> ImageStackReader::read(IDataArray& destination) const
+{
+  if(!IsDataArrayOf<int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t, float, double>(destination))
+  {
+    std::vector<SliceStatus> statuses(1);
+    statuses[0].errorCode = k_BufferSizeError;
+    statuses[0].message = QObject::tr("Array '%1' of type %2 does not store its values in a contiguous numeric buffer").arg(destination.getName()).arg(destination.getTypeAsString());
+    return statuses;
+  }
+
+  const size_t numSlices = static_cast<size_t>(m_FileList.size());
+  const size_t numBytes = destination.getSize() * destination.getTypeSize();
+  if(numSlices == 0 || numBytes % numSlices != 0)
+  {
+    std::vector<SliceStatus> statuses(1);
+    statuses[0].errorCode = k_BufferSizeError;
+    statuses[0].message = QObject::tr("Array '%1' of %2 bytes can not be split into %3 equally sized slices").arg(destination.getName()).arg(numBytes).arg(numSlices);
+    return statuses;
+  }
+  return read(destination.getVoidPointer(0), numBytes / numSlices);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const ImageStackReader::SliceStatus* ImageStackReader::FirstError(const std::vector<SliceStatus>& statuses)
+{
+  auto iter = std::find_if(statuses.begin(), statuses.end(), [](const SliceStatus& status) { return status.errorCode < 0; });
+  return (iter != statuses.end()) ? &(*iter) : nullptr;
+}
@@ -0,0 +1,195 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/SIMPLib.h"
+
+class IDataArray;
+
+/**
+ * @brief The ImageStackReader class reads an ordered list of slice files, such as the one returned by
+ * FilePathGenerator::GenerateFileList, into consecutive slices of one destination buffer. Several slices
+ * are decoded at the same time and each decoder writes straight into the slice's offset in the buffer,
+ * so no intermediate slice copies are made.
+ *
+ * The prefetch window bounds how far the readers may run ahead of the oldest unfinished slice. Slices
+ * are reported to the observer strictly in file order and every file gets its own status, so errors
+ * are attributed to the file that caused them. With StopOnError set (the default) no new slice is
+ * started once an error has been reported.
+ *
+ * The decoding itself is done by a SliceDecoder, e.g. the ITK based one in itkImageStackSliceDecoder.hpp.
+ */
+class SIMPLib_EXPORT ImageStackReader
+{
+public:
+  /**
+   * @brief Outcome of reading one file
+   */
+  struct SliceStatus
+  {
+    QString filePath;
+    int32_t errorCode = 0;
+    QString message;
+    bool read = false;
+  };
+
+  /**
+   * @brief Decodes filePath into numBytes bytes at destination. Returns a negative error code and sets
+   * message on failure. Called concurrently from several threads.
+   */
+  using SliceDecoder = std::function<int32_t(const QString& filePath, void* destination, size_t numBytes, QString& message)>;
+
+  /**
+   * @brief Called once per finished slice, in file order, from the reading threads but never concurrently
+   */
+  using SliceObserver = std::function<void(size_t sliceIndex, const SliceStatus& status)>;
+
+  static constexpr int32_t k_NoDecoderError = -31000;
+  static constexpr int32_t k_BufferSizeError = -31001;
+  static constexpr int32_t k_CanceledError = -31002;
+  static constexpr int32_t k_DecoderExceptionError = -31003;
+
+  ImageStackReader();
+  ~ImageStackReader();
+
+  /**
+   * @brief Sets the files to read. The i-th file is written to the i-th slice of the destination.
+   * @param fileList
+   */
+  void setFileList(const QVector<QString>& fileList);
+
+  /**
+   * @brief Returns the files to read
+   * @return
+   */
+  QVector<QString> getFileList() const;
+
+  /**
+   * @brief Sets the function that decodes one file
+   * @param decoder
+   */
+  void setDecoder(const SliceDecoder& decoder);
+
+  /**
+   * @brief Sets the function told about every finished slice
+   * @param observer
+   */
+  void setSliceObserver(const SliceObserver& observer);
+
+  /**
+   * @brief Sets a function polled before each slice is started. Reading stops when it returns true.
+   * @param cancelCheck
+   */
+  void setCancelCheck(const std::function<bool()>& cancelCheck);
+
+  /**
+   * @brief Sets the number of slices decoded at the same time. Zero uses the hardware concurrency.
+   * @param numThreads
+   */
+  void setNumberOfThreads(uint32_t numThreads);
+
+  /**
+   * @brief Returns the number of slices decoded at the same time. Zero uses the hardware concurrency.
+   * @return
+   */
+  uint32_t getNumberOfThreads() const;
+
+  /**
+   * @brief Sets how many slices past the oldest unfinished one may be started. Zero uses twice the
+   * number of threads.
+   * @param window
+   */
+  void setPrefetchWindow(size_t window);
+
+  /**
+   * @brief Returns the prefetch window. Zero uses twice the number of threads.
+   * @return
+   */
+  size_t getPrefetchWindow() const;
+
+  /**
+   * @brief Sets whether reading stops at the first failed slice
+   * @param stopOnError
+   */
+  void setStopOnError(bool stopOnError);
+
+  /**
+   * @brief Returns whether reading stops at the first failed slice
+   * @return
+   */
+  bool getStopOnError() const;
+
+  /**
+   * @brief Reads every file into slices of sliceBytes bytes starting at destination
+   * @param destination Buffer of at least sliceBytes times the number of files
+   * @param sliceBytes
+   * @return The status of every file, in file order. Files that were not started have read set to false.
+   */
+  std::vector<SliceStatus> read(void* destination, size_t sliceBytes) const;
+
+  /**
+   * @brief Reads every file into destination, which is split into one equally sized slice per file.
+   * Only numeric DataArrays are accepted; any other array returns k_BufferSizeError.
+   * @param destination
+   * @return The status of every file, in file order
+   */
+  std::vector<SliceStatus> read(IDataArray& destination) const;
+
+  /**
+   * @brief Returns the first failed status of statuses or nullptr if every slice was read
+   * @param statuses
+   * @return
+   */
+  static const SliceStatus* FirstError(const std::vector<SliceStatus>& statuses);
+
+private:
+  QVector<QString> m_FileList;
+  SliceDecoder m_Decoder;
+  SliceObserver m_SliceObserver;
+  std::function<bool()> m_CancelCheck;
+  uint32_t m_NumberOfThreads = 0;
+  size_t m_PrefetchWindow = 0;
+  bool m_StopOnError = true;
+
+public:
+  ImageStackReader(const ImageStackReader&) = delete;            // Copy Constructor Not Implemented
+  ImageStackReader(ImageStackReader&&) = delete;                 // Move Constructor Not Implemented
+  ImageStackReader& operator=(const ImageStackReader&) = delete; // Copy Assignment Not Implemented
+  ImageStackReader& operator=(ImageStackReader&&) = delete;      // Move Assignment Not Implemented
+};
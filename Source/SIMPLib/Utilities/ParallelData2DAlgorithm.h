@@ -38,6 +38,7 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLRange2D.h"
+#include "SIMPLib/Utilities/ParallelRegionObserver.h"
 
 // SIMPLib.h MUST be included before this or the guard will block the include but not its uses below.
 // This is consistent with previous behavior, only earlier parallelization split the includes between
@@ -115,6 +116,11 @@ public:
     bool doParallel = false;
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
     doParallel = m_RunParallel;
+#endif
+    // Reported to the observer of this thread, e.g. a profiled pipeline that is executing
+    ParallelRegionObserver::ScopedRegion profileRegion("ParallelData2DAlgorithm", m_Range.size(), doParallel);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
     if(doParallel)
     {
       tbb::blocked_range2d<size_t, size_t> tbbRange(m_Range.minRow(), m_Range.maxRow(), m_Range.minCol(), m_Range.maxCol());
@@ -38,6 +38,7 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLRange3D.h"
+#include "SIMPLib/Utilities/ParallelRegionObserver.h"
 
 // SIMPLib.h MUST be included before this or the guard will block the include but not its uses below.
 // This is consistent with previous behavior, only earlier parallelization split the includes between
@@ -122,6 +123,11 @@ public:
     bool doParallel = false;
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
     doParallel = m_RunParallel;
+#endif
+    // Reported to the observer of this thread, e.g. a profiled pipeline that is executing
+    ParallelRegionObserver::ScopedRegion profileRegion("ParallelData3DAlgorithm", (m_Range[1] - m_Range[0]) * (m_Range[3] - m_Range[2]) * (m_Range[5] - m_Range[4]), doParallel);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
     if(doParallel)
     {
       tbb::blocked_range3d<size_t, size_t, size_t> tbbRange(m_Range[0], m_Range[1], m_Grain, m_Range[2], m_Range[3], m_Range[3], m_Range[4], m_Range[5], m_Range[5]);
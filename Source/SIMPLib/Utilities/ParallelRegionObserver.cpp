@@ -0,0 +1,88 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ParallelRegionObserver.h"
+
+namespace
+{
+// Filters run on the thread that executes their pipeline, so regions of concurrently executing
+// pipelines are not mixed up.
+thread_local ParallelRegionObserver* s_ThreadObserver = nullptr;
+} // namespace
+
+// -----------------------------------------------------------------------------
+ParallelRegionObserver::ParallelRegionObserver() = default;
+
+// -----------------------------------------------------------------------------
+ParallelRegionObserver::~ParallelRegionObserver()
+{
+  if(s_ThreadObserver == this)
+  {
+    s_ThreadObserver = nullptr;
+  }
+}
+
+// -----------------------------------------------------------------------------
+ParallelRegionObserver* ParallelRegionObserver::ThreadObserver()
+{
+  return s_ThreadObserver;
+}
+
+// -----------------------------------------------------------------------------
+void ParallelRegionObserver::SetThreadObserver(ParallelRegionObserver* observer)
+{
+  s_ThreadObserver = observer;
+}
+
+// -----------------------------------------------------------------------------
+ParallelRegionObserver::ScopedRegion::ScopedRegion(const char* name, size_t rangeSize, bool parallel)
+: m_Observer(s_ThreadObserver)
+, m_Name(name)
+, m_RangeSize(rangeSize)
+, m_Parallel(parallel)
+{
+  if(nullptr != m_Observer)
+  {
+    m_Start = std::chrono::steady_clock::now();
+  }
+}
+
+// -----------------------------------------------------------------------------
+ParallelRegionObserver::ScopedRegion::~ScopedRegion()
+{
+  if(nullptr != m_Observer)
+  {
+    m_Observer->parallelRegionFinished(m_Name, m_Start, std::chrono::steady_clock::now(), m_RangeSize, m_Parallel);
+  }
+}
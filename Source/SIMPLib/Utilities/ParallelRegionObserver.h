@@ -0,0 +1,106 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The ParallelRegionObserver class is told about every parallel algorithm that finishes on the thread
+ * it is installed on. The parallel algorithms only know this interface, so code at higher levels such as the
+ * PipelineProfiler can time them without the utilities depending on it.
+ */
+class SIMPLib_EXPORT ParallelRegionObserver
+{
+public:
+  virtual ~ParallelRegionObserver();
+
+  /**
+   * @brief Called on the thread that ran the algorithm when the algorithm finished
+   * @param name Name of the algorithm
+   * @param start
+   * @param stop
+   * @param rangeSize Number of items the algorithm processed
+   * @param parallel True if the algorithm ran in parallel
+   */
+  virtual void parallelRegionFinished(const char* name, const std::chrono::steady_clock::time_point& start, const std::chrono::steady_clock::time_point& stop, size_t rangeSize,
+                                      bool parallel) = 0;
+
+  /**
+   * @brief Returns the observer installed on the calling thread or nullptr
+   * @return
+   */
+  static ParallelRegionObserver* ThreadObserver();
+
+  /**
+   * @brief Installs the observer for the calling thread. Pass nullptr to remove it.
+   * @param observer
+   */
+  static void SetThreadObserver(ParallelRegionObserver* observer);
+
+  /**
+   * @brief Reports its lifetime to the observer that was installed on this thread when it was created.
+   * Does nothing when no observer is installed.
+   */
+  class SIMPLib_EXPORT ScopedRegion
+  {
+  public:
+    ScopedRegion(const char* name, size_t rangeSize, bool parallel);
+    ~ScopedRegion();
+
+    ScopedRegion(const ScopedRegion&) = delete;
+    ScopedRegion(ScopedRegion&&) = delete;
+    ScopedRegion& operator=(const ScopedRegion&) = delete;
+    ScopedRegion& operator=(ScopedRegion&&) = delete;
+
+  private:
+    ParallelRegionObserver* m_Observer = nullptr;
+    const char* m_Name = nullptr;
+    size_t m_RangeSize = 0;
+    bool m_Parallel = false;
+    std::chrono::steady_clock::time_point m_Start;
+  };
+
+protected:
+  ParallelRegionObserver();
+
+public:
+  ParallelRegionObserver(const ParallelRegionObserver&) = delete;            // Copy Constructor Not Implemented
+  ParallelRegionObserver(ParallelRegionObserver&&) = delete;                 // Move Constructor Not Implemented
+  ParallelRegionObserver& operator=(const ParallelRegionObserver&) = delete; // Copy Assignment Not Implemented
+  ParallelRegionObserver& operator=(ParallelRegionObserver&&) = delete;      // Move Assignment Not Implemented
+};
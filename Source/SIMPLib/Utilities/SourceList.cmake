@@ -16,16 +16,21 @@ set_source_files_properties( ${SIMPLib_${SUBDIR_NAME}_Generated_MOC_SRCS} PROPER
 
 
 set(SIMPLib_Utilities_HDRS
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ColorMap.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ColorTable.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ColorUtilities.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ComponentTranspose.hpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArrayReductions.hpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FilePathGenerator.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FileSystemPathHelper.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FloatSummation.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/GenericDataParser.hpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ImageStackReader.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/MontageSelection.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ParallelDataAlgorithm.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ParallelData2DAlgorithm.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ParallelData3DAlgorithm.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ParallelRegionObserver.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ParallelTaskAlgorithm.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PythonSupport.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLDataPathValidator.h
@@ -41,15 +46,18 @@ set(SIMPLib_Utilities_HDRS
 )
 
 set(SIMPLib_Utilities_SRCS
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ColorMap.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ColorTable.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ColorUtilities.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FilePathGenerator.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FileSystemPathHelper.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FloatSummation.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ImageStackReader.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/MontageSelection.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ParallelDataAlgorithm.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ParallelData2DAlgorithm.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ParallelData3DAlgorithm.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ParallelRegionObserver.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ParallelTaskAlgorithm.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PythonSupport.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLDataPathValidator.cpp
@@ -0,0 +1,187 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cmath>
+#include <iostream>
+
+#include <QtCore/QJsonArray>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+#include "SIMPLib/Utilities/ColorMap.h"
+
+class ColorMapTest
+{
+public:
+  ColorMapTest() = default;
+  virtual ~ColorMapTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  ColorMap createColorMap()
+  {
+    // Black to red to white with positions that need normalizing
+    QJsonArray controlPoints = {-2.0, 0.0, 0.0, 0.0, 3.0, 1.0, 0.0, 0.0, 8.0, 1.0, 1.0, 1.0};
+    return ColorMap(controlPoints);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMapNormalized()
+  {
+    ColorMap colorMap = createColorMap();
+    DREAM3D_REQUIRE_EQUAL(colorMap.isValid(), true)
+    DREAM3D_REQUIRE_EQUAL(colorMap.getNumberOfControlPoints(), 3)
+
+    uint8_t rgb[3] = {1, 1, 1};
+    colorMap.mapNormalized(0.0f, rgb);
+    DREAM3D_REQUIRE(rgb[0] == 0 && rgb[1] == 0 && rgb[2] == 0)
+    colorMap.mapNormalized(0.5f, rgb);
+    DREAM3D_REQUIRE(rgb[0] == 255 && rgb[1] == 0 && rgb[2] == 0)
+    colorMap.mapNormalized(1.0f, rgb);
+    DREAM3D_REQUIRE(rgb[0] == 255 && rgb[1] == 255 && rgb[2] == 255)
+    colorMap.mapNormalized(0.75f, rgb);
+    DREAM3D_REQUIRE(rgb[0] == 255 && rgb[1] == 127 && rgb[2] == 127)
+
+    // Out of range and NaN values are clamped to the ends
+    colorMap.mapNormalized(2.0f, rgb);
+    DREAM3D_REQUIRE(rgb[0] == 255 && rgb[1] == 255 && rgb[2] == 255)
+    colorMap.mapNormalized(std::nanf(""), rgb);
+    DREAM3D_REQUIRE(rgb[0] == 0 && rgb[1] == 0 && rgb[2] == 0)
+
+    ColorMap empty;
+    DREAM3D_REQUIRE_EQUAL(empty.isValid(), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  void CheckExactMapping(T min, T max, size_t step)
+  {
+    ColorMap colorMap = createColorMap();
+    std::vector<T> values;
+    for(size_t i = 0; i <= static_cast<size_t>(max - min); i += step)
+    {
+      values.push_back(static_cast<T>(min + static_cast<T>(i)));
+    }
+    values.push_back(max);
+
+    std::vector<uint8_t> rgb(values.size() * 3);
+    colorMap.mapValues(values.data(), values.size(), min, max, rgb.data());
+
+    float range = static_cast<float>(static_cast<double>(max) - static_cast<double>(min));
+    for(size_t i = 0; i < values.size(); i++)
+    {
+      uint8_t expected[3];
+      colorMap.mapNormalized(static_cast<float>(static_cast<double>(values[i]) - static_cast<double>(min)) / range, expected);
+      DREAM3D_REQUIRE(rgb[i * 3] == expected[0] && rgb[i * 3 + 1] == expected[1] && rgb[i * 3 + 2] == expected[2])
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMapValues()
+  {
+    // Mapped through the per value table
+    CheckExactMapping<int16_t>(-1000, 1000, 1);
+    // Interpolated per value
+    CheckExactMapping<int32_t>(-100000, 100000, 7);
+
+    // Quantized values use the table entry nearest to their position
+    ColorMap colorMap = createColorMap();
+    std::vector<uint8_t> table = colorMap.createLookupTable(256);
+    DREAM3D_REQUIRE_EQUAL(table.size(), 256 * 3)
+    std::vector<uint8_t> values(256);
+    for(size_t i = 0; i < values.size(); i++)
+    {
+      values[i] = static_cast<uint8_t>(i);
+    }
+    std::vector<uint8_t> rgb(values.size() * 3);
+    colorMap.mapValues(values.data(), values.size(), static_cast<uint8_t>(0), static_cast<uint8_t>(255), table, rgb.data());
+    DREAM3D_REQUIRE(rgb == table)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMapArray()
+  {
+    ColorMap colorMap = createColorMap();
+    FloatArrayType::Pointer values = FloatArrayType::CreateArray(5, "Values", true);
+    values->setValue(0, 10.0f);
+    values->setValue(1, 20.0f);
+    values->setValue(2, std::nanf(""));
+    values->setValue(3, 15.0f);
+    values->setValue(4, 17.5f);
+
+    UInt8ArrayType::Pointer rgb = UInt8ArrayType::CreateArray(5, std::vector<size_t>{3}, "RGB", true);
+    DREAM3D_REQUIRE_EQUAL(colorMap.mapArray(*values, *rgb), true)
+    std::vector<uint8_t> expected = {0, 0, 0, 255, 255, 255, 0, 0, 0, 255, 0, 0, 255, 127, 127};
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(rgb->getValue(i), expected[i])
+    }
+
+    DREAM3D_REQUIRE_EQUAL(colorMap.mapArray(*values, *rgb, ColorMap::k_DefaultTableSize), true)
+    DREAM3D_REQUIRE_EQUAL(rgb->getValue(3), 255)
+    DREAM3D_REQUIRE_EQUAL(rgb->getValue(6), 0)
+
+    // The color array needs three components
+    UInt8ArrayType::Pointer gray = UInt8ArrayType::CreateArray(5, "Gray", true);
+    DREAM3D_REQUIRE_EQUAL(colorMap.mapArray(*values, *gray), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### ColorMapTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestMapNormalized());
+    DREAM3D_REGISTER_TEST(TestMapValues());
+    DREAM3D_REGISTER_TEST(TestMapArray());
+  }
+
+public:
+  ColorMapTest(const ColorMapTest&) = delete;            // Copy Constructor Not Implemented
+  ColorMapTest(ColorMapTest&&) = delete;                 // Move Constructor Not Implemented
+  ColorMapTest& operator=(const ColorMapTest&) = delete; // Copy Assignment Not Implemented
+  ColorMapTest& operator=(ColorMapTest&&) = delete;      // Move Assignment Not Implemented
+};
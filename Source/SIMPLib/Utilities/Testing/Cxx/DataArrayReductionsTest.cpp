@@ -0,0 +1,176 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+#include "SIMPLib/Utilities/DataArrayReductions.hpp"
+
+class DataArrayReductionsTest
+{
+public:
+  DataArrayReductionsTest() = default;
+  virtual ~DataArrayReductionsTest() = default;
+
+  // Spans several reduction blocks so the block merge is exercised
+  const size_t k_NumTuples = 3 * DataArrayReductions::k_BlockSize + 17;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FloatArrayType::Pointer createArray()
+  {
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(k_NumTuples, std::vector<size_t>{2}, "Values", true);
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      array->setComponent(i, 0, static_cast<float>(i % 100));
+      array->setComponent(i, 1, static_cast<float>(i % 7) - 3.0f);
+    }
+    return array;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMinMax()
+  {
+    FloatArrayType::Pointer array = createArray();
+    size_t lastTuple = k_NumTuples - 5;
+    array->setComponent(lastTuple, 0, -10.0f);
+    array->setComponent(7, 0, std::nanf(""));
+
+    DataArrayReductions::MinMaxResult<float> result = DataArrayReductions::MinMax(*array, 0);
+    DREAM3D_REQUIRE_EQUAL(result.isValid(), true)
+    DREAM3D_REQUIRE_EQUAL(result.count, k_NumTuples - 1)
+    DREAM3D_REQUIRE_EQUAL(result.min, -10.0f)
+    DREAM3D_REQUIRE_EQUAL(result.minIndex, lastTuple)
+    DREAM3D_REQUIRE_EQUAL(result.max, 99.0f)
+    DREAM3D_REQUIRE_EQUAL(result.maxIndex, 99)
+
+    // Ties keep the first occurrence and whole array indices are element indices
+    result = DataArrayReductions::MinMax(*array, 1);
+    DREAM3D_REQUIRE_EQUAL(result.min, -3.0f)
+    DREAM3D_REQUIRE_EQUAL(result.minIndex, 0)
+    result = DataArrayReductions::MinMax(*array);
+    DREAM3D_REQUIRE_EQUAL(result.minIndex, lastTuple * 2)
+
+    FloatArrayType::Pointer empty = FloatArrayType::CreateArray(0, "Empty", true);
+    result = DataArrayReductions::MinMax(*empty);
+    DREAM3D_REQUIRE_EQUAL(result.isValid(), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSumAndMeanVariance()
+  {
+    FloatArrayType::Pointer array = createArray();
+
+    double expectedSum = 0.0;
+    double expectedMean = 0.0;
+    double expectedM2 = 0.0;
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      double value = static_cast<double>(array->getComponent(i, 1));
+      expectedSum += value;
+      double delta = value - expectedMean;
+      expectedMean += delta / static_cast<double>(i + 1);
+      expectedM2 += delta * (value - expectedMean);
+    }
+
+    double sum = DataArrayReductions::Sum(*array, 1);
+    DREAM3D_REQUIRE(std::abs(sum - expectedSum) < 1.0E-6)
+
+    DataArrayReductions::MeanVarianceResult meanVar = DataArrayReductions::MeanVariance(*array, 1);
+    DREAM3D_REQUIRE_EQUAL(meanVar.count, k_NumTuples)
+    DREAM3D_REQUIRE(std::abs(meanVar.mean - expectedMean) < 1.0E-9)
+    DREAM3D_REQUIRE(std::abs(meanVar.variance() - expectedM2 / static_cast<double>(k_NumTuples)) < 1.0E-9)
+    DREAM3D_REQUIRE(std::abs(meanVar.sampleVariance() - expectedM2 / static_cast<double>(k_NumTuples - 1)) < 1.0E-9)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestHistogram()
+  {
+    Int32ArrayType::Pointer array = Int32ArrayType::CreateArray(k_NumTuples, "Ints", true);
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      array->setValue(i, static_cast<int32_t>(i % 10));
+    }
+
+    std::vector<size_t> histogram = DataArrayReductions::Histogram(*array, 5);
+    DREAM3D_REQUIRE_EQUAL(histogram.size(), 5)
+    size_t total = 0;
+    for(size_t bin = 0; bin < histogram.size(); bin++)
+    {
+      size_t expected = 0;
+      for(size_t i = 0; i < k_NumTuples; i++)
+      {
+        size_t value = i % 10;
+        size_t expectedBin = std::min(static_cast<size_t>(static_cast<double>(value) * 5.0 / 9.0), static_cast<size_t>(4));
+        expected += (expectedBin == bin) ? 1 : 0;
+      }
+      DREAM3D_REQUIRE_EQUAL(histogram[bin], expected)
+      total += histogram[bin];
+    }
+    DREAM3D_REQUIRE_EQUAL(total, k_NumTuples)
+
+    // Values outside the range are not counted
+    histogram = DataArrayReductions::Histogram(*array, 2, 0.0, 3.0);
+    DREAM3D_REQUIRE_EQUAL(histogram[0] + histogram[1], (k_NumTuples / 10) * 4 + 4)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### DataArrayReductionsTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestMinMax());
+    DREAM3D_REGISTER_TEST(TestSumAndMeanVariance());
+    DREAM3D_REGISTER_TEST(TestHistogram());
+  }
+
+public:
+  DataArrayReductionsTest(const DataArrayReductionsTest&) = delete;            // Copy Constructor Not Implemented
+  DataArrayReductionsTest(DataArrayReductionsTest&&) = delete;                 // Move Constructor Not Implemented
+  DataArrayReductionsTest& operator=(const DataArrayReductionsTest&) = delete; // Copy Assignment Not Implemented
+  DataArrayReductionsTest& operator=(DataArrayReductionsTest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,189 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/BitMaskArray.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+#include "SIMPLib/Utilities/ImageStackReader.h"
+
+class ImageStackReaderTest
+{
+public:
+  ImageStackReaderTest() = default;
+  virtual ~ImageStackReaderTest() = default;
+
+  const size_t k_NumSlices = 24;
+  const size_t k_SliceValues = 100;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QVector<QString> createFileList()
+  {
+    QVector<QString> fileList;
+    for(size_t i = 0; i < k_NumSlices; i++)
+    {
+      fileList.push_back(QString("slice_%1.tif").arg(i));
+    }
+    return fileList;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestReadStack()
+  {
+    std::atomic<int> inFlight(0);
+    std::atomic<int> maxInFlight(0);
+    ImageStackReader reader;
+    reader.setFileList(createFileList());
+    reader.setNumberOfThreads(4);
+    reader.setPrefetchWindow(4);
+
+    // Fills each slice with its index, taking longer for early slices so they finish out of order
+    reader.setDecoder([&](const QString& filePath, void* destination, size_t numBytes, QString& message) -> int32_t {
+      int current = ++inFlight;
+      int previous = maxInFlight.load();
+      while(current > previous && !maxInFlight.compare_exchange_weak(previous, current))
+      {
+      }
+      int32_t sliceIndex = filePath.mid(6, filePath.indexOf('.') - 6).toInt();
+      std::this_thread::sleep_for(std::chrono::milliseconds(sliceIndex % 4 == 0 ? 5 : 1));
+      int32_t* values = static_cast<int32_t*>(destination);
+      for(size_t i = 0; i < numBytes / sizeof(int32_t); i++)
+      {
+        values[i] = sliceIndex;
+      }
+      --inFlight;
+      return 0;
+    });
+
+    std::vector<size_t> observed;
+    reader.setSliceObserver([&](size_t sliceIndex, const ImageStackReader::SliceStatus& status) { observed.push_back(sliceIndex); });
+
+    Int32ArrayType::Pointer array = Int32ArrayType::CreateArray(k_NumSlices * k_SliceValues, "Stack", true);
+    array->initializeWithValue(-1);
+    std::vector<ImageStackReader::SliceStatus> statuses = reader.read(*array);
+
+    DREAM3D_REQUIRE_EQUAL(statuses.size(), k_NumSlices)
+    DREAM3D_REQUIRE(ImageStackReader::FirstError(statuses) == nullptr)
+    DREAM3D_REQUIRE(maxInFlight.load() <= 4)
+    DREAM3D_REQUIRE_EQUAL(observed.size(), k_NumSlices)
+    for(size_t i = 0; i < k_NumSlices; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(observed[i], i)
+      DREAM3D_REQUIRE_EQUAL(statuses[i].read, true)
+      DREAM3D_REQUIRE_EQUAL(array->getValue(i * k_SliceValues), static_cast<int32_t>(i))
+      DREAM3D_REQUIRE_EQUAL(array->getValue(i * k_SliceValues + k_SliceValues - 1), static_cast<int32_t>(i))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestErrors()
+  {
+    ImageStackReader reader;
+    reader.setFileList(createFileList());
+    reader.setNumberOfThreads(2);
+    reader.setPrefetchWindow(2);
+    reader.setDecoder([](const QString& filePath, void* destination, size_t numBytes, QString& message) -> int32_t {
+      if(filePath == "slice_5.tif")
+      {
+        message = "Corrupt file";
+        return -5;
+      }
+      return 0;
+    });
+
+    std::vector<uint8_t> buffer(k_NumSlices * 8);
+    std::vector<ImageStackReader::SliceStatus> statuses = reader.read(buffer.data(), 8);
+    const ImageStackReader::SliceStatus* error = ImageStackReader::FirstError(statuses);
+    DREAM3D_REQUIRE(error != nullptr)
+    DREAM3D_REQUIRE_EQUAL(error->filePath, QString("slice_5.tif"))
+    DREAM3D_REQUIRE_EQUAL(error->message, QString("Corrupt file"))
+    for(size_t i = 0; i < 5; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(statuses[i].read, true)
+    }
+    // Nothing past the prefetch window is started once the error is reported
+    DREAM3D_REQUIRE_EQUAL(statuses.back().read, false)
+
+    // Every file is read when errors do not stop the stack
+    reader.setStopOnError(false);
+    statuses = reader.read(buffer.data(), 8);
+    DREAM3D_REQUIRE_EQUAL(statuses.back().read, true)
+    DREAM3D_REQUIRE_EQUAL(statuses[5].errorCode, -5)
+
+    // The destination has to split evenly into slices
+    Int32ArrayType::Pointer array = Int32ArrayType::CreateArray(k_NumSlices + 1, "Stack", true);
+    statuses = reader.read(*array);
+    DREAM3D_REQUIRE_EQUAL(statuses[0].errorCode, ImageStackReader::k_BufferSizeError)
+
+    // Packed bits do not fill getSize() * getTypeSize() bytes so they are rejected before anything is written
+    BitMaskArray::Pointer mask = BitMaskArray::CreateArray(k_NumSlices * 8, "Mask", true);
+    statuses = reader.read(*mask);
+    DREAM3D_REQUIRE_EQUAL(statuses.size(), 1)
+    DREAM3D_REQUIRE_EQUAL(statuses[0].errorCode, ImageStackReader::k_BufferSizeError)
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), 0)
+
+    // Canceling marks the slices that were not started
+    reader.setCancelCheck([]() { return true; });
+    statuses = reader.read(buffer.data(), 8);
+    DREAM3D_REQUIRE_EQUAL(statuses[0].errorCode, ImageStackReader::k_CanceledError)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### ImageStackReaderTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestReadStack());
+    DREAM3D_REGISTER_TEST(TestErrors());
+  }
+
+public:
+  ImageStackReaderTest(const ImageStackReaderTest&) = delete;            // Copy Constructor Not Implemented
+  ImageStackReaderTest(ImageStackReaderTest&&) = delete;                 // Move Constructor Not Implemented
+  ImageStackReaderTest& operator=(const ImageStackReaderTest&) = delete; // Copy Assignment Not Implemented
+  ImageStackReaderTest& operator=(ImageStackReaderTest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -38,6 +38,9 @@
 
 #include <iostream>
 
+#include <QtCore/QHash>
+#include <QtCore/QSet>
+
 #include <QtCore/QMimeData>
 #include <QtGui/QDrag>
 #include <QtGui/QMouseEvent>
@@ -57,6 +60,32 @@ namespace
 {
 const int InfoStringRole = Qt::UserRole + 1;
 const int MontageRole = Qt::UserRole + 2;
+
+// -----------------------------------------------------------------------------
+// Only touch the item when the value actually changes so unchanged rows do not emit dataChanged
+void SetItemData(QStandardItem* item, const QVariant& value, int role)
+{
+  if(item->data(role) != value)
+  {
+    item->setData(value, role);
+  }
+}
+
+// -----------------------------------------------------------------------------
+void SetItemInfo(QStandardItem* item, const QString& infoString, const QString& toolTip)
+{
+  SetItemData(item, infoString, ::InfoStringRole);
+  SetItemData(item, toolTip, Qt::ToolTipRole);
+}
+
+// -----------------------------------------------------------------------------
+void SetItemIcon(QStandardItem* item, const QIcon& icon)
+{
+  if(item->icon().cacheKey() != icon.cacheKey())
+  {
+    item->setIcon(icon);
+  }
+}
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -593,17 +622,77 @@ QStandardItem* DataStructureTreeView::findItemByPath(const DataArrayPath& path)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void DataStructureTreeView::removeNonexistingEntries(QStandardItem* rootItem, const QStringList& existingItems, int column)
+QVector<QStandardItem*> DataStructureTreeView::syncChildItems(QStandardItem* parentItem, const QStringList& names)
 {
-  int rowCount = rootItem->rowCount();
+  // Index the current children by name. Walking backwards lets the first of any duplicate names win.
+  const int rowCount = parentItem->rowCount();
+  QHash<QString, QStandardItem*> existingItems;
+  existingItems.reserve(rowCount);
   for(int row = rowCount - 1; row >= 0; row--)
   {
-    QStandardItem* anItem = rootItem->child(row, column);
-    if(!existingItems.contains(anItem->text()))
+    QStandardItem* child = parentItem->child(row, 0);
+    existingItems.insert(child->text(), child);
+  }
+
+  // Match each requested name to an existing item
+  QVector<QStandardItem*> items(names.size(), nullptr);
+  QSet<QStandardItem*> keptItems;
+  keptItems.reserve(names.size());
+  for(int i = 0; i < names.size(); i++)
+  {
+    auto iter = existingItems.find(names[i]);
+    if(iter != existingItems.end() && nullptr != iter.value())
+    {
+      items[i] = iter.value();
+      keptItems.insert(iter.value());
+      iter.value() = nullptr;
+    }
+  }
+
+  // Remove the rows that no longer exist, one contiguous block at a time
+  int row = rowCount - 1;
+  while(row >= 0)
+  {
+    if(keptItems.contains(parentItem->child(row, 0)))
+    {
+      row--;
+      continue;
+    }
+    int last = row;
+    while(row >= 0 && !keptItems.contains(parentItem->child(row, 0)))
     {
-      rootItem->removeRow(row);
+      row--;
     }
+    parentItem->removeRows(row + 1, last - row);
   }
+
+  // Rows [0, i) always hold items [0, i). The kept items that remain keep their
+  // relative order so moves only happen if the structure itself was reordered.
+  int i = 0;
+  while(i < names.size())
+  {
+    if(nullptr == items[i])
+    {
+      int start = i;
+      QList<QStandardItem*> newItems;
+      while(i < names.size() && nullptr == items[i])
+      {
+        items[i] = new QStandardItem(names[i]);
+        newItems.push_back(items[i]);
+        i++;
+      }
+      parentItem->insertRows(start, newItems);
+      continue;
+    }
+    if(parentItem->child(i, 0) != items[i])
+    {
+      QList<QStandardItem*> movedRow = parentItem->takeRow(items[i]->row());
+      parentItem->insertRow(i, movedRow);
+    }
+    i++;
+  }
+
+  return items;
 }
 
 // -----------------------------------------------------------------------------
@@ -618,17 +707,6 @@ void DataStructureTreeView::displayDataContainers(const DataContainerArray::Poin
   }
 
   QStandardItemModel* model = getStandardModel();
-  QVector<QString> path;
-  {
-    QModelIndex currIndex = currentIndex();
-    QStandardItem* item = model->itemFromIndex(currIndex);
-    // Get what is selected and save it
-    while(nullptr != item)
-    {
-      path.push_front(item->text());
-      item = item->parent();
-    }
-  }
 
   // Sanity check model
   if(model == nullptr)
@@ -637,46 +715,44 @@ void DataStructureTreeView::displayDataContainers(const DataContainerArray::Poin
     return;
   }
 
-  // Loop over the data containers
+  // The existing items are updated in place so the expanded and selected items
+  // survive without having to be saved and restored.
   DataContainerArray::Container containers = dca->getDataContainers();
-  QStandardItem* rootItem = model->invisibleRootItem();
+  QStringList dcNames;
+  for(const DataContainer::Pointer& dc : containers)
+  {
+    dcNames.push_back(dc->getName());
+  }
+  QVector<QStandardItem*> dcItems = syncChildItems(model->invisibleRootItem(), dcNames);
 
-  for(DataContainer::Pointer dc : containers)
+  int dcIndex = 0;
+  for(const DataContainer::Pointer& dc : containers)
   {
-    QStandardItem* dcItem = generateDataContainerItem(rootItem, dc);
+    QStandardItem* dcItem = dcItems[dcIndex++];
+    updateDataContainerItem(dcItem, dc);
 
-    if(!path.empty() && dc->getName().compare(path[0]) == 0)
+    DataContainer::Container_t attrMatrices = dc->getChildren();
+    QStringList amNames;
+    for(const auto& am : attrMatrices)
     {
-      setCurrentIndex(model->indexFromItem(dcItem));
+      amNames.push_back(am->getName());
     }
+    QVector<QStandardItem*> amItems = syncChildItems(dcItem, amNames);
 
-    // We found the proper Data Container, now populate the AttributeMatrix List
-    for(const auto& am : dc->getChildren())
+    int amIndex = 0;
+    for(const auto& am : attrMatrices)
     {
-      QStandardItem* amItem = generateAttrMatrixItem(dcItem, am);
+      QStandardItem* amItem = amItems[amIndex++];
+      updateAttrMatrixItem(amItem, am);
 
-      if(path.size() > 1 && am->getName().compare(path[1]) == 0)
+      QStringList attrArrayNames = am->getAttributeArrayNames();
+      QVector<QStandardItem*> aaItems = syncChildItems(amItem, attrArrayNames);
+      for(int i = 0; i < attrArrayNames.size(); i++)
       {
-        setCurrentIndex(model->indexFromItem(amItem));
+        updateDataArrayItem(aaItems[i], am->getAttributeArray(attrArrayNames[i]));
       }
-
-      // We found the selected AttributeMatrix, so loop over this attribute matrix arrays and populate the list widget
-      QList<QString> attrArrayNames = am->getAttributeArrayNames();
-      for(const QString& attrArrayName : attrArrayNames)
-      {
-        QStandardItem* aaItem = generateDataArrayItem(amItem, am, attrArrayName);
-
-        if(path.size() > 2 && attrArrayName.compare(path[2]) == 0)
-        {
-          QModelIndex idx = model->indexFromItem(aaItem);
-          setCurrentIndex(idx);
-        }
-      }
-      removeNonexistingEntries(amItem, attrArrayNames, 0);
     }
-    removeNonexistingEntries(dcItem, dc->getAttributeMatrixNames(), 0);
   }
-  removeNonexistingEntries(rootItem, dca->getDataContainerNames(), 0);
 
   // repaint the DataStructureTreeView
   repaint();
@@ -687,26 +763,7 @@ void DataStructureTreeView::displayDataContainers(const DataContainerArray::Poin
 // -----------------------------------------------------------------------------
 void DataStructureTreeView::displayMontages(const DataContainerArray::Pointer& dca)
 {
-  if(dca.get() == nullptr)
-  {
-    QStandardItemModel* model = getStandardModel();
-    QStandardItem* rootItem = model->invisibleRootItem();
-    removeNonexistingEntries(rootItem, QStringList(), 0);
-    return;
-  }
-
   QStandardItemModel* model = getStandardModel();
-  QVector<QString> path;
-  {
-    QModelIndex currIndex = currentIndex();
-    QStandardItem* item = model->itemFromIndex(currIndex);
-    // Get what is selected and save it
-    while(nullptr != item)
-    {
-      path.push_front(item->text());
-      item = item->parent();
-    }
-  }
 
   // Sanity check model
   if(model == nullptr)
@@ -716,42 +773,51 @@ void DataStructureTreeView::displayMontages(const DataContainerArray::Pointer& d
   }
 
   QStandardItem* rootItem = model->invisibleRootItem();
+  if(dca.get() == nullptr)
+  {
+    syncChildItems(rootItem, QStringList());
+    return;
+  }
+
   DataContainerArray::MontageCollection montageCollection = dca->getMontageCollection();
+  QStringList montageNames;
+  for(const auto& montage : montageCollection)
+  {
+    montageNames.push_back(montage->getName());
+  }
+  QVector<QStandardItem*> montageItems = syncChildItems(rootItem, montageNames);
 
+  int montageIndex = 0;
   for(const auto& montage : montageCollection)
   {
-    QStandardItem* montageItem = generateMontageItem(rootItem, montage);
-    montageItem->setData(true, ::MontageRole);
+    QStandardItem* montageItem = montageItems[montageIndex++];
+    updateMontageItem(montageItem, montage);
+    SetItemData(montageItem, true, ::MontageRole);
 
     // Loop over the data containers
     DataContainerArray::Container containers = montage->getDataContainers();
-    for(DataContainer::Pointer dc : containers)
+    QStringList dcNames;
+    for(const DataContainer::Pointer& dc : containers)
     {
-      QStandardItem* dcItem;
-      if(nullptr == dc)
-      {
-        dcItem = new QStandardItem("[Missing Data Container]");
-        montageItem->appendRow(dcItem);
-      }
-      else
-      {
-        dcItem = generateDataContainerItem(montageItem, dc);
-        dcItem->setData(false, ::MontageRole);
-
-        AbstractTileIndexShPtr dcIndex = montage->getTileIndexFor(dc);
-        ToolTipGenerator dcToolTip = dcIndex->getToolTipGenerator();
-        dcToolTip.append(dc->getToolTipGenerator());
-        dcItem->setToolTip(dcToolTip.generateHTML());
-      }
+      dcNames.push_back(nullptr == dc ? QString("[Missing Data Container]") : dc->getName());
+    }
+    QVector<QStandardItem*> dcItems = syncChildItems(montageItem, dcNames);
 
-      if(!path.empty() && dc->getName().compare(path[0]) == 0)
+    int dcIndex = 0;
+    for(const DataContainer::Pointer& dc : containers)
+    {
+      QStandardItem* dcItem = dcItems[dcIndex++];
+      if(nullptr == dc)
       {
-        setCurrentIndex(model->indexFromItem(dcItem));
+        continue;
       }
+      AbstractTileIndexShPtr dcIndexInfo = montage->getTileIndexFor(dc);
+      ToolTipGenerator dcToolTip = dcIndexInfo->getToolTipGenerator();
+      dcToolTip.append(dc->getToolTipGenerator());
+      updateDataContainerItem(dcItem, dc, dcToolTip.generateHTML());
+      SetItemData(dcItem, false, ::MontageRole);
     }
-    removeNonexistingEntries(montageItem, dca->getDataContainerNames(), 0);
   }
-  removeNonexistingEntries(rootItem, dca->getMontageNames(), 0);
 
   update();
 }
@@ -759,84 +825,56 @@ void DataStructureTreeView::displayMontages(const DataContainerArray::Pointer& d
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-QStandardItem* DataStructureTreeView::generateMontageItem(QStandardItem* rootItem, const AbstractMontage::Pointer& montage)
+void DataStructureTreeView::updateMontageItem(QStandardItem* montageItem, const AbstractMontage::Pointer& montage)
 {
-  QStandardItem* montageItem = getOrCreateItem(rootItem, montage->getName());
-  montageItem->setData(montage->getInfoString(), ::InfoStringRole);
-  montageItem->setToolTip(montage->getInfoString());
+  QString infoString = montage->getInfoString();
+  SetItemInfo(montageItem, infoString, infoString);
   if(montage->isValid())
   {
-    montageItem->setIcon(QIcon());
+    SetItemIcon(montageItem, QIcon());
   }
   else
   {
-    montageItem->setIcon(QIcon(":SIMPL/icons/images/warning.png"));
+    SetItemIcon(montageItem, m_WarningIcon);
   }
-
-  return montageItem;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-QStandardItem* DataStructureTreeView::generateDataContainerItem(QStandardItem* rootItem, const DataContainer::Pointer& dc)
+void DataStructureTreeView::updateDataContainerItem(QStandardItem* dcItem, const DataContainer::Pointer& dc, const QString& toolTip)
 {
-  QStandardItem* dcItem = getOrCreateItem(rootItem, dc->getName());
-  dcItem->setData(dc->getInfoString(SIMPL::HtmlFormat), ::InfoStringRole);
-  dcItem->setToolTip(dc->getInfoString(SIMPL::HtmlFormat));
+  QString infoString = dc->getInfoString(SIMPL::HtmlFormat);
+  SetItemInfo(dcItem, infoString, toolTip.isEmpty() ? infoString : toolTip);
   if(dc->getGeometry())
   {
     IGeometry::Type geomType = dc->getGeometry()->getGeometryType();
-    dcItem->setIcon(getDataContainerIcon(geomType));
+    SetItemIcon(dcItem, getDataContainerIcon(geomType));
   }
   else
   {
-    dcItem->setIcon(QIcon());
+    SetItemIcon(dcItem, QIcon());
   }
-
-  return dcItem;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-QStandardItem* DataStructureTreeView::generateAttrMatrixItem(QStandardItem* dcItem, const AttributeMatrix::Pointer& am)
-{
-  QStandardItem* amItem = getOrCreateItem(dcItem, am->getName());
-  amItem->setData(am->getInfoString(SIMPL::HtmlFormat), ::InfoStringRole);
-  amItem->setToolTip(am->getInfoString(SIMPL::HtmlFormat));
-  amItem->setIcon(QIcon());
-
-  return amItem;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-QStandardItem* DataStructureTreeView::generateDataArrayItem(QStandardItem* amItem, const AttributeMatrix::Pointer& am, const QString& name)
+void DataStructureTreeView::updateAttrMatrixItem(QStandardItem* amItem, const AttributeMatrix::Pointer& am)
 {
-  IDataArray::Pointer attrArray = am->getAttributeArray(name);
-
-  QStandardItem* aaItem = getOrCreateItem(amItem, attrArray->getName());
-  aaItem->setData(attrArray->getInfoString(SIMPL::HtmlFormat), ::InfoStringRole);
-  aaItem->setToolTip(attrArray->getInfoString(SIMPL::HtmlFormat));
-  aaItem->setIcon(QIcon());
-
-  return aaItem;
+  QString infoString = am->getInfoString(SIMPL::HtmlFormat);
+  SetItemInfo(amItem, infoString, infoString);
+  SetItemIcon(amItem, QIcon());
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-QStandardItem* DataStructureTreeView::getOrCreateItem(QStandardItem* parentItem, const QString& name)
+void DataStructureTreeView::updateDataArrayItem(QStandardItem* aaItem, const IDataArrayShPtrType& attrArray)
 {
-  QStandardItem* targetItem = findChildByName(parentItem, name, 0);
-  if(targetItem == nullptr)
-  {
-    targetItem = new QStandardItem(name);
-    parentItem->appendRow(targetItem);
-  }
-  return targetItem;
+  QString infoString = attrArray->getInfoString(SIMPL::HtmlFormat);
+  SetItemInfo(aaItem, infoString, infoString);
+  SetItemIcon(aaItem, QIcon());
 }
 
 // -----------------------------------------------------------------------------
@@ -46,6 +46,7 @@
 #include <QtGui/QStandardItemModel>
 #include <QtWidgets/QTreeView>
 
+#include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataContainers/DataArrayPath.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/Montages/AbstractMontage.h"
@@ -259,52 +260,43 @@ protected:
   QStandardItem* findItemByPath(const DataArrayPath& path);
 
   /**
-   * @brief getOrCreateItem
+   * @brief Makes the children of parentItem match names, in order. Children whose
+   * name is still present are kept, together with their expansion and selection
+   * state. Missing names are inserted and stale rows removed in contiguous blocks.
    * @param parentItem
-   * @param name
-   * @return
+   * @param names
+   * @return The child item for each name
    */
-  QStandardItem* getOrCreateItem(QStandardItem* parentItem, const QString& name);
+  QVector<QStandardItem*> syncChildItems(QStandardItem* parentItem, const QStringList& names);
 
   /**
-   * @brief generateMontageItem
-   * @param rootItem
+   * @brief updateMontageItem
+   * @param montageItem
    * @param montage
-   * @return
-   */
-  QStandardItem* generateMontageItem(QStandardItem* rootItem, const AbstractMontage::Pointer& montage);
-
-  /**
-   * @brief generateDataContainerItem
-   * @param rootItem
-   * @param dc
    */
-  QStandardItem* generateDataContainerItem(QStandardItem* rootItem, const DataContainerShPtr& dc);
+  void updateMontageItem(QStandardItem* montageItem, const AbstractMontage::Pointer& montage);
 
   /**
-   * @brief generateAttrMatrixItem
+   * @brief updateDataContainerItem
    * @param dcItem
-   * @param am
-   * @return
+   * @param dc
+   * @param toolTip The tool tip to use instead of the info string when not empty
    */
-  QStandardItem* generateAttrMatrixItem(QStandardItem* dcItem, const AttributeMatrixShPtr& am);
+  void updateDataContainerItem(QStandardItem* dcItem, const DataContainerShPtr& dc, const QString& toolTip = QString());
 
   /**
-   * @brief generateDataArrayItem
+   * @brief updateAttrMatrixItem
    * @param amItem
    * @param am
-   * @param name
-   * @return
    */
-  QStandardItem* generateDataArrayItem(QStandardItem* amItem, const AttributeMatrixShPtr& am, const QString& name);
+  void updateAttrMatrixItem(QStandardItem* amItem, const AttributeMatrixShPtr& am);
 
   /**
-   * @brief removeNonexistingEntries
-   * @param rootItem
-   * @param existingItems
-   * @param column
+   * @brief updateDataArrayItem
+   * @param aaItem
+   * @param attrArray
    */
-  void removeNonexistingEntries(QStandardItem* rootItem, const QStringList& existingItems, int column);
+  void updateDataArrayItem(QStandardItem* aaItem, const IDataArrayShPtrType& attrArray);
 
   /**
    * @brief rowsInserted
@@ -340,6 +332,7 @@ private:
   QIcon m_TetrahedralGeomIcon = QIcon(SIMPLView::GeometryIcons::Tetetrahedral);
   QIcon m_HexahedralGeomIcon = QIcon(SIMPLView::GeometryIcons::Hexahedral);
   QIcon m_RectilinearGeomIcon = QIcon(SIMPLView::GeometryIcons::Rectilinear);
+  QIcon m_WarningIcon = QIcon(":SIMPL/icons/images/warning.png");
 
   /**
    * @brief performDrag
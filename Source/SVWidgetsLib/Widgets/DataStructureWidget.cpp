@@ -83,7 +83,9 @@ void DataStructureWidget::setupGui()
 // -----------------------------------------------------------------------------
 void DataStructureWidget::updateDataContainerArray(DataContainerArray::Pointer dca)
 {
-  m_Dca = dca->deepCopy(true);
+  // Preflight hands each filter its own DataContainerArray that is replaced, never
+  // modified, by the next preflight so it can be displayed without another copy.
+  m_Dca = dca;
   refreshData();
 }
 
@@ -106,11 +108,7 @@ void DataStructureWidget::filterActivated(AbstractFilter::Pointer filter)
   m_Ui->montageTreeView->setActiveFilter(filter);
   if(filter.get() != nullptr)
   {
-    DataContainerArray::Pointer dca = filter->getDataContainerArray();
-    if(dca.get() != nullptr)
-    {
-      m_Dca = dca->deepCopy(true);
-    }
+    m_Dca = filter->getDataContainerArray();
   }
 
   refreshData();
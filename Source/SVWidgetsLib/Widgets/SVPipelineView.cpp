@@ -39,11 +39,13 @@
 #include <utility>
 
 #include <QtCore/QFileInfo>
+#include <QtCore/QFutureWatcher>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
 #include <QtCore/QMimeData>
 #include <QtCore/QThread>
 #include <QtCore/QUrl>
+#include <QtConcurrent/QtConcurrentRun>
 
 #include <QtGui/QClipboard>
 #include <QtGui/QDrag>
@@ -113,6 +115,7 @@ SVPipelineView::SVPipelineView(QWidget* parent)
 // -----------------------------------------------------------------------------
 SVPipelineView::~SVPipelineView()
 {
+  cancelPreflight();
   delete m_WorkerThread;
   delete m_ActionEnableFilter;
 }
@@ -329,35 +332,185 @@ void SVPipelineView::preflightPipeline()
     return;
   }
 
+  // Any preflight that is still running is now out of date. Only one preflight reads the input files at
+  // a time, so start this one when the stale one finishes instead of blocking the GUI until it does.
+  cancelPreflight();
+  if(nullptr != m_PreflightInFlight)
+  {
+    m_PreflightQueued = true;
+    return;
+  }
+
   // Create a Pipeline Object and fill it with the filters from this View
   FilterPipeline::Pointer pipeline = getFilterPipeline();
 
   // qDebug() << "Prepping Filters for preflight... ";
 
+  // The preflight runs on copies of the filters so that the GUI can keep editing the
+  // real filters while the worker thread is busy.
+  PreflightSnapshotPtr snapshot = std::make_shared<PreflightSnapshot>();
+  snapshot->Generation = m_PreflightGeneration;
+  snapshot->Pipeline = FilterPipeline::New();
+  bool canPreflightInBackground = true;
+
   FilterPipeline::FilterContainerType filters = pipeline->getFilterContainer();
   for(int i = 0; i < filters.size(); i++)
   {
-    filters.at(i)->clearErrorCode();
-    filters.at(i)->setCancel(false);
+    AbstractFilter::Pointer filter = filters.at(i);
+    filter->clearErrorCode();
+    filter->setCancel(false);
 
     QModelIndex childIndex = model->index(i, PipelineItem::Contents);
     if(childIndex.isValid())
     {
       model->setData(childIndex, static_cast<int>(PipelineItem::ErrorState::Ok), PipelineModel::ErrorStateRole);
-      AbstractFilter::Pointer filter = model->filter(childIndex);
-      if(filter && filter->getEnabled())
+      AbstractFilter::Pointer modelFilter = model->filter(childIndex);
+      if(modelFilter && modelFilter->getEnabled())
       {
         model->setData(childIndex, static_cast<int>(PipelineItem::WidgetState::Ready), PipelineModel::WidgetStateRole);
       }
     }
+
+    // Let the filter parameter widgets push their current values into the filter before it is copied
+    Q_EMIT filter->preflightAboutToExecute();
+    Q_EMIT filter->updateFilterParameters(filter.get());
+
+    AbstractFilter::Pointer filterCopy = filter->newFilterInstance(true);
+    if(nullptr == filterCopy)
+    {
+      canPreflightInBackground = false;
+      continue;
+    }
+    filterCopy->setEnabled(filter->getEnabled());
+    filter->copyPreflightState(filterCopy.get());
+    snapshot->Pipeline->pushBack(filterCopy);
+    snapshot->LiveFilters.push_back(filter);
+  }
+
+  if(!canPreflightInBackground)
+  {
+    // At least one filter could not be copied so preflight the real filters on this thread
+    snapshot->Pipeline = pipeline;
+    snapshot->LiveFilters.assign(filters.begin(), filters.end());
+    snapshot->Renames.resize(snapshot->LiveFilters.size());
+    snapshot->Error = pipeline->preflightPipeline();
+    finishPreflight(snapshot);
+    return;
   }
 
-  int err = pipeline->preflightPipeline();
+  // Collect the messages and path renames from the copies. Only the thread running the
+  // preflight touches the snapshot until it has finished.
+  PreflightSnapshot* snapshotData = snapshot.get();
+  snapshot->Renames.resize(snapshot->LiveFilters.size());
+  FilterPipeline::FilterContainerType filterCopies = snapshot->Pipeline->getFilterContainer();
+  for(int i = 0; i < filterCopies.size(); i++)
+  {
+    AbstractFilter* filterCopy = filterCopies.at(i).get();
+    connect(filterCopy, &AbstractFilter::messageGenerated, [snapshotData](const AbstractMessage::Pointer& msg) { snapshotData->Messages.push_back(msg); });
+    connect(filterCopy, &AbstractFilter::dataArrayPathUpdated, [snapshotData, i](const QString& propertyName, const DataArrayPath::RenameType& renamePath) {
+      Q_UNUSED(propertyName)
+      std::vector<DataArrayPath::RenameType>& renames = snapshotData->Renames[i];
+      if(renames.empty() || !(renames.back() == renamePath))
+      {
+        renames.push_back(renamePath);
+      }
+    });
+  }
+  connect(snapshot->Pipeline.get(), &FilterPipeline::messageGenerated, [snapshotData](const AbstractMessage::Pointer& msg) { snapshotData->Messages.push_back(msg); });
+
+  m_PreflightInFlight = snapshot;
+  QFutureWatcher<void>* watcher = new QFutureWatcher<void>(this);
+  connect(watcher, &QFutureWatcher<void>::finished, this, [this, watcher, snapshot]() {
+    watcher->deleteLater();
+    finishPreflight(snapshot);
+  });
+  watcher->setFuture(QtConcurrent::run([snapshot]() { snapshot->Error = snapshot->Pipeline->preflightPipeline(); }));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::cancelPreflight()
+{
+  m_PreflightGeneration++;
+  m_PreflightQueued = false;
+  if(nullptr != m_PreflightInFlight)
+  {
+    // The pipeline only checks for the cancel between filters. The worker and the watcher both hold the
+    // snapshot, so it stays alive until the current filter returns and finishPreflight() drops it.
+    m_PreflightInFlight->Pipeline->cancelPreflight();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::finishPreflight(const PreflightSnapshotPtr& snapshot)
+{
+  if(m_PreflightInFlight == snapshot)
+  {
+    m_PreflightInFlight.reset();
+  }
+  if(snapshot->Generation != m_PreflightGeneration)
+  {
+    // A newer edit made these results stale. Start the preflight it queued now that the files are free.
+    if(m_PreflightQueued)
+    {
+      m_PreflightQueued = false;
+      preflightPipeline();
+    }
+    return;
+  }
+
+  PipelineModel* model = getPipelineModel();
+  if(nullptr == model)
+  {
+    return;
+  }
+
+  // Publish the results to the real filters all at once on the GUI thread
+  FilterPipeline::FilterContainerType filterCopies = snapshot->Pipeline->getFilterContainer();
+  for(int i = 0; i < filterCopies.size(); i++)
+  {
+    AbstractFilter::Pointer filter = snapshot->LiveFilters[i];
+    AbstractFilter::Pointer filterCopy = filterCopies.at(i);
+    if(filterCopy == filter)
+    {
+      continue;
+    }
+    for(const DataArrayPath::RenameType& renamePath : snapshot->Renames[i])
+    {
+      filter->renameDataArrayPath(renamePath);
+    }
+    filterCopy->copyPreflightState(filter.get());
+
+    // A filter may update its own parameters during preflight, such as a reader merging its proxy
+    // with a file that changed on disk, so copy any parameter that differs back to the live filter
+    QJsonObject copyJson;
+    filterCopy->writeFilterParameters(copyJson);
+    QJsonObject liveJson;
+    filter->writeFilterParameters(liveJson);
+    if(copyJson != liveJson)
+    {
+      filterCopy->copyFilterParameterInstanceVariables(filter.get());
+    }
+    Q_EMIT filter->preflightExecuted();
+  }
+
+  for(const AbstractMessage::Pointer& msg : snapshot->Messages)
+  {
+    for(const auto& observer : m_PipelineMessageObservers)
+    {
+      QMetaObject::invokeMethod(observer, "processPipelineMessage", Qt::DirectConnection, Q_ARG(AbstractMessage::Pointer, msg));
+    }
+  }
+
+  int err = snapshot->Error;
   if(err < 0)
   {
     // FIXME: Implement error handling.
   }
-  int count = pipeline->getFilterContainer().size();
+  int count = static_cast<int>(snapshot->LiveFilters.size());
   // Now that the preflight has been executed loop through the filters and check their error condition and set the
   // outline on the filter widget if there were errors or warnings
   for(qint32 i = 0; i < count; ++i)
@@ -400,6 +553,9 @@ void SVPipelineView::executePipeline()
   }
   m_WorkerThread = new QThread(); // Create a new Thread Resource
 
+  // Keep a background preflight from publishing over the pipeline that is about to run
+  cancelPreflight();
+
   // Clear out the Issues Table
   Q_EMIT clearIssuesTriggered();
 
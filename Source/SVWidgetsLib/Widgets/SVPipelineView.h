@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 #include <stack>
@@ -303,8 +304,9 @@ public Q_SLOTS:
   void pasteFilters(int insertIndex = -1, bool useAnimationOnFirstRun = true);
 
   /**
-   * @brief preflightPipeline
-   * @param pipelineIndex
+   * @brief preflightPipeline Preflights a copy of the pipeline on a worker thread.
+   * The results are published back to the filters in this view when the preflight
+   * finishes unless a newer preflight has been started in the meantime.
    */
   void preflightPipeline();
 
@@ -448,8 +450,39 @@ private Q_SLOTS:
   void finishPipeline();
 
 private:
+  /**
+   * @brief Copy of the pipeline that is preflighted on a worker thread along with
+   * the messages and path renames that are published back to the live filters.
+   */
+  struct PreflightSnapshot
+  {
+    uint64_t Generation = 0;
+    FilterPipeline::Pointer Pipeline;
+    std::vector<AbstractFilter::Pointer> LiveFilters;
+    std::vector<std::vector<DataArrayPath::RenameType>> Renames;
+    std::vector<AbstractMessage::Pointer> Messages;
+    int Error = 0;
+  };
+  using PreflightSnapshotPtr = std::shared_ptr<PreflightSnapshot>;
+
+  /**
+   * @brief Publishes the results of a background preflight to the filters in this view
+   * @param snapshot
+   */
+  void finishPreflight(const PreflightSnapshotPtr& snapshot);
+
+  /**
+   * @brief Makes any running background preflight stale so that its results are dropped. It does not
+   * wait; the snapshot stays alive until its worker finishes and a queued preflight starts from there.
+   */
+  void cancelPreflight();
+
   SVPipelineView::PipelineViewState m_PipelineState = {};
 
+  uint64_t m_PreflightGeneration = 0;
+  PreflightSnapshotPtr m_PreflightInFlight;
+  bool m_PreflightQueued = false;
+
   QThread* m_WorkerThread = nullptr;
   FilterPipeline::Pointer m_PipelineInFlight;
   QVector<DataContainerArrayShPtrType> m_PreflightDataContainerArrays;
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""Compare a SIMPLBenchmarks result file against a stored baseline.
+
+Both files are the JSON written by ``SIMPLBenchmarks --output <file>``. A baseline
+is simply a result file produced on the reference machine from the release branch,
+for example:
+
+    SIMPLBenchmarks --repetitions 9 --output baseline.json
+
+The script prints one line per benchmark and exits with a non-zero status when any
+benchmark is slower than the baseline by more than the threshold, when a benchmark
+failed, or when a baseline benchmark is missing from the results.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_results(path):
+    with open(path, 'r') as f:
+        doc = json.load(f)
+    return doc.get('context', {}), {b['name']: b for b in doc.get('benchmarks', [])}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare SIMPLBenchmarks JSON results against a baseline.')
+    parser.add_argument('baseline', help='Baseline JSON file')
+    parser.add_argument('results', help='JSON file of the run under test')
+    parser.add_argument('--metric', default='median_ns', choices=['min_ns', 'median_ns', 'mean_ns'],
+                        help='Timing metric to compare (default: median_ns)')
+    parser.add_argument('--threshold', type=float, default=10.0,
+                        help='Allowed slowdown in percent before a benchmark counts as a regression (default: 10)')
+    parser.add_argument('--allow-missing', action='store_true',
+                        help='Do not fail when a baseline benchmark is absent from the results')
+    args = parser.parse_args()
+
+    base_context, baseline = load_results(args.baseline)
+    run_context, results = load_results(args.results)
+
+    if base_context.get('scale') != run_context.get('scale'):
+        print('ERROR: baseline scale {} does not match result scale {}'.format(base_context.get('scale'), run_context.get('scale')))
+        return 2
+
+    regressions = []
+    failures = []
+    missing = []
+
+    width = max([len(name) for name in list(baseline.keys()) + list(results.keys())] + [9])
+    print('{:<{w}}  {:>14}  {:>14}  {:>9}'.format('Benchmark', 'Baseline (ms)', 'Current (ms)', 'Change', w=width))
+    for name in sorted(baseline.keys()):
+        base = baseline[name]
+        if name not in results:
+            missing.append(name)
+            print('{:<{w}}  {:>14}  {:>14}  {:>9}'.format(name, '', 'missing', '', w=width))
+            continue
+        current = results[name]
+        if not current.get('ok', True):
+            failures.append(name)
+            print('{:<{w}}  {:>14}  {:>14}  {:>9}'.format(name, '', 'FAILED', '', w=width))
+            continue
+        base_value = float(base[args.metric])
+        cur_value = float(current[args.metric])
+        change = 0.0 if base_value <= 0.0 else (cur_value - base_value) / base_value * 100.0
+        flag = ''
+        if change > args.threshold:
+            regressions.append(name)
+            flag = '  REGRESSION'
+        print('{:<{w}}  {:>14.3f}  {:>14.3f}  {:>+8.1f}%{}'.format(name, base_value * 1.0e-6, cur_value * 1.0e-6, change, flag, w=width))
+
+    for name in sorted(set(results.keys()) - set(baseline.keys())):
+        print('{:<{w}}  {:>14}  {:>14.3f}  {:>9}'.format(name, 'new', float(results[name][args.metric]) * 1.0e-6, '', w=width))
+
+    if regressions:
+        print('\n{} benchmark(s) regressed by more than {}%: {}'.format(len(regressions), args.threshold, ', '.join(regressions)))
+    if failures:
+        print('\n{} benchmark(s) failed: {}'.format(len(failures), ', '.join(failures)))
+    if missing and not args.allow_missing:
+        print('\n{} baseline benchmark(s) missing from the results: {}'.format(len(missing), ', '.join(missing)))
+
+    if regressions or failures or (missing and not args.allow_missing):
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -30,6 +30,7 @@ PYB11_WRITE: str = 'WRITE'
 PYB11_CONST_GET_OVERLOAD: str = 'CONST_GET_OVERLOAD'
 PYB11_CONST_METHOD: str = 'CONST_METHOD'
 PYB11_RETURN_VALUE_POLICY: str = 'RETURN_VALUE_POLICY'
+PYB11_CALL_GUARD: str = 'CALL_GUARD'
 PYB11_ARGS: str = 'ARGS'
 PYB11_OVERLOAD: str = 'OVERLOAD'
 
@@ -56,6 +57,7 @@ class PyMethod():
     self.arg_types: List[str] = []
     self.is_const: bool = False
     self.return_value_policy: str = ''
+    self.call_guard: str = ''
     self.is_overload: bool = False
 
 class PyStaticCreation():
@@ -178,6 +180,8 @@ class PyClass():
         code += f'  .def(\"{method.name}\", &{self.name}::{method.name}'
       if method.return_value_policy:
         code += f', {method.return_value_policy}'
+      if method.call_guard:
+        code += f', py::call_guard<{method.call_guard}>()'
       if method.args:
         args = ', '.join([f'\"{arg}\"_a' for arg in method.args])
         code += f', {args}'
@@ -334,6 +338,13 @@ def parse_method(line: str) -> PyMethod:
       method.return_value_policy = tokens.pop(index + 1)
       tokens.pop(index)
 
+    index = find_index(tokens, PYB11_CALL_GUARD)
+
+    if index is not None:
+      method.call_guard = tokens.pop(index + 1)
+      tokens.pop(index)
+
+  if tokens:
     token = tokens.pop(0)
     if token == PYB11_ARGS:
       while tokens:
@@ -14,6 +14,23 @@ registerDataArray<float>(mod, "FloatArray");
 registerDataArray<double>(mod, "DoubleArray");
 
 registerDataArray<bool>(mod, "BoolArray");
+registerBitMaskArray(mod, "BitMaskArray");
+registerStringDataArray(mod, "StringDataArray");
+
+registerNeighborList<int8_t>(mod, "Int8NeighborList");
+registerNeighborList<uint8_t>(mod, "UInt8NeighborList");
+
+registerNeighborList<int16_t>(mod, "Int16NeighborList");
+registerNeighborList<uint16_t>(mod, "UInt16NeighborList");
+
+registerNeighborList<int32_t>(mod, "Int32NeighborList");
+registerNeighborList<uint32_t>(mod, "UInt32NeighborList");
+
+registerNeighborList<int64_t>(mod, "Int64NeighborList");
+registerNeighborList<uint64_t>(mod, "UInt64NeighborList");
+
+registerNeighborList<float>(mod, "FloatNeighborList");
+registerNeighborList<double>(mod, "DoubleNeighborList");
 
 registerSIMPLArray<float, 2>(mod, "FloatVec2");
 registerSIMPLArray<int32_t, 2>(mod, "IntVec2");
@@ -8,7 +8,10 @@
 #include <pybind11/stl.h>
 
 #include "SIMPLib/Common/SIMPLArray.hpp"
+#include "SIMPLib/DataArrays/BitMaskArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/DataContainers/AttributeMatrix.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
@@ -66,8 +69,23 @@ void registerDataArray(pybind11::module& mod, const char* name)
         return DataArrayType::WrapPointer(reinterpret_cast<T*>(data.mutable_data(0)), numTuples, cDims, name, ownsData);
       }))
       .def_property("name", &DataArrayType::getName, &DataArrayType::setName)
-      .def("__getitem__", [](const DataArrayType& dataArray, size_t i) { return dataArray.at(i); })
-      .def("__setitem__", [](DataArrayType& dataArray, size_t i, T value) { dataArray.at(i) = value; })
+      // at() does not read deferred data, so go through data() first, which does
+      .def("__getitem__",
+           [](const DataArrayType& dataArray, size_t i) {
+             if(nullptr == dataArray.data() && !dataArray.empty())
+             {
+               throw std::runtime_error("The data of the array could not be read");
+             }
+             return dataArray.at(i);
+           })
+      .def("__setitem__",
+           [](DataArrayType& dataArray, size_t i, T value) {
+             if(nullptr == dataArray.data() && !dataArray.empty())
+             {
+               throw std::runtime_error("The data of the array could not be read");
+             }
+             dataArray.at(i) = value;
+           })
       .def("__len__", &DataArrayType::size)
       .def_property_readonly("size", &DataArrayType::size)
       .def_property_readonly("cdims",
@@ -141,6 +159,212 @@ void registerDataArray(pybind11::module& mod, const char* name)
       });
 }
 
+void registerBitMaskArray(pybind11::module& mod, const char* name)
+{
+  namespace py = pybind11;
+  using namespace py::literals;
+  using WordType = BitMaskArray::WordType;
+  py::class_<BitMaskArray, IDataArray, std::shared_ptr<BitMaskArray>>(mod, name, py::buffer_protocol())
+      .def(py::init([](size_t numTuples, const QString& name) {
+        if(name.isEmpty())
+        {
+          throw std::invalid_argument("name cannot be empty");
+        }
+        return BitMaskArray::CreateArray(numTuples, name, true);
+      }))
+      .def(py::init([](size_t numTuples, const std::vector<size_t>& cDims, const QString& name) {
+        if(name.isEmpty())
+        {
+          throw std::invalid_argument("name cannot be empty");
+        }
+        return BitMaskArray::CreateArray(numTuples, cDims, name, true);
+      }))
+      .def_static("from_bool_array", [](const BoolArrayType& boolArray) { return BitMaskArray::FromBoolArray(boolArray); })
+      .def("to_bool_array", &BitMaskArray::toBoolArray)
+      .def_property("name", &BitMaskArray::getName, &BitMaskArray::setName)
+      .def("__getitem__",
+           [](const BitMaskArray& mask, size_t i) {
+             if(i >= mask.getSize())
+             {
+               throw py::index_error();
+             }
+             return mask.getValue(i);
+           })
+      .def("__setitem__",
+           [](BitMaskArray& mask, size_t i, bool value) {
+             if(i >= mask.getSize())
+             {
+               throw py::index_error();
+             }
+             mask.setValue(i, value);
+           })
+      .def("__len__", &BitMaskArray::getSize)
+      .def_property_readonly("size", &BitMaskArray::getSize)
+      .def_property_readonly("tuples", &BitMaskArray::getNumberOfTuples)
+      .def("count_true", &BitMaskArray::countTrue, py::call_guard<py::gil_scoped_release>())
+      .def("bitwise_and", &BitMaskArray::bitwiseAnd, py::call_guard<py::gil_scoped_release>())
+      .def("bitwise_or", &BitMaskArray::bitwiseOr, py::call_guard<py::gil_scoped_release>())
+      .def("bitwise_and_not", &BitMaskArray::bitwiseAndNot, py::call_guard<py::gil_scoped_release>())
+      .def("bitwise_not", &BitMaskArray::bitwiseNot, py::call_guard<py::gil_scoped_release>())
+      // The buffer exposes the packed words, not one value per element. Both views are read-only because
+      // writing a word could set the padding bits past the last element; writes must go through __setitem__.
+      .def_buffer([](BitMaskArray& mask) -> py::buffer_info {
+        return py::buffer_info(mask.getWordPointer(0), sizeof(WordType), py::format_descriptor<WordType>::format(), 1, {static_cast<ssize_t>(mask.getNumberOfWords())},
+                               {static_cast<ssize_t>(sizeof(WordType))}, true);
+      })
+      .def(
+          "words",
+          [](BitMaskArray& mask) {
+            py::array_t<WordType, py::array::c_style> view(mask.getNumberOfWords(), mask.getWordPointer(0), py::cast(mask));
+            view.attr("setflags")(py::arg("write") = false);
+            return view;
+          },
+          py::return_value_policy::reference_internal)
+      .def("__repr__", [](const BitMaskArray& a) {
+        std::stringstream ss;
+        ss << "<'" << a.getFullNameOfClass().toStdString() << "  NAME=" << a.getName().toStdString() << ": TUPLES: " << a.getNumberOfTuples() << "  COMPONENTS: " << a.getNumberOfComponents()
+           << "'>";
+        return ss.str();
+      });
+}
+
+void registerStringDataArray(pybind11::module& mod, const char* name)
+{
+  namespace py = pybind11;
+  using namespace py::literals;
+  using OffsetType = StringDataArray::OffsetType;
+  py::class_<StringDataArray, IDataArray, std::shared_ptr<StringDataArray>>(mod, name)
+      .def(py::init([]() { return StringDataArray::New(); }))
+      .def_static("New", &StringDataArray::New)
+      .def(py::init([](size_t numTuples, const QString& name, bool allocate) { return StringDataArray::CreateArray(numTuples, name, allocate); }))
+      .def(py::init([](size_t numTuples, const std::vector<size_t>& cDims, const QString& name, bool allocate) { return StringDataArray::CreateArray(numTuples, cDims, name, allocate); }))
+      .def_property("Name", &StringDataArray::getName, &StringDataArray::setName)
+      .def("getValue", &StringDataArray::getValue, "i"_a)
+      .def("setValue", &StringDataArray::setValue, "i"_a, "value"_a)
+      .def("getSize", &StringDataArray::getSize)
+      .def("getNumberOfTuples", &StringDataArray::getNumberOfTuples)
+      .def("__getitem__",
+           [](const StringDataArray& strings, size_t i) {
+             if(i >= strings.getNumberOfTuples())
+             {
+               throw py::index_error();
+             }
+             std::string_view value = strings.getValueView(i);
+             return py::str(value.data(), value.size());
+           })
+      .def("__setitem__",
+           [](StringDataArray& strings, size_t i, const std::string& value) {
+             if(i >= strings.getNumberOfTuples())
+             {
+               throw py::index_error();
+             }
+             strings.setValueUtf8(i, value);
+           })
+      .def("__len__", &StringDataArray::getNumberOfTuples)
+      .def("compact", &StringDataArray::compact, py::call_guard<py::gil_scoped_release>())
+      // Read only views of the numTuples + 1 offsets and the UTF-8 bytes, laid out like an Arrow large_string
+      // array. Both are invalidated by any call that modifies the array. Writes must go through __setitem__
+      // so the offsets stay consistent with the buffer.
+      .def(
+          "offsets",
+          [](StringDataArray& strings) {
+            const std::vector<OffsetType>& offsets = strings.getOffsets();
+            py::array_t<OffsetType, py::array::c_style> view(offsets.size(), offsets.data(), py::cast(strings));
+            view.attr("setflags")(py::arg("write") = false);
+            return view;
+          },
+          py::return_value_policy::reference_internal)
+      .def(
+          "buffer",
+          [](StringDataArray& strings) {
+            const std::vector<char>& buffer = strings.getBuffer();
+            py::array_t<uint8_t, py::array::c_style> view(buffer.size(), reinterpret_cast<const uint8_t*>(buffer.data()), py::cast(strings));
+            view.attr("setflags")(py::arg("write") = false);
+            return view;
+          },
+          py::return_value_policy::reference_internal)
+      .def("__repr__", [](const StringDataArray& a) {
+        std::stringstream ss;
+        ss << "<'" << a.getFullNameOfClass().toStdString() << "  NAME=" << a.getName().toStdString() << ": TUPLES: " << a.getNumberOfTuples() << "'>";
+        return ss.str();
+      });
+}
+
+template <class T>
+void registerNeighborList(pybind11::module& mod, const char* name)
+{
+  namespace py = pybind11;
+  using namespace py::literals;
+  using NeighborListType = NeighborList<T>;
+  using OffsetsArrayType = py::array_t<uint64_t, py::array::c_style | py::array::forcecast>;
+  using ValuesArrayType = py::array_t<T, py::array::c_style | py::array::forcecast>;
+  py::class_<NeighborListType, IDataArray, std::shared_ptr<NeighborListType>>(mod, name)
+      .def(py::init([](size_t numTuples, const QString& name) {
+        if(name.isEmpty())
+        {
+          throw std::invalid_argument("name cannot be empty");
+        }
+        return NeighborListType::CreateArray(numTuples, name, true);
+      }))
+      .def_property("name", &NeighborListType::getName, &NeighborListType::setName)
+      .def("__len__", &NeighborListType::getNumberOfLists)
+      .def_property_readonly("size", &NeighborListType::getSize)
+      .def_property_readonly("tuples", &NeighborListType::getNumberOfTuples)
+      .def("__getitem__",
+           [](const NeighborListType& neighborList, size_t i) {
+             if(i >= static_cast<size_t>(neighborList.getNumberOfLists()))
+             {
+               throw py::index_error();
+             }
+             const typename NeighborListType::VectorType& values = neighborList.getListReference(static_cast<int>(i));
+             return py::array_t<T>(values.size(), values.data());
+           })
+      // Each list is its own vector so the (offsets, values) pair is built with one bulk copy
+      // outside of the GIL instead of a view
+      .def("to_arrays",
+           [](const NeighborListType& neighborList) {
+             py::array_t<uint64_t> offsets(static_cast<size_t>(neighborList.getNumberOfLists()) + 1);
+             py::array_t<T> values(neighborList.getSize());
+             uint64_t* offsetsPtr = offsets.mutable_data();
+             T* valuesPtr = values.mutable_data();
+             {
+               py::gil_scoped_release gilRelease;
+               neighborList.copyToFlatArrays(offsetsPtr, valuesPtr);
+             }
+             return py::make_tuple(offsets, values);
+           })
+      .def(
+          "from_arrays",
+          [](NeighborListType& neighborList, const OffsetsArrayType& offsets, const ValuesArrayType& values) {
+            if(offsets.ndim() != 1 || offsets.size() < 1)
+            {
+              throw std::invalid_argument("offsets must be a one dimensional array with at least one value");
+            }
+            size_t numLists = static_cast<size_t>(offsets.size()) - 1;
+            const uint64_t* offsetsPtr = offsets.data();
+            if(offsetsPtr[numLists] > static_cast<uint64_t>(values.size()))
+            {
+              throw std::invalid_argument("the last offset is larger than the number of values");
+            }
+            const T* valuesPtr = values.data();
+            bool valid = false;
+            {
+              py::gil_scoped_release gilRelease;
+              valid = neighborList.setFromFlatArrays(numLists, offsetsPtr, valuesPtr);
+            }
+            if(!valid)
+            {
+              throw std::invalid_argument("offsets must start at zero and be increasing");
+            }
+          },
+          "offsets"_a, "values"_a)
+      .def("__repr__", [](const NeighborListType& a) {
+        std::stringstream ss;
+        ss << "<'" << a.getFullNameOfClass().toStdString() << "  NAME=" << a.getName().toStdString() << ": LISTS: " << a.getNumberOfLists() << "  VALUES: " << a.getSize() << "'>";
+        return ss.str();
+      });
+}
+
 template <class T, unsigned int Dim_>
 struct IVecType
 {